@@ -6,8 +6,13 @@
 
 #include <legate.h>
 
+#include <atomic>
 #include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
+#include <new>
 #include <string_view>
 #include <vector>
 
@@ -15,6 +20,30 @@ namespace {
 
 constexpr std::string_view LIBNAME = "bench";
 
+// Number of calls to the global operator new from any thread, used to report the allocations
+// per launch
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<std::uint64_t> num_allocations{};
+
+}  // namespace
+
+// NOLINTBEGIN(misc-new-delete-overloads, cppcoreguidelines-no-malloc)
+void* operator new(std::size_t size)
+{
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (auto* const ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+// NOLINTEND(misc-new-delete-overloads, cppcoreguidelines-no-malloc)
+
+namespace {
+
 class EmptyTask : public legate::LegateTask<EmptyTask> {
  public:
   static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
@@ -95,6 +124,8 @@ void benchmark_body(TaskLaunchFixture& fixt, benchmark::State& state)
 {
   auto runtime = legate::Runtime::get_runtime();
   auto lib     = runtime->find_library(LIBNAME);
+  // Allocations made while launching the tasks, excluding those made to create them
+  std::uint64_t launch_allocations = 0;
 
   for (auto _ : state) {  // NOLINT(clang-analyzer-deadcode.DeadStores)
     state.PauseTiming();
@@ -107,9 +138,14 @@ void benchmark_body(TaskLaunchFixture& fixt, benchmark::State& state)
     }
     state.ResumeTiming();
 
+    const auto before = num_allocations.load(std::memory_order_relaxed);
+
     runtime->submit(std::move(task));
     runtime->issue_execution_fence(true);
+    launch_allocations += num_allocations.load(std::memory_order_relaxed) - before;
   }
+  state.counters["allocs_per_launch"] =
+    benchmark::Counter{static_cast<double>(launch_allocations), benchmark::Counter::kAvgIterations};
 }
 
 BENCHMARK_DEFINE_F(TaskLaunchFixture, InlineTaskLaunch)(benchmark::State& state)
@@ -0,0 +1,115 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/data/detail/logical_store.h>
+#include <legate/mapping/detail/instance_manager.h>
+
+#include <legate.h>
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+// Measures the latency of InstanceSet::find_or_create_region_group(), the coalescing query the
+// mapper runs for every non-exact instance it maps, as the number of live instances in the set
+// grows.
+class InstanceSetFixture : public benchmark::Fixture {
+ public:
+  static constexpr legate::coord_t TILE_SIZE = 100;
+
+  void SetUp(benchmark::State& state) override
+  {
+    const auto num_instances = static_cast<std::size_t>(state.range(0));
+
+    stores_.reserve(num_instances + 1);
+    for (std::size_t i = 0; i <= num_instances; ++i) {
+      // Stores of different shapes are backed by different regions
+      stores_.emplace_back(legate::Runtime::get_runtime()->create_store(
+        legate::Shape{static_cast<std::uint64_t>(i) + 1}, legate::int32()));
+    }
+
+    // Disjoint tiles, so that no group gets coalesced with another while the set is populated
+    for (std::size_t i = 0; i < num_instances; ++i) {
+      const auto region = region_of_(i);
+      const auto lo     = static_cast<legate::coord_t>(i) * TILE_SIZE;
+      const auto group  = instance_set_.find_or_create_region_group(
+        region, legate::Domain{legate::Rect<1>{lo, lo + TILE_SIZE - 1}}, /*exact=*/false);
+
+      instance_set_.record_pending_instance_creation(group);
+      instance_set_.record_instance(region, group, Legion::Mapping::PhysicalInstance{}, {});
+    }
+  }
+
+  void TearDown(benchmark::State&) override
+  {
+    instance_set_ = legate::mapping::detail::InstanceSet{};
+    stores_.clear();
+  }
+
+  [[nodiscard]] Legion::LogicalRegion query_region() const
+  {
+    return region_of_(stores_.size() - 1);
+  }
+
+  [[nodiscard]] const legate::mapping::detail::InstanceSet& instance_set() const
+  {
+    return instance_set_;
+  }
+
+ private:
+  [[nodiscard]] Legion::LogicalRegion region_of_(std::size_t i) const
+  {
+    return stores_[i].impl()->get_region_field()->region();
+  }
+
+  std::vector<legate::LogicalStore> stores_{};
+  legate::mapping::detail::InstanceSet instance_set_{};
+};
+
+BENCHMARK_DEFINE_F(InstanceSetFixture, FindOrCreateRegionGroup)(benchmark::State& state)
+{
+  const auto num_instances = state.range(0);
+  const auto region        = query_region();
+  legate::coord_t tile     = 0;
+
+  for (auto _ : state) {  // NOLINT(clang-analyzer-deadcode.DeadStores)
+    // Straddle two neighboring tiles so that the query has something to coalesce with
+    const auto lo = (tile * TILE_SIZE) + (TILE_SIZE / 2);
+
+    benchmark::DoNotOptimize(instance_set().find_or_create_region_group(
+      region, legate::Domain{legate::Rect<1>{lo, lo + TILE_SIZE - 1}}, /*exact=*/false));
+    tile = (tile + 1) % num_instances;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// NOLINTBEGIN(legate-use-aggregate-constructor, clang-diagnostic-c2y-extensions)
+// NOLINTBEGIN(cert-err58-cpp, bugprone-throwing-static-initialization)
+BENCHMARK_REGISTER_F(InstanceSetFixture, FindOrCreateRegionGroup)
+  ->Unit(benchmark::kMicrosecond)
+  // Determines the number of live instances in the set
+  ->RangeMultiplier(4)
+  ->Range(/* begin */ 16, /* end */ 4096);
+// NOLINTEND(cert-err58-cpp, bugprone-throwing-static-initialization)
+// NOLINTEND(legate-use-aggregate-constructor, clang-diagnostic-c2y-extensions)
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  legate::start();
+
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+  return legate::finish();
+}
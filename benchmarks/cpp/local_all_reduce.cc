@@ -0,0 +1,153 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/comm/coll_comm.h>
+#include <legate/comm/detail/local_network.h>
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using legate::detail::comm::coll::LocalNetwork;
+
+enum class Algorithm : std::uint8_t { FULL, SLICED };
+
+// Runs all-reduces of float buffers over a LocalNetwork communicator spanning num_ranks threads.
+// The calling thread acts as rank 0 and drives the benchmark loop, the other ranks follow along.
+class LocalAllReduceRunner {
+ public:
+  LocalAllReduceRunner(std::size_t count, int num_ranks, Algorithm algorithm)
+    : network_{algorithm == Algorithm::SLICED ? 0 : std::numeric_limits<std::size_t>::max()},
+      count_{count},
+      num_ranks_{num_ranks},
+      comms_(static_cast<std::size_t>(num_ranks))
+  {
+    const auto unique_id = network_.init_comm();
+
+    workers_.reserve(static_cast<std::size_t>(num_ranks_) - 1);
+    for (int rank = 1; rank < num_ranks_; ++rank) {
+      workers_.emplace_back([this, rank, unique_id] { worker_main_(rank, unique_id); });
+    }
+    create_comm_(0, unique_id);
+  }
+
+  ~LocalAllReduceRunner()
+  {
+    stop_.store(true, std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_release);
+    network_.comm_destroy(&comms_[0]);
+    for (auto&& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  LocalAllReduceRunner(const LocalAllReduceRunner&)            = delete;
+  LocalAllReduceRunner& operator=(const LocalAllReduceRunner&) = delete;
+  LocalAllReduceRunner(LocalAllReduceRunner&&)                 = delete;
+  LocalAllReduceRunner& operator=(LocalAllReduceRunner&&)      = delete;
+
+  void run_once()
+  {
+    generation_.fetch_add(1, std::memory_order_release);
+    all_reduce_(0);
+  }
+
+ private:
+  void create_comm_(int rank, int unique_id)
+  {
+    network_.comm_create(&comms_[static_cast<std::size_t>(rank)],
+                         num_ranks_,
+                         rank,
+                         unique_id,
+                         /* mapping_table */ nullptr);
+  }
+
+  void all_reduce_(int rank)
+  {
+    thread_local std::vector<float> send_buffer{};
+    thread_local std::vector<float> recv_buffer{};
+
+    send_buffer.resize(count_, 1.0F);
+    recv_buffer.resize(count_);
+    network_.all_reduce(send_buffer.data(),
+                        recv_buffer.data(),
+                        static_cast<int>(count_),
+                        legate::comm::coll::CollDataType::CollFloat,
+                        legate::ReductionOpKind::ADD,
+                        &comms_[static_cast<std::size_t>(rank)]);
+  }
+
+  void worker_main_(int rank, int unique_id)
+  {
+    auto seen = generation_.load(std::memory_order_acquire);
+
+    create_comm_(rank, unique_id);
+    while (true) {
+      std::uint64_t current{};
+
+      while ((current = generation_.load(std::memory_order_acquire)) == seen) {
+        std::this_thread::yield();
+      }
+      seen = current;
+      if (stop_.load(std::memory_order_relaxed)) {
+        break;
+      }
+      all_reduce_(rank);
+    }
+    network_.comm_destroy(&comms_[static_cast<std::size_t>(rank)]);
+  }
+
+  LocalNetwork network_;
+  std::size_t count_{};
+  int num_ranks_{};
+  std::vector<legate::comm::coll::Coll_Comm> comms_{};
+  std::vector<std::thread> workers_{};
+  std::atomic<std::uint64_t> generation_{};
+  std::atomic<bool> stop_{};
+};
+
+void benchmark_body(benchmark::State& state, Algorithm algorithm)
+{
+  const auto count     = static_cast<std::size_t>(state.range(0));
+  const auto num_ranks = static_cast<int>(state.range(1));
+  LocalAllReduceRunner runner{count, num_ranks, algorithm};
+
+  for (auto _ : state) {  // NOLINT(clang-analyzer-deadcode.DeadStores)
+    runner.run_once();
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(count * sizeof(float)));
+}
+
+void local_all_reduce_full(benchmark::State& state) { benchmark_body(state, Algorithm::FULL); }
+
+void local_all_reduce_sliced(benchmark::State& state) { benchmark_body(state, Algorithm::SLICED); }
+
+// Sweeps the element count x the number of ranks in the communicator
+void apply_sweep(benchmark::internal::Benchmark* bench)
+{
+  bench->ArgNames({"count", "ranks"})
+    ->ArgsProduct({benchmark::CreateRange(1 << 8, 1 << 24, /* multi */ 16),
+                   benchmark::CreateRange(2, 64, /* multi */ 2)})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+}
+
+// NOLINTBEGIN(legate-use-aggregate-constructor, clang-diagnostic-c2y-extensions)
+// NOLINTBEGIN(cert-err58-cpp, bugprone-throwing-static-initialization)
+BENCHMARK(local_all_reduce_full)->Apply(apply_sweep);
+BENCHMARK(local_all_reduce_sliced)->Apply(apply_sweep);
+// NOLINTEND(cert-err58-cpp, bugprone-throwing-static-initialization)
+// NOLINTEND(legate-use-aggregate-constructor, clang-diagnostic-c2y-extensions)
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,258 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/comm/coll_comm.h>
+#include <legate/comm/detail/local_network.h>
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using legate::detail::comm::coll::LocalNetwork;
+
+// Each rooted or scattered collective comes in two flavors: the native one, and the emulation
+// on top of all-gather/all-reduce that callers had to resort to before the native one existed.
+enum class Collective : std::uint8_t {
+  BROADCAST,
+  BROADCAST_VIA_ALL_GATHER,
+  GATHER,
+  GATHER_VIA_ALL_GATHER,
+  REDUCE,
+  REDUCE_VIA_ALL_REDUCE,
+  REDUCE_SCATTER,
+  REDUCE_SCATTER_VIA_ALL_REDUCE,
+};
+
+constexpr int ROOT = 0;
+
+// Runs one collective over float buffers of a LocalNetwork communicator spanning num_ranks
+// threads. The calling thread acts as rank 0 and drives the benchmark loop, the other ranks
+// follow along.
+class LocalCollectiveRunner {
+ public:
+  LocalCollectiveRunner(std::size_t count, int num_ranks, Collective collective)
+    : count_{count},
+      num_ranks_{num_ranks},
+      collective_{collective},
+      comms_(static_cast<std::size_t>(num_ranks))
+  {
+    const auto unique_id = network_.init_comm();
+
+    workers_.reserve(static_cast<std::size_t>(num_ranks_) - 1);
+    for (int rank = 1; rank < num_ranks_; ++rank) {
+      workers_.emplace_back([this, rank, unique_id] { worker_main_(rank, unique_id); });
+    }
+    create_comm_(0, unique_id);
+  }
+
+  ~LocalCollectiveRunner()
+  {
+    stop_.store(true, std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_release);
+    network_.comm_destroy(&comms_[0]);
+    for (auto&& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  LocalCollectiveRunner(const LocalCollectiveRunner&)            = delete;
+  LocalCollectiveRunner& operator=(const LocalCollectiveRunner&) = delete;
+  LocalCollectiveRunner(LocalCollectiveRunner&&)                 = delete;
+  LocalCollectiveRunner& operator=(LocalCollectiveRunner&&)      = delete;
+
+  void run_once()
+  {
+    generation_.fetch_add(1, std::memory_order_release);
+    run_collective_(0);
+  }
+
+ private:
+  void create_comm_(int rank, int unique_id)
+  {
+    network_.comm_create(&comms_[static_cast<std::size_t>(rank)],
+                         num_ranks_,
+                         rank,
+                         unique_id,
+                         /* mapping_table */ nullptr);
+  }
+
+  // count_ is the size of the result each rank (or the root) is interested in
+  void run_collective_(int rank)
+  {
+    thread_local std::vector<float> send_buffer{};
+    thread_local std::vector<float> recv_buffer{};
+
+    constexpr auto type = legate::comm::coll::CollDataType::CollFloat;
+    constexpr auto op   = legate::ReductionOpKind::ADD;
+    const auto count    = static_cast<int>(count_);
+    const auto all      = count_ * static_cast<std::size_t>(num_ranks_);
+    auto* const comm    = &comms_[static_cast<std::size_t>(rank)];
+
+    switch (collective_) {
+      case Collective::BROADCAST: {
+        recv_buffer.resize(count_, 1.0F);
+        network_.broadcast(recv_buffer.data(), count, type, ROOT, comm);
+        break;
+      }
+      case Collective::BROADCAST_VIA_ALL_GATHER: {
+        // Everybody contributes a full buffer, and only keeps the root's
+        send_buffer.resize(count_, 1.0F);
+        recv_buffer.resize(all);
+        network_.all_gather(send_buffer.data(), recv_buffer.data(), count, type, comm);
+        std::memmove(recv_buffer.data(),
+                     recv_buffer.data() + (static_cast<std::size_t>(ROOT) * count_),
+                     count_ * sizeof(float));
+        break;
+      }
+      case Collective::GATHER: {
+        send_buffer.resize(count_, 1.0F);
+        recv_buffer.resize(all);
+        network_.gather(send_buffer.data(), recv_buffer.data(), count, type, ROOT, comm);
+        break;
+      }
+      case Collective::GATHER_VIA_ALL_GATHER: {
+        send_buffer.resize(count_, 1.0F);
+        recv_buffer.resize(all);
+        network_.all_gather(send_buffer.data(), recv_buffer.data(), count, type, comm);
+        break;
+      }
+      case Collective::REDUCE: {
+        send_buffer.resize(count_, 1.0F);
+        recv_buffer.resize(count_);
+        network_.reduce(send_buffer.data(), recv_buffer.data(), count, type, op, ROOT, comm);
+        break;
+      }
+      case Collective::REDUCE_VIA_ALL_REDUCE: {
+        send_buffer.resize(count_, 1.0F);
+        recv_buffer.resize(count_);
+        network_.all_reduce(send_buffer.data(), recv_buffer.data(), count, type, op, comm);
+        break;
+      }
+      case Collective::REDUCE_SCATTER: {
+        send_buffer.resize(all, 1.0F);
+        recv_buffer.resize(count_);
+        network_.reduce_scatter(send_buffer.data(), recv_buffer.data(), count, type, op, comm);
+        break;
+      }
+      case Collective::REDUCE_SCATTER_VIA_ALL_REDUCE: {
+        // Everybody reduces the full buffer, and only keeps its own block
+        send_buffer.resize(all, 1.0F);
+        recv_buffer.resize(all);
+        network_.all_reduce(
+          send_buffer.data(), recv_buffer.data(), static_cast<int>(all), type, op, comm);
+        std::memmove(recv_buffer.data(),
+                     recv_buffer.data() + (static_cast<std::size_t>(rank) * count_),
+                     count_ * sizeof(float));
+        break;
+      }
+    }
+  }
+
+  void worker_main_(int rank, int unique_id)
+  {
+    auto seen = generation_.load(std::memory_order_acquire);
+
+    create_comm_(rank, unique_id);
+    while (true) {
+      std::uint64_t current{};
+
+      while ((current = generation_.load(std::memory_order_acquire)) == seen) {
+        std::this_thread::yield();
+      }
+      seen = current;
+      if (stop_.load(std::memory_order_relaxed)) {
+        break;
+      }
+      run_collective_(rank);
+    }
+    network_.comm_destroy(&comms_[static_cast<std::size_t>(rank)]);
+  }
+
+  LocalNetwork network_{};
+  std::size_t count_{};
+  int num_ranks_{};
+  Collective collective_{};
+  std::vector<legate::comm::coll::Coll_Comm> comms_{};
+  std::vector<std::thread> workers_{};
+  std::atomic<std::uint64_t> generation_{};
+  std::atomic<bool> stop_{};
+};
+
+void benchmark_body(benchmark::State& state, Collective collective)
+{
+  const auto count     = static_cast<std::size_t>(state.range(0));
+  const auto num_ranks = static_cast<int>(state.range(1));
+  LocalCollectiveRunner runner{count, num_ranks, collective};
+
+  for (auto _ : state) {  // NOLINT(clang-analyzer-deadcode.DeadStores)
+    runner.run_once();
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(count * sizeof(float)));
+}
+
+void local_broadcast(benchmark::State& state) { benchmark_body(state, Collective::BROADCAST); }
+
+void local_broadcast_via_all_gather(benchmark::State& state)
+{
+  benchmark_body(state, Collective::BROADCAST_VIA_ALL_GATHER);
+}
+
+void local_gather(benchmark::State& state) { benchmark_body(state, Collective::GATHER); }
+
+void local_gather_via_all_gather(benchmark::State& state)
+{
+  benchmark_body(state, Collective::GATHER_VIA_ALL_GATHER);
+}
+
+void local_reduce(benchmark::State& state) { benchmark_body(state, Collective::REDUCE); }
+
+void local_reduce_via_all_reduce(benchmark::State& state)
+{
+  benchmark_body(state, Collective::REDUCE_VIA_ALL_REDUCE);
+}
+
+void local_reduce_scatter(benchmark::State& state)
+{
+  benchmark_body(state, Collective::REDUCE_SCATTER);
+}
+
+void local_reduce_scatter_via_all_reduce(benchmark::State& state)
+{
+  benchmark_body(state, Collective::REDUCE_SCATTER_VIA_ALL_REDUCE);
+}
+
+// Sweeps the element count x the number of ranks in the communicator
+void apply_sweep(benchmark::internal::Benchmark* bench)
+{
+  bench->ArgNames({"count", "ranks"})
+    ->ArgsProduct({benchmark::CreateRange(1 << 8, 1 << 20, /* multi */ 16),
+                   benchmark::CreateRange(2, 32, /* multi */ 2)})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+}
+
+// NOLINTBEGIN(legate-use-aggregate-constructor, clang-diagnostic-c2y-extensions)
+// NOLINTBEGIN(cert-err58-cpp, bugprone-throwing-static-initialization)
+BENCHMARK(local_broadcast)->Apply(apply_sweep);
+BENCHMARK(local_broadcast_via_all_gather)->Apply(apply_sweep);
+BENCHMARK(local_gather)->Apply(apply_sweep);
+BENCHMARK(local_gather_via_all_gather)->Apply(apply_sweep);
+BENCHMARK(local_reduce)->Apply(apply_sweep);
+BENCHMARK(local_reduce_via_all_reduce)->Apply(apply_sweep);
+BENCHMARK(local_reduce_scatter)->Apply(apply_sweep);
+BENCHMARK(local_reduce_scatter_via_all_reduce)->Apply(apply_sweep);
+// NOLINTEND(cert-err58-cpp, bugprone-throwing-static-initialization)
+// NOLINTEND(legate-use-aggregate-constructor, clang-diagnostic-c2y-extensions)
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,159 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/comm/coll_comm.h>
+#include <legate/comm/detail/local_network.h>
+#include <legate/comm/detail/wait_strategy.h>
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using legate::detail::comm::coll::LocalNetwork;
+using legate::detail::comm::coll::WaitStrategy;
+
+// Runs small all-reduces over a LocalNetwork communicator spanning num_ranks threads. The calling
+// thread acts as rank 0 and drives the benchmark loop, the other ranks follow along. Every
+// all-reduce synchronizes all ranks, so with more ranks than cores, the time it takes is dominated
+// by how quickly waiting ranks hand their core over to the ones that still have work to do.
+class AllReduceRunner {
+ public:
+  AllReduceRunner(int num_ranks, WaitStrategy wait_strategy)
+    : network_{LocalNetwork::DEFAULT_ALL_REDUCE_SLICE_THRESHOLD, wait_strategy},
+      num_ranks_{num_ranks},
+      comms_(static_cast<std::size_t>(num_ranks))
+  {
+    const auto unique_id = network_.init_comm();
+
+    workers_.reserve(static_cast<std::size_t>(num_ranks_) - 1);
+    for (int rank = 1; rank < num_ranks_; ++rank) {
+      workers_.emplace_back([this, rank, unique_id] { worker_main_(rank, unique_id); });
+    }
+    create_comm_(0, unique_id);
+  }
+
+  ~AllReduceRunner()
+  {
+    stop_.store(true, std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_release);
+    network_.comm_destroy(&comms_[0]);
+    for (auto&& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  AllReduceRunner(const AllReduceRunner&)            = delete;
+  AllReduceRunner& operator=(const AllReduceRunner&) = delete;
+  AllReduceRunner(AllReduceRunner&&)                 = delete;
+  AllReduceRunner& operator=(AllReduceRunner&&)      = delete;
+
+  void run_once()
+  {
+    generation_.fetch_add(1, std::memory_order_release);
+    run_all_reduce_(0);
+  }
+
+ private:
+  static constexpr int COUNT = 16;
+
+  void create_comm_(int rank, int unique_id)
+  {
+    network_.comm_create(&comms_[static_cast<std::size_t>(rank)],
+                         num_ranks_,
+                         rank,
+                         unique_id,
+                         /* mapping_table */ nullptr);
+  }
+
+  void run_all_reduce_(int rank)
+  {
+    std::vector<float> send_buffer(COUNT, 1.0F);
+    std::vector<float> recv_buffer(COUNT);
+
+    network_.all_reduce(send_buffer.data(),
+                        recv_buffer.data(),
+                        COUNT,
+                        legate::comm::coll::CollDataType::CollFloat,
+                        legate::ReductionOpKind::ADD,
+                        &comms_[static_cast<std::size_t>(rank)]);
+  }
+
+  void worker_main_(int rank, int unique_id)
+  {
+    auto seen = generation_.load(std::memory_order_acquire);
+
+    create_comm_(rank, unique_id);
+    while (true) {
+      std::uint64_t current{};
+
+      while ((current = generation_.load(std::memory_order_acquire)) == seen) {
+        std::this_thread::yield();
+      }
+      seen = current;
+      if (stop_.load(std::memory_order_relaxed)) {
+        break;
+      }
+      run_all_reduce_(rank);
+    }
+    network_.comm_destroy(&comms_[static_cast<std::size_t>(rank)]);
+  }
+
+  LocalNetwork network_;
+  int num_ranks_{};
+  std::vector<legate::comm::coll::Coll_Comm> comms_{};
+  std::vector<std::thread> workers_{};
+  std::atomic<std::uint64_t> generation_{};
+  std::atomic<bool> stop_{};
+};
+
+// The only argument is the number of ranks per core
+void benchmark_body(benchmark::State& state, WaitStrategy wait_strategy)
+{
+  const auto num_cores =
+    static_cast<std::int64_t>(std::max(std::thread::hardware_concurrency(), 1U));
+  const auto num_ranks = static_cast<int>(num_cores * state.range(0));
+  AllReduceRunner runner{num_ranks, wait_strategy};
+
+  for (auto _ : state) {  // NOLINT(clang-analyzer-deadcode.DeadStores)
+    runner.run_once();
+  }
+  state.counters["ranks"] = num_ranks;
+}
+
+void local_wait_spin(benchmark::State& state) { benchmark_body(state, WaitStrategy::SPIN); }
+
+void local_wait_yield(benchmark::State& state) { benchmark_body(state, WaitStrategy::YIELD); }
+
+void local_wait_block(benchmark::State& state) { benchmark_body(state, WaitStrategy::BLOCK); }
+
+// Sweeps the oversubscription factor, from one rank per core to four. The process CPU time shows
+// how much of the machine the waiting ranks burn.
+void apply_sweep(benchmark::internal::Benchmark* bench)
+{
+  bench->ArgNames({"ranks_per_core"})
+    ->DenseRange(1, 4)
+    ->Unit(benchmark::kMicrosecond)
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+}
+
+// NOLINTBEGIN(legate-use-aggregate-constructor, clang-diagnostic-c2y-extensions)
+// NOLINTBEGIN(cert-err58-cpp, bugprone-throwing-static-initialization)
+BENCHMARK(local_wait_spin)->Apply(apply_sweep);
+BENCHMARK(local_wait_yield)->Apply(apply_sweep);
+BENCHMARK(local_wait_block)->Apply(apply_sweep);
+// NOLINTEND(cert-err58-cpp, bugprone-throwing-static-initialization)
+// NOLINTEND(legate-use-aggregate-constructor, clang-diagnostic-c2y-extensions)
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate.h>
+
+#include <legate/partitioning/detail/strategy_cache.h>
+#include <legate/runtime/detail/runtime.h>
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr std::string_view LIBNAME = "bench";
+constexpr std::uint64_t EXTENT     = 1 << 10;
+
+class EmptyTask : public legate::LegateTask<EmptyTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{0}};
+
+  static void cpu_variant(legate::TaskContext) {}
+};
+
+[[nodiscard]] std::vector<legate::LogicalStore> make_stores(std::size_t num_stores)
+{
+  const auto runtime = legate::Runtime::get_runtime();
+  auto stores        = std::vector<legate::LogicalStore>{};
+
+  stores.reserve(num_stores);
+  for (std::size_t i = 0; i < num_stores; ++i) {
+    stores.emplace_back(runtime->create_store(legate::Shape{EXTENT, EXTENT}, legate::int64()));
+  }
+  return stores;
+}
+
+// Partitions and launches a task writing all the stores, aligned with each other. Stores are
+// matched in the strategy cache by the storage they view, so launches on the same stores hit the
+// cache, and launches on new stores miss it and pay for the signature on top of the solver.
+void launch(const std::vector<legate::LogicalStore>& stores)
+{
+  const auto runtime = legate::Runtime::get_runtime();
+  const auto library = runtime->find_library(LIBNAME);
+  auto task          = runtime->create_task(library, EmptyTask::TASK_CONFIG.task_id());
+  const auto first   = task.add_output(stores.front());
+
+  for (std::size_t i = 1; i < stores.size(); ++i) {
+    task.add_constraint(legate::align(first, task.add_output(stores[i])));
+  }
+  runtime->submit(std::move(task));
+  // Partitions the task now rather than when the scheduling window fills up
+  legate::detail::Runtime::get_runtime().flush_scheduling_window();
+}
+
+// The only argument is the number of stores of each launch
+void benchmark_body(benchmark::State& state, bool reuse_stores)
+{
+  const auto num_stores = static_cast<std::size_t>(state.range(0));
+  auto&& cache          = legate::detail::Runtime::get_runtime().strategy_cache();
+  auto stores           = make_stores(num_stores);
+  const auto hits       = cache.num_hits();
+  const auto misses     = cache.num_misses();
+
+  for (auto _ : state) {  // NOLINT(clang-analyzer-deadcode.DeadStores)
+    if (!reuse_stores) {
+      state.PauseTiming();
+      stores = make_stores(num_stores);
+      state.ResumeTiming();
+    }
+    launch(stores);
+  }
+  legate::Runtime::get_runtime()->issue_execution_fence(/* block */ true);
+
+  const auto num_hits   = static_cast<double>(cache.num_hits() - hits);
+  const auto num_misses = static_cast<double>(cache.num_misses() - misses);
+
+  state.counters["hit_rate"] = num_hits + num_misses > 0 ? num_hits / (num_hits + num_misses) : 0;
+}
+
+void same_stores(benchmark::State& state) { benchmark_body(state, /* reuse_stores */ true); }
+
+void new_stores(benchmark::State& state) { benchmark_body(state, /* reuse_stores */ false); }
+
+void apply_num_stores(benchmark::internal::Benchmark* bench)
+{
+  bench->ArgNames({"stores"})->RangeMultiplier(4)->Range(1, 64)->Unit(benchmark::kMicrosecond);
+}
+
+// NOLINTBEGIN(legate-use-aggregate-constructor, clang-diagnostic-c2y-extensions)
+// NOLINTBEGIN(cert-err58-cpp, bugprone-throwing-static-initialization)
+BENCHMARK(same_stores)->Apply(apply_num_stores);
+BENCHMARK(new_stores)->Apply(apply_num_stores);
+// NOLINTEND(cert-err58-cpp, bugprone-throwing-static-initialization)
+// NOLINTEND(legate-use-aggregate-constructor, clang-diagnostic-c2y-extensions)
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  legate::start();
+  EmptyTask::register_variants(legate::Runtime::get_runtime()->find_or_create_library(LIBNAME));
+
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+  return legate::finish();
+}
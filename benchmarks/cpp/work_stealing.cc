@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate.h>
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace {
+
+constexpr std::string_view LIBNAME = "bench";
+
+// Number of point tasks per CPU in each launch
+constexpr std::uint64_t TASKS_PER_PROC = 8;
+// Time it takes to run a regular point task
+constexpr auto BASE_DURATION = std::chrono::microseconds{200};
+
+// Busy-waits for BASE_DURATION, or skew times as long for the first quarter of the points. The
+// slicer hands out contiguous blocks of points to each processor, so the processors that get the
+// slow points end up with much more work than the rest.
+void run_skewed(legate::TaskContext context)
+{
+  const auto skew     = context.scalar(0).value<std::uint32_t>();
+  const auto index    = context.get_task_index()[0];
+  const auto num_pts  = context.get_launch_domain().get_volume();
+  const auto is_slow  = static_cast<std::size_t>(index) < num_pts / 4;
+  const auto duration = is_slow ? BASE_DURATION * skew : BASE_DURATION;
+  const auto end      = std::chrono::steady_clock::now() + duration;
+
+  while (std::chrono::steady_clock::now() < end) {
+    // Spin, so that the task occupies its processor like a compute-bound task would
+  }
+}
+
+class SkewedTask : public legate::LegateTask<SkewedTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{0}};
+
+  static void cpu_variant(legate::TaskContext context) { run_skewed(context); }
+};
+
+class StealableSkewedTask : public legate::LegateTask<StealableSkewedTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{1}};
+  static constexpr auto CPU_VARIANT_OPTIONS = legate::VariantOptions{}.with_stealable(true);
+
+  static void cpu_variant(legate::TaskContext context) { run_skewed(context); }
+};
+
+// The only argument is the skew, i.e. how many times longer the slow points take
+void benchmark_body(benchmark::State& state, legate::LocalTaskID task_id)
+{
+  auto runtime    = legate::Runtime::get_runtime();
+  auto lib        = runtime->find_library(LIBNAME);
+  const auto skew = static_cast<std::uint32_t>(state.range(0));
+
+  const auto ntasks =
+    TASKS_PER_PROC * runtime->get_machine().count(legate::mapping::TaskTarget::CPU);
+
+  for (auto _ : state) {  // NOLINT(clang-analyzer-deadcode.DeadStores)
+    auto task = runtime->create_task(lib, task_id, legate::tuple<std::uint64_t>{ntasks});
+
+    task.add_scalar_arg(legate::Scalar{skew});
+    runtime->submit(std::move(task));
+    runtime->issue_execution_fence(true);
+  }
+  state.counters["tasks"] = static_cast<double>(ntasks);
+}
+
+void work_stealing_off(benchmark::State& state)
+{
+  benchmark_body(state, SkewedTask::TASK_CONFIG.task_id());
+}
+
+void work_stealing_on(benchmark::State& state)
+{
+  benchmark_body(state, StealableSkewedTask::TASK_CONFIG.task_id());
+}
+
+void apply_skews(benchmark::internal::Benchmark* bench)
+{
+  bench->ArgNames({"skew"})->RangeMultiplier(4)->Range(1, 64)->Unit(benchmark::kMillisecond);
+}
+
+// NOLINTBEGIN(legate-use-aggregate-constructor, clang-diagnostic-c2y-extensions)
+// NOLINTBEGIN(cert-err58-cpp, bugprone-throwing-static-initialization)
+BENCHMARK(work_stealing_off)->Apply(apply_skews);
+BENCHMARK(work_stealing_on)->Apply(apply_skews);
+// NOLINTEND(cert-err58-cpp, bugprone-throwing-static-initialization)
+// NOLINTEND(legate-use-aggregate-constructor, clang-diagnostic-c2y-extensions)
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  legate::start();
+
+  auto library = legate::Runtime::get_runtime()->find_or_create_library(LIBNAME);
+
+  SkewedTask::register_variants(library);
+  StealableSkewedTask::register_variants(library);
+
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+  return legate::finish();
+}
@@ -6,6 +6,7 @@
 #include <legate_mpi_wrapper/mpi_wrapper.h>
 
 #include <mpi.h>
+#include <stdlib.h>
 
 // Cannot do if defined(FOO) && FOO >= ... because preprocessor short-circuiting was not
 // mandated by C until C11. C++ appears to have always had it.
@@ -31,6 +32,10 @@ static_assert(
   "Size of thunk too small to hold MPI_Status. Please report this to Legate developers by opening "
   "an issue at https://github.com/nv-legate/legate and/or sending an email to "
   "legate@nvidia.com.");
+static_assert(sizeof(MPI_Request) <= sizeof(Legate_MPI_Request),
+              "Legate_MPI_Request too small to hold MPI_Request. Please report this to Legate "
+              "developers by opening an issue at https://github.com/nv-legate/legate and/or "
+              "sending an email to legate@nvidia.com.");
 #endif
 
 // NOLINTBEGIN
@@ -47,6 +52,12 @@ Legate_MPI_Kind legate_mpi_wrapper_kind(void)
 #endif
 }
 
+void legate_mpi_wrapper_version(int32_t* major, int32_t* minor)
+{
+  *major = LEGATE_MPI_WRAPPER_VERSION_MAJOR;
+  *minor = LEGATE_MPI_WRAPPER_VERSION_MINOR;
+}
+
 // ==========================================================================================
 
 Legate_MPI_Comm legate_mpi_comm_world(void) { return (Legate_MPI_Comm)MPI_COMM_WORLD; }
@@ -170,6 +181,114 @@ int legate_mpi_recv(void* buf,
   return ret;
 }
 
+int legate_mpi_isend(const void* buf,
+                     int count,
+                     Legate_MPI_Datatype datatype,
+                     int dest,
+                     int tag,
+                     Legate_MPI_Comm comm,
+                     Legate_MPI_Request* request)
+{
+  MPI_Request real_request;
+  int ret =
+    MPI_Isend(buf, count, (MPI_Datatype)datatype, dest, tag, (MPI_Comm)comm, &real_request);
+
+  *request = (Legate_MPI_Request)real_request;
+  return ret;
+}
+
+int legate_mpi_irecv(void* buf,
+                     int count,
+                     Legate_MPI_Datatype datatype,
+                     int source,
+                     int tag,
+                     Legate_MPI_Comm comm,
+                     Legate_MPI_Request* request)
+{
+  MPI_Request real_request;
+  int ret =
+    MPI_Irecv(buf, count, (MPI_Datatype)datatype, source, tag, (MPI_Comm)comm, &real_request);
+
+  *request = (Legate_MPI_Request)real_request;
+  return ret;
+}
+
+// MPI_Request may be narrower than Legate_MPI_Request (e.g. MPICH uses an int), so requests must
+// be converted into an array of the real type first. Up to this many requests are converted on
+// the stack, so that polling a request with legate_mpi_testall() doesn't allocate.
+#define LEGATE_MPI_WRAPPER_STACK_REQUESTS 64
+
+static MPI_Request* to_real_requests(int count,
+                                     const Legate_MPI_Request* requests,
+                                     MPI_Request* stack_requests)
+{
+  MPI_Request* real_requests = stack_requests;
+  int i;
+
+  if (count > LEGATE_MPI_WRAPPER_STACK_REQUESTS) {
+    real_requests = (MPI_Request*)malloc((size_t)count * sizeof(MPI_Request));
+    if (!real_requests) {
+      return NULL;
+    }
+  }
+  for (i = 0; i < count; ++i) {
+    real_requests[i] = (MPI_Request)requests[i];
+  }
+  return real_requests;
+}
+
+static void from_real_requests(int count,
+                               MPI_Request* real_requests,
+                               Legate_MPI_Request* requests,
+                               const MPI_Request* stack_requests)
+{
+  int i;
+
+  for (i = 0; i < count; ++i) {
+    requests[i] = (Legate_MPI_Request)real_requests[i];
+  }
+  if (real_requests != stack_requests) {
+    free(real_requests);
+  }
+}
+
+int legate_mpi_waitall(int count, Legate_MPI_Request* requests)
+{
+  MPI_Request stack_requests[LEGATE_MPI_WRAPPER_STACK_REQUESTS];
+  MPI_Request* real_requests;
+  int ret;
+
+  if (count <= 0) {
+    return MPI_SUCCESS;
+  }
+  real_requests = to_real_requests(count, requests, stack_requests);
+  if (!real_requests) {
+    return MPI_ERR_NO_MEM;
+  }
+  ret = MPI_Waitall(count, real_requests, MPI_STATUSES_IGNORE);
+  from_real_requests(count, real_requests, requests, stack_requests);
+  return ret;
+}
+
+int legate_mpi_testall(int count, Legate_MPI_Request* requests, int* flag)
+{
+  MPI_Request stack_requests[LEGATE_MPI_WRAPPER_STACK_REQUESTS];
+  MPI_Request* real_requests;
+  int ret;
+
+  if (count <= 0) {
+    *flag = 1;
+    return MPI_SUCCESS;
+  }
+  real_requests = to_real_requests(count, requests, stack_requests);
+  if (!real_requests) {
+    return MPI_ERR_NO_MEM;
+  }
+  ret = MPI_Testall(count, real_requests, flag, MPI_STATUSES_IGNORE);
+  from_real_requests(count, real_requests, requests, stack_requests);
+  return ret;
+}
+
 int legate_mpi_sendrecv(const void* sendbuf,
                         int sendcount,
                         Legate_MPI_Datatype sendtype,
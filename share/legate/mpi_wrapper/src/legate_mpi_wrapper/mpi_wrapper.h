@@ -23,6 +23,7 @@ extern "C" {
 #endif
 
 LEGATE_MPI_WRAPPER_EXPORT Legate_MPI_Kind legate_mpi_wrapper_kind(void);
+LEGATE_MPI_WRAPPER_EXPORT void legate_mpi_wrapper_version(int32_t* major, int32_t* minor);
 
 // ==========================================================================================
 
@@ -88,6 +89,24 @@ LEGATE_MPI_WRAPPER_EXPORT int legate_mpi_recv(void* buf,
                                               int tag,
                                               Legate_MPI_Comm comm,
                                               Legate_MPI_Status* status);
+LEGATE_MPI_WRAPPER_EXPORT int legate_mpi_isend(const void* buf,
+                                               int count,
+                                               Legate_MPI_Datatype datatype,
+                                               int dest,
+                                               int tag,
+                                               Legate_MPI_Comm comm,
+                                               Legate_MPI_Request* request);
+LEGATE_MPI_WRAPPER_EXPORT int legate_mpi_irecv(void* buf,
+                                               int count,
+                                               Legate_MPI_Datatype datatype,
+                                               int source,
+                                               int tag,
+                                               Legate_MPI_Comm comm,
+                                               Legate_MPI_Request* request);
+LEGATE_MPI_WRAPPER_EXPORT int legate_mpi_waitall(int count, Legate_MPI_Request* requests);
+LEGATE_MPI_WRAPPER_EXPORT int legate_mpi_testall(int count,
+                                                 Legate_MPI_Request* requests,
+                                                 int* flag);
 LEGATE_MPI_WRAPPER_EXPORT int legate_mpi_sendrecv(const void* sendbuf,
                                                   int sendcount,
                                                   Legate_MPI_Datatype sendtype,
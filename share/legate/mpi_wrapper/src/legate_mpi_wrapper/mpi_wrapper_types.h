@@ -14,6 +14,8 @@
 typedef ptrdiff_t Legate_MPI_Comm;
 typedef ptrdiff_t Legate_MPI_Datatype;
 typedef ptrdiff_t Legate_MPI_Aint;
+// Wide enough to hold both MPICH (integer handle) and OpenMPI (pointer) requests.
+typedef ptrdiff_t Legate_MPI_Request;
 
 // The size in bytes of the thunk where we will stash the original MPI_Status. While the
 // standard mandates the public members of MPI_Status, it says nothing about the order, or
@@ -44,5 +46,16 @@ typedef int32_t Legate_MPI_Kind;
 #define LEGATE_MPI_KIND_MPICH ((Legate_MPI_Kind)0)
 #define LEGATE_MPI_KIND_OPEN_MPI ((Legate_MPI_Kind)1)
 
+// The version of the interface exported by the wrapper, which must match the project version in
+// its CMakeLists.txt. The minor version is bumped when functions are added, and the major version
+// when existing ones change. Legate refuses to load a wrapper with another major version, or an
+// older minor version, than the one it was built against.
+//
+// 1.0: Initial version.
+// 1.1: Add legate_mpi_wrapper_version(), legate_mpi_isend(), legate_mpi_irecv(),
+//      legate_mpi_waitall() and legate_mpi_testall().
+#define LEGATE_MPI_WRAPPER_VERSION_MAJOR 1
+#define LEGATE_MPI_WRAPPER_VERSION_MINOR 1
+
 #endif  // LEGATE_SHARE_LEGATE_MPI_WRAPPER_TYPES_H
 // NOLINTEND
@@ -8,36 +8,38 @@
 
 #include <legate/comm/detail/backend_network.h>
 #include <legate/comm/detail/logger.h>
+#include <legate/comm/detail/reduction_helpers.h>
 #include <legate/utilities/abort.h>
 #include <legate/utilities/detail/traced_exception.h>
 
+#include <fmt/format.h>
+
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
 namespace coll_detail = legate::detail::comm::coll;
 
 namespace legate::comm::coll {
 
-void collCommCreate(CollComm global_comm,
-                    int global_comm_size,
-                    int global_rank,
-                    int unique_id,
-                    const int* mapping_table)
-{
-  coll_detail::BackendNetwork::get_network()->comm_create(
-    global_comm, global_comm_size, global_rank, unique_id, mapping_table);
-}
+namespace {
 
-void collCommDestroy(CollComm global_comm)
+void check_root(int root, CollComm global_comm)
 {
-  coll_detail::BackendNetwork::get_network()->comm_destroy(global_comm);
+  if (root < 0 || root >= global_comm->global_comm_size) {
+    throw legate::detail::TracedException<std::invalid_argument>{
+      fmt::format("Invalid root: {} is not in [0, {})", root, global_comm->global_comm_size)};
+  }
 }
 
-void collAlltoallv(const void* sendbuf,
-                   const int sendcounts[],
-                   const int sdispls[],
-                   void* recvbuf,
-                   const int recvcounts[],
-                   const int rdispls[],
-                   CollDataType type,
-                   CollComm global_comm)
+void check_all_to_all_v_args(const void* sendbuf,
+                             const int sendcounts[],
+                             const int sdispls[],
+                             const void* recvbuf,
+                             const int recvcounts[],
+                             const int rdispls[])
 {
   if (sendbuf == nullptr) {
     throw legate::detail::TracedException<std::invalid_argument>{"Invalid sendbuf: nullptr"};
@@ -62,20 +64,9 @@ void collAlltoallv(const void* sendbuf,
     throw legate::detail::TracedException<std::invalid_argument>{
       "Inplace Alltoallv not yet supported"};
   }
-  coll_detail::logger().debug() << "Alltoallv: global_rank " << global_comm->global_rank
-                                << ", mpi_rank " << global_comm->mpi_rank << ", unique_id "
-                                << global_comm->unique_id << ", comm_size "
-                                << global_comm->global_comm_size << ", mpi_comm_size "
-                                << global_comm->mpi_comm_size << ' '
-                                << global_comm->mpi_comm_size_actual << ", nb_threads "
-                                << global_comm->nb_threads;
-
-  coll_detail::BackendNetwork::get_network()->all_to_all_v(
-    sendbuf, sendcounts, sdispls, recvbuf, recvcounts, rdispls, type, global_comm);
 }
 
-void collAlltoall(
-  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm)
+void check_buffers(const void* sendbuf, const void* recvbuf, int count)
 {
   if (sendbuf == nullptr) {
     throw legate::detail::TracedException<std::invalid_argument>{"Invalid sendbuf: nullptr"};
@@ -86,43 +77,123 @@ void collAlltoall(
   if (count <= 0) {
     throw legate::detail::TracedException<std::invalid_argument>{"Invalid count: <= 0"};
   }
+}
+
+void check_all_to_all_args(const void* sendbuf, const void* recvbuf, int count)
+{
+  check_buffers(sendbuf, recvbuf, count);
   // IN_PLACE is not supported
   if (sendbuf == recvbuf) {
     throw legate::detail::TracedException<std::invalid_argument>{
       "Inplace Alltoall not yet supported"};
   }
-  coll_detail::logger().debug() << "Alltoall: global_rank " << global_comm->global_rank
+}
+
+void log_collective(std::string_view coll_name, CollComm global_comm)
+{
+  coll_detail::logger().debug() << coll_name << ": global_rank " << global_comm->global_rank
                                 << ", mpi_rank " << global_comm->mpi_rank << ", unique_id "
                                 << global_comm->unique_id << ", comm_size "
                                 << global_comm->global_comm_size << ", mpi_comm_size "
                                 << global_comm->mpi_comm_size << ' '
                                 << global_comm->mpi_comm_size_actual << ", nb_threads "
                                 << global_comm->nb_threads;
+}
 
-  coll_detail::BackendNetwork::get_network()->all_to_all(
-    sendbuf, recvbuf, count, type, global_comm);
+}  // namespace
+
+CollRequest::CollRequest() noexcept = default;
+
+CollRequest::CollRequest(CollRequest&&) noexcept = default;
+
+CollRequest& CollRequest::operator=(CollRequest&& other)
+{
+  if (this != &other) {
+    wait();
+    impl_ = std::move(other.impl_);
+  }
+  return *this;
 }
 
-void collAllgather(
-  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm)
+CollRequest::~CollRequest()
 {
-  if (sendbuf == nullptr) {
-    throw legate::detail::TracedException<std::invalid_argument>{"Invalid sendbuf: nullptr"};
+  // The backend may still write to the buffers of the collective, which the caller is likely to
+  // release right after the request, so a collective that fails here can't just be abandoned
+  try {
+    wait();
+  } catch (const std::exception& e) {
+    LEGATE_ABORT("Non-blocking collective failed while its request was destroyed: ", e.what());
   }
-  if (recvbuf == nullptr) {
-    throw legate::detail::TracedException<std::invalid_argument>{"Invalid recvbuf: nullptr"};
+}
+
+CollRequest::CollRequest(std::unique_ptr<coll_detail::CollRequest> impl) noexcept
+  : impl_{std::move(impl)}
+{
+}
+
+bool CollRequest::test()
+{
+  // The backend state is released as soon as the collective completes
+  if (impl_ && impl_->test()) {
+    impl_.reset();
   }
-  if (count <= 0) {
-    throw legate::detail::TracedException<std::invalid_argument>{"Invalid count: <= 0"};
+  return impl_ == nullptr;
+}
+
+void CollRequest::wait()
+{
+  if (impl_) {
+    impl_->wait();
+    impl_.reset();
   }
+}
 
-  coll_detail::logger().debug() << "Allgather: global_rank " << global_comm->global_rank
-                                << ", mpi_rank " << global_comm->mpi_rank << ", unique_id "
-                                << global_comm->unique_id << ", comm_size "
-                                << global_comm->global_comm_size << ", mpi_comm_size "
-                                << global_comm->mpi_comm_size << ' '
-                                << global_comm->mpi_comm_size_actual << ", nb_threads "
-                                << global_comm->nb_threads;
+void collCommCreate(CollComm global_comm,
+                    int global_comm_size,
+                    int global_rank,
+                    int unique_id,
+                    const int* mapping_table)
+{
+  coll_detail::BackendNetwork::get_network()->comm_create(
+    global_comm, global_comm_size, global_rank, unique_id, mapping_table);
+}
+
+void collCommDestroy(CollComm global_comm)
+{
+  coll_detail::BackendNetwork::get_network()->comm_destroy(global_comm);
+}
+
+void collAlltoallv(const void* sendbuf,
+                   const int sendcounts[],
+                   const int sdispls[],
+                   void* recvbuf,
+                   const int recvcounts[],
+                   const int rdispls[],
+                   CollDataType type,
+                   CollComm global_comm)
+{
+  check_all_to_all_v_args(sendbuf, sendcounts, sdispls, recvbuf, recvcounts, rdispls);
+  log_collective("Alltoallv", global_comm);
+
+  coll_detail::BackendNetwork::get_network()->all_to_all_v(
+    sendbuf, sendcounts, sdispls, recvbuf, recvcounts, rdispls, type, global_comm);
+}
+
+void collAlltoall(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm)
+{
+  check_all_to_all_args(sendbuf, recvbuf, count);
+  log_collective("Alltoall", global_comm);
+
+  coll_detail::BackendNetwork::get_network()->all_to_all(
+    sendbuf, recvbuf, count, type, global_comm);
+}
+
+void collAllgather(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm)
+{
+  check_buffers(sendbuf, recvbuf, count);
+  log_collective("Allgather", global_comm);
 
   coll_detail::BackendNetwork::get_network()->all_gather(
     sendbuf, recvbuf, count, type, global_comm);
@@ -134,43 +205,167 @@ void collAllreduce(const void* sendbuf,
                    CollDataType type,
                    ReductionOpKind op,
                    CollComm global_comm)
+{
+  check_buffers(sendbuf, recvbuf, count);
+  coll_detail::check_reduction_op(type, op, "all_reduce");
+  log_collective("Allreduce", global_comm);
+
+  coll_detail::BackendNetwork::get_network()->all_reduce(
+    sendbuf, recvbuf, count, type, op, global_comm);
+}
+
+void collBroadcast(void* buf, int count, CollDataType type, int root, CollComm global_comm)
+{
+  if (buf == nullptr) {
+    throw legate::detail::TracedException<std::invalid_argument>{"Invalid buf: nullptr"};
+  }
+  if (count <= 0) {
+    throw legate::detail::TracedException<std::invalid_argument>{"Invalid count: <= 0"};
+  }
+  check_root(root, global_comm);
+
+  log_collective("Broadcast", global_comm);
+
+  coll_detail::BackendNetwork::get_network()->broadcast(buf, count, type, root, global_comm);
+}
+
+void collGather(const void* sendbuf,
+                void* recvbuf,
+                int count,
+                CollDataType type,
+                int root,
+                CollComm global_comm)
 {
   if (sendbuf == nullptr) {
     throw legate::detail::TracedException<std::invalid_argument>{"Invalid sendbuf: nullptr"};
   }
-  if (recvbuf == nullptr) {
-    throw legate::detail::TracedException<std::invalid_argument>{"Invalid recvbuf: nullptr"};
+  if (count <= 0) {
+    throw legate::detail::TracedException<std::invalid_argument>{"Invalid count: <= 0"};
+  }
+  check_root(root, global_comm);
+  // The receive buffer only matters on the root
+  if (global_comm->global_rank == root) {
+    if (recvbuf == nullptr) {
+      throw legate::detail::TracedException<std::invalid_argument>{"Invalid recvbuf: nullptr"};
+    }
+    // IN_PLACE is not supported
+    if (sendbuf == recvbuf) {
+      throw legate::detail::TracedException<std::invalid_argument>{
+        "Inplace Gather not yet supported"};
+    }
+  }
+
+  log_collective("Gather", global_comm);
+
+  coll_detail::BackendNetwork::get_network()->gather(
+    sendbuf, recvbuf, count, type, root, global_comm);
+}
+
+void collReduce(const void* sendbuf,
+                void* recvbuf,
+                int count,
+                CollDataType type,
+                ReductionOpKind op,
+                int root,
+                CollComm global_comm)
+{
+  if (sendbuf == nullptr) {
+    throw legate::detail::TracedException<std::invalid_argument>{"Invalid sendbuf: nullptr"};
   }
   if (count <= 0) {
     throw legate::detail::TracedException<std::invalid_argument>{"Invalid count: <= 0"};
   }
+  check_root(root, global_comm);
+  // The receive buffer only matters on the root
+  if (global_comm->global_rank == root && recvbuf == nullptr) {
+    throw legate::detail::TracedException<std::invalid_argument>{"Invalid recvbuf: nullptr"};
+  }
+  coll_detail::check_reduction_op(type, op, "reduce");
+
+  log_collective("Reduce", global_comm);
 
-  switch (op) {
-    case legate::ReductionOpKind::ADD: [[fallthrough]];
-    case legate::ReductionOpKind::MUL: [[fallthrough]];
-    case legate::ReductionOpKind::MAX: [[fallthrough]];
-    case legate::ReductionOpKind::MIN: break;
-    case legate::ReductionOpKind::OR: [[fallthrough]];
-    case legate::ReductionOpKind::XOR: [[fallthrough]];
-    case legate::ReductionOpKind::AND:
-      if (type == legate::comm::coll::CollDataType::CollFloat ||
-          type == legate::comm::coll::CollDataType::CollDouble) {
-        throw legate::detail::TracedException<std::invalid_argument>{
-          "all_reduce does not support float or double reduction with bitwise operations"};
-      }
-      break;
+  coll_detail::BackendNetwork::get_network()->reduce(
+    sendbuf, recvbuf, count, type, op, root, global_comm);
+}
+
+void collReduceScatter(const void* sendbuf,
+                       void* recvbuf,
+                       int recvcount,
+                       CollDataType type,
+                       ReductionOpKind op,
+                       CollComm global_comm)
+{
+  if (sendbuf == nullptr) {
+    throw legate::detail::TracedException<std::invalid_argument>{"Invalid sendbuf: nullptr"};
   }
+  if (recvbuf == nullptr) {
+    throw legate::detail::TracedException<std::invalid_argument>{"Invalid recvbuf: nullptr"};
+  }
+  if (recvcount <= 0) {
+    throw legate::detail::TracedException<std::invalid_argument>{"Invalid recvcount: <= 0"};
+  }
+  // IN_PLACE is not supported
+  if (sendbuf == recvbuf) {
+    throw legate::detail::TracedException<std::invalid_argument>{
+      "Inplace ReduceScatter not yet supported"};
+  }
+  coll_detail::check_reduction_op(type, op, "reduce_scatter");
 
-  coll_detail::logger().debug() << "Allreduce: global_rank " << global_comm->global_rank
-                                << ", mpi_rank " << global_comm->mpi_rank << ", unique_id "
-                                << global_comm->unique_id << ", comm_size "
-                                << global_comm->global_comm_size << ", mpi_comm_size "
-                                << global_comm->mpi_comm_size << ' '
-                                << global_comm->mpi_comm_size_actual << ", nb_threads "
-                                << global_comm->nb_threads;
+  log_collective("ReduceScatter", global_comm);
 
-  coll_detail::BackendNetwork::get_network()->all_reduce(
-    sendbuf, recvbuf, count, type, op, global_comm);
+  coll_detail::BackendNetwork::get_network()->reduce_scatter(
+    sendbuf, recvbuf, recvcount, type, op, global_comm);
+}
+
+CollRequest collIalltoallv(const void* sendbuf,
+                           const int sendcounts[],
+                           const int sdispls[],
+                           void* recvbuf,
+                           const int recvcounts[],
+                           const int rdispls[],
+                           CollDataType type,
+                           CollComm global_comm)
+{
+  check_all_to_all_v_args(sendbuf, sendcounts, sdispls, recvbuf, recvcounts, rdispls);
+  log_collective("Ialltoallv", global_comm);
+
+  return CollRequest{coll_detail::BackendNetwork::get_network()->iall_to_all_v(
+    sendbuf, sendcounts, sdispls, recvbuf, recvcounts, rdispls, type, global_comm)};
+}
+
+CollRequest collIalltoall(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm)
+{
+  check_all_to_all_args(sendbuf, recvbuf, count);
+  log_collective("Ialltoall", global_comm);
+
+  return CollRequest{coll_detail::BackendNetwork::get_network()->iall_to_all(
+    sendbuf, recvbuf, count, type, global_comm)};
+}
+
+CollRequest collIallgather(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm)
+{
+  check_buffers(sendbuf, recvbuf, count);
+  log_collective("Iallgather", global_comm);
+
+  return CollRequest{coll_detail::BackendNetwork::get_network()->iall_gather(
+    sendbuf, recvbuf, count, type, global_comm)};
+}
+
+CollRequest collIallreduce(const void* sendbuf,
+                           void* recvbuf,
+                           int count,
+                           CollDataType type,
+                           ReductionOpKind op,
+                           CollComm global_comm)
+{
+  check_buffers(sendbuf, recvbuf, count);
+  coll_detail::check_reduction_op(type, op, "iall_reduce");
+  log_collective("Iallreduce", global_comm);
+
+  return CollRequest{coll_detail::BackendNetwork::get_network()->iall_reduce(
+    sendbuf, recvbuf, count, type, op, global_comm)};
 }
 
 }  // namespace legate::comm::coll
@@ -9,8 +9,59 @@
 #include <legate/comm/coll_comm.h>
 #include <legate/utilities/typedefs.h>
 
+#include <memory>
+
+namespace legate::detail::comm::coll {
+
+class CollRequest;
+
+}  // namespace legate::detail::comm::coll
+
 namespace legate::comm::coll {
 
+/**
+ * @brief A handle to an in-flight non-blocking collective.
+ *
+ * The buffers passed to a non-blocking collective (as well as the arrays of counts and
+ * displacements) must stay alive, and must not be modified (or in the case of receive buffers,
+ * read), until the collective has completed. Collectives only make progress while their requests
+ * are tested or waited on, so a rank should do either from time to time until completion.
+ *
+ * A request that is destroyed or assigned to before its collective has completed first waits for
+ * it to complete. If the collective fails while its request is being destroyed, the program is
+ * aborted, as the destructor cannot report the error.
+ */
+class LEGATE_EXPORT CollRequest {
+ public:
+  /**
+   * @brief Create a request that has already completed.
+   */
+  CollRequest() noexcept;
+  CollRequest(CollRequest&&) noexcept;
+  CollRequest& operator=(CollRequest&&);
+  ~CollRequest();
+
+  CollRequest(const CollRequest&)            = delete;
+  CollRequest& operator=(const CollRequest&) = delete;
+
+  explicit CollRequest(std::unique_ptr<legate::detail::comm::coll::CollRequest> impl) noexcept;
+
+  /**
+   * @brief Make progress on the collective, without blocking.
+   *
+   * @return `true` if the collective has completed, `false` otherwise.
+   */
+  [[nodiscard]] bool test();
+
+  /**
+   * @brief Block until the collective has completed.
+   */
+  void wait();
+
+ private:
+  std::unique_ptr<legate::detail::comm::coll::CollRequest> impl_{};
+};
+
 // NOLINTBEGIN(readability-identifier-naming)
 LEGATE_EXPORT void collCommCreate(CollComm global_comm,
                                   int global_comm_size,
@@ -56,6 +107,160 @@ LEGATE_EXPORT void collAllreduce(const void* sendbuf,
                                  CollDataType type,
                                  ReductionOpKind op,
                                  CollComm global_comm);
+
+/**
+ * @brief Broadcast a buffer from the root rank to all ranks of the global communicator.
+ *
+ * @param buf The buffer to broadcast. On the root rank this holds the data to send, on all other
+ * ranks it receives the data. This buffer must be of size count x CollDataType size.
+ * @param count The number of elements to broadcast.
+ * @param type The data type of the elements.
+ * @param root The global rank to broadcast from.
+ * @param global_comm The global communicator.
+ *
+ * @throw std::invalid_argument if `root` is not a rank of the global communicator.
+ */
+LEGATE_EXPORT void collBroadcast(
+  void* buf, int count, CollDataType type, int root, CollComm global_comm);
+
+/**
+ * @brief Gather the buffers of all ranks of the global communicator into the root rank.
+ *
+ * The data from rank `i` is stored at offset `i x count` of the root's receive buffer.
+ *
+ * @param sendbuf The source buffer to send to the root. This buffer must be of size count x
+ * CollDataType size.
+ * @param recvbuf The destination buffer, only used on the root rank (and may be null on the
+ * others). This buffer must be of size global_comm_size x count x CollDataType size.
+ * @param count The number of elements each rank sends.
+ * @param type The data type of the elements.
+ * @param root The global rank to gather into.
+ * @param global_comm The global communicator.
+ *
+ * @throw std::invalid_argument if `root` is not a rank of the global communicator, or if the
+ * gather is requested in place.
+ */
+LEGATE_EXPORT void collGather(const void* sendbuf,
+                              void* recvbuf,
+                              int count,
+                              CollDataType type,
+                              int root,
+                              CollComm global_comm);
+
+/**
+ * @brief Reduce the buffers of all ranks of the global communicator into the root rank.
+ * Bitwise and logical operations are not supported for floating point types.
+ *
+ * @param sendbuf The source buffer to reduce. This buffer must be of size count x CollDataType
+ * size.
+ * @param recvbuf The destination buffer to receive the reduced result into, only used on the root
+ * rank (and may be null on the others). This buffer must be of size count x CollDataType size.
+ * @param count The number of elements to reduce.
+ * @param type The data type of the elements.
+ * @param op The reduction operation to perform.
+ * @param root The global rank to reduce into.
+ * @param global_comm The global communicator.
+ *
+ * @throw std::invalid_argument if the reduction operation is not supported for the data type, or
+ * if `root` is not a rank of the global communicator.
+ */
+LEGATE_EXPORT void collReduce(const void* sendbuf,
+                              void* recvbuf,
+                              int count,
+                              CollDataType type,
+                              ReductionOpKind op,
+                              int root,
+                              CollComm global_comm);
+
+/**
+ * @brief Reduce the buffers of all ranks of the global communicator, and scatter the result so
+ * that each rank receives one block of it. Bitwise and logical operations are not supported for
+ * floating point types.
+ *
+ * Rank `i` receives the reduction of the elements `[i x recvcount, (i + 1) x recvcount)` of all
+ * send buffers. This is equivalent to, but moves global_comm_size times less data than, an
+ * all-reduce followed by each rank picking its own block.
+ *
+ * @param sendbuf The source buffer to reduce. This buffer must be of size global_comm_size x
+ * recvcount x CollDataType size.
+ * @param recvbuf The destination buffer to receive this rank's block of the result. This buffer
+ * must be of size recvcount x CollDataType size.
+ * @param recvcount The number of elements each rank receives.
+ * @param type The data type of the elements.
+ * @param op The reduction operation to perform.
+ * @param global_comm The global communicator.
+ *
+ * @throw std::invalid_argument if the reduction operation is not supported for the data type, or
+ * if the reduce-scatter is requested in place.
+ */
+LEGATE_EXPORT void collReduceScatter(const void* sendbuf,
+                                     void* recvbuf,
+                                     int recvcount,
+                                     CollDataType type,
+                                     ReductionOpKind op,
+                                     CollComm global_comm);
+
+/**
+ * @brief Start a non-blocking all-to-all-v operation among the ranks of the global communicator.
+ *
+ * The arguments are the same as the ones of `collAlltoallv()`. Non-blocking collectives must be
+ * started in the same order on all ranks, but may complete in any order.
+ *
+ * @return The request tracking the collective.
+ *
+ * @throw std::invalid_argument if any of the buffers or arrays is null, or if the all-to-all-v is
+ * requested in place.
+ */
+[[nodiscard]] LEGATE_EXPORT CollRequest collIalltoallv(const void* sendbuf,
+                                                       const int sendcounts[],
+                                                       const int sdispls[],
+                                                       void* recvbuf,
+                                                       const int recvcounts[],
+                                                       const int rdispls[],
+                                                       CollDataType type,
+                                                       CollComm global_comm);
+
+/**
+ * @brief Start a non-blocking all-to-all operation among the ranks of the global communicator.
+ *
+ * The arguments are the same as the ones of `collAlltoall()`.
+ *
+ * @return The request tracking the collective.
+ *
+ * @throw std::invalid_argument if any of the buffers is null, if `count` is not positive, or if
+ * the all-to-all is requested in place.
+ */
+[[nodiscard]] LEGATE_EXPORT CollRequest collIalltoall(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm);
+
+/**
+ * @brief Start a non-blocking all-gather operation among the ranks of the global communicator.
+ *
+ * The arguments are the same as the ones of `collAllgather()`.
+ *
+ * @return The request tracking the collective.
+ *
+ * @throw std::invalid_argument if any of the buffers is null, or if `count` is not positive.
+ */
+[[nodiscard]] LEGATE_EXPORT CollRequest collIallgather(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm);
+
+/**
+ * @brief Start a non-blocking all-reduce operation among the ranks of the global communicator.
+ * Bitwise and logical operations are not supported for floating point types.
+ *
+ * The arguments are the same as the ones of `collAllreduce()`.
+ *
+ * @return The request tracking the collective.
+ *
+ * @throw std::invalid_argument if the reduction operation is not supported for the data type.
+ */
+[[nodiscard]] LEGATE_EXPORT CollRequest collIallreduce(const void* sendbuf,
+                                                       void* recvbuf,
+                                                       int count,
+                                                       CollDataType type,
+                                                       ReductionOpKind op,
+                                                       CollComm global_comm);
 // NOLINTEND(readability-identifier-naming)
 
 }  // namespace legate::comm::coll
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <legate/comm/coll_comm.h>
+#include <legate/comm/detail/coll_request.h>
 
 #include <cstddef>
 #include <memory>
@@ -70,6 +71,177 @@ class BackendNetwork {
                           ReductionOpKind op,
                           legate::comm::coll::CollComm global_comm) = 0;
 
+  /**
+   * @brief Broadcast a buffer from the root rank to all other ranks.
+   *
+   * @param buf The buffer to send from (on the root) or receive into (on all other ranks). This
+   * buffer must be of size count x CollDataType size.
+   * @param count The number of elements to broadcast.
+   * @param type The data type of the elements.
+   * @param root The global rank to broadcast from.
+   * @param global_comm The global communicator.
+   */
+  virtual void broadcast(void* buf,
+                         int count,
+                         legate::comm::coll::CollDataType type,
+                         int root,
+                         legate::comm::coll::CollComm global_comm) = 0;
+
+  /**
+   * @brief Gather the send buffers of all ranks into the receive buffer of the root, in rank
+   * order.
+   *
+   * @param sendbuf The source buffer. This buffer must be of size count x CollDataType size.
+   * @param recvbuf The destination buffer, only used on the root. This buffer must be of size
+   * global_comm_size x count x CollDataType size, and must not alias `sendbuf`.
+   * @param count The number of elements each rank sends.
+   * @param type The data type of the elements.
+   * @param root The global rank to gather into.
+   * @param global_comm The global communicator.
+   */
+  virtual void gather(const void* sendbuf,
+                      void* recvbuf,
+                      int count,
+                      legate::comm::coll::CollDataType type,
+                      int root,
+                      legate::comm::coll::CollComm global_comm) = 0;
+
+  /**
+   * @brief Perform a reduction whose result is only delivered to the root.
+   *
+   * @param sendbuf The source buffer to reduce. This buffer must be of size count x CollDataType
+   * size.
+   * @param recvbuf The destination buffer, only used on the root. This buffer must be of size count
+   * x CollDataType size, and may alias `sendbuf`.
+   * @param count The number of elements to reduce.
+   * @param type The data type of the elements.
+   * @param op The reduction operation to perform.
+   * @param root The global rank to reduce into.
+   * @param global_comm The global communicator.
+   */
+  virtual void reduce(const void* sendbuf,
+                      void* recvbuf,
+                      int count,
+                      legate::comm::coll::CollDataType type,
+                      ReductionOpKind op,
+                      int root,
+                      legate::comm::coll::CollComm global_comm) = 0;
+
+  /**
+   * @brief Perform a reduction whose result is split into one block per rank, rank `i` receiving
+   * the elements `[i x recvcount, (i + 1) x recvcount)`.
+   *
+   * @param sendbuf The source buffer to reduce. This buffer must be of size global_comm_size x
+   * recvcount x CollDataType size.
+   * @param recvbuf The destination buffer. This buffer must be of size recvcount x CollDataType
+   * size, and must not alias `sendbuf`.
+   * @param recvcount The number of elements each rank receives.
+   * @param type The data type of the elements.
+   * @param op The reduction operation to perform.
+   * @param global_comm The global communicator.
+   */
+  virtual void reduce_scatter(const void* sendbuf,
+                              void* recvbuf,
+                              int recvcount,
+                              legate::comm::coll::CollDataType type,
+                              ReductionOpKind op,
+                              legate::comm::coll::CollComm global_comm) = 0;
+
+  /**
+   * @brief Start a non-blocking all-to-all-v operation.
+   *
+   * The buffers, as well as the count and displacement arrays, must stay alive and unmodified
+   * until the returned request has completed. Non-blocking collectives must be started in the
+   * same order on all ranks of the communicator.
+   *
+   * @param sendbuf The source buffer.
+   * @param sendcounts The number of elements to send to each rank.
+   * @param sdispls The offset (in elements) in `sendbuf` of the data sent to each rank.
+   * @param recvbuf The destination buffer, must not alias `sendbuf`.
+   * @param recvcounts The number of elements to receive from each rank.
+   * @param rdispls The offset (in elements) in `recvbuf` of the data received from each rank.
+   * @param type The data type of the elements.
+   * @param global_comm The global communicator.
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] virtual std::unique_ptr<CollRequest> iall_to_all_v(
+    const void* sendbuf,
+    const int sendcounts[],
+    const int sdispls[],
+    void* recvbuf,
+    const int recvcounts[],
+    const int rdispls[],
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm) = 0;
+
+  /**
+   * @brief Start a non-blocking all-to-all operation.
+   *
+   * See `iall_to_all_v()` for the lifetime and ordering requirements.
+   *
+   * @param sendbuf The source buffer. This buffer must be of size global_comm_size x count x
+   * CollDataType size.
+   * @param recvbuf The destination buffer, must not alias `sendbuf`. This buffer must be of size
+   * global_comm_size x count x CollDataType size.
+   * @param count The number of elements exchanged between each pair of ranks.
+   * @param type The data type of the elements.
+   * @param global_comm The global communicator.
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] virtual std::unique_ptr<CollRequest> iall_to_all(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm) = 0;
+
+  /**
+   * @brief Start a non-blocking all-gather operation.
+   *
+   * See `iall_to_all_v()` for the lifetime and ordering requirements.
+   *
+   * @param sendbuf The source buffer. This buffer must be of size count x CollDataType size.
+   * @param recvbuf The destination buffer. This buffer must be of size global_comm_size x count x
+   * CollDataType size.
+   * @param count The number of elements each rank contributes.
+   * @param type The data type of the elements.
+   * @param global_comm The global communicator.
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] virtual std::unique_ptr<CollRequest> iall_gather(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm) = 0;
+
+  /**
+   * @brief Start a non-blocking all-reduce operation.
+   *
+   * See `iall_to_all_v()` for the lifetime and ordering requirements.
+   *
+   * @param sendbuf The source buffer to reduce. This buffer must be of size count x CollDataType
+   * size.
+   * @param recvbuf The destination buffer to receive the reduced result into. This buffer must be
+   * of size count x CollDataType size, and may alias `sendbuf`.
+   * @param count The number of elements to reduce.
+   * @param type The data type of the elements.
+   * @param op The reduction operation to perform.
+   * @param global_comm The global communicator.
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] virtual std::unique_ptr<CollRequest> iall_reduce(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    ReductionOpKind op,
+    legate::comm::coll::CollComm global_comm) = 0;
+
   static void create_network(std::unique_ptr<BackendNetwork>&& network);
   [[nodiscard]] static std::unique_ptr<BackendNetwork>& get_network();
   [[nodiscard]] static bool has_network();
@@ -0,0 +1,20 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/comm/detail/coll_request.h>
+
+#include <thread>
+
+namespace legate::detail::comm::coll {
+
+void CollRequest::wait()
+{
+  while (!test()) {
+    std::this_thread::yield();
+  }
+}
+
+}  // namespace legate::detail::comm::coll
@@ -0,0 +1,43 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+namespace legate::detail::comm::coll {
+
+/**
+ * @brief The backend specific state of an in-flight non-blocking collective.
+ *
+ * Backends make progress on the collective whenever the request is tested or waited on, so the
+ * owner is expected to do either from time to time until the collective completes.
+ */
+class CollRequest {
+ public:
+  CollRequest()                              = default;
+  virtual ~CollRequest()                     = default;
+  CollRequest(const CollRequest&)            = delete;
+  CollRequest& operator=(const CollRequest&) = delete;
+  CollRequest(CollRequest&&)                 = delete;
+  CollRequest& operator=(CollRequest&&)      = delete;
+
+  /**
+   * @brief Make progress on the collective, without blocking.
+   *
+   * Once this has returned `true`, all subsequent calls return `true` as well.
+   *
+   * @return `true` if the collective has completed, `false` otherwise.
+   */
+  [[nodiscard]] virtual bool test() = 0;
+
+  /**
+   * @brief Block until the collective has completed.
+   *
+   * The default implementation polls `test()`.
+   */
+  virtual void wait();
+};
+
+}  // namespace legate::detail::comm::coll
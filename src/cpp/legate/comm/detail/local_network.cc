@@ -15,15 +15,108 @@
 #include <legate/utilities/detail/traced_exception.h>
 #include <legate/utilities/macros.h>
 
+#include <fmt/format.h>
+
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace legate::detail::comm::coll {
 
+namespace {
+
+// Balanced split of [0, count) into total_size contiguous slices, returns the start of the slice
+// of the given rank
+[[nodiscard]] std::int64_t slice_bound(int count, int rank, int total_size)
+{
+  return static_cast<std::int64_t>(count) * rank / total_size;
+}
+
+// A non-blocking collective is a sequence of steps, each of which a rank may only run once all
+// ranks are done with the previous one, the first step waiting for all ranks to publish their
+// buffers in the rendezvous. Once all ranks have run all steps, nobody reads from (or writes to)
+// anybody else's buffers anymore, and the collective is complete.
+class LocalRequest final : public CollRequest {
+ public:
+  using step_type = std::function<void()>;
+
+  // The caller must have published its buffers in the rendezvous
+  LocalRequest(std::shared_ptr<ThreadComm::Rendezvous> rendezvous,
+               std::vector<step_type> steps,
+               std::unique_ptr<char[]> inplace_buffer);
+
+  [[nodiscard]] bool test() override;
+
+ private:
+  std::shared_ptr<ThreadComm::Rendezvous> rendezvous_{};
+  std::vector<step_type> steps_{};
+  // Stands in for the send buffer of in-place collectives, until everybody is done reading it
+  std::unique_ptr<char[]> inplace_buffer_{};
+  std::size_t next_step_{};
+};
+
+LocalRequest::LocalRequest(std::shared_ptr<ThreadComm::Rendezvous> rendezvous,
+                           std::vector<step_type> steps,
+                           std::unique_ptr<char[]> inplace_buffer)
+  : rendezvous_{std::move(rendezvous)},
+    steps_{std::move(steps)},
+    inplace_buffer_{std::move(inplace_buffer)}
+{
+  rendezvous_->arrive();
+}
+
+bool LocalRequest::test()
+{
+  // Step i may run once every rank has arrived i + 1 times, i.e. published its buffers and run
+  // steps [0, i)
+  while (next_step_ < steps_.size()) {
+    if (!rendezvous_->reached(next_step_ + 1)) {
+      return false;
+    }
+    steps_[next_step_]();
+    ++next_step_;
+    rendezvous_->arrive();
+  }
+  return rendezvous_->reached(steps_.size() + 1);
+}
+
+// Reduce the elements [first, first + count) of the send buffers published in a rendezvous, in
+// rank order, into dst
+void reduce_rendezvous_block(ThreadComm::Rendezvous* rendezvous,
+                             int total_size,
+                             std::int64_t first,
+                             std::int64_t count,
+                             std::size_t type_extent,
+                             legate::comm::coll::CollDataType type,
+                             ReductionOpKind op,
+                             void* dst)
+{
+  if (count == 0) {
+    return;
+  }
+
+  const auto offset    = static_cast<std::ptrdiff_t>(first) * type_extent;
+  const auto block_src = [&](int source_rank) {
+    return static_cast<const char*>(rendezvous->buffers()[source_rank]) + offset;
+  };
+
+  std::memcpy(dst, block_src(0), static_cast<std::size_t>(count) * type_extent);
+  for (int source_rank = 1; source_rank < total_size; ++source_rank) {
+    apply_reduction(dst, block_src(source_rank), static_cast<std::size_t>(count), type, op);
+  }
+}
+
+}  // namespace
+
 // public functions start from here
 
-LocalNetwork::LocalNetwork()
+LocalNetwork::LocalNetwork(std::size_t all_reduce_slice_threshold, WaitStrategy wait_strategy)
+  : all_reduce_slice_threshold_{all_reduce_slice_threshold}, wait_strategy_{wait_strategy}
 {
   logger().debug() << "Enable LocalNetwork";
   LEGATE_CHECK(current_unique_id_ == 0);
@@ -65,11 +158,14 @@ void LocalNetwork::comm_create(legate::comm::coll::CollComm global_comm,
   global_comm->mpi_comm_size        = 1;
   global_comm->mpi_comm_size_actual = 1;
   global_comm->mpi_rank             = 0;
+
+  auto& thread_comm = thread_comms_[global_comm->unique_id];
+
   if (global_comm->global_rank == 0) {
-    thread_comms_[global_comm->unique_id]->init(global_comm->global_comm_size);
+    thread_comm->init(global_comm->global_comm_size, wait_strategy_);
   }
-  while (!thread_comms_[global_comm->unique_id]->ready()) {}
-  global_comm->local_comm = thread_comms_[global_comm->unique_id].get();
+  thread_comm->wait_until([&] { return thread_comm->ready(); });
+  global_comm->local_comm = thread_comm.get();
   barrier_local_(global_comm);
   LEGATE_CHECK(global_comm->local_comm->ready());
   global_comm->nb_threads = global_comm->global_comm_size;
@@ -104,11 +200,14 @@ void LocalNetwork::all_to_all_v(const void* sendbuf,
 
   loc_displs[global_rank]  = sdispls;
   loc_buffers[global_rank] = sendbuf;
+  global_comm->local_comm->notify();
   for (int i = 1; i < total_size + 1; i++) {
     const auto recvfrom_global_rank = (global_rank + total_size - i) % total_size;
     // wait for other threads to update the buffer address
-    while (loc_buffers[recvfrom_global_rank] == nullptr ||
-           loc_displs[recvfrom_global_rank] == nullptr) {}
+    global_comm->local_comm->wait_until([&] {
+      return loc_buffers[recvfrom_global_rank] != nullptr &&
+             loc_displs[recvfrom_global_rank] != nullptr;
+    });
 
     // NOLINTBEGIN(bugprone-casting-through-void)
     const auto* src_base =
@@ -152,10 +251,11 @@ void LocalNetwork::all_to_all(const void* sendbuf,
   auto* buffers              = global_comm->local_comm->buffers();
 
   buffers[global_rank] = sendbuf;
+  global_comm->local_comm->notify();
   for (int i = 1; i < total_size + 1; i++) {
     const auto recvfrom_global_rank = (global_rank + total_size - i) % total_size;
     // wait for other threads to update the buffer address
-    while (buffers[recvfrom_global_rank] == nullptr) {}
+    global_comm->local_comm->wait_until([&] { return buffers[recvfrom_global_rank] != nullptr; });
     src_base = buffers[recvfrom_global_rank];
     const auto* src =
       static_cast<const void*>(static_cast<const char*>(src_base) +
@@ -196,9 +296,10 @@ void LocalNetwork::all_gather(const void* sendbuf,
   }
 
   buffers[global_rank] = sendbuf_tmp;
+  global_comm->local_comm->notify();
   for (int recvfrom_global_rank = 0; recvfrom_global_rank < total_size; recvfrom_global_rank++) {
     // wait for other threads to update the buffer address
-    while (buffers[recvfrom_global_rank] == nullptr) {}
+    global_comm->local_comm->wait_until([&] { return buffers[recvfrom_global_rank] != nullptr; });
     const void* src = buffers[recvfrom_global_rank];
     char* dst =
       static_cast<char*>(recvbuf) + (static_cast<std::ptrdiff_t>(recvfrom_global_rank) * num_bytes);
@@ -227,22 +328,7 @@ void LocalNetwork::all_reduce(const void* sendbuf,
                               ReductionOpKind op,
                               legate::comm::coll::CollComm global_comm)
 {
-  switch (op) {
-    case legate::ReductionOpKind::ADD: [[fallthrough]];
-    case legate::ReductionOpKind::MUL: [[fallthrough]];
-    case legate::ReductionOpKind::MAX: [[fallthrough]];
-    case legate::ReductionOpKind::MIN: break;
-    case legate::ReductionOpKind::OR: [[fallthrough]];
-    case legate::ReductionOpKind::XOR: [[fallthrough]];
-    case legate::ReductionOpKind::AND:
-      if (type == legate::comm::coll::CollDataType::CollFloat ||
-          type == legate::comm::coll::CollDataType::CollDouble) {
-        throw legate::detail::TracedException<std::invalid_argument>{
-          "LocalNetwork::all_reduce does not support float or double reduction with bitwise "
-          "operations"};
-      }
-      break;
-  }
+  check_reduction_op(type, op, "LocalNetwork::all_reduce");
   LEGATE_CHECK(count >= 0);
 
   const auto total_size   = global_comm->global_comm_size;
@@ -256,31 +342,162 @@ void LocalNetwork::all_reduce(const void* sendbuf,
     sendbuf_tmp = allocate_inplace_buffer_(recvbuf, num_bytes);
   }
 
-  std::memcpy(recvbuf, sendbuf_tmp, num_bytes);
-  buffers[global_rank] = sendbuf_tmp;
+  if (total_size > 1 && num_bytes >= all_reduce_slice_threshold_) {
+    global_comm->local_comm->recv_buffers()[global_rank] = recvbuf;
+    buffers[global_rank]                                 = sendbuf_tmp;
+    global_comm->local_comm->notify();
+    all_reduce_sliced_(count, type, op, global_comm);
+  } else {
+    std::memcpy(recvbuf, sendbuf_tmp, num_bytes);
+    buffers[global_rank] = sendbuf_tmp;
+    global_comm->local_comm->notify();
+
+    // Wait for all threads to publish their buffers and then reduce data from each rank
+    for (int source_rank = 0; source_rank < total_size; source_rank++) {
+      if (source_rank == global_rank) {
+        continue;
+      }
+
+      // wait for other threads to update the buffer address
+      global_comm->local_comm->wait_until([&] { return buffers[source_rank] != nullptr; });
+      const void* src = buffers[source_rank];
+
+      if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
+        logger().debug() << "AllreduceLocal rank " << source_rank << " === global_rank "
+                         << global_rank << ", dtype " << type_extent << ", reduce from rank "
+                         << source_rank << " (" << src << ") to rank " << global_rank << " ("
+                         << recvbuf << ')';
+      }
 
-  // Wait for all threads to publish their buffers and then reduce data from each rank
-  for (int source_rank = 0; source_rank < total_size; source_rank++) {
-    if (source_rank == global_rank) {
-      continue;
+      apply_reduction(recvbuf, src, static_cast<std::size_t>(count), type, op);
     }
+  }
 
-    // wait for other threads to update the buffer address
-    while (buffers[source_rank] == nullptr) {}
-    const void* src = buffers[source_rank];
+  barrier_local_(global_comm);
+  if (sendbuf == recvbuf) {
+    delete_inplace_buffer_(const_cast<void*>(sendbuf_tmp), num_bytes);
+  }
+  __sync_synchronize();
+  reset_local_buffer_(global_comm);
+  barrier_local_(global_comm);
+}
+
+void LocalNetwork::broadcast(void* buf,
+                             int count,
+                             legate::comm::coll::CollDataType type,
+                             int root,
+                             legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(count >= 0);
+  const auto global_rank = global_comm->global_rank;
+  const auto type_extent = get_dtype_size_(type);
+  const auto num_bytes   = type_extent * static_cast<std::size_t>(count);
+  auto* buffers          = global_comm->local_comm->buffers();
+
+  if (global_rank == root) {
+    buffers[global_rank] = buf;
+    global_comm->local_comm->notify();
+  } else {
+    // wait for the root to publish its buffer
+    global_comm->local_comm->wait_until([&] { return buffers[root] != nullptr; });
+    const void* src = buffers[root];
 
     if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
-      logger().debug() << "AllreduceLocal rank " << source_rank << " === global_rank "
-                       << global_rank << ", dtype " << type_extent << ", reduce from rank "
-                       << source_rank << " (" << src << ") to rank " << global_rank << " ("
-                       << recvbuf << ')';
+      logger().debug() << "BcastLocal: global_rank " << global_rank << ", dtype " << type_extent
+                       << ", copy root " << root << " (" << src << ") to rank " << global_rank
+                       << " (" << buf << ')';
     }
+    std::memcpy(buf, src, num_bytes);
+  }
 
-    apply_reduction_(recvbuf, src, count, type, op);
+  barrier_local_(global_comm);
+  __sync_synchronize();
+  reset_local_buffer_(global_comm);
+  barrier_local_(global_comm);
+}
+
+void LocalNetwork::gather(const void* sendbuf,
+                          void* recvbuf,
+                          int count,
+                          legate::comm::coll::CollDataType type,
+                          int root,
+                          legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(count >= 0);
+  const auto global_rank = global_comm->global_rank;
+  const auto type_extent = get_dtype_size_(type);
+  const auto num_bytes   = type_extent * static_cast<std::size_t>(count);
+  auto* recv_buffers     = global_comm->local_comm->recv_buffers();
+
+  if (global_rank == root) {
+    recv_buffers[global_rank] = recvbuf;
+    global_comm->local_comm->notify();
   }
+  // wait for the root to publish its buffer
+  global_comm->local_comm->wait_until([&] { return recv_buffers[root] != nullptr; });
+  auto* dst = static_cast<char*>(recv_buffers[root].load()) +
+              (static_cast<std::ptrdiff_t>(global_rank) * num_bytes);
+
+  if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
+    logger().debug() << "GatherLocal: global_rank " << global_rank << ", dtype " << type_extent
+                     << ", copy rank " << global_rank << " (" << sendbuf << ") to root " << root
+                     << " (" << static_cast<void*>(dst) << ')';
+  }
+  std::memcpy(dst, sendbuf, num_bytes);
 
   barrier_local_(global_comm);
-  if (sendbuf == recvbuf) {
+  __sync_synchronize();
+  reset_local_buffer_(global_comm);
+  barrier_local_(global_comm);
+}
+
+void LocalNetwork::reduce(const void* sendbuf,
+                          void* recvbuf,
+                          int count,
+                          legate::comm::coll::CollDataType type,
+                          ReductionOpKind op,
+                          int root,
+                          legate::comm::coll::CollComm global_comm)
+{
+  check_reduction_op(type, op, "LocalNetwork::reduce");
+  LEGATE_CHECK(count >= 0);
+
+  const auto total_size   = global_comm->global_comm_size;
+  const auto global_rank  = global_comm->global_rank;
+  const auto type_extent  = get_dtype_size_(type);
+  const auto num_bytes    = type_extent * static_cast<std::size_t>(count);
+  const auto inplace      = global_rank == root && sendbuf == recvbuf;
+  const auto* sendbuf_tmp = sendbuf;
+  auto* recv_buffers      = global_comm->local_comm->recv_buffers();
+
+  if (inplace) {
+    sendbuf_tmp = allocate_inplace_buffer_(recvbuf, num_bytes);
+  }
+  if (global_rank == root) {
+    recv_buffers[global_rank] = recvbuf;
+  }
+  global_comm->local_comm->buffers()[global_rank] = sendbuf_tmp;
+  global_comm->local_comm->notify();
+
+  if (total_size > 1 && num_bytes >= all_reduce_slice_threshold_) {
+    const auto slice_lo    = slice_bound(count, global_rank, total_size);
+    const auto slice_count = slice_bound(count, global_rank + 1, total_size) - slice_lo;
+
+    // wait for the root to publish its buffer
+    global_comm->local_comm->wait_until([&] { return recv_buffers[root] != nullptr; });
+    reduce_block_(slice_lo,
+                  slice_count,
+                  type,
+                  op,
+                  static_cast<char*>(recv_buffers[root].load()) +
+                    (static_cast<std::ptrdiff_t>(slice_lo) * type_extent),
+                  global_comm);
+  } else if (global_rank == root) {
+    reduce_block_(0, count, type, op, recvbuf, global_comm);
+  }
+
+  barrier_local_(global_comm);
+  if (inplace) {
     delete_inplace_buffer_(const_cast<void*>(sendbuf_tmp), num_bytes);
   }
   __sync_synchronize();
@@ -288,6 +505,198 @@ void LocalNetwork::all_reduce(const void* sendbuf,
   barrier_local_(global_comm);
 }
 
+void LocalNetwork::reduce_scatter(const void* sendbuf,
+                                  void* recvbuf,
+                                  int recvcount,
+                                  legate::comm::coll::CollDataType type,
+                                  ReductionOpKind op,
+                                  legate::comm::coll::CollComm global_comm)
+{
+  check_reduction_op(type, op, "LocalNetwork::reduce_scatter");
+  LEGATE_CHECK(recvcount >= 0);
+
+  const auto global_rank = global_comm->global_rank;
+
+  global_comm->local_comm->buffers()[global_rank] = sendbuf;
+  global_comm->local_comm->notify();
+  reduce_block_(static_cast<std::int64_t>(global_rank) * recvcount,
+                recvcount,
+                type,
+                op,
+                recvbuf,
+                global_comm);
+
+  barrier_local_(global_comm);
+  __sync_synchronize();
+  reset_local_buffer_(global_comm);
+  barrier_local_(global_comm);
+}
+
+std::unique_ptr<CollRequest> LocalNetwork::iall_to_all_v(const void* sendbuf,
+                                                          const int /*sendcounts*/[],
+                                                          const int sdispls[],
+                                                          void* recvbuf,
+                                                          const int recvcounts[],
+                                                          const int rdispls[],
+                                                          legate::comm::coll::CollDataType type,
+                                                          legate::comm::coll::CollComm global_comm)
+{
+  const auto total_size  = global_comm->global_comm_size;
+  const auto global_rank = global_comm->global_rank;
+  const auto type_extent = get_dtype_size_(type);
+  auto rendezvous        = global_comm->local_comm->next_rendezvous(global_rank);
+  auto* const rdv        = rendezvous.get();
+
+  rdv->buffers()[global_rank] = sendbuf;
+  rdv->displs()[global_rank]  = sdispls;
+
+  auto exchange = [=] {
+    for (int i = 1; i < total_size + 1; i++) {
+      const auto src_rank  = (global_rank + total_size - i) % total_size;
+      const auto src_displ = static_cast<std::ptrdiff_t>(rdv->displs()[src_rank][global_rank]);
+      const auto dst_displ = static_cast<std::ptrdiff_t>(rdispls[src_rank]);
+
+      std::memcpy(static_cast<char*>(recvbuf) + (dst_displ * type_extent),
+                  static_cast<const char*>(rdv->buffers()[src_rank]) + (src_displ * type_extent),
+                  recvcounts[src_rank] * type_extent);
+    }
+  };
+
+  return std::make_unique<LocalRequest>(
+    std::move(rendezvous), std::vector<LocalRequest::step_type>{std::move(exchange)}, nullptr);
+}
+
+std::unique_ptr<CollRequest> LocalNetwork::iall_to_all(const void* sendbuf,
+                                                        void* recvbuf,
+                                                        int count,
+                                                        legate::comm::coll::CollDataType type,
+                                                        legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(count >= 0);
+  const auto total_size  = global_comm->global_comm_size;
+  const auto global_rank = global_comm->global_rank;
+  const auto num_bytes   = get_dtype_size_(type) * static_cast<std::size_t>(count);
+  auto rendezvous        = global_comm->local_comm->next_rendezvous(global_rank);
+  auto* const rdv        = rendezvous.get();
+
+  rdv->buffers()[global_rank] = sendbuf;
+
+  auto exchange = [=] {
+    // This rank's segment sits at the same offset in everybody's send buffer
+    const auto src_offset = static_cast<std::size_t>(global_rank) * num_bytes;
+
+    for (int i = 1; i < total_size + 1; i++) {
+      const auto src_rank = (global_rank + total_size - i) % total_size;
+
+      std::memcpy(static_cast<char*>(recvbuf) + (static_cast<std::size_t>(src_rank) * num_bytes),
+                  static_cast<const char*>(rdv->buffers()[src_rank]) + src_offset,
+                  num_bytes);
+    }
+  };
+
+  return std::make_unique<LocalRequest>(
+    std::move(rendezvous), std::vector<LocalRequest::step_type>{std::move(exchange)}, nullptr);
+}
+
+std::unique_ptr<CollRequest> LocalNetwork::iall_gather(const void* sendbuf,
+                                                        void* recvbuf,
+                                                        int count,
+                                                        legate::comm::coll::CollDataType type,
+                                                        legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(count >= 0);
+  const auto total_size  = global_comm->global_comm_size;
+  const auto global_rank = global_comm->global_rank;
+  const auto num_bytes   = get_dtype_size_(type) * static_cast<std::size_t>(count);
+  auto rendezvous        = global_comm->local_comm->next_rendezvous(global_rank);
+  auto* const rdv        = rendezvous.get();
+  std::unique_ptr<char[]> inplace_buffer{};
+
+  // MPI_IN_PLACE
+  if (sendbuf == recvbuf) {
+    inplace_buffer.reset(static_cast<char*>(allocate_inplace_buffer_(recvbuf, num_bytes)));
+    sendbuf = inplace_buffer.get();
+  }
+  rdv->buffers()[global_rank] = sendbuf;
+
+  auto exchange = [=] {
+    for (int src_rank = 0; src_rank < total_size; src_rank++) {
+      std::memcpy(static_cast<char*>(recvbuf) + (static_cast<std::size_t>(src_rank) * num_bytes),
+                  rdv->buffers()[src_rank],
+                  num_bytes);
+    }
+  };
+
+  return std::make_unique<LocalRequest>(std::move(rendezvous),
+                                        std::vector<LocalRequest::step_type>{std::move(exchange)},
+                                        std::move(inplace_buffer));
+}
+
+std::unique_ptr<CollRequest> LocalNetwork::iall_reduce(const void* sendbuf,
+                                                        void* recvbuf,
+                                                        int count,
+                                                        legate::comm::coll::CollDataType type,
+                                                        ReductionOpKind op,
+                                                        legate::comm::coll::CollComm global_comm)
+{
+  check_reduction_op(type, op, "LocalNetwork::iall_reduce");
+  LEGATE_CHECK(count >= 0);
+
+  const auto total_size  = global_comm->global_comm_size;
+  const auto global_rank = global_comm->global_rank;
+  const auto type_extent = get_dtype_size_(type);
+  const auto num_bytes   = type_extent * static_cast<std::size_t>(count);
+  auto rendezvous        = global_comm->local_comm->next_rendezvous(global_rank);
+  auto* const rdv        = rendezvous.get();
+  std::unique_ptr<char[]> inplace_buffer{};
+  std::vector<LocalRequest::step_type> steps{};
+
+  if (sendbuf == recvbuf) {
+    inplace_buffer.reset(static_cast<char*>(allocate_inplace_buffer_(recvbuf, num_bytes)));
+    sendbuf = inplace_buffer.get();
+  }
+  rdv->buffers()[global_rank]      = sendbuf;
+  rdv->recv_buffers()[global_rank] = recvbuf;
+
+  if (total_size > 1 && num_bytes >= all_reduce_slice_threshold_) {
+    // Every rank reduces its own slice into its receive buffer, and then collects the slices
+    // reduced by the others from theirs
+    const auto slice_offset = [=](int rank) {
+      return static_cast<std::ptrdiff_t>(slice_bound(count, rank, total_size)) * type_extent;
+    };
+
+    steps.emplace_back([=] {
+      const auto slice_lo = slice_bound(count, global_rank, total_size);
+
+      reduce_rendezvous_block(rdv,
+                              total_size,
+                              slice_lo,
+                              slice_bound(count, global_rank + 1, total_size) - slice_lo,
+                              type_extent,
+                              type,
+                              op,
+                              static_cast<char*>(recvbuf) + slice_offset(global_rank));
+    });
+    steps.emplace_back([=] {
+      for (int i = 1; i < total_size; ++i) {
+        const auto src_rank = (global_rank + i) % total_size;
+        const auto offset   = slice_offset(src_rank);
+
+        std::memcpy(static_cast<char*>(recvbuf) + offset,
+                    static_cast<const char*>(rdv->recv_buffers()[src_rank]) + offset,
+                    static_cast<std::size_t>(slice_offset(src_rank + 1) - offset));
+      }
+    });
+  } else {
+    steps.emplace_back([=] {
+      reduce_rendezvous_block(rdv, total_size, 0, count, type_extent, type, op, recvbuf);
+    });
+  }
+
+  return std::make_unique<LocalRequest>(
+    std::move(rendezvous), std::move(steps), std::move(inplace_buffer));
+}
+
 // protected functions start from here
 
 std::size_t LocalNetwork::get_dtype_size_(legate::comm::coll::CollDataType dtype)
@@ -322,54 +731,78 @@ std::size_t LocalNetwork::get_dtype_size_(legate::comm::coll::CollDataType dtype
   LEGATE_ABORT("Unknown datatype");
 }
 
-void LocalNetwork::apply_reduction_(
-  void* dst, const void* src, int count, legate::comm::coll::CollDataType type, ReductionOpKind op)
+void LocalNetwork::reduce_block_(std::int64_t first,
+                                 std::int64_t count,
+                                 legate::comm::coll::CollDataType type,
+                                 ReductionOpKind op,
+                                 void* dst,
+                                 legate::comm::coll::CollComm global_comm)
 {
-  switch (type) {
-    case legate::comm::coll::CollDataType::CollInt8: {
-      apply_reduction_typed<std::int8_t>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollChar: {
-      apply_reduction_typed<char>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollUint8: {
-      apply_reduction_typed<std::uint8_t>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollInt: {
-      apply_reduction_typed<int>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollUint32: {
-      apply_reduction_typed<std::uint32_t>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollInt64: {
-      apply_reduction_typed<std::int64_t>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollUint64: {
-      apply_reduction_typed<std::uint64_t>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollFloat: {
-      apply_reduction_typed<float>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollDouble: {
-      apply_reduction_typed<double>(dst, src, count, op);
-      break;
+  if (count == 0) {
+    return;
+  }
+
+  const auto total_size  = global_comm->global_comm_size;
+  const auto type_extent = get_dtype_size_(type);
+  const auto offset      = static_cast<std::ptrdiff_t>(first) * type_extent;
+  auto* buffers          = global_comm->local_comm->buffers();
+  const auto block_src   = [&](int source_rank) {
+    // wait for other threads to update the buffer address
+    global_comm->local_comm->wait_until([&] { return buffers[source_rank] != nullptr; });
+    return static_cast<const char*>(buffers[source_rank].load()) + offset;
+  };
+
+  std::memcpy(dst, block_src(0), static_cast<std::size_t>(count) * type_extent);
+  for (int source_rank = 1; source_rank < total_size; ++source_rank) {
+    if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
+      logger().debug() << "ReduceLocal rank " << source_rank << " === global_rank "
+                       << global_comm->global_rank << ", dtype " << type_extent
+                       << ", reduce elements [" << first << ", " << first + count << ")";
     }
+    apply_reduction(dst, block_src(source_rank), static_cast<std::size_t>(count), type, op);
+  }
+}
+
+void LocalNetwork::all_reduce_sliced_(int count,
+                                      legate::comm::coll::CollDataType type,
+                                      ReductionOpKind op,
+                                      legate::comm::coll::CollComm global_comm)
+{
+  const auto total_size   = global_comm->global_comm_size;
+  const auto global_rank  = global_comm->global_rank;
+  const auto type_extent  = get_dtype_size_(type);
+  auto* recv_buffers      = global_comm->local_comm->recv_buffers();
+  const auto slice_lo     = slice_bound(count, global_rank, total_size);
+  const auto slice_count  = slice_bound(count, global_rank + 1, total_size) - slice_lo;
+  const auto slice_offset = static_cast<std::ptrdiff_t>(slice_lo) * type_extent;
+  const auto slice_bytes  = static_cast<std::size_t>(slice_count) * type_extent;
+  auto* const slice_dst   = static_cast<char*>(recv_buffers[global_rank].load()) + slice_offset;
+
+  if (slice_count == 0) {
+    return;
+  }
+
+  // Every rank's slice is reduced in the same (rank) order by a single thread, so all ranks end up
+  // with bitwise identical results, even for floating point reductions
+  reduce_block_(slice_lo, slice_count, type, op, slice_dst, global_comm);
+
+  // Gather phase, pushing the reduced slice into everybody else's receive buffer
+  for (int i = 1; i < total_size; ++i) {
+    const auto dest_rank = (global_rank + i) % total_size;
+
+    global_comm->local_comm->wait_until([&] { return recv_buffers[dest_rank] != nullptr; });
+    std::memcpy(static_cast<char*>(recv_buffers[dest_rank].load()) + slice_offset,
+                slice_dst,
+                slice_bytes);
   }
 }
 
 void LocalNetwork::reset_local_buffer_(legate::comm::coll::CollComm global_comm)
 {
-  const auto global_rank                          = global_comm->global_rank;
-  global_comm->local_comm->buffers()[global_rank] = nullptr;
-  global_comm->local_comm->displs()[global_rank]  = nullptr;
+  const auto global_rank                               = global_comm->global_rank;
+  global_comm->local_comm->buffers()[global_rank]      = nullptr;
+  global_comm->local_comm->recv_buffers()[global_rank] = nullptr;
+  global_comm->local_comm->displs()[global_rank]       = nullptr;
 }
 
 void LocalNetwork::barrier_local_(legate::comm::coll::CollComm global_comm)
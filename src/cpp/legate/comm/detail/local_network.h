@@ -8,7 +8,10 @@
 
 #include <legate/comm/detail/backend_network.h>
 #include <legate/comm/detail/thread_comm.h>
+#include <legate/comm/detail/wait_strategy.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -16,7 +19,23 @@ namespace legate::detail::comm::coll {
 
 class LocalNetwork : public BackendNetwork {
  public:
-  LocalNetwork();
+  /**
+   * @brief Default message size (in bytes) from which all-reduce switches to the sliced
+   * (reduce-scatter followed by all-gather) algorithm.
+   */
+  static constexpr std::size_t DEFAULT_ALL_REDUCE_SLICE_THRESHOLD = 64 * 1024;
+
+  /**
+   * @brief Construct a LocalNetwork.
+   *
+   * @param all_reduce_slice_threshold Message size (in bytes) from which all-reduce uses the
+   * sliced algorithm, in which each rank reduces only its share of the buffer.
+   * @param wait_strategy How the ranks of the communicators created by this network wait for each
+   * other, unless changed for an individual communicator through its ThreadComm.
+   */
+  explicit LocalNetwork(
+    std::size_t all_reduce_slice_threshold = DEFAULT_ALL_REDUCE_SLICE_THRESHOLD,
+    WaitStrategy wait_strategy             = WaitStrategy::BLOCK);
 
   ~LocalNetwork() override;
 
@@ -55,6 +74,11 @@ class LocalNetwork : public BackendNetwork {
    * @brief Perform an all-reduce operation among the ranks of the global communicator using local
    * memory reductions.
    *
+   * Small messages are reduced in full by every rank. Messages of at least
+   * `all_reduce_slice_threshold` bytes are split into one slice per rank, each rank reduces its
+   * own slice across all peers and writes the result into every rank's receive buffer. This keeps
+   * the work and memory traffic per rank at O(count) instead of O(count x ranks).
+   *
    * @param sendbuf The source buffer to reduce. This buffer must be of size count x CollDataType
    * size.
    * @param recvbuf The destination buffer to receive the reduced result into. This buffer must be
@@ -71,22 +95,180 @@ class LocalNetwork : public BackendNetwork {
                   ReductionOpKind op,
                   legate::comm::coll::CollComm global_comm) override;
 
+  void broadcast(void* buf,
+                 int count,
+                 legate::comm::coll::CollDataType type,
+                 int root,
+                 legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Gather the send buffers of all ranks into the receive buffer of the root.
+   *
+   * Every rank copies its own contribution straight into the root's receive buffer, so the copies
+   * proceed in parallel instead of being serialized on the root.
+   *
+   * @param sendbuf The source buffer. This buffer must be of size count x CollDataType size.
+   * @param recvbuf The destination buffer, only used on the root. This buffer must be of size
+   * global_comm_size x count x CollDataType size.
+   * @param count The number of elements each rank sends.
+   * @param type The data type of the elements.
+   * @param root The global rank to gather into.
+   * @param global_comm The global communicator.
+   */
+  void gather(const void* sendbuf,
+              void* recvbuf,
+              int count,
+              legate::comm::coll::CollDataType type,
+              int root,
+              legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Perform a reduction whose result is only delivered to the root.
+   *
+   * Messages of at least `all_reduce_slice_threshold` bytes are split into one slice per rank,
+   * each rank reducing its own slice directly into the root's receive buffer. Smaller messages are
+   * reduced by the root alone.
+   *
+   * @param sendbuf The source buffer to reduce. This buffer must be of size count x CollDataType
+   * size.
+   * @param recvbuf The destination buffer, only used on the root. This buffer must be of size count
+   * x CollDataType size.
+   * @param count The number of elements to reduce.
+   * @param type The data type of the elements.
+   * @param op The reduction operation to perform.
+   * @param root The global rank to reduce into.
+   * @param global_comm The global communicator.
+   */
+  void reduce(const void* sendbuf,
+              void* recvbuf,
+              int count,
+              legate::comm::coll::CollDataType type,
+              ReductionOpKind op,
+              int root,
+              legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Perform a reduce-scatter, each rank reducing its own block of all published send
+   * buffers into its receive buffer.
+   *
+   * @param sendbuf The source buffer to reduce. This buffer must be of size global_comm_size x
+   * recvcount x CollDataType size.
+   * @param recvbuf The destination buffer. This buffer must be of size recvcount x CollDataType
+   * size.
+   * @param recvcount The number of elements each rank receives.
+   * @param type The data type of the elements.
+   * @param op The reduction operation to perform.
+   * @param global_comm The global communicator.
+   */
+  void reduce_scatter(const void* sendbuf,
+                      void* recvbuf,
+                      int recvcount,
+                      legate::comm::coll::CollDataType type,
+                      ReductionOpKind op,
+                      legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Start a non-blocking all-to-all-v operation.
+   *
+   * The collective is driven forward by the ranks testing or waiting on their requests: every
+   * rank publishes its buffers when it starts the collective, and copies its share out of the
+   * peers' buffers on the first test after all of them have been published.
+   *
+   * @param sendbuf The source buffer.
+   * @param sendcounts The number of elements to send to each rank.
+   * @param sdispls The offset (in elements) in `sendbuf` of the data sent to each rank.
+   * @param recvbuf The destination buffer, must not alias `sendbuf`.
+   * @param recvcounts The number of elements to receive from each rank.
+   * @param rdispls The offset (in elements) in `recvbuf` of the data received from each rank.
+   * @param type The data type of the elements.
+   * @param global_comm The global communicator.
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_to_all_v(
+    const void* sendbuf,
+    const int sendcounts[],
+    const int sdispls[],
+    void* recvbuf,
+    const int recvcounts[],
+    const int rdispls[],
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm) override;
+
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_to_all(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm) override;
+
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_gather(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Start a non-blocking all-reduce operation.
+   *
+   * Like `all_reduce()`, messages of at least `all_reduce_slice_threshold` bytes are reduced one
+   * slice per rank, in which case the ranks go through one more round of tests: one to reduce
+   * their own slice, and one to collect the slices reduced by their peers.
+   *
+   * @param sendbuf The source buffer to reduce. This buffer must be of size count x CollDataType
+   * size.
+   * @param recvbuf The destination buffer to receive the reduced result into. This buffer must be
+   * of size count x CollDataType size.
+   * @param count The number of elements to reduce.
+   * @param type The data type of the elements.
+   * @param op The reduction operation to perform.
+   * @param global_comm The global communicator.
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_reduce(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    ReductionOpKind op,
+    legate::comm::coll::CollComm global_comm) override;
+
  protected:
   [[nodiscard]] static std::size_t get_dtype_size_(legate::comm::coll::CollDataType dtype);
 
-  /** @brief Apply a reduction operation for each index in destination and source buffer. Store
-   * result in destination buffer.
+  /**
+   * @brief Reduce the elements `[first, first + count)` of the published send buffers of all
+   * ranks, in rank order, into `dst`.
    *
-   * @param dst Destination buffer (also serves as one input, modified in-place).
-   * @param src Source buffer.
-   * @param count Number of elements.
-   * @param op Reduction operation to apply.
+   * @param first The index of the first element to reduce.
+   * @param count The number of elements to reduce.
+   * @param type The data type of the elements.
+   * @param op The reduction operation to perform.
+   * @param dst The buffer to store the `count` reduced elements into.
+   * @param global_comm The global communicator.
+   */
+  static void reduce_block_(std::int64_t first,
+                            std::int64_t count,
+                            legate::comm::coll::CollDataType type,
+                            ReductionOpKind op,
+                            void* dst,
+                            legate::comm::coll::CollComm global_comm);
+
+  /**
+   * @brief Reduce this rank's slice of the published send buffers, and scatter the result into
+   * every rank's receive buffer.
+   *
+   * @param count The total number of elements being reduced.
+   * @param type The data type of the elements.
+   * @param op The reduction operation to perform.
+   * @param global_comm The global communicator.
    */
-  static void apply_reduction_(void* dst,
-                               const void* src,
-                               int count,
-                               legate::comm::coll::CollDataType type,
-                               ReductionOpKind op);
+  static void all_reduce_sliced_(int count,
+                                 legate::comm::coll::CollDataType type,
+                                 ReductionOpKind op,
+                                 legate::comm::coll::CollComm global_comm);
 
   void reset_local_buffer_(legate::comm::coll::CollComm global_comm);
 
@@ -94,6 +276,8 @@ class LocalNetwork : public BackendNetwork {
 
  private:
   std::vector<std::unique_ptr<ThreadComm>> thread_comms_{};
+  std::size_t all_reduce_slice_threshold_{};
+  WaitStrategy wait_strategy_{};
 };
 
 }  // namespace legate::detail::comm::coll
@@ -19,6 +19,7 @@
 #include <fmt/std.h>
 
 #include <cctype>
+#include <cstdint>
 #include <filesystem>
 #include <iterator>
 #include <legate_mpi_wrapper/mpi_wrapper.h>
@@ -34,6 +35,7 @@ class MPIInterface::Impl {
   using MPI_Datatype = MPIInterface::MPI_Datatype;
   using MPI_Aint     = MPIInterface::MPI_Aint;
   using MPI_Status   = MPIInterface::MPI_Status;
+  using MPI_Request  = MPIInterface::MPI_Request;
 
   Impl();
 
@@ -91,9 +93,15 @@ class MPIInterface::Impl {
                       MPI_Comm,
                       MPI_Status*)                                           = nullptr;
 
+  int (*mpi_isend)(const void*, int, MPI_Datatype, int, int, MPI_Comm, MPI_Request*) = nullptr;
+  int (*mpi_irecv)(void*, int, MPI_Datatype, int, int, MPI_Comm, MPI_Request*)       = nullptr;
+  int (*mpi_waitall)(int, MPI_Request*)                                              = nullptr;
+  int (*mpi_testall)(int, MPI_Request*, int*)                                        = nullptr;
+
  private:
   [[nodiscard]] static std::filesystem::path get_wrapper_path_();
   [[nodiscard]] static SharedLibrary load_handle_();
+  void check_version_() const;
   void load_wrapper_();
 
   SharedLibrary lib_;
@@ -127,6 +135,11 @@ class LEGATE_EXPORT HandleLoadError : public std::invalid_argument {
   using std::invalid_argument::invalid_argument;
 };
 
+class LEGATE_EXPORT WrapperVersionError : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
 }  // namespace
 
 /*static*/ std::filesystem::path MPIInterface::Impl::get_wrapper_path_()
@@ -166,6 +179,46 @@ class LEGATE_EXPORT HandleLoadError : public std::invalid_argument {
   }
 }
 
+void MPIInterface::Impl::check_version_() const
+{
+  constexpr auto REQUIRED_MAJOR = std::int32_t{LEGATE_MPI_WRAPPER_VERSION_MAJOR};
+  constexpr auto REQUIRED_MINOR = std::int32_t{LEGATE_MPI_WRAPPER_VERSION_MINOR};
+  const auto rebuild_hint       = [&] {
+    return fmt::format(
+      "Legate requires version {}.{} of the MPI wrapper. Rebuild and reinstall the wrapper "
+      "from the share/legate/mpi_wrapper directory of this Legate installation (see "
+      "install.bash there), or point {} at an up to date build of it.",
+      REQUIRED_MAJOR,
+      REQUIRED_MINOR,
+      LEGATE_MPI_WRAPPER.data());
+  };
+  void (*version_fn)(std::int32_t*, std::int32_t*) = nullptr;
+
+  try {
+    lib_.load_symbol_into("legate_mpi_wrapper_version", &version_fn);
+  } catch (const std::invalid_argument&) {
+    // Versions before 1.1 did not export their version
+    throw legate::detail::TracedException<WrapperVersionError>{
+      fmt::format("MPI wrapper '{}' is too old (version 1.0). {}",
+                  lib_.handle_path(),
+                  rebuild_hint())};
+  }
+
+  std::int32_t major = 0;
+  std::int32_t minor = 0;
+
+  version_fn(&major, &minor);
+  // New functions only bump the minor version, so newer wrappers of the same major version work
+  if (major != REQUIRED_MAJOR || minor < REQUIRED_MINOR) {
+    throw legate::detail::TracedException<WrapperVersionError>{
+      fmt::format("MPI wrapper '{}' has incompatible version {}.{}. {}",
+                  lib_.handle_path(),
+                  major,
+                  minor,
+                  rebuild_hint())};
+  }
+}
+
 void MPIInterface::Impl::load_wrapper_()
 {
 #define LEGATE_LOAD_FN(dest, src)                                                       \
@@ -210,6 +263,10 @@ void MPIInterface::Impl::load_wrapper_()
   LEGATE_LOAD_FN(mpi_bcast, legate_mpi_bcast);
   LEGATE_LOAD_FN(mpi_send, legate_mpi_send);
   LEGATE_LOAD_FN(mpi_recv, legate_mpi_recv);
+  LEGATE_LOAD_FN(mpi_isend, legate_mpi_isend);
+  LEGATE_LOAD_FN(mpi_irecv, legate_mpi_irecv);
+  LEGATE_LOAD_FN(mpi_waitall, legate_mpi_waitall);
+  LEGATE_LOAD_FN(mpi_testall, legate_mpi_testall);
   LEGATE_LOAD_FN(mpi_sendrecv, legate_mpi_sendrecv);
 
 #undef LEGATE_LOAD_FN
@@ -217,7 +274,11 @@ void MPIInterface::Impl::load_wrapper_()
 
 // ==========================================================================================
 
-MPIInterface::Impl::Impl() : lib_{load_handle_()} { load_wrapper_(); }
+MPIInterface::Impl::Impl() : lib_{load_handle_()}
+{
+  check_version_();
+  load_wrapper_();
+}
 
 // ==========================================================================================
 
@@ -401,6 +462,38 @@ MPIInterface::Impl::Impl() : lib_{load_handle_()} { load_wrapper_(); }
   return get_interface_().mpi_recv(buf, count, datatype, source, tag, comm, status);
 }
 
+/*static*/ int MPIInterface::mpi_isend(const void* buf,
+                                       int count,
+                                       MPIInterface::MPI_Datatype datatype,
+                                       int dest,
+                                       int tag,
+                                       MPIInterface::MPI_Comm comm,
+                                       MPIInterface::MPI_Request* request)
+{
+  return get_interface_().mpi_isend(buf, count, datatype, dest, tag, comm, request);
+}
+
+/*static*/ int MPIInterface::mpi_irecv(void* buf,
+                                       int count,
+                                       MPIInterface::MPI_Datatype datatype,
+                                       int source,
+                                       int tag,
+                                       MPIInterface::MPI_Comm comm,
+                                       MPIInterface::MPI_Request* request)
+{
+  return get_interface_().mpi_irecv(buf, count, datatype, source, tag, comm, request);
+}
+
+/*static*/ int MPIInterface::mpi_waitall(int count, MPIInterface::MPI_Request* requests)
+{
+  return get_interface_().mpi_waitall(count, requests);
+}
+
+/*static*/ int MPIInterface::mpi_testall(int count, MPIInterface::MPI_Request* requests, int* flag)
+{
+  return get_interface_().mpi_testall(count, requests, flag);
+}
+
 /*static*/ int MPIInterface::mpi_sendrecv(const void* sendbuf,
                                           int sendcount,
                                           MPIInterface::MPI_Datatype sendtype,
@@ -25,6 +25,7 @@ class MPIInterface {
   using MPI_Datatype = Legate_MPI_Datatype;
   using MPI_Aint     = Legate_MPI_Aint;
   using MPI_Status   = Legate_MPI_Status;
+  using MPI_Request  = Legate_MPI_Request;
 
   // NOLINTBEGIN(readability-identifier-naming)
   static MPI_Comm MPI_COMM_WORLD();
@@ -74,6 +75,22 @@ class MPIInterface {
                       int tag,
                       MPI_Comm comm,
                       MPI_Status* status);
+  static int mpi_isend(const void* buf,
+                       int count,
+                       MPI_Datatype datatype,
+                       int dest,
+                       int tag,
+                       MPI_Comm comm,
+                       MPI_Request* request);
+  static int mpi_irecv(void* buf,
+                       int count,
+                       MPI_Datatype datatype,
+                       int source,
+                       int tag,
+                       MPI_Comm comm,
+                       MPI_Request* request);
+  static int mpi_waitall(int count, MPI_Request* requests);
+  static int mpi_testall(int count, MPI_Request* requests, int* flag);
   static int mpi_sendrecv(const void* sendbuf,
                           int sendcount,
                           MPI_Datatype sendtype,
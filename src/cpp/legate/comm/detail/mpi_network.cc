@@ -18,22 +18,36 @@
 #include <legate/utilities/span.h>
 #include <legate/utilities/typedefs.h>
 
+#include <fmt/format.h>
+
 #include <algorithm>
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <stdexcept>
+#include <string_view>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace legate::detail::comm::coll {
 
-MPINetwork::MPINetwork()
+MPINetwork::MPINetwork(std::int32_t all_to_all_max_in_flight,
+                       bool hierarchical_collectives,
+                       WaitStrategy wait_strategy)
+  : all_to_all_max_in_flight_{all_to_all_max_in_flight},
+    hierarchical_collectives_{hierarchical_collectives},
+    wait_strategy_{wait_strategy}
 {
   logger().debug() << "Enable MPINetwork";
   LEGATE_CHECK(current_unique_id_ == 0);
+  LEGATE_CHECK(all_to_all_max_in_flight_ > 0);
 
   int init_flag = 0;
 
@@ -86,6 +100,10 @@ MPINetwork::~MPINetwork()
     LEGATE_CHECK_MPI(MPIInterface::mpi_comm_free(&mpi_comm));
   }
   mpi_comms_.clear();
+  for (auto&& thread_comm : thread_comms_) {
+    LEGATE_CHECK(!thread_comm->ready());
+  }
+  thread_comms_.clear();
 
   if (self_init_mpi_) {
     logger().info() << "finalize mpi";
@@ -122,6 +140,7 @@ int MPINetwork::init_comm()
 
   LEGATE_CHECK_MPI(MPIInterface::mpi_comm_dup(MPIInterface::MPI_COMM_WORLD(), &mpi_comm));
   mpi_comms_.push_back(mpi_comm);
+  thread_comms_.emplace_back(std::make_unique<ThreadComm>());
   logger().debug() << "Init comm id " << id;
   return id;
 }
@@ -143,6 +162,90 @@ namespace {
   return {max_elem, hash.size()};
 }
 
+/**
+ * @return The number of ranks of the communicator living in the process with MPI rank `mpi_rank`,
+ * and the lowest of their global ranks.
+ */
+[[nodiscard]] std::pair<std::int32_t, int> local_ranks(Span<const int> mpi_ranks, int mpi_rank)
+{
+  const auto first = std::find(mpi_ranks.begin(), mpi_ranks.end(), mpi_rank);
+
+  LEGATE_CHECK(first != mpi_ranks.end());
+  return {static_cast<std::int32_t>(std::count(first, mpi_ranks.end(), mpi_rank)),
+          static_cast<int>(first - mpi_ranks.begin())};
+}
+
+/**
+ * @return The lower bound of the `rank`-th of `total_size` contiguous slices of `count` elements.
+ */
+[[nodiscard]] std::int64_t slice_bound(int count, int rank, int total_size)
+{
+  return static_cast<std::int64_t>(count) * rank / total_size;
+}
+
+// A non-blocking collective: a set of point to point operations, and an epilogue that finishes
+// the collective locally once all of them have completed
+class MPIRequest final : public CollRequest {
+  using MPIInterface = mpi::detail::MPIInterface;
+
+ public:
+  MPIRequest(std::vector<MPIInterface::MPI_Request> requests,
+             std::function<void()> epilogue,
+             std::unique_ptr<char[]> scratch);
+
+  [[nodiscard]] bool test() override;
+  void wait() override;
+
+ private:
+  void complete_();
+
+  std::vector<MPIInterface::MPI_Request> requests_{};
+  std::function<void()> epilogue_{};
+  // Buffers the operations read from or write to, that must outlive them
+  std::unique_ptr<char[]> scratch_{};
+  bool completed_{};
+};
+
+MPIRequest::MPIRequest(std::vector<MPIInterface::MPI_Request> requests,
+                       std::function<void()> epilogue,
+                       std::unique_ptr<char[]> scratch)
+  : requests_{std::move(requests)}, epilogue_{std::move(epilogue)}, scratch_{std::move(scratch)}
+{
+}
+
+bool MPIRequest::test()
+{
+  if (!completed_) {
+    int flag = 0;
+
+    LEGATE_CHECK_MPI(
+      MPIInterface::mpi_testall(static_cast<int>(requests_.size()), requests_.data(), &flag));
+    if (!flag) {
+      return false;
+    }
+    complete_();
+  }
+  return true;
+}
+
+void MPIRequest::wait()
+{
+  if (!completed_) {
+    LEGATE_CHECK_MPI(
+      MPIInterface::mpi_waitall(static_cast<int>(requests_.size()), requests_.data()));
+    complete_();
+  }
+}
+
+void MPIRequest::complete_()
+{
+  completed_ = true;
+  if (epilogue_) {
+    epilogue_();
+  }
+  scratch_.reset();
+}
+
 }  // namespace
 
 void MPINetwork::comm_create(legate::comm::coll::CollComm global_comm,
@@ -181,10 +284,39 @@ void MPINetwork::comm_create(legate::comm::coll::CollComm global_comm,
 
   global_comm->mapping_table.global_rank = global_ranks.release();
   global_comm->mapping_table.mpi_rank    = mpi_ranks.release();
+
+  // Ranks living in the same process exchange data through shared memory instead of MPI
+  const auto [num_local_ranks, first_local_rank] = local_ranks(
+    {mapping_table, static_cast<std::size_t>(global_comm_size)}, global_comm->mpi_rank);
+
+  if (num_local_ranks > 1) {
+    auto& thread_comm = thread_comms_[static_cast<std::size_t>(unique_id)];
+
+    if (global_rank == first_local_rank) {
+      thread_comm->init(global_comm_size, num_local_ranks, wait_strategy_);
+    }
+    thread_comm->wait_until([&] { return thread_comm->ready(); });
+    global_comm->local_comm = thread_comm.get();
+    global_comm->local_comm->barrier_local();
+  }
 }
 
 void MPINetwork::comm_destroy(legate::comm::coll::CollComm global_comm)
 {
+  if (auto* const thread_comm = std::exchange(global_comm->local_comm, nullptr)) {
+    const auto [num_local_ranks, first_local_rank] =
+      local_ranks({global_comm->mapping_table.mpi_rank,
+                   static_cast<std::size_t>(global_comm->global_comm_size)},
+                  global_comm->mpi_rank);
+
+    thread_comm->barrier_local();
+    thread_comm->finalize(num_local_ranks, global_comm->global_rank == first_local_rank);
+  }
+  {
+    const std::scoped_lock<std::mutex> lock{pending_all_reduces_mutex_};
+
+    pending_all_reduces_.erase(global_comm);
+  }
   delete[] std::exchange(global_comm->mapping_table.global_rank, nullptr);
   delete[] std::exchange(global_comm->mapping_table.mpi_rank, nullptr);
   global_comm->status = false;
@@ -199,61 +331,13 @@ void MPINetwork::all_to_all_v(const void* sendbuf,
                               legate::comm::coll::CollDataType type,
                               legate::comm::coll::CollComm global_comm)
 {
-  const int total_size  = global_comm->global_comm_size;
-  const int global_rank = global_comm->global_rank;
-  const auto mpi_type   = dtype_to_mpi_dtype_(type);
-  MPIInterface::MPI_Aint lb, type_extent;
-
-  LEGATE_CHECK_MPI(MPIInterface::mpi_type_get_extent(mpi_type, &lb, &type_extent));
-  for (int i = 1; i < total_size + 1; i++) {
-    const auto sendto_global_rank   = (global_rank + i) % total_size;
-    const auto recvfrom_global_rank = (global_rank + total_size - i) % total_size;
-    // How else are we supposed to make a char* out of const void*?????????????????????????
-    // NOLINTNEXTLINE(bugprone-casting-through-void)
-    const auto src   = static_cast<char*>(const_cast<void*>(sendbuf)) +
-                       (static_cast<std::ptrdiff_t>(sdispls[sendto_global_rank]) * type_extent);
-    const auto dst   = static_cast<char*>(recvbuf) +
-                       (static_cast<std::ptrdiff_t>(rdispls[recvfrom_global_rank]) * type_extent);
-    const int scount = sendcounts[sendto_global_rank];
-    const int rcount = recvcounts[recvfrom_global_rank];
-    const auto sendto_mpi_rank   = global_comm->mapping_table.mpi_rank[sendto_global_rank];
-    const auto recvfrom_mpi_rank = global_comm->mapping_table.mpi_rank[recvfrom_global_rank];
-
-    LEGATE_CHECK(sendto_global_rank == global_comm->mapping_table.global_rank[sendto_global_rank]);
-    LEGATE_CHECK(recvfrom_global_rank ==
-                 global_comm->mapping_table.global_rank[recvfrom_global_rank]);
-    // tag: seg idx + rank_idx + tag
-    const int send_tag = generate_alltoallv_tag_(sendto_global_rank, global_rank, global_comm);
-    const int recv_tag = generate_alltoallv_tag_(global_rank, recvfrom_global_rank, global_comm);
-
-    if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
-      logger().debug() << "AlltoallvMPI i: " << i << " === global_rank " << global_rank
-                       << ", mpi rank " << global_comm->mpi_rank << ", send to "
-                       << sendto_global_rank << " (" << sendto_mpi_rank << "), send_tag "
-                       << send_tag
-                       << ", "
-                          "recv from "
-                       << recvfrom_global_rank << " (" << recvfrom_mpi_rank
-                       << "), "
-                          "recv_tag "
-                       << recv_tag;
-    }
-
-    MPIInterface::MPI_Status status;
-
-    LEGATE_CHECK_MPI(MPIInterface::mpi_sendrecv(src,
-                                                scount,
-                                                mpi_type,
-                                                sendto_mpi_rank,
-                                                send_tag,
-                                                dst,
-                                                rcount,
-                                                mpi_type,
-                                                recvfrom_mpi_rank,
-                                                recv_tag,
-                                                global_comm->mpi_comm,
-                                                &status));
-  }
+  all_to_all_impl_(sendbuf,
+                   SegmentLayout{sendcounts, sdispls, /* count */ 0},
+                   recvbuf,
+                   SegmentLayout{recvcounts, rdispls, /* count */ 0},
+                   type,
+                   &MPINetwork::generate_alltoallv_tag_,
+                   global_comm);
 }
 
 void MPINetwork::all_to_all(const void* sendbuf,
@@ -262,54 +346,10 @@ void MPINetwork::all_to_all(const void* sendbuf,
                             legate::comm::coll::CollDataType type,
                             legate::comm::coll::CollComm global_comm)
 {
-  const auto total_size  = global_comm->global_comm_size;
-  const auto global_rank = global_comm->global_rank;
-  const auto mpi_type    = dtype_to_mpi_dtype_(type);
-  MPIInterface::MPI_Aint lb, type_extent;
-
-  LEGATE_CHECK_MPI(MPIInterface::mpi_type_get_extent(mpi_type, &lb, &type_extent));
-  for (int i = 1; i < total_size + 1; i++) {
-    const auto sendto_global_rank   = (global_rank + i) % total_size;
-    const auto recvfrom_global_rank = (global_rank + total_size - i) % total_size;
-    // How else are we supposed to make a char* out of const void*?????????????????????????
-    // NOLINTNEXTLINE(bugprone-casting-through-void)
-    const auto src = static_cast<char*>(const_cast<void*>(sendbuf)) +
-                     (static_cast<std::ptrdiff_t>(sendto_global_rank) * type_extent * count);
-    const auto dst = static_cast<char*>(recvbuf) +
-                     (static_cast<std::ptrdiff_t>(recvfrom_global_rank) * type_extent * count);
-    const auto sendto_mpi_rank   = global_comm->mapping_table.mpi_rank[sendto_global_rank];
-    const auto recvfrom_mpi_rank = global_comm->mapping_table.mpi_rank[recvfrom_global_rank];
-
-    LEGATE_CHECK(sendto_global_rank == global_comm->mapping_table.global_rank[sendto_global_rank]);
-    LEGATE_CHECK(recvfrom_global_rank ==
-                 global_comm->mapping_table.global_rank[recvfrom_global_rank]);
-    // tag: seg idx + rank_idx + tag
-    const int send_tag = generate_alltoall_tag_(sendto_global_rank, global_rank, global_comm);
-    const int recv_tag = generate_alltoall_tag_(global_rank, recvfrom_global_rank, global_comm);
-
-    if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
-      logger().debug() << "AlltoallMPI i: " << i << " === global_rank " << global_rank
-                       << ", mpi rank " << global_comm->mpi_rank << ", send to "
-                       << sendto_global_rank << " (" << sendto_mpi_rank << "), send_tag "
-                       << send_tag << ", recv from " << recvfrom_global_rank << " ("
-                       << recvfrom_mpi_rank << "), recv_tag " << recv_tag;
-    }
-
-    MPIInterface::MPI_Status status;
+  const auto layout = SegmentLayout{/* counts */ nullptr, /* displs */ nullptr, count};
 
-    LEGATE_CHECK_MPI(MPIInterface::mpi_sendrecv(src,
-                                                count,
-                                                mpi_type,
-                                                sendto_mpi_rank,
-                                                send_tag,
-                                                dst,
-                                                count,
-                                                mpi_type,
-                                                recvfrom_mpi_rank,
-                                                recv_tag,
-                                                global_comm->mpi_comm,
-                                                &status));
-  }
+  all_to_all_impl_(
+    sendbuf, layout, recvbuf, layout, type, &MPINetwork::generate_alltoall_tag_, global_comm);
 }
 
 void MPINetwork::all_gather(const void* sendbuf,
@@ -339,6 +379,10 @@ void MPINetwork::all_gather(const void* sendbuf,
   );
   // clang-format on
 
+  if (use_hierarchical_(global_comm)) {
+    all_gather_hierarchical_(sendbuf_tmp, recvbuf, count, type, global_comm);
+    return;
+  }
   gather_(sendbuf_tmp, recvbuf, count, type, /*root=*/0, global_comm);
   bcast_(recvbuf, count * total_size, type, /*root=*/0, global_comm);
 }
@@ -350,22 +394,7 @@ void MPINetwork::all_reduce(const void* sendbuf,
                             ReductionOpKind op,
                             legate::comm::coll::CollComm global_comm)
 {
-  switch (op) {
-    case legate::ReductionOpKind::ADD: [[fallthrough]];
-    case legate::ReductionOpKind::MUL: [[fallthrough]];
-    case legate::ReductionOpKind::MAX: [[fallthrough]];
-    case legate::ReductionOpKind::MIN: break;
-    case legate::ReductionOpKind::OR: [[fallthrough]];
-    case legate::ReductionOpKind::XOR: [[fallthrough]];
-    case legate::ReductionOpKind::AND:
-      if (type == legate::comm::coll::CollDataType::CollFloat ||
-          type == legate::comm::coll::CollDataType::CollDouble) {
-        throw legate::detail::TracedException<std::invalid_argument>{
-          "MPINetwork::all_reduce does not support float or double reduction with bitwise "
-          "operations"};
-      }
-      break;
-  }
+  check_reduction_op(type, op, "MPINetwork::all_reduce");
   LEGATE_CHECK(count >= 0);
 
   const auto mpi_type = dtype_to_mpi_dtype_(type);
@@ -388,10 +417,1025 @@ void MPINetwork::all_reduce(const void* sendbuf,
   );
   // clang-format on
 
+  if (use_hierarchical_(global_comm)) {
+    all_reduce_hierarchical_(sendbuf_tmp, recvbuf, count, type, op, global_comm);
+    return;
+  }
   reduce_(sendbuf_tmp, recvbuf, count, type, op, /* root rank */ 0, global_comm);
   bcast_(recvbuf, count, type, /* root rank */ 0, global_comm);
 }
 
+void MPINetwork::broadcast(void* buf,
+                           int count,
+                           legate::comm::coll::CollDataType type,
+                           int root,
+                           legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(count >= 0);
+  bcast_(buf, count, type, root, global_comm);
+}
+
+void MPINetwork::gather(const void* sendbuf,
+                        void* recvbuf,
+                        int count,
+                        legate::comm::coll::CollDataType type,
+                        int root,
+                        legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(count >= 0);
+  gather_(sendbuf, recvbuf, count, type, root, global_comm);
+}
+
+void MPINetwork::reduce(const void* sendbuf,
+                        void* recvbuf,
+                        int count,
+                        legate::comm::coll::CollDataType type,
+                        ReductionOpKind op,
+                        int root,
+                        legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(count >= 0);
+
+  const auto mpi_type = dtype_to_mpi_dtype_(type);
+  const auto inplace  = global_comm->global_rank == root && sendbuf == recvbuf;
+  auto sendbuf_tmp    = const_cast<void*>(sendbuf);
+  MPIInterface::MPI_Aint lb, type_extent;
+
+  LEGATE_CHECK_MPI(MPIInterface::mpi_type_get_extent(mpi_type, &lb, &type_extent));
+
+  const auto num_bytes = static_cast<std::size_t>(type_extent * count);
+  // MPI_IN_PLACE
+  if (inplace) {
+    sendbuf_tmp = allocate_inplace_buffer_(recvbuf, num_bytes);
+  }
+  // For some reason clang-format like to pack this one along one line...
+  // clang-format off
+  LEGATE_SCOPE_GUARD(
+    if (inplace) {
+      delete_inplace_buffer_(sendbuf_tmp, num_bytes);
+    }
+  );
+  // clang-format on
+
+  reduce_(sendbuf_tmp, recvbuf, count, type, op, root, global_comm);
+}
+
+void MPINetwork::reduce_scatter(const void* sendbuf,
+                                void* recvbuf,
+                                int recvcount,
+                                legate::comm::coll::CollDataType type,
+                                ReductionOpKind op,
+                                legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(recvcount >= 0);
+  // Should not see inplace here
+  if (sendbuf == recvbuf) {
+    throw legate::detail::TracedException<std::invalid_argument>{
+      "MPINetwork::reduce_scatter() does not support inplace reduce-scatter"};
+  }
+
+  const auto total_size  = global_comm->global_comm_size;
+  const auto global_rank = global_comm->global_rank;
+  const auto mpi_type    = dtype_to_mpi_dtype_(type);
+  const auto* mpi_ranks  = global_comm->mapping_table.mpi_rank;
+  MPIInterface::MPI_Aint lb, type_extent;
+
+  LEGATE_CHECK_MPI(MPIInterface::mpi_type_get_extent(mpi_type, &lb, &type_extent));
+
+  const auto block_bytes = static_cast<std::size_t>(type_extent * recvcount);
+  const auto block_of    = [&](int rank) {
+    return static_cast<const char*>(sendbuf) + (static_cast<std::ptrdiff_t>(rank) * block_bytes);
+  };
+
+  std::memcpy(recvbuf, block_of(global_rank), block_bytes);
+  if (total_size == 1) {
+    return;
+  }
+
+  auto temp_buffer = std::make_unique<char[]>(block_bytes);
+
+  for (int i = 1; i < total_size; ++i) {
+    const auto sendto_global_rank   = (global_rank + i) % total_size;
+    const auto recvfrom_global_rank = (global_rank + total_size - i) % total_size;
+    MPIInterface::MPI_Status status;
+
+    LEGATE_CHECK(sendto_global_rank == global_comm->mapping_table.global_rank[sendto_global_rank]);
+    LEGATE_CHECK(recvfrom_global_rank ==
+                 global_comm->mapping_table.global_rank[recvfrom_global_rank]);
+    if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
+      logger().debug() << "ReduceScatterMPI i: " << i << " === global_rank " << global_rank
+                       << ", mpi rank " << global_comm->mpi_rank << ", send to "
+                       << sendto_global_rank << " (" << mpi_ranks[sendto_global_rank]
+                       << "), recv from " << recvfrom_global_rank << " ("
+                       << mpi_ranks[recvfrom_global_rank] << ")";
+    }
+    LEGATE_CHECK_MPI(MPIInterface::mpi_sendrecv(
+      block_of(sendto_global_rank),
+      recvcount,
+      mpi_type,
+      mpi_ranks[sendto_global_rank],
+      generate_reduce_scatter_tag_(sendto_global_rank, global_rank, global_comm),
+      temp_buffer.get(),
+      recvcount,
+      mpi_type,
+      mpi_ranks[recvfrom_global_rank],
+      generate_reduce_scatter_tag_(global_rank, recvfrom_global_rank, global_comm),
+      global_comm->mpi_comm,
+      &status));
+    apply_reduction(recvbuf, temp_buffer.get(), static_cast<std::size_t>(recvcount), type, op);
+  }
+}
+
+std::unique_ptr<CollRequest> MPINetwork::iall_to_all_v(const void* sendbuf,
+                                                        const int sendcounts[],
+                                                        const int sdispls[],
+                                                        void* recvbuf,
+                                                        const int recvcounts[],
+                                                        const int rdispls[],
+                                                        legate::comm::coll::CollDataType type,
+                                                        legate::comm::coll::CollComm global_comm)
+{
+  return std::make_unique<MPIRequest>(
+    iall_to_all_impl_(sendbuf,
+                      SegmentLayout{sendcounts, sdispls, /* count */ 0},
+                      recvbuf,
+                      SegmentLayout{recvcounts, rdispls, /* count */ 0},
+                      type,
+                      &MPINetwork::generate_alltoallv_tag_,
+                      global_comm),
+    /* epilogue */ nullptr,
+    /* scratch */ nullptr);
+}
+
+std::unique_ptr<CollRequest> MPINetwork::iall_to_all(const void* sendbuf,
+                                                      void* recvbuf,
+                                                      int count,
+                                                      legate::comm::coll::CollDataType type,
+                                                      legate::comm::coll::CollComm global_comm)
+{
+  const auto layout = SegmentLayout{/* counts */ nullptr, /* displs */ nullptr, count};
+
+  return std::make_unique<MPIRequest>(
+    iall_to_all_impl_(
+      sendbuf, layout, recvbuf, layout, type, &MPINetwork::generate_alltoall_tag_, global_comm),
+    /* epilogue */ nullptr,
+    /* scratch */ nullptr);
+}
+
+std::unique_ptr<CollRequest> MPINetwork::iall_gather(const void* sendbuf,
+                                                      void* recvbuf,
+                                                      int count,
+                                                      legate::comm::coll::CollDataType type,
+                                                      legate::comm::coll::CollComm global_comm)
+{
+  MPIInterface::MPI_Aint lb, type_extent;
+
+  LEGATE_CHECK_MPI(
+    MPIInterface::mpi_type_get_extent(dtype_to_mpi_dtype_(type), &lb, &type_extent));
+
+  const auto num_bytes = static_cast<std::size_t>(type_extent * count);
+  std::unique_ptr<char[]> scratch{};
+
+  // MPI_IN_PLACE
+  if (sendbuf == recvbuf) {
+    scratch.reset(static_cast<char*>(allocate_inplace_buffer_(recvbuf, num_bytes)));
+    sendbuf = scratch.get();
+  }
+
+  // An all-gather is an all-to-all where every rank sends the same segment to everybody
+  const std::vector<int> sdispls(static_cast<std::size_t>(global_comm->global_comm_size), 0);
+  const auto send_layout = SegmentLayout{/* counts */ nullptr, sdispls.data(), count};
+  const auto recv_layout = SegmentLayout{/* counts */ nullptr, /* displs */ nullptr, count};
+
+  auto requests = iall_to_all_impl_(sendbuf,
+                                    send_layout,
+                                    recvbuf,
+                                    recv_layout,
+                                    type,
+                                    &MPINetwork::generate_allgather_tag_,
+                                    global_comm);
+
+  return std::make_unique<MPIRequest>(
+    std::move(requests), /* epilogue */ nullptr, std::move(scratch));
+}
+
+class MPINetwork::AllReduceRequest final : public CollRequest {
+ public:
+  AllReduceRequest(MPINetwork* network,
+                   const void* sendbuf,
+                   void* recvbuf,
+                   int count,
+                   legate::comm::coll::CollDataType type,
+                   ReductionOpKind op,
+                   legate::comm::coll::CollComm global_comm);
+  ~AllReduceRequest() override;
+
+  [[nodiscard]] bool test() override;
+  void wait() override;
+
+ private:
+  /**
+   * @brief Start the all-gather of this all-reduce, after those of the all-reduces of the
+   * communicator that were started before it.
+   *
+   * @return Whether the all-gather was started, which is always the case if `block` is true.
+   */
+  [[nodiscard]] bool start_all_gather_(bool block);
+
+  /**
+   * @brief Reduce the slice of this rank and post the all-gather, once the reduce-scatter has
+   * completed. The all-reduce must be the oldest one of its communicator that has yet to start
+   * its all-gather.
+   */
+  [[nodiscard]] bool try_start_all_gather_(bool block);
+
+  void complete_();
+
+  MPINetwork* network_{};
+  std::deque<AllReduceRequest*>* pending_{};
+  void* recvbuf_{};
+  legate::comm::coll::CollDataType type_{};
+  ReductionOpKind op_{};
+  legate::comm::coll::CollComm global_comm_{};
+  // The slice of the buffer reduced by each rank
+  std::vector<int> slice_counts_{};
+  std::vector<int> slice_displs_{};
+  // The contributions of all ranks to the slice of this rank, reduced into the first one
+  std::unique_ptr<char[]> contributions_{};
+  std::size_t slice_bytes_{};
+  std::vector<MPIInterface::MPI_Request> requests_{};
+  bool all_gather_started_{};
+  bool completed_{};
+};
+
+MPINetwork::AllReduceRequest::AllReduceRequest(MPINetwork* network,
+                                               const void* sendbuf,
+                                               void* recvbuf,
+                                               int count,
+                                               legate::comm::coll::CollDataType type,
+                                               ReductionOpKind op,
+                                               legate::comm::coll::CollComm global_comm)
+  : network_{network}, recvbuf_{recvbuf}, type_{type}, op_{op}, global_comm_{global_comm}
+{
+  const auto total_size = global_comm->global_comm_size;
+  MPIInterface::MPI_Aint lb, type_extent;
+
+  LEGATE_CHECK_MPI(
+    MPIInterface::mpi_type_get_extent(dtype_to_mpi_dtype_(type), &lb, &type_extent));
+
+  slice_counts_.reserve(static_cast<std::size_t>(total_size));
+  slice_displs_.reserve(static_cast<std::size_t>(total_size));
+  for (int rank = 0; rank < total_size; ++rank) {
+    const auto lo = slice_bound(count, rank, total_size);
+
+    slice_displs_.push_back(static_cast<int>(lo));
+    slice_counts_.push_back(static_cast<int>(slice_bound(count, rank + 1, total_size) - lo));
+  }
+
+  const auto slice_count = slice_counts_[static_cast<std::size_t>(global_comm->global_rank)];
+
+  slice_bytes_ = static_cast<std::size_t>(type_extent) * static_cast<std::size_t>(slice_count);
+  contributions_.reset(new char[slice_bytes_ * static_cast<std::size_t>(total_size)]);
+  // The send buffer is only read by the reduce-scatter, which completes before the all-gather
+  // writes to the receive buffer, so the in-place case needs no copy
+  requests_ = network_->iall_to_all_impl_(
+    sendbuf,
+    SegmentLayout{slice_counts_.data(), slice_displs_.data(), /* count */ 0},
+    contributions_.get(),
+    SegmentLayout{/* counts */ nullptr, /* displs */ nullptr, slice_count},
+    type,
+    &MPINetwork::generate_allreduce_tag_,
+    global_comm);
+  pending_ = &network_->pending_all_reduces_of_(global_comm);
+  pending_->push_back(this);
+}
+
+MPINetwork::AllReduceRequest::~AllReduceRequest()
+{
+  // Only reachable if the owner gave up on the request, in which case the later all-reduces must
+  // not wait for it to start its all-gather
+  if (!all_gather_started_) {
+    pending_->erase(std::find(pending_->begin(), pending_->end(), this));
+  }
+}
+
+bool MPINetwork::AllReduceRequest::test()
+{
+  if (!completed_) {
+    if (!start_all_gather_(/* block */ false)) {
+      return false;
+    }
+
+    int flag = 0;
+
+    LEGATE_CHECK_MPI(
+      MPIInterface::mpi_testall(static_cast<int>(requests_.size()), requests_.data(), &flag));
+    if (!flag) {
+      return false;
+    }
+    complete_();
+  }
+  return true;
+}
+
+void MPINetwork::AllReduceRequest::wait()
+{
+  if (!completed_) {
+    std::ignore = start_all_gather_(/* block */ true);
+    LEGATE_CHECK_MPI(
+      MPIInterface::mpi_waitall(static_cast<int>(requests_.size()), requests_.data()));
+    complete_();
+  }
+}
+
+bool MPINetwork::AllReduceRequest::start_all_gather_(bool block)
+{
+  // The other ranks start the all-gathers in the same order, as they also started the all-reduces
+  // in the same order
+  while (!all_gather_started_) {
+    if (!pending_->front()->try_start_all_gather_(block)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool MPINetwork::AllReduceRequest::try_start_all_gather_(bool block)
+{
+  if (block) {
+    LEGATE_CHECK_MPI(
+      MPIInterface::mpi_waitall(static_cast<int>(requests_.size()), requests_.data()));
+  } else {
+    int flag = 0;
+
+    LEGATE_CHECK_MPI(
+      MPIInterface::mpi_testall(static_cast<int>(requests_.size()), requests_.data(), &flag));
+    if (!flag) {
+      return false;
+    }
+  }
+
+  const auto total_size  = global_comm_->global_comm_size;
+  const auto global_rank = static_cast<std::size_t>(global_comm_->global_rank);
+  const auto slice_count = slice_counts_[global_rank];
+
+  // Reduce in rank order, as the hierarchical all-reduce does
+  for (int rank = 1; rank < total_size; ++rank) {
+    apply_reduction(contributions_.get(),
+                    contributions_.get() + (static_cast<std::size_t>(rank) * slice_bytes_),
+                    static_cast<std::size_t>(slice_count),
+                    type_,
+                    op_);
+  }
+
+  // Every rank sends its reduced slice to everybody, and receives the others' in place
+  const std::vector<int> sdispls(static_cast<std::size_t>(total_size), 0);
+
+  requests_ = network_->iall_to_all_impl_(
+    contributions_.get(),
+    SegmentLayout{/* counts */ nullptr, sdispls.data(), slice_count},
+    recvbuf_,
+    SegmentLayout{slice_counts_.data(), slice_displs_.data(), /* count */ 0},
+    type_,
+    &MPINetwork::generate_allreduce_allgather_tag_,
+    global_comm_);
+  LEGATE_CHECK(pending_->front() == this);
+  pending_->pop_front();
+  all_gather_started_ = true;
+  return true;
+}
+
+void MPINetwork::AllReduceRequest::complete_()
+{
+  completed_ = true;
+  contributions_.reset();
+}
+
+std::deque<MPINetwork::AllReduceRequest*>& MPINetwork::pending_all_reduces_of_(
+  legate::comm::coll::CollComm global_comm)
+{
+  // Each communicator is only used by one thread at a time, so only the map needs the lock. The
+  // queues themselves are not moved by later insertions.
+  const std::scoped_lock<std::mutex> lock{pending_all_reduces_mutex_};
+
+  return pending_all_reduces_[global_comm];
+}
+
+std::unique_ptr<CollRequest> MPINetwork::iall_reduce(const void* sendbuf,
+                                                      void* recvbuf,
+                                                      int count,
+                                                      legate::comm::coll::CollDataType type,
+                                                      ReductionOpKind op,
+                                                      legate::comm::coll::CollComm global_comm)
+{
+  check_reduction_op(type, op, "MPINetwork::iall_reduce");
+  LEGATE_CHECK(count >= 0);
+
+  return std::make_unique<AllReduceRequest>(
+    this, sendbuf, recvbuf, count, type, op, global_comm);
+}
+
+int MPINetwork::SegmentLayout::count_of(int rank) const
+{
+  return counts ? counts[rank] : count;
+}
+
+std::ptrdiff_t MPINetwork::SegmentLayout::displ_of(int rank) const
+{
+  return displs ? displs[rank] : static_cast<std::ptrdiff_t>(rank) * count;
+}
+
+class MPINetwork::ProcessLayout {
+ public:
+  explicit ProcessLayout(legate::comm::coll::CollComm global_comm);
+
+  [[nodiscard]] int num_processes() const;
+  [[nodiscard]] int num_ranks_of(int process) const;
+  [[nodiscard]] int leader_of(int process) const;
+  [[nodiscard]] int leader() const;
+
+  // The global ranks grouped by process, with the processes ordered by their leader (lowest rank)
+  std::vector<int> ranks{};
+  // The ranks of process i are ranks[offsets[i]] to ranks[offsets[i + 1] - 1]
+  std::vector<int> offsets{};
+  // The index of this rank's process, and of this rank within its process
+  int process_index{};
+  int local_index{};
+  // Whether the grouping preserves the rank order, i.e. ranks[i] == i
+  bool identity{};
+};
+
+MPINetwork::ProcessLayout::ProcessLayout(legate::comm::coll::CollComm global_comm)
+{
+  const auto total_size = global_comm->global_comm_size;
+  const auto* mpi_ranks = global_comm->mapping_table.mpi_rank;
+  std::unordered_map<int, int> process_of_mpi_rank;
+  std::vector<int> process_of_rank;
+
+  process_of_rank.reserve(static_cast<std::size_t>(total_size));
+  // Processes are numbered in the order in which their lowest rank appears
+  for (int i = 0; i < total_size; ++i) {
+    const auto it =
+      process_of_mpi_rank.try_emplace(mpi_ranks[i], static_cast<int>(process_of_mpi_rank.size()))
+        .first;
+
+    process_of_rank.push_back(it->second);
+  }
+
+  offsets.assign(process_of_mpi_rank.size() + 1, 0);
+  for (auto&& process : process_of_rank) {
+    ++offsets[static_cast<std::size_t>(process) + 1];
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  auto next = std::vector<int>{offsets.begin(), offsets.end() - 1};
+
+  ranks.resize(static_cast<std::size_t>(total_size));
+  for (int i = 0; i < total_size; ++i) {
+    const auto process = process_of_rank[static_cast<std::size_t>(i)];
+    const auto slot    = next[static_cast<std::size_t>(process)]++;
+
+    ranks[static_cast<std::size_t>(slot)] = i;
+    if (i == global_comm->global_rank) {
+      process_index = process;
+      local_index   = slot - offsets[static_cast<std::size_t>(process)];
+    }
+  }
+
+  identity = true;
+  for (int i = 0; i < total_size; ++i) {
+    if (ranks[static_cast<std::size_t>(i)] != i) {
+      identity = false;
+      break;
+    }
+  }
+}
+
+int MPINetwork::ProcessLayout::num_processes() const
+{
+  return static_cast<int>(offsets.size()) - 1;
+}
+
+int MPINetwork::ProcessLayout::num_ranks_of(int process) const
+{
+  return offsets[static_cast<std::size_t>(process) + 1] -
+         offsets[static_cast<std::size_t>(process)];
+}
+
+int MPINetwork::ProcessLayout::leader_of(int process) const
+{
+  return ranks[static_cast<std::size_t>(offsets[static_cast<std::size_t>(process)])];
+}
+
+int MPINetwork::ProcessLayout::leader() const
+{
+  return leader_of(process_index);
+}
+
+bool MPINetwork::use_hierarchical_(legate::comm::coll::CollComm global_comm) const
+{
+  // nb_threads is derived from the whole mapping table, so all ranks agree on the outcome
+  return hierarchical_collectives_ && global_comm->nb_threads > 1;
+}
+
+void MPINetwork::all_gather_hierarchical_(const void* sendbuf,
+                                          void* recvbuf,
+                                          int count,
+                                          legate::comm::coll::CollDataType type,
+                                          legate::comm::coll::CollComm global_comm)
+{
+  const auto global_rank  = global_comm->global_rank;
+  const auto mpi_type     = dtype_to_mpi_dtype_(type);
+  auto* const thread_comm = global_comm->local_comm;
+  const ProcessLayout processes{global_comm};
+  const auto is_leader = processes.leader() == global_rank;
+  MPIInterface::MPI_Aint lb, type_extent;
+
+  LEGATE_CHECK_MPI(MPIInterface::mpi_type_get_extent(mpi_type, &lb, &type_extent));
+
+  // A process that holds a single rank has no ThreadComm, and nobody to synchronize with
+  const auto barrier_local = [&] {
+    if (thread_comm) {
+      thread_comm->barrier_local();
+    }
+  };
+  const auto block_bytes = static_cast<std::size_t>(type_extent * count);
+  const auto total_bytes = block_bytes * processes.ranks.size();
+  // The blocks are staged in process order, which is the rank order when every process holds
+  // contiguous ranks. The leader's receive buffer then doubles as the staging buffer.
+  std::unique_ptr<char[]> scratch{};
+  void* staging = recvbuf;
+
+  if (is_leader) {
+    if (!processes.identity) {
+      scratch = std::make_unique<char[]>(total_bytes);
+      staging = scratch.get();
+    }
+    if (thread_comm) {
+      thread_comm->recv_buffers()[global_rank] = staging;
+    }
+  }
+  barrier_local();
+  if (thread_comm) {
+    staging = thread_comm->recv_buffers()[processes.leader()];
+  }
+
+  const auto block_of = [&](std::size_t slot) {
+    return static_cast<char*>(staging) + (slot * block_bytes);
+  };
+  const auto own_slot = static_cast<std::size_t>(
+    processes.offsets[static_cast<std::size_t>(processes.process_index)] + processes.local_index);
+
+  std::memcpy(block_of(own_slot), sendbuf, block_bytes);
+  barrier_local();
+
+  if (is_leader && processes.num_processes() > 1) {
+    std::vector<int> counts, displs;
+
+    counts.reserve(static_cast<std::size_t>(processes.num_processes()));
+    displs.reserve(static_cast<std::size_t>(processes.num_processes()));
+    for (int i = 0; i < processes.num_processes(); ++i) {
+      counts.push_back(processes.num_ranks_of(i) * count);
+      displs.push_back(processes.offsets[static_cast<std::size_t>(i)] * count);
+    }
+    all_gather_leaders_(staging,
+                        SegmentLayout{counts.data(), displs.data(), /* count */ 0},
+                        type,
+                        processes,
+                        global_comm);
+  }
+  barrier_local();
+
+  if (processes.identity) {
+    if (!is_leader) {
+      std::memcpy(recvbuf, staging, total_bytes);
+    }
+  } else {
+    for (std::size_t slot = 0; slot < processes.ranks.size(); ++slot) {
+      auto* const dst = static_cast<char*>(recvbuf) +
+                        (static_cast<std::size_t>(processes.ranks[slot]) * block_bytes);
+
+      std::memcpy(dst, block_of(slot), block_bytes);
+    }
+  }
+
+  // The leader may not retract (or free) the staging buffer until everybody has copied it out
+  barrier_local();
+  if (is_leader && thread_comm) {
+    thread_comm->recv_buffers()[global_rank] = nullptr;
+  }
+}
+
+void MPINetwork::all_reduce_hierarchical_(const void* sendbuf,
+                                          void* recvbuf,
+                                          int count,
+                                          legate::comm::coll::CollDataType type,
+                                          ReductionOpKind op,
+                                          legate::comm::coll::CollComm global_comm)
+{
+  const auto global_rank  = global_comm->global_rank;
+  const auto mpi_type     = dtype_to_mpi_dtype_(type);
+  auto* const thread_comm = global_comm->local_comm;
+  const ProcessLayout processes{global_comm};
+  const auto leader    = processes.leader();
+  const auto is_leader = leader == global_rank;
+  MPIInterface::MPI_Aint lb, type_extent;
+
+  LEGATE_CHECK_MPI(MPIInterface::mpi_type_get_extent(mpi_type, &lb, &type_extent));
+
+  const auto num_bytes = static_cast<std::size_t>(type_extent * count);
+
+  // This rank is alone in its process, and hence its own leader
+  if (!thread_comm) {
+    std::memcpy(recvbuf, sendbuf, num_bytes);
+    if (processes.num_processes() > 1) {
+      all_reduce_leaders_(recvbuf, count, type, op, processes, global_comm);
+    }
+    return;
+  }
+
+  auto* const buffers      = thread_comm->buffers();
+  auto* const recv_buffers = thread_comm->recv_buffers();
+
+  buffers[global_rank] = sendbuf;
+  if (is_leader) {
+    recv_buffers[global_rank] = recvbuf;
+  }
+  thread_comm->barrier_local();
+
+  // Every rank of the process reduces one slice of all the local send buffers into the leader's
+  // receive buffer. The buffers are always reduced in the same order, so that the result does not
+  // depend on the number of ranks per process.
+  const auto first        = processes.offsets[static_cast<std::size_t>(processes.process_index)];
+  const auto num_local    = processes.num_ranks_of(processes.process_index);
+  const auto slice_lo     = slice_bound(count, processes.local_index, num_local);
+  const auto slice_count  = slice_bound(count, processes.local_index + 1, num_local) - slice_lo;
+  const auto slice_offset = static_cast<std::ptrdiff_t>(slice_lo) * type_extent;
+  auto* const slice_dst   = static_cast<char*>(recv_buffers[leader].load()) + slice_offset;
+
+  for (int i = 0; i < num_local; ++i) {
+    const auto local_rank = processes.ranks[static_cast<std::size_t>(first + i)];
+    const auto* const src = static_cast<const char*>(buffers[local_rank].load()) + slice_offset;
+
+    if (i == 0) {
+      std::memcpy(slice_dst, src, static_cast<std::size_t>(slice_count * type_extent));
+    } else {
+      apply_reduction(slice_dst, src, static_cast<std::size_t>(slice_count), type, op);
+    }
+  }
+  thread_comm->barrier_local();
+  buffers[global_rank] = nullptr;
+
+  if (is_leader && processes.num_processes() > 1) {
+    all_reduce_leaders_(recvbuf, count, type, op, processes, global_comm);
+  }
+  thread_comm->barrier_local();
+  if (!is_leader) {
+    std::memcpy(recvbuf, recv_buffers[leader], num_bytes);
+  }
+
+  // The leader may not retract its receive buffer until everybody has copied it out
+  thread_comm->barrier_local();
+  if (is_leader) {
+    recv_buffers[global_rank] = nullptr;
+  }
+}
+
+void MPINetwork::all_reduce_leaders_(void* buf,
+                                     int count,
+                                     legate::comm::coll::CollDataType type,
+                                     ReductionOpKind op,
+                                     const ProcessLayout& processes,
+                                     legate::comm::coll::CollComm global_comm)
+{
+  const auto global_rank   = global_comm->global_rank;
+  const auto mpi_type      = dtype_to_mpi_dtype_(type);
+  const auto* mpi_ranks    = global_comm->mapping_table.mpi_rank;
+  const auto num_processes = processes.num_processes();
+  const auto process_index = processes.process_index;
+  MPIInterface::MPI_Aint lb, type_extent;
+
+  LEGATE_CHECK_MPI(MPIInterface::mpi_type_get_extent(mpi_type, &lb, &type_extent));
+
+  // Leader i reduces slice i of the buffer
+  std::vector<int> counts, displs;
+
+  counts.reserve(static_cast<std::size_t>(num_processes));
+  displs.reserve(static_cast<std::size_t>(num_processes));
+  for (int i = 0; i < num_processes; ++i) {
+    const auto lo = slice_bound(count, i, num_processes);
+
+    counts.push_back(static_cast<int>(slice_bound(count, i + 1, num_processes) - lo));
+    displs.push_back(static_cast<int>(lo));
+  }
+
+  const auto layout      = SegmentLayout{counts.data(), displs.data(), /* count */ 0};
+  const auto slice_count = layout.count_of(process_index);
+  const auto slice_bytes = static_cast<std::size_t>(slice_count * type_extent);
+  const auto slice_of    = [&](int process) {
+    return static_cast<char*>(buf) + (layout.displ_of(process) * type_extent);
+  };
+  // The contributions of all leaders to this leader's slice, in process order
+  auto scratch = std::make_unique<char[]>(slice_bytes * static_cast<std::size_t>(num_processes));
+
+  const auto scratch_of = [&](int process) {
+    return scratch.get() + (static_cast<std::size_t>(process) * slice_bytes);
+  };
+  std::vector<MPIInterface::MPI_Request> requests;
+
+  requests.reserve(2 * static_cast<std::size_t>(num_processes - 1));
+  for (int i = 1; i < num_processes; ++i) {
+    const auto sendto          = (process_index + i) % num_processes;
+    const auto recvfrom        = (process_index + num_processes - i) % num_processes;
+    const auto sendto_leader   = processes.leader_of(sendto);
+    const auto recvfrom_leader = processes.leader_of(recvfrom);
+
+    if (slice_count > 0) {
+      LEGATE_CHECK_MPI(MPIInterface::mpi_irecv(
+        scratch_of(recvfrom),
+        slice_count,
+        mpi_type,
+        mpi_ranks[recvfrom_leader],
+        generate_leader_reduce_scatter_tag_(global_rank, recvfrom_leader, global_comm),
+        global_comm->mpi_comm,
+        &requests.emplace_back()));
+    }
+    if (layout.count_of(sendto) > 0) {
+      LEGATE_CHECK_MPI(MPIInterface::mpi_isend(
+        slice_of(sendto),
+        layout.count_of(sendto),
+        mpi_type,
+        mpi_ranks[sendto_leader],
+        generate_leader_reduce_scatter_tag_(sendto_leader, global_rank, global_comm),
+        global_comm->mpi_comm,
+        &requests.emplace_back()));
+    }
+  }
+  std::memcpy(scratch_of(process_index), slice_of(process_index), slice_bytes);
+  LEGATE_CHECK_MPI(MPIInterface::mpi_waitall(static_cast<int>(requests.size()), requests.data()));
+
+  // Reduce in process order, so that the result does not depend on which leader reduces the slice
+  std::memcpy(slice_of(process_index), scratch_of(0), slice_bytes);
+  for (int i = 1; i < num_processes; ++i) {
+    apply_reduction(
+      slice_of(process_index), scratch_of(i), static_cast<std::size_t>(slice_count), type, op);
+  }
+
+  all_gather_leaders_(buf, layout, type, processes, global_comm);
+}
+
+void MPINetwork::all_gather_leaders_(void* buf,
+                                     const SegmentLayout& layout,
+                                     legate::comm::coll::CollDataType type,
+                                     const ProcessLayout& processes,
+                                     legate::comm::coll::CollComm global_comm)
+{
+  const auto global_rank   = global_comm->global_rank;
+  const auto mpi_type      = dtype_to_mpi_dtype_(type);
+  const auto* mpi_ranks    = global_comm->mapping_table.mpi_rank;
+  const auto num_processes = processes.num_processes();
+  const auto process_index = processes.process_index;
+  MPIInterface::MPI_Aint lb, type_extent;
+
+  LEGATE_CHECK_MPI(MPIInterface::mpi_type_get_extent(mpi_type, &lb, &type_extent));
+
+  const auto segment_of = [&](int process) {
+    return static_cast<char*>(buf) + (layout.displ_of(process) * type_extent);
+  };
+  std::vector<MPIInterface::MPI_Request> requests;
+
+  requests.reserve(2 * static_cast<std::size_t>(num_processes - 1));
+  for (int i = 1; i < num_processes; ++i) {
+    const auto sendto          = (process_index + i) % num_processes;
+    const auto recvfrom        = (process_index + num_processes - i) % num_processes;
+    const auto sendto_leader   = processes.leader_of(sendto);
+    const auto recvfrom_leader = processes.leader_of(recvfrom);
+
+    if (layout.count_of(recvfrom) > 0) {
+      LEGATE_CHECK_MPI(MPIInterface::mpi_irecv(
+        segment_of(recvfrom),
+        layout.count_of(recvfrom),
+        mpi_type,
+        mpi_ranks[recvfrom_leader],
+        generate_leader_allgather_tag_(global_rank, recvfrom_leader, global_comm),
+        global_comm->mpi_comm,
+        &requests.emplace_back()));
+    }
+    if (layout.count_of(process_index) > 0) {
+      LEGATE_CHECK_MPI(MPIInterface::mpi_isend(
+        segment_of(process_index),
+        layout.count_of(process_index),
+        mpi_type,
+        mpi_ranks[sendto_leader],
+        generate_leader_allgather_tag_(sendto_leader, global_rank, global_comm),
+        global_comm->mpi_comm,
+        &requests.emplace_back()));
+    }
+  }
+  LEGATE_CHECK_MPI(MPIInterface::mpi_waitall(static_cast<int>(requests.size()), requests.data()));
+}
+
+void MPINetwork::all_to_all_local_(const void* sendbuf,
+                                   const SegmentLayout& send_layout,
+                                   void* recvbuf,
+                                   const SegmentLayout& recv_layout,
+                                   std::ptrdiff_t type_extent,
+                                   legate::comm::coll::CollComm global_comm)
+{
+  const auto total_size  = global_comm->global_comm_size;
+  const auto global_rank = global_comm->global_rank;
+  const auto copy_from   = [&](int src_rank, const void* src_buffer, const int* src_displs) {
+    // all_to_all() does not publish displacements, as every rank uses the same layout
+    const auto src_displ =
+      src_displs ? src_displs[global_rank] : send_layout.displ_of(global_rank);
+    const auto* src = static_cast<const char*>(src_buffer) + (src_displ * type_extent);
+    auto* dst = static_cast<char*>(recvbuf) + (recv_layout.displ_of(src_rank) * type_extent);
+
+    std::memcpy(dst,
+                src,
+                static_cast<std::size_t>(recv_layout.count_of(src_rank)) *
+                  static_cast<std::size_t>(type_extent));
+  };
+  auto* const thread_comm = global_comm->local_comm;
+
+  if (!thread_comm) {
+    copy_from(global_rank, sendbuf, send_layout.displs);
+    return;
+  }
+
+  auto* buffers = thread_comm->buffers();
+  auto* displs  = thread_comm->displs();
+
+  displs[global_rank]  = send_layout.displs;
+  buffers[global_rank] = sendbuf;
+  thread_comm->notify();
+  for (int i = 0; i < total_size; ++i) {
+    const auto src_rank = (global_rank + total_size - i) % total_size;
+
+    if (global_comm->mapping_table.mpi_rank[src_rank] != global_comm->mpi_rank) {
+      continue;
+    }
+    // wait for the peer to publish its buffer
+    thread_comm->wait_until([&] {
+      return buffers[src_rank] != nullptr && (!send_layout.displs || displs[src_rank] != nullptr);
+    });
+    copy_from(src_rank, buffers[src_rank], displs[src_rank]);
+  }
+
+  // Nobody may retract its buffer (or publish the next one) until every peer is done reading
+  thread_comm->barrier_local();
+  buffers[global_rank] = nullptr;
+  displs[global_rank]  = nullptr;
+  thread_comm->barrier_local();
+}
+
+void MPINetwork::all_to_all_impl_(const void* sendbuf,
+                                  const SegmentLayout& send_layout,
+                                  void* recvbuf,
+                                  const SegmentLayout& recv_layout,
+                                  legate::comm::coll::CollDataType type,
+                                  tag_generator_type generate_tag,
+                                  legate::comm::coll::CollComm global_comm)
+{
+  const auto total_size  = global_comm->global_comm_size;
+  const auto global_rank = global_comm->global_rank;
+  const auto mpi_type    = dtype_to_mpi_dtype_(type);
+  const auto* mpi_ranks  = global_comm->mapping_table.mpi_rank;
+  MPIInterface::MPI_Aint lb, type_extent;
+
+  LEGATE_CHECK_MPI(MPIInterface::mpi_type_get_extent(mpi_type, &lb, &type_extent));
+
+  std::vector<MPIInterface::MPI_Request> requests;
+
+  requests.reserve(2 * static_cast<std::size_t>(all_to_all_max_in_flight_));
+  // Posts the exchanges with the peers at distances [first, last) from this rank. Both ends of a
+  // pair of ranks see each other at the same distance, so matching operations are always posted
+  // in the same window, which is what keeps the windows from deadlocking.
+  const auto post_window = [&](int first) {
+    const auto last = std::min(first + all_to_all_max_in_flight_, total_size);
+
+    requests.clear();
+    for (int i = first; i < last; ++i) {
+      const auto sendto_global_rank   = (global_rank + i) % total_size;
+      const auto recvfrom_global_rank = (global_rank + total_size - i) % total_size;
+      const auto sendto_mpi_rank      = mpi_ranks[sendto_global_rank];
+      const auto recvfrom_mpi_rank    = mpi_ranks[recvfrom_global_rank];
+
+      LEGATE_CHECK(sendto_global_rank ==
+                   global_comm->mapping_table.global_rank[sendto_global_rank]);
+      LEGATE_CHECK(recvfrom_global_rank ==
+                   global_comm->mapping_table.global_rank[recvfrom_global_rank]);
+      if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
+        logger().debug() << "AlltoallMPI i: " << i << " === global_rank " << global_rank
+                         << ", mpi rank " << global_comm->mpi_rank << ", send to "
+                         << sendto_global_rank << " (" << sendto_mpi_rank << "), recv from "
+                         << recvfrom_global_rank << " (" << recvfrom_mpi_rank << ")";
+      }
+      // Peers in this process are served by all_to_all_local_()
+      if (recvfrom_mpi_rank != global_comm->mpi_rank) {
+        auto* const dst = static_cast<char*>(recvbuf) +
+                          (recv_layout.displ_of(recvfrom_global_rank) * type_extent);
+
+        LEGATE_CHECK_MPI(MPIInterface::mpi_irecv(
+          dst,
+          recv_layout.count_of(recvfrom_global_rank),
+          mpi_type,
+          recvfrom_mpi_rank,
+          (this->*generate_tag)(global_rank, recvfrom_global_rank, global_comm),
+          global_comm->mpi_comm,
+          &requests.emplace_back()));
+      }
+      if (sendto_mpi_rank != global_comm->mpi_rank) {
+        const auto* const src = static_cast<const char*>(sendbuf) +
+                                (send_layout.displ_of(sendto_global_rank) * type_extent);
+
+        LEGATE_CHECK_MPI(MPIInterface::mpi_isend(
+          src,
+          send_layout.count_of(sendto_global_rank),
+          mpi_type,
+          sendto_mpi_rank,
+          (this->*generate_tag)(sendto_global_rank, global_rank, global_comm),
+          global_comm->mpi_comm,
+          &requests.emplace_back()));
+      }
+    }
+    return last;
+  };
+
+  // Get the first window going before doing the intra-process copies, so that the two overlap
+  auto next = post_window(1);
+
+  all_to_all_local_(sendbuf, send_layout, recvbuf, recv_layout, type_extent, global_comm);
+  while (true) {
+    LEGATE_CHECK_MPI(
+      MPIInterface::mpi_waitall(static_cast<int>(requests.size()), requests.data()));
+    if (next >= total_size) {
+      break;
+    }
+    next = post_window(next);
+  }
+}
+
+std::vector<MPINetwork::MPIInterface::MPI_Request> MPINetwork::iall_to_all_impl_(
+  const void* sendbuf,
+  const SegmentLayout& send_layout,
+  void* recvbuf,
+  const SegmentLayout& recv_layout,
+  legate::comm::coll::CollDataType type,
+  tag_generator_type generate_tag,
+  legate::comm::coll::CollComm global_comm)
+{
+  const auto total_size  = global_comm->global_comm_size;
+  const auto global_rank = global_comm->global_rank;
+  const auto mpi_type    = dtype_to_mpi_dtype_(type);
+  const auto* mpi_ranks  = global_comm->mapping_table.mpi_rank;
+  MPIInterface::MPI_Aint lb, type_extent;
+
+  LEGATE_CHECK_MPI(MPIInterface::mpi_type_get_extent(mpi_type, &lb, &type_extent));
+
+  std::vector<MPIInterface::MPI_Request> requests;
+
+  requests.reserve(2 * static_cast<std::size_t>(total_size - 1));
+  for (int i = 1; i < total_size; ++i) {
+    const auto sendto_global_rank   = (global_rank + i) % total_size;
+    const auto recvfrom_global_rank = (global_rank + total_size - i) % total_size;
+    auto* const dst =
+      static_cast<char*>(recvbuf) + (recv_layout.displ_of(recvfrom_global_rank) * type_extent);
+    const auto* const src =
+      static_cast<const char*>(sendbuf) + (send_layout.displ_of(sendto_global_rank) * type_extent);
+
+    if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
+      logger().debug() << "IalltoallMPI i: " << i << " === global_rank " << global_rank
+                       << ", mpi rank " << global_comm->mpi_rank << ", send to "
+                       << sendto_global_rank << " (" << mpi_ranks[sendto_global_rank]
+                       << "), recv from " << recvfrom_global_rank << " ("
+                       << mpi_ranks[recvfrom_global_rank] << ")";
+    }
+    LEGATE_CHECK_MPI(MPIInterface::mpi_irecv(
+      dst,
+      recv_layout.count_of(recvfrom_global_rank),
+      mpi_type,
+      mpi_ranks[recvfrom_global_rank],
+      (this->*generate_tag)(global_rank, recvfrom_global_rank, global_comm),
+      global_comm->mpi_comm,
+      &requests.emplace_back()));
+    LEGATE_CHECK_MPI(MPIInterface::mpi_isend(
+      src,
+      send_layout.count_of(sendto_global_rank),
+      mpi_type,
+      mpi_ranks[sendto_global_rank],
+      (this->*generate_tag)(sendto_global_rank, global_rank, global_comm),
+      global_comm->mpi_comm,
+      &requests.emplace_back()));
+  }
+  std::memcpy(
+    static_cast<char*>(recvbuf) + (recv_layout.displ_of(global_rank) * type_extent),
+    static_cast<const char*>(sendbuf) + (send_layout.displ_of(global_rank) * type_extent),
+    static_cast<std::size_t>(recv_layout.count_of(global_rank)) *
+      static_cast<std::size_t>(type_extent));
+  return requests;
+}
+
 void MPINetwork::gather_(const void* sendbuf,
                          void* recvbuf,
                          int count,
@@ -571,55 +1615,12 @@ void MPINetwork::reduce_(const void* sendbuf,
     LEGATE_CHECK_MPI(MPIInterface::mpi_recv(
       temp_buffer.get(), count, mpi_type, recvfrom_mpi_rank, tag, global_comm->mpi_comm, &status));
 
-    apply_reduction_(recvbuf, temp_buffer.get(), count, type, op);
+    apply_reduction(recvbuf, temp_buffer.get(), static_cast<std::size_t>(count), type, op);
   }
 }
 
 // protected functions start from here
 
-void MPINetwork::apply_reduction_(
-  void* dst, const void* src, int count, legate::comm::coll::CollDataType type, ReductionOpKind op)
-{
-  switch (type) {
-    case legate::comm::coll::CollDataType::CollInt8: {
-      apply_reduction_typed<std::int8_t>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollChar: {
-      apply_reduction_typed<char>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollUint8: {
-      apply_reduction_typed<std::uint8_t>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollInt: {
-      apply_reduction_typed<int>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollUint32: {
-      apply_reduction_typed<std::uint32_t>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollInt64: {
-      apply_reduction_typed<std::int64_t>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollUint64: {
-      apply_reduction_typed<std::uint64_t>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollFloat: {
-      apply_reduction_typed<float>(dst, src, count, op);
-      break;
-    }
-    case legate::comm::coll::CollDataType::CollDouble: {
-      apply_reduction_typed<double>(dst, src, count, op);
-      break;
-    }
-  }
-}
-
 mpi::detail::MPIInterface::MPI_Datatype MPINetwork::dtype_to_mpi_dtype_(
   legate::comm::coll::CollDataType dtype)
 {
@@ -659,12 +1660,21 @@ mpi::detail::MPIInterface::MPI_Datatype MPINetwork::dtype_to_mpi_dtype_(
 namespace {
 
 enum CollTag : std::uint8_t {
-  BCAST_TAG     = 0,
-  GATHER_TAG    = 1,
-  ALLTOALL_TAG  = 2,
-  ALLTOALLV_TAG = 3,
-  REDUCE_TAG    = 4,
-  MAX_TAG       = 10,
+  BCAST_TAG          = 0,
+  GATHER_TAG         = 1,
+  ALLTOALL_TAG       = 2,
+  ALLTOALLV_TAG      = 3,
+  REDUCE_TAG         = 4,
+  REDUCE_SCATTER_TAG = 5,
+  ALLGATHER_TAG      = 6,
+  ALLREDUCE_TAG      = 7,
+  // Exchanges between the leaders of the hierarchical collectives
+  LEADER_REDUCE_SCATTER_TAG = 8,
+  LEADER_ALLGATHER_TAG      = 9,
+  // The all-gather of the non-blocking all-reduces, which is posted after the collectives started
+  // later, and thus can't share the tag of the all-gathers
+  ALLREDUCE_ALLGATHER_TAG = 10,
+  MAX_TAG                 = 11,
 };
 
 [[nodiscard]] int match_to_ranks(int rank1, int rank2, legate::comm::coll::CollComm global_comm)
@@ -726,6 +1736,66 @@ int MPINetwork::generate_alltoallv_tag_(int rank1,
   return tag;
 }
 
+int MPINetwork::generate_reduce_scatter_tag_(int rank1,
+                                             int rank2,
+                                             legate::comm::coll::CollComm global_comm) const
+{
+  const int tag =
+    (match_to_ranks(rank1, rank2, global_comm) * CollTag::MAX_TAG) + CollTag::REDUCE_SCATTER_TAG;
+  LEGATE_CHECK(tag <= mpi_tag_ub_ && tag > 0);
+  return tag;
+}
+
+int MPINetwork::generate_allgather_tag_(int rank1,
+                                        int rank2,
+                                        legate::comm::coll::CollComm global_comm) const
+{
+  const int tag =
+    (match_to_ranks(rank1, rank2, global_comm) * CollTag::MAX_TAG) + CollTag::ALLGATHER_TAG;
+  LEGATE_CHECK(tag <= mpi_tag_ub_ && tag > 0);
+  return tag;
+}
+
+int MPINetwork::generate_allreduce_tag_(int rank1,
+                                        int rank2,
+                                        legate::comm::coll::CollComm global_comm) const
+{
+  const int tag =
+    (match_to_ranks(rank1, rank2, global_comm) * CollTag::MAX_TAG) + CollTag::ALLREDUCE_TAG;
+  LEGATE_CHECK(tag <= mpi_tag_ub_ && tag > 0);
+  return tag;
+}
+
+int MPINetwork::generate_leader_reduce_scatter_tag_(int rank1,
+                                                    int rank2,
+                                                    legate::comm::coll::CollComm global_comm) const
+{
+  const int tag = (match_to_ranks(rank1, rank2, global_comm) * CollTag::MAX_TAG) +
+                  CollTag::LEADER_REDUCE_SCATTER_TAG;
+  LEGATE_CHECK(tag <= mpi_tag_ub_ && tag > 0);
+  return tag;
+}
+
+int MPINetwork::generate_leader_allgather_tag_(int rank1,
+                                               int rank2,
+                                               legate::comm::coll::CollComm global_comm) const
+{
+  const int tag =
+    (match_to_ranks(rank1, rank2, global_comm) * CollTag::MAX_TAG) + CollTag::LEADER_ALLGATHER_TAG;
+  LEGATE_CHECK(tag <= mpi_tag_ub_ && tag > 0);
+  return tag;
+}
+
+int MPINetwork::generate_allreduce_allgather_tag_(int rank1,
+                                                  int rank2,
+                                                  legate::comm::coll::CollComm global_comm) const
+{
+  const int tag = (match_to_ranks(rank1, rank2, global_comm) * CollTag::MAX_TAG) +
+                  CollTag::ALLREDUCE_ALLGATHER_TAG;
+  LEGATE_CHECK(tag <= mpi_tag_ub_ && tag > 0);
+  return tag;
+}
+
 int MPINetwork::generate_bcast_tag_(int rank, legate::comm::coll::CollComm /*global_comm*/) const
 {
   const int tag = (rank * CollTag::MAX_TAG) + CollTag::BCAST_TAG;
@@ -9,7 +9,15 @@
 #include <legate/comm/coll_comm.h>
 #include <legate/comm/detail/backend_network.h>
 #include <legate/comm/detail/mpi_interface.h>
+#include <legate/comm/detail/thread_comm.h>
+#include <legate/comm/detail/wait_strategy.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace legate::detail::comm::coll {
@@ -18,7 +26,34 @@ class MPINetwork final : public BackendNetwork {
   using MPIInterface = mpi::detail::MPIInterface;
 
  public:
-  MPINetwork();
+  /**
+   * @brief The default maximum number of peers an all-to-all exchanges data with at once.
+   */
+  static constexpr std::int32_t DEFAULT_ALL_TO_ALL_MAX_IN_FLIGHT = 32;
+
+  /**
+   * @brief Construct the MPI network.
+   *
+   * All-to-all exchanges post non-blocking sends and receives for up to
+   * `all_to_all_max_in_flight` peers at a time. Ranks that live in the same process (i.e. share
+   * an MPI rank) bypass MPI and copy directly from each other's buffers.
+   *
+   * With `hierarchical_collectives`, all-gathers and all-reduces on communicators with several
+   * ranks per process run in three stages: the ranks of each process combine their data in shared
+   * memory, the lowest rank of each process (its leader) exchanges the combined data with the
+   * other leaders over MPI, and the leaders hand the result back to the other ranks of their
+   * process. The number of MPI messages then grows with the number of processes rather than with
+   * the number of ranks.
+   *
+   * @param all_to_all_max_in_flight The maximum number of peers an all-to-all exchanges data with
+   * at once. Must be positive.
+   * @param hierarchical_collectives Whether to use the hierarchical all-gather and all-reduce.
+   * @param wait_strategy How the ranks living in the same process wait for each other, unless
+   * changed for an individual communicator through its ThreadComm.
+   */
+  explicit MPINetwork(std::int32_t all_to_all_max_in_flight = DEFAULT_ALL_TO_ALL_MAX_IN_FLIGHT,
+                      bool hierarchical_collectives         = true,
+                      WaitStrategy wait_strategy            = WaitStrategy::BLOCK);
 
   ~MPINetwork() override;
 
@@ -49,6 +84,19 @@ class MPINetwork final : public BackendNetwork {
                   legate::comm::coll::CollDataType type,
                   legate::comm::coll::CollComm global_comm) override;
 
+  /**
+   * @brief Perform an all-gather operation among the ranks of the global communicator.
+   *
+   * See the constructor for when the hierarchical algorithm is used. Otherwise, the root gathers
+   * all buffers and broadcasts the result.
+   *
+   * @param sendbuf The source buffer. This buffer must be of size count x CollDataType size.
+   * @param recvbuf The destination buffer. This buffer must be of size global_comm_size x count x
+   * CollDataType size.
+   * @param count The number of elements each rank contributes.
+   * @param type The data type of the elements.
+   * @param global_comm The global communicator.
+   */
   void all_gather(const void* sendbuf,
                   void* recvbuf,
                   int count,
@@ -59,6 +107,9 @@ class MPINetwork final : public BackendNetwork {
    * @brief Perform an all-reduce operation among the ranks of the global communicator using MPI
    * point to point communication.
    *
+   * See the constructor for when the hierarchical algorithm is used. Otherwise, the root reduces
+   * all buffers and broadcasts the result.
+   *
    * @param sendbuf The source buffer to reduce. This buffer must be of size count x CollDataType
    * size in bytes.
    * @param recvbuf The destination buffer to receive the reduced result into. This buffer must be
@@ -75,7 +126,251 @@ class MPINetwork final : public BackendNetwork {
                   ReductionOpKind op,
                   legate::comm::coll::CollComm global_comm) override;
 
+  void broadcast(void* buf,
+                 int count,
+                 legate::comm::coll::CollDataType type,
+                 int root,
+                 legate::comm::coll::CollComm global_comm) override;
+
+  void gather(const void* sendbuf,
+              void* recvbuf,
+              int count,
+              legate::comm::coll::CollDataType type,
+              int root,
+              legate::comm::coll::CollComm global_comm) override;
+
+  void reduce(const void* sendbuf,
+              void* recvbuf,
+              int count,
+              legate::comm::coll::CollDataType type,
+              ReductionOpKind op,
+              int root,
+              legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Perform a reduce-scatter using a pairwise exchange.
+   *
+   * In step `i`, each rank sends the block owned by the rank `i` places after it, receives its own
+   * block from the rank `i` places before it, and folds it into the result. Every rank therefore
+   * sends and receives (global_comm_size - 1) x recvcount elements, instead of the global_comm_size
+   * x recvcount x global_comm_size elements an all-reduce would move through the root.
+   *
+   * @param sendbuf The source buffer to reduce. This buffer must be of size global_comm_size x
+   * recvcount x CollDataType size.
+   * @param recvbuf The destination buffer. This buffer must be of size recvcount x CollDataType
+   * size.
+   * @param recvcount The number of elements each rank receives.
+   * @param type The data type of the elements.
+   * @param op The reduction operation to perform.
+   * @param global_comm The global communicator.
+   */
+  void reduce_scatter(const void* sendbuf,
+                      void* recvbuf,
+                      int recvcount,
+                      legate::comm::coll::CollDataType type,
+                      ReductionOpKind op,
+                      legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Start a non-blocking all-to-all-v operation.
+   *
+   * Unlike `all_to_all_v()`, all sends and receives are posted up front (including those with
+   * ranks living in the same process, which cannot be served by a blocking shared memory copy),
+   * and MPI progresses them in the background, or whenever the request is tested.
+   *
+   * @param sendbuf The source buffer.
+   * @param sendcounts The number of elements to send to each rank.
+   * @param sdispls The offset (in elements) in `sendbuf` of the data sent to each rank.
+   * @param recvbuf The destination buffer, must not alias `sendbuf`.
+   * @param recvcounts The number of elements to receive from each rank.
+   * @param rdispls The offset (in elements) in `recvbuf` of the data received from each rank.
+   * @param type The data type of the elements.
+   * @param global_comm The global communicator.
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_to_all_v(
+    const void* sendbuf,
+    const int sendcounts[],
+    const int sdispls[],
+    void* recvbuf,
+    const int recvcounts[],
+    const int rdispls[],
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm) override;
+
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_to_all(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm) override;
+
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_gather(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Start a non-blocking all-reduce operation.
+   *
+   * Each rank reduces one slice of the buffers of all ranks (a reduce-scatter), after which the
+   * ranks all-gather the reduced slices, like the leaders of the hierarchical `all_reduce()` do.
+   * Every rank sends and receives about 2 x count elements and needs a temporary buffer of about
+   * count elements, regardless of the number of ranks. The all-gather is started when the request
+   * is tested or waited on after the reduce-scatter has completed, and the all-gathers of the
+   * all-reduces of a communicator are started in the order the all-reduces were.
+   *
+   * @param sendbuf The source buffer to reduce. This buffer must be of size count x CollDataType
+   * size.
+   * @param recvbuf The destination buffer to receive the reduced result into. This buffer must be
+   * of size count x CollDataType size.
+   * @param count The number of elements to reduce.
+   * @param type The data type of the elements.
+   * @param op The reduction operation to perform.
+   * @param global_comm The global communicator.
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_reduce(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    ReductionOpKind op,
+    legate::comm::coll::CollComm global_comm) override;
+
  private:
+  /**
+   * @brief The location of the per-rank segments in an all-to-all buffer.
+   *
+   * If `counts` (resp. `displs`) is null, every segment holds `count` elements (resp. the
+   * segments are laid out back to back in rank order).
+   */
+  class SegmentLayout {
+   public:
+    [[nodiscard]] int count_of(int rank) const;
+    [[nodiscard]] std::ptrdiff_t displ_of(int rank) const;
+
+    const int* counts{};
+    const int* displs{};
+    int count{};
+  };
+
+  using tag_generator_type = int (MPINetwork::*)(int, int, legate::comm::coll::CollComm) const;
+
+  /**
+   * @brief The global ranks of a communicator grouped by the process they live in.
+   */
+  class ProcessLayout;
+
+  /**
+   * @brief A non-blocking all-reduce, performed as a reduce-scatter followed by an all-gather of
+   * the reduced slices.
+   */
+  class AllReduceRequest;
+
+  /**
+   * @return The non-blocking all-reduces of the communicator that have yet to start their
+   * all-gather, in the order they were started.
+   */
+  [[nodiscard]] std::deque<AllReduceRequest*>& pending_all_reduces_of_(
+    legate::comm::coll::CollComm global_comm);
+
+  /**
+   * @return Whether the hierarchical algorithms should be used on the communicator.
+   */
+  [[nodiscard]] bool use_hierarchical_(legate::comm::coll::CollComm global_comm) const;
+
+  /**
+   * @brief Perform an all-gather in three stages: the ranks of each process copy their
+   * contribution into a staging buffer of their leader, the leaders exchange their staging
+   * buffers, and all ranks copy the result out of the staging buffer of their leader.
+   */
+  void all_gather_hierarchical_(const void* sendbuf,
+                                void* recvbuf,
+                                int count,
+                                legate::comm::coll::CollDataType type,
+                                legate::comm::coll::CollComm global_comm);
+
+  /**
+   * @brief Perform an all-reduce in three stages: the ranks of each process reduce one slice each
+   * of their send buffers into the receive buffer of their leader, the leaders all-reduce their
+   * receive buffers, and all ranks copy the result out of the receive buffer of their leader.
+   */
+  void all_reduce_hierarchical_(const void* sendbuf,
+                                void* recvbuf,
+                                int count,
+                                legate::comm::coll::CollDataType type,
+                                ReductionOpKind op,
+                                legate::comm::coll::CollComm global_comm);
+
+  /**
+   * @brief All-reduce a buffer among the leaders of all processes.
+   *
+   * Each leader reduces one slice of the buffer (a reduce-scatter), after which the leaders
+   * all-gather the reduced slices. Every leader sends and receives about 2 x count elements
+   * regardless of the number of processes.
+   */
+  void all_reduce_leaders_(void* buf,
+                           int count,
+                           legate::comm::coll::CollDataType type,
+                           ReductionOpKind op,
+                           const ProcessLayout& processes,
+                           legate::comm::coll::CollComm global_comm);
+
+  /**
+   * @brief All-gather the segments of a buffer among the leaders of all processes.
+   *
+   * @param buf The buffer, holding the segment of this leader's process on entry and the segments
+   * of all processes on exit.
+   * @param layout The location of the segment of each process, indexed by process.
+   * @param type The data type of the elements.
+   * @param processes The process layout of the communicator.
+   * @param global_comm The global communicator.
+   */
+  void all_gather_leaders_(void* buf,
+                           const SegmentLayout& layout,
+                           legate::comm::coll::CollDataType type,
+                           const ProcessLayout& processes,
+                           legate::comm::coll::CollComm global_comm);
+
+  /**
+   * @brief Copy the segments destined to this rank out of the send buffers of all ranks living in
+   * the same process (including this one), bypassing MPI.
+   */
+  static void all_to_all_local_(const void* sendbuf,
+                                const SegmentLayout& send_layout,
+                                void* recvbuf,
+                                const SegmentLayout& recv_layout,
+                                std::ptrdiff_t type_extent,
+                                legate::comm::coll::CollComm global_comm);
+
+  void all_to_all_impl_(const void* sendbuf,
+                        const SegmentLayout& send_layout,
+                        void* recvbuf,
+                        const SegmentLayout& recv_layout,
+                        legate::comm::coll::CollDataType type,
+                        tag_generator_type generate_tag,
+                        legate::comm::coll::CollComm global_comm);
+
+  /**
+   * @brief Post the sends and receives of an all-to-all with every other rank, and copy the
+   * segment this rank sends to itself.
+   *
+   * @return The requests of the posted operations.
+   */
+  [[nodiscard]] std::vector<MPIInterface::MPI_Request> iall_to_all_impl_(
+    const void* sendbuf,
+    const SegmentLayout& send_layout,
+    void* recvbuf,
+    const SegmentLayout& recv_layout,
+    legate::comm::coll::CollDataType type,
+    tag_generator_type generate_tag,
+    legate::comm::coll::CollComm global_comm);
+
   void gather_(const void* sendbuf,
                void* recvbuf,
                int count,
@@ -122,29 +417,48 @@ class MPINetwork final : public BackendNetwork {
                                             int rank2,
                                             legate::comm::coll::CollComm global_comm) const;
 
+  [[nodiscard]] int generate_reduce_scatter_tag_(int rank1,
+                                                 int rank2,
+                                                 legate::comm::coll::CollComm global_comm) const;
+
+  [[nodiscard]] int generate_allgather_tag_(int rank1,
+                                            int rank2,
+                                            legate::comm::coll::CollComm global_comm) const;
+
+  [[nodiscard]] int generate_allreduce_tag_(int rank1,
+                                            int rank2,
+                                            legate::comm::coll::CollComm global_comm) const;
+
+  [[nodiscard]] int generate_leader_reduce_scatter_tag_(
+    int rank1, int rank2, legate::comm::coll::CollComm global_comm) const;
+
+  [[nodiscard]] int generate_leader_allgather_tag_(int rank1,
+                                                   int rank2,
+                                                   legate::comm::coll::CollComm global_comm) const;
+
+  [[nodiscard]] int generate_allreduce_allgather_tag_(
+    int rank1, int rank2, legate::comm::coll::CollComm global_comm) const;
+
   [[nodiscard]] int generate_bcast_tag_(int rank, legate::comm::coll::CollComm global_comm) const;
 
   [[nodiscard]] int generate_gather_tag_(int rank, legate::comm::coll::CollComm global_comm) const;
 
   [[nodiscard]] int generate_reduce_tag_(int rank, legate::comm::coll::CollComm global_comm) const;
 
-  /** @brief Apply a reduction operation for each index in destination and source buffer. Store
-   * result in destination buffer.
-   *
-   * @param dst Destination buffer (also serves as one input, modified in-place).
-   * @param src Source buffer.
-   * @param count Number of elements.
-   * @param op Reduction operation to apply.
-   */
-  static void apply_reduction_(void* dst,
-                               const void* src,
-                               int count,
-                               legate::comm::coll::CollDataType type,
-                               ReductionOpKind op);
-
+  std::int32_t all_to_all_max_in_flight_{};
+  bool hierarchical_collectives_{};
+  WaitStrategy wait_strategy_{};
   int mpi_tag_ub_{};
   bool self_init_mpi_{};
   std::vector<MPIInterface::MPI_Comm> mpi_comms_{};
+  // Shared by the ranks of a communicator that live in this process, indexed by unique id
+  std::vector<std::unique_ptr<ThreadComm>> thread_comms_{};
+  // The all-gathers of the non-blocking all-reduces are started lazily, once their reduce-scatter
+  // has completed. Their messages are only told apart by the order in which they are posted, so
+  // every rank starts them in the order it started the all-reduces.
+  std::mutex pending_all_reduces_mutex_{};
+  std::unordered_map<legate::comm::coll::CollComm, std::deque<AllReduceRequest*>>
+    pending_all_reduces_{};
 };
 
 }  // namespace legate::detail::comm::coll
@@ -0,0 +1,250 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/comm/detail/reduction_helpers.h>
+
+#include <legate/comm/detail/logger.h>
+#include <legate/utilities/detail/traced_exception.h>
+
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+// The SIMD kernels are produced by compiling the same (trivially vectorizable) loops once per
+// instruction set, using per-function target attributes, and picking the widest one supported by
+// the host at runtime. On other architectures (e.g. aarch64, where NEON is part of the baseline)
+// the generic kernels are already vectorized for the native SIMD unit.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define LEGATE_REDUCTION_X86_DISPATCH 1
+#else
+#define LEGATE_REDUCTION_X86_DISPATCH 0
+#endif
+
+namespace legate::detail::comm::coll {
+
+namespace reduction_detail {
+
+namespace {
+
+// The buffers are deliberately not marked __restrict: in-place collectives reduce a buffer into
+// itself or into another part of the same allocation. The compiler still vectorizes the loop,
+// guarded by a runtime overlap check.
+template <typename T, typename F>
+[[gnu::always_inline]] inline void reduce_loop(T* dst, const T* src, std::size_t count, F fn)
+{
+  for (std::size_t i = 0; i < count; ++i) {
+    dst[i] = fn(dst[i], src[i]);
+  }
+}
+
+template <typename T>
+[[gnu::always_inline]] inline void reduce_generic(T* dst,
+                                                  const T* src,
+                                                  std::size_t count,
+                                                  ReductionOpKind op)
+{
+  switch (op) {
+    case legate::ReductionOpKind::ADD: {
+      reduce_loop(dst, src, count, [](T a, T b) { return static_cast<T>(a + b); });
+      return;
+    }
+    case legate::ReductionOpKind::MUL: {
+      reduce_loop(dst, src, count, [](T a, T b) { return static_cast<T>(a * b); });
+      return;
+    }
+    case legate::ReductionOpKind::MAX: {
+      // Spelled out (instead of std::max) so that the compiler can map it directly onto the
+      // vector max instructions, which have the same NaN semantics
+      reduce_loop(dst, src, count, [](T a, T b) { return a < b ? b : a; });
+      return;
+    }
+    case legate::ReductionOpKind::MIN: {
+      reduce_loop(dst, src, count, [](T a, T b) { return b < a ? b : a; });
+      return;
+    }
+    case legate::ReductionOpKind::AND: {
+      if constexpr (std::is_integral_v<T>) {
+        reduce_loop(dst, src, count, [](T a, T b) { return static_cast<T>(a & b); });
+      }
+      return;
+    }
+    case legate::ReductionOpKind::OR: {
+      if constexpr (std::is_integral_v<T>) {
+        reduce_loop(dst, src, count, [](T a, T b) { return static_cast<T>(a | b); });
+      }
+      return;
+    }
+    case legate::ReductionOpKind::XOR: {
+      if constexpr (std::is_integral_v<T>) {
+        reduce_loop(dst, src, count, [](T a, T b) { return static_cast<T>(a ^ b); });
+      }
+      return;
+    }
+  }
+}
+
+template <typename T>
+[[gnu::flatten]] void reduce_default(T* dst, const T* src, std::size_t count, ReductionOpKind op)
+{
+  reduce_generic(dst, src, count, op);
+}
+
+#if LEGATE_REDUCTION_X86_DISPATCH
+template <typename T>
+[[gnu::target("avx2"), gnu::flatten]] void reduce_avx2(T* dst,
+                                                     const T* src,
+                                                     std::size_t count,
+                                                     ReductionOpKind op)
+{
+  reduce_generic(dst, src, count, op);
+}
+
+template <typename T>
+[[gnu::target("avx512f,avx512bw,avx512dq,avx512vl"), gnu::flatten]] void reduce_avx512(
+  T* dst, const T* src, std::size_t count, ReductionOpKind op)
+{
+  reduce_generic(dst, src, count, op);
+}
+#endif
+
+[[nodiscard]] ReductionISA detect_isa()
+{
+#if LEGATE_REDUCTION_X86_DISPATCH
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+      __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl")) {
+    return ReductionISA::AVX512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return ReductionISA::AVX2;
+  }
+#endif
+  return ReductionISA::GENERIC;
+}
+
+}  // namespace
+
+ReductionISA selected_isa()
+{
+  static const auto isa = [] {
+    const auto ret = detect_isa();
+
+    logger().debug() << "Using reduction kernels for ISA " << static_cast<int>(ret);
+    return ret;
+  }();
+
+  return isa;
+}
+
+template <typename T>
+void reduce(T* dst, const T* src, std::size_t count, ReductionOpKind op)
+{
+  switch (selected_isa()) {
+#if LEGATE_REDUCTION_X86_DISPATCH
+    case ReductionISA::AVX512: reduce_avx512(dst, src, count, op); return;
+    case ReductionISA::AVX2: reduce_avx2(dst, src, count, op); return;
+#else
+    case ReductionISA::AVX512: [[fallthrough]];
+    case ReductionISA::AVX2: [[fallthrough]];
+#endif
+    case ReductionISA::GENERIC: reduce_default(dst, src, count, op); return;
+  }
+}
+
+template void reduce<std::int8_t>(std::int8_t*, const std::int8_t*, std::size_t, ReductionOpKind);
+template void reduce<char>(char*, const char*, std::size_t, ReductionOpKind);
+template void reduce<std::uint8_t>(std::uint8_t*,
+                                   const std::uint8_t*,
+                                   std::size_t,
+                                   ReductionOpKind);
+template void reduce<int>(int*, const int*, std::size_t, ReductionOpKind);
+template void reduce<std::uint32_t>(std::uint32_t*,
+                                    const std::uint32_t*,
+                                    std::size_t,
+                                    ReductionOpKind);
+template void reduce<std::int64_t>(std::int64_t*,
+                                   const std::int64_t*,
+                                   std::size_t,
+                                   ReductionOpKind);
+template void reduce<std::uint64_t>(std::uint64_t*,
+                                    const std::uint64_t*,
+                                    std::size_t,
+                                    ReductionOpKind);
+template void reduce<float>(float*, const float*, std::size_t, ReductionOpKind);
+template void reduce<double>(double*, const double*, std::size_t, ReductionOpKind);
+
+}  // namespace reduction_detail
+
+void check_reduction_op(legate::comm::coll::CollDataType type,
+                        ReductionOpKind op,
+                        std::string_view coll_name)
+{
+  switch (op) {
+    case legate::ReductionOpKind::ADD: [[fallthrough]];
+    case legate::ReductionOpKind::MUL: [[fallthrough]];
+    case legate::ReductionOpKind::MAX: [[fallthrough]];
+    case legate::ReductionOpKind::MIN: break;
+    case legate::ReductionOpKind::OR: [[fallthrough]];
+    case legate::ReductionOpKind::XOR: [[fallthrough]];
+    case legate::ReductionOpKind::AND:
+      if (type == legate::comm::coll::CollDataType::CollFloat ||
+          type == legate::comm::coll::CollDataType::CollDouble) {
+        throw legate::detail::TracedException<std::invalid_argument>{fmt::format(
+          "{} does not support float or double reduction with bitwise operations", coll_name)};
+      }
+      break;
+  }
+}
+
+void apply_reduction(void* dst,
+                     const void* src,
+                     std::size_t count,
+                     legate::comm::coll::CollDataType type,
+                     ReductionOpKind op)
+{
+  switch (type) {
+    case legate::comm::coll::CollDataType::CollInt8: {
+      apply_reduction_typed<std::int8_t>(dst, src, count, op);
+      break;
+    }
+    case legate::comm::coll::CollDataType::CollChar: {
+      apply_reduction_typed<char>(dst, src, count, op);
+      break;
+    }
+    case legate::comm::coll::CollDataType::CollUint8: {
+      apply_reduction_typed<std::uint8_t>(dst, src, count, op);
+      break;
+    }
+    case legate::comm::coll::CollDataType::CollInt: {
+      apply_reduction_typed<int>(dst, src, count, op);
+      break;
+    }
+    case legate::comm::coll::CollDataType::CollUint32: {
+      apply_reduction_typed<std::uint32_t>(dst, src, count, op);
+      break;
+    }
+    case legate::comm::coll::CollDataType::CollInt64: {
+      apply_reduction_typed<std::int64_t>(dst, src, count, op);
+      break;
+    }
+    case legate::comm::coll::CollDataType::CollUint64: {
+      apply_reduction_typed<std::uint64_t>(dst, src, count, op);
+      break;
+    }
+    case legate::comm::coll::CollDataType::CollFloat: {
+      apply_reduction_typed<float>(dst, src, count, op);
+      break;
+    }
+    case legate::comm::coll::CollDataType::CollDouble: {
+      apply_reduction_typed<double>(dst, src, count, op);
+      break;
+    }
+  }
+}
+
+}  // namespace legate::detail::comm::coll
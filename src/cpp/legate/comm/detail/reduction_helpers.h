@@ -8,20 +8,87 @@
 
 #include <legate/comm/coll_comm.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
 namespace legate::detail::comm::coll {
 
 /**
  * @brief Apply a reduction operation for each index in destination and source buffer. Store result
  * in destination buffer.
  *
+ * The reduction is performed by SIMD kernels selected at runtime for the instruction sets
+ * supported by the host.
+ *
  * @tparam T The data type of the buffers.
  * @param dst Destination buffer (also serves as one input, modified in-place).
- * @param src Source buffer.
+ * @param src Source buffer. May overlap with `dst`, in which case the elements are combined in
+ * increasing index order.
  * @param count Number of elements.
  * @param op Reduction operation to apply.
+ *
+ * @throw std::invalid_argument If `op` is a bitwise operation and `T` is not integral.
+ */
+template <typename T>
+void apply_reduction_typed(void* dst, const void* src, std::size_t count, ReductionOpKind op);
+
+/**
+ * @brief Apply a reduction operation for each index in destination and source buffer. Store result
+ * in destination buffer.
+ *
+ * This is the type-erased version of `apply_reduction_typed()`, which all CPU collective backends
+ * share.
+ *
+ * @param dst Destination buffer (also serves as one input, modified in-place).
+ * @param src Source buffer. May overlap with `dst`, in which case the elements are combined in
+ * increasing index order.
+ * @param count Number of elements.
+ * @param type The data type of the buffers.
+ * @param op Reduction operation to apply.
+ *
+ * @throw std::invalid_argument If `op` is a bitwise operation and `type` is a floating point type.
  */
+void apply_reduction(void* dst,
+                     const void* src,
+                     std::size_t count,
+                     legate::comm::coll::CollDataType type,
+                     ReductionOpKind op);
+
+/**
+ * @brief Check that a reduction operation can be applied to a data type.
+ *
+ * Collectives must call this before any rank publishes its buffers, as throwing afterwards would
+ * leave the peers waiting for it forever.
+ *
+ * @param type The data type of the buffers.
+ * @param op The reduction operation.
+ * @param coll_name The name of the collective, used in the error message.
+ *
+ * @throw std::invalid_argument If `op` is a bitwise operation and `type` is a floating point type.
+ */
+void check_reduction_op(legate::comm::coll::CollDataType type,
+                        ReductionOpKind op,
+                        std::string_view coll_name);
+
+namespace reduction_detail {
+
+/**
+ * @brief The instruction sets for which reduction kernels are compiled.
+ */
+enum class ReductionISA : std::uint8_t { GENERIC, AVX2, AVX512 };
+
+/**
+ * @return The instruction set used by the reduction kernels on this host.
+ */
+[[nodiscard]] ReductionISA selected_isa();
+
+// Defined (and explicitly instantiated for the C++ type of each CollDataType) in
+// reduction_helpers.cc.
 template <typename T>
-void apply_reduction_typed(void* dst, const void* src, unsigned count, ReductionOpKind op);
+void reduce(T* dst, const T* src, std::size_t count, ReductionOpKind op);
+
+}  // namespace reduction_detail
 
 }  // namespace legate::detail::comm::coll
 
@@ -6,70 +6,68 @@
 
 #pragma once
 
-#include <legate/utilities/abort.h>
+#include <legate/comm/detail/reduction_helpers.h>
 #include <legate/utilities/detail/traced_exception.h>
 
-#include <algorithm>
-#include <functional>
+#include <cstdint>
+#include <stdexcept>
 #include <type_traits>
 
 namespace legate::detail::comm::coll {
 
+namespace reduction_detail {
+
+extern template void reduce<std::int8_t>(std::int8_t*,
+                                         const std::int8_t*,
+                                         std::size_t,
+                                         ReductionOpKind);
+extern template void reduce<char>(char*, const char*, std::size_t, ReductionOpKind);
+extern template void reduce<std::uint8_t>(std::uint8_t*,
+                                          const std::uint8_t*,
+                                          std::size_t,
+                                          ReductionOpKind);
+extern template void reduce<int>(int*, const int*, std::size_t, ReductionOpKind);
+extern template void reduce<std::uint32_t>(std::uint32_t*,
+                                           const std::uint32_t*,
+                                           std::size_t,
+                                           ReductionOpKind);
+extern template void reduce<std::int64_t>(std::int64_t*,
+                                          const std::int64_t*,
+                                          std::size_t,
+                                          ReductionOpKind);
+extern template void reduce<std::uint64_t>(std::uint64_t*,
+                                           const std::uint64_t*,
+                                           std::size_t,
+                                           ReductionOpKind);
+extern template void reduce<float>(float*, const float*, std::size_t, ReductionOpKind);
+extern template void reduce<double>(double*, const double*, std::size_t, ReductionOpKind);
+
+}  // namespace reduction_detail
+
 template <typename T>
-void apply_reduction_typed(void* dst, const void* src, unsigned count, ReductionOpKind op)
+void apply_reduction_typed(void* dst, const void* src, std::size_t count, ReductionOpKind op)
 {
-  auto* dst_typed       = static_cast<T*>(dst);
-  const auto* src_typed = static_cast<const T*>(src);
-
-  switch (op) {
-    case legate::ReductionOpKind::ADD: {
-      std::transform(dst_typed, dst_typed + count, src_typed, dst_typed, std::plus<T>{});
-      break;
-    }
-    case legate::ReductionOpKind::MUL: {
-      std::transform(dst_typed, dst_typed + count, src_typed, dst_typed, std::multiplies<T>{});
-      break;
-    }
-    case legate::ReductionOpKind::MAX: {
-      std::transform(dst_typed, dst_typed + count, src_typed, dst_typed, [](T a, T b) {
-        return std::max(a, b);
-      });
-      break;
-    }
-    case legate::ReductionOpKind::MIN: {
-      std::transform(dst_typed, dst_typed + count, src_typed, dst_typed, [](T a, T b) {
-        return std::min(a, b);
-      });
-      break;
-    }
-    case legate::ReductionOpKind::AND: {
-      if constexpr (std::is_integral_v<T>) {
-        std::transform(dst_typed, dst_typed + count, src_typed, dst_typed, std::bit_and<T>{});
-      } else {
+  if constexpr (!std::is_integral_v<T>) {
+    switch (op) {
+      case legate::ReductionOpKind::ADD: [[fallthrough]];
+      case legate::ReductionOpKind::MUL: [[fallthrough]];
+      case legate::ReductionOpKind::MAX: [[fallthrough]];
+      case legate::ReductionOpKind::MIN: break;
+      case legate::ReductionOpKind::AND: {
         throw legate::detail::TracedException<std::invalid_argument>{
           "Reduction does not support non-integral types with AND"};
       }
-      break;
-    }
-    case legate::ReductionOpKind::OR: {
-      if constexpr (std::is_integral_v<T>) {
-        std::transform(dst_typed, dst_typed + count, src_typed, dst_typed, std::bit_or<T>{});
-      } else {
+      case legate::ReductionOpKind::OR: {
         throw legate::detail::TracedException<std::invalid_argument>{
           "Reduction does not support non-integral types with OR"};
       }
-      break;
-    }
-    case legate::ReductionOpKind::XOR: {
-      if constexpr (std::is_integral_v<T>) {
-        std::transform(dst_typed, dst_typed + count, src_typed, dst_typed, std::bit_xor<T>{});
-      } else {
+      case legate::ReductionOpKind::XOR: {
         throw legate::detail::TracedException<std::invalid_argument>{
           "Reduction does not support non-integral types with XOR"};
       }
-      break;
     }
   }
+  reduction_detail::reduce(static_cast<T*>(dst), static_cast<const T*>(src), count, op);
 }
 
 }  // namespace legate::detail::comm::coll
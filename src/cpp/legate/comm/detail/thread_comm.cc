@@ -6,54 +6,111 @@
 
 #include <legate/comm/detail/thread_comm.h>
 
-#include <legate/comm/detail/pthread_barrier.h>
 #include <legate/utilities/assert.h>
 
+#include <cstddef>
+#include <mutex>
+
 namespace legate::detail::comm::coll {
 
-void ThreadComm::init(std::int32_t global_comm_size)
+void ThreadComm::init(std::int32_t global_comm_size, WaitStrategy wait_strategy)
+{
+  init(global_comm_size, global_comm_size, wait_strategy);
+}
+
+void ThreadComm::init(std::int32_t global_comm_size,
+                      std::int32_t num_threads,
+                      WaitStrategy wait_strategy)
 {
   LEGATE_CHECK(global_comm_size > 0);
-  CHECK_PTHREAD_CALL_V(
-    pthread_barrier_init(&barrier_, nullptr, static_cast<unsigned int>(global_comm_size)));
+  LEGATE_CHECK(num_threads > 0 && num_threads <= global_comm_size);
+  barrier_.init(num_threads);
   buffers_ = std::make_unique<atomic_buffer_type[]>(static_cast<std::size_t>(global_comm_size));
-  displs_  = std::make_unique<atomic_displ_type[]>(static_cast<std::size_t>(global_comm_size));
+  recv_buffers_ =
+    std::make_unique<atomic_recv_buffer_type[]>(static_cast<std::size_t>(global_comm_size));
+  displs_ = std::make_unique<atomic_displ_type[]>(static_cast<std::size_t>(global_comm_size));
+  rendezvous_counts_ =
+    std::make_unique<std::uint64_t[]>(static_cast<std::size_t>(global_comm_size));
+  global_comm_size_ = global_comm_size;
+  num_threads_      = num_threads;
   entered_finalize_ = 0;
-  ready_flag_       = true;
+  set_wait_strategy(wait_strategy);
+  ready_flag_ = true;
+  notify();
 }
 
 void ThreadComm::finalize(std::int32_t global_comm_size, bool is_finalizer)
 {
   ++entered_finalize_;
+  notify();
   if (is_finalizer) {
     // Need to ensure that all other threads have left the barrier before we can destroy the
     // thread_comm.
-    while (entered_finalize_ != global_comm_size) {}
+    wait_until([&] { return entered_finalize_ == global_comm_size; });
     entered_finalize_ = 0;
     clear();
+    notify();
   } else {
     // The remaining threads are not allowed to leave until the finalizer thread has finished
     // its work.
-    while (ready()) {}
+    wait_until([&] { return !ready(); });
   }
 }
 
 void ThreadComm::clear() noexcept
 {
-  CHECK_PTHREAD_CALL_V(pthread_barrier_destroy(&barrier_));
   buffers_.reset();
+  recv_buffers_.reset();
   displs_.reset();
+  rendezvous_counts_.reset();
+  pending_rendezvous_.clear();
   ready_flag_ = false;
 }
 
-void ThreadComm::barrier_local()
+void ThreadComm::barrier_local() { barrier_.arrive_and_wait(event_, wait_strategy()); }
+
+std::shared_ptr<ThreadComm::Rendezvous> ThreadComm::next_rendezvous(std::int32_t global_rank)
 {
-  if (const auto ret = pthread_barrier_wait(&barrier_)) {
-    if (ret == PTHREAD_BARRIER_SERIAL_THREAD) {
-      return;
-    }
-    CHECK_PTHREAD_CALL_V(ret);
+  LEGATE_ASSERT(global_rank >= 0 && global_rank < global_comm_size_);
+
+  // Each rank only ever touches its own counter
+  const auto seq_num = rendezvous_counts_[static_cast<std::size_t>(global_rank)]++;
+  const std::scoped_lock<std::mutex> lock{rendezvous_mutex_};
+  auto it = pending_rendezvous_.find(seq_num);
+
+  if (it == pending_rendezvous_.end()) {
+    it = pending_rendezvous_
+           .emplace(seq_num,
+                    PendingRendezvous{
+                      std::make_shared<Rendezvous>(global_comm_size_, num_threads_), 0})
+           .first;
+  }
+
+  auto ret = it->second.rendezvous;
+
+  // The ranks share ownership from now on
+  if (++it->second.num_fetched == num_threads_) {
+    pending_rendezvous_.erase(it);
   }
+  return ret;
+}
+
+// ==========================================================================================
+
+ThreadComm::Rendezvous::Rendezvous(std::int32_t global_comm_size, std::int32_t num_ranks)
+  : num_ranks_{num_ranks},
+    buffers_(static_cast<std::size_t>(global_comm_size)),
+    recv_buffers_(static_cast<std::size_t>(global_comm_size)),
+    displs_(static_cast<std::size_t>(global_comm_size))
+{
+  LEGATE_CHECK(num_ranks > 0 && num_ranks <= global_comm_size);
+}
+
+void ThreadComm::Rendezvous::arrive() { arrivals_.fetch_add(1, std::memory_order_acq_rel); }
+
+bool ThreadComm::Rendezvous::reached(std::size_t phase) const
+{
+  return arrivals_.load(std::memory_order_acquire) >= phase * static_cast<std::size_t>(num_ranks_);
 }
 
 }  // namespace legate::detail::comm::coll
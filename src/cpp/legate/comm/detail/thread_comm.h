@@ -6,36 +6,146 @@
 
 #pragma once
 
-#include <legate/comm/detail/pthread_barrier.h>
+#include <legate/comm/detail/wait_strategy.h>
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace legate::detail::comm::coll {
 
 class ThreadComm {
  public:
-  using atomic_buffer_type = std::atomic<const void*>;
-  using atomic_displ_type  = std::atomic<const int*>;
+  using atomic_buffer_type      = std::atomic<const void*>;
+  using atomic_recv_buffer_type = std::atomic<void*>;
+  using atomic_displ_type       = std::atomic<const int*>;
 
-  void init(std::int32_t global_comm_size);
+  /**
+   * @brief The meeting point of the ranks taking part in one non-blocking collective.
+   *
+   * Unlike the buffers of the ThreadComm itself, which are reused by every blocking collective and
+   * guarded by barriers, each non-blocking collective gets its own rendezvous, so any number of
+   * them can be in flight at once. Ranks synchronize through a phase counter that never blocks:
+   * each rank `arrive()`s once per phase, and a phase has been reached once all ranks have
+   * arrived at it.
+   */
+  class Rendezvous {
+   public:
+    /**
+     * @param global_comm_size The number of buffer slots, one per global rank.
+     * @param num_ranks The number of ranks taking part in the collective.
+     */
+    Rendezvous(std::int32_t global_comm_size, std::int32_t num_ranks);
+
+    /**
+     * @brief Signal that the calling rank is done with the current phase.
+     *
+     * Anything the rank wrote before arriving (e.g. its slots in `buffers()`) is visible to all
+     * ranks that have observed the next phase being reached.
+     */
+    void arrive();
+
+    /**
+     * @param phase The phase to check, starting at 1 (i.e. all ranks having arrived once).
+     *
+     * @return `true` if all ranks have arrived at least `phase` times.
+     */
+    [[nodiscard]] bool reached(std::size_t phase) const;
+
+    [[nodiscard]] const void** buffers();
+    [[nodiscard]] void** recv_buffers();
+    [[nodiscard]] const int** displs();
+
+   private:
+    std::int32_t num_ranks_{};
+    std::atomic<std::size_t> arrivals_{};
+    std::vector<const void*> buffers_{};
+    std::vector<void*> recv_buffers_{};
+    std::vector<const int*> displs_{};
+  };
+
+  void init(std::int32_t global_comm_size, WaitStrategy wait_strategy);
+  // Slots for global_comm_size ranks, of which only num_threads (the ones living in this process)
+  // take part in barrier_local() and finalize()
+  void init(std::int32_t global_comm_size, std::int32_t num_threads, WaitStrategy wait_strategy);
   void finalize(std::int32_t global_comm_size, bool is_finalizer);
   void clear() noexcept;
   void barrier_local();
 
+  /**
+   * @brief Wait until `done()` returns `true`, following the wait strategy of the communicator.
+   *
+   * `done()` must only read sequentially consistent atomics (such as the slots of `buffers()`),
+   * and whoever makes it return `true` must call `notify()` afterwards.
+   *
+   * @param done The condition to wait for.
+   */
+  template <typename F>
+  void wait_until(F&& done);
+
+  /**
+   * @brief Wake up the ranks waiting in `wait_until()`, so that they re-check their condition.
+   */
+  void notify();
+
+  [[nodiscard]] WaitStrategy wait_strategy() const;
+  /**
+   * @brief Change how the ranks of this communicator wait for each other.
+   *
+   * Takes effect for waits that start after the call. Ranks that are already waiting finish
+   * their current wait with the strategy they started with.
+   *
+   * @param wait_strategy The new wait strategy.
+   */
+  void set_wait_strategy(WaitStrategy wait_strategy);
+
   [[nodiscard]] bool ready() const;
   [[nodiscard]] const atomic_buffer_type* buffers() const;
   [[nodiscard]] atomic_buffer_type* buffers();
+  [[nodiscard]] const atomic_recv_buffer_type* recv_buffers() const;
+  [[nodiscard]] atomic_recv_buffer_type* recv_buffers();
   [[nodiscard]] const atomic_displ_type* displs() const;
   [[nodiscard]] atomic_displ_type* displs();
 
+  /**
+   * @brief Get the rendezvous of the next non-blocking collective started by a rank.
+   *
+   * All ranks must start their non-blocking collectives in the same order, the n-th call made by
+   * each rank then returns the same rendezvous.
+   *
+   * @param global_rank The global rank of the caller.
+   *
+   * @return The rendezvous.
+   */
+  [[nodiscard]] std::shared_ptr<Rendezvous> next_rendezvous(std::int32_t global_rank);
+
  private:
+  class PendingRendezvous {
+   public:
+    std::shared_ptr<Rendezvous> rendezvous{};
+    std::int32_t num_fetched{};
+  };
+
   std::unique_ptr<atomic_buffer_type[]> buffers_{};
+  std::unique_ptr<atomic_recv_buffer_type[]> recv_buffers_{};
   std::unique_ptr<atomic_displ_type[]> displs_{};
   std::atomic<bool> ready_flag_{};
   std::atomic<std::int32_t> entered_finalize_{};
-  pthread_barrier_t barrier_{};
+  std::atomic<WaitStrategy> wait_strategy_{WaitStrategy::BLOCK};
+  // Wakes up the ranks waiting in wait_until() (including those in barrier_local())
+  WaitEvent event_{};
+  ThreadBarrier barrier_{};
+  std::int32_t global_comm_size_{};
+  std::int32_t num_threads_{};
+  // The number of non-blocking collectives each rank has started so far, indexed by global rank
+  std::unique_ptr<std::uint64_t[]> rendezvous_counts_{};
+  // Rendezvous that have not yet been fetched by all ranks, indexed by sequence number
+  std::unordered_map<std::uint64_t, PendingRendezvous> pending_rendezvous_{};
+  std::mutex rendezvous_mutex_{};
 };
 
 }  // namespace legate::detail::comm::coll
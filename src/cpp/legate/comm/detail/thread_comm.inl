@@ -8,16 +8,54 @@
 
 #include <legate/comm/detail/thread_comm.h>
 
+#include <utility>
+
 namespace legate::detail::comm::coll {
 
+template <typename F>
+void ThreadComm::wait_until(F&& done)
+{
+  event_.wait_until(std::forward<F>(done), wait_strategy());
+}
+
+inline void ThreadComm::notify() { event_.notify_all(); }
+
+inline WaitStrategy ThreadComm::wait_strategy() const
+{
+  return wait_strategy_.load(std::memory_order_relaxed);
+}
+
+inline void ThreadComm::set_wait_strategy(WaitStrategy wait_strategy)
+{
+  wait_strategy_.store(wait_strategy, std::memory_order_relaxed);
+}
+
 inline bool ThreadComm::ready() const { return ready_flag_; }
 
 inline const ThreadComm::atomic_buffer_type* ThreadComm::buffers() const { return buffers_.get(); }
 
 inline ThreadComm::atomic_buffer_type* ThreadComm::buffers() { return buffers_.get(); }
 
+inline const ThreadComm::atomic_recv_buffer_type* ThreadComm::recv_buffers() const
+{
+  return recv_buffers_.get();
+}
+
+inline ThreadComm::atomic_recv_buffer_type* ThreadComm::recv_buffers()
+{
+  return recv_buffers_.get();
+}
+
 inline const ThreadComm::atomic_displ_type* ThreadComm::displs() const { return displs_.get(); }
 
 inline ThreadComm::atomic_displ_type* ThreadComm::displs() { return displs_.get(); }
 
+// ==========================================================================================
+
+inline const void** ThreadComm::Rendezvous::buffers() { return buffers_.data(); }
+
+inline void** ThreadComm::Rendezvous::recv_buffers() { return recv_buffers_.data(); }
+
+inline const int** ThreadComm::Rendezvous::displs() { return displs_.data(); }
+
 }  // namespace legate::detail::comm::coll
@@ -25,8 +25,10 @@
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
 #include <mutex>
 #include <numeric>
+#include <string_view>
 #include <thread>
 #include <unordered_map>
 #include <utility>
@@ -94,6 +96,27 @@ class UCCCommunicator {  // NOLINT(misc-use-internal-linkage)
    */
   [[nodiscard]] ucc_status_t ucc_collective(ucc_coll_args_t* coll_args);
 
+  /**
+   * @brief Post the UCC collective operation without waiting for its completion
+   *
+   * @param coll_args The UCC collective arguments
+   * @param req The handle of the posted collective, must be tested with `test_collective()` until
+   * completion and then finalized. Left untouched if the collective could not be posted.
+   *
+   * @return The UCC status UCC_OK if the collective operation was posted.
+   */
+  [[nodiscard]] ucc_status_t post_collective(ucc_coll_args_t* coll_args, ucc_coll_req_h* req);
+
+  /**
+   * @brief Make progress on the UCC context and test a posted collective for completion
+   *
+   * @param req The handle of the posted collective
+   *
+   * @return UCC_INPROGRESS if the collective is still running, UCC_OK if it completed
+   * successfully, or the error status otherwise.
+   */
+  [[nodiscard]] ucc_status_t test_collective(ucc_coll_req_h req);
+
  private:
   /**
    * @brief Create UCC context for the communicator. This function will abort the program if the
@@ -139,6 +162,39 @@ class UCCCommunicator {  // NOLINT(misc-use-internal-linkage)
   std::size_t timeout_{UCCNetwork::DEFAULT_TIMEOUT_SECONDS};
 };
 
+/**
+ * @brief The state of a non-blocking UCC collective.
+ *
+ * The request finalizes the UCC collective once it completes, and owns the arrays the collective
+ * arguments point to.
+ */
+class UCCRequest final : public CollRequest {  // NOLINT(misc-use-internal-linkage)
+ public:
+  /**
+   * @brief Creates a UCCRequest
+   *
+   * @param ucc_comm The UCC communicator the collective was posted on
+   * @param req The handle of the posted collective
+   * @param counts Storage for the counts and displacements of the collective, if any
+   */
+  UCCRequest(UCCCommunicator* ucc_comm, ucc_coll_req_h req, std::vector<ucc_count_t> counts = {});
+
+  [[nodiscard]] bool test() override;
+
+  /**
+   * @brief Drive the UCC context until the collective completes, without yielding in between.
+   */
+  void wait() override;
+
+ private:
+  [[nodiscard]] bool complete_(ucc_status_t status);
+
+  UCCCommunicator* ucc_comm_{};
+  ucc_coll_req_h req_{};
+  std::vector<ucc_count_t> counts_{};
+  bool completed_{};
+};
+
 class UCCNetwork::Impl {
  public:
   /**
@@ -274,7 +330,188 @@ class UCCNetwork::Impl {
                   ReductionOpKind op,
                   legate::comm::coll::CollComm global_comm);
 
+  /**
+   * @brief Perform a broadcast operation.
+   *
+   * @param buf The buffer to send from on the root, and to receive into on all other ranks. This
+   * buffer must be of size count x dtype_size.
+   * @param count The number of elements to broadcast
+   * @param type The data type of the elements
+   * @param root The global rank to broadcast from
+   * @param global_comm The global communicator, this holds the unique id.
+   */
+  void broadcast(void* buf,
+                 int count,
+                 legate::comm::coll::CollDataType type,
+                 int root,
+                 legate::comm::coll::CollComm global_comm);
+
+  /**
+   * @brief Perform a gather operation.
+   *
+   * @param sendbuf The buffer to send
+   * @param recvbuf The buffer to receive into, only used on the root. This buffer must be of size
+   * global_comm_size x count x dtype_size.
+   * @param count The number of elements to send
+   * @param type The data type of the elements
+   * @param root The global rank to gather into
+   * @param global_comm The global communicator, this holds the unique id.
+   */
+  void gather(const void* sendbuf,
+              void* recvbuf,
+              int count,
+              legate::comm::coll::CollDataType type,
+              int root,
+              legate::comm::coll::CollComm global_comm);
+
+  /**
+   * @brief Perform a reduce operation.
+   *
+   * @param sendbuf The buffer to reduce from
+   * @param recvbuf The buffer to receive the reduced result into, only used on the root. This
+   * buffer must be of size count x dtype_size.
+   * @param count The number of elements to reduce
+   * @param type The data type of the elements
+   * @param op The reduction operation to perform
+   * @param root The global rank to reduce into
+   * @param global_comm The global communicator, this holds the unique id.
+   */
+  void reduce(const void* sendbuf,
+              void* recvbuf,
+              int count,
+              legate::comm::coll::CollDataType type,
+              ReductionOpKind op,
+              int root,
+              legate::comm::coll::CollComm global_comm);
+
+  /**
+   * @brief Perform a reduce-scatter operation.
+   *
+   * @param sendbuf The buffer to reduce from. This buffer must be of size global_comm_size x
+   * recvcount x dtype_size.
+   * @param recvbuf The buffer to receive this rank's block of the reduced result into. This buffer
+   * must be of size recvcount x dtype_size.
+   * @param recvcount The number of elements each rank receives
+   * @param type The data type of the elements
+   * @param op The reduction operation to perform
+   * @param global_comm The global communicator, this holds the unique id.
+   */
+  void reduce_scatter(const void* sendbuf,
+                      void* recvbuf,
+                      int recvcount,
+                      legate::comm::coll::CollDataType type,
+                      ReductionOpKind op,
+                      legate::comm::coll::CollComm global_comm);
+
+  /**
+   * @brief Start a non-blocking all-to-all-v operation.
+   *
+   * @param sendbuf The buffer to send from
+   * @param sendcounts The number of elements to send to each rank
+   * @param sdispls The displacement the elements in the send buffer
+   * @param recvbuf The buffer to receive into. This buffer must be able to hold all the elements
+   * received from all ranks.
+   * @param recvcounts The number of elements to receive from each rank
+   * @param rdispls The offset into the receive buffer to receive from each rank
+   * @param type The data type of the elements
+   * @param global_comm The global communicator, this holds the unique id.
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_to_all_v(
+    const void* sendbuf,
+    const int sendcounts[],
+    const int sdispls[],
+    void* recvbuf,
+    const int recvcounts[],
+    const int rdispls[],
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm);
+
+  /**
+   * @brief Start a non-blocking all-to-all operation.
+   *
+   * @param sendbuf The buffer to send from
+   * @param recvbuf The buffer to receive into. This buffer must be of size global_comm_size x count
+   * x dtype_size.
+   * @param count The number of elements to send
+   * @param type The data type of the elements
+   * @param global_comm The global communicator, this holds the unique id.
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_to_all(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm);
+
+  /**
+   * @brief Start a non-blocking all-gather operation.
+   *
+   * @param sendbuf The buffer to send
+   * @param recvbuf The buffer to receive into. This buffer must be of size global_comm_size x count
+   * x dtype_size.
+   * @param count The number of elements to send
+   * @param type The data type of the elements
+   * @param global_comm The global communicator, this holds the unique id.
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_gather(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm);
+
+  /**
+   * @brief Start a non-blocking all-reduce operation.
+   *
+   * @param sendbuf The buffer to reduce from
+   * @param recvbuf The buffer to receive the reduced result into. This buffer must be of size count
+   * x dtype_size.
+   * @param count The number of elements to reduce
+   * @param type The data type of the elements
+   * @param op The reduction operation to perform
+   * @param global_comm The global communicator, this holds the unique id.
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_reduce(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    ReductionOpKind op,
+    legate::comm::coll::CollComm global_comm);
+
  private:
+  /**
+   * @brief Post a collective on a UCC communicator, and wrap it into a request.
+   *
+   * @param ucc_comm The UCC communicator to post the collective on.
+   * @param coll_args The UCC collective arguments.
+   * @param counts Storage for the counts and displacements `coll_args` points to, if any.
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] static std::unique_ptr<CollRequest> post_(UCCCommunicator* ucc_comm,
+                                                          ucc_coll_args_t* coll_args,
+                                                          std::vector<ucc_count_t> counts = {});
+
+  /**
+   * @brief Look up the UCC communicator of a rank, aborting if there is none.
+   *
+   * @param global_comm The global communicator, this holds the global rank.
+   * @param coll_name The name of the collective, used in the error message.
+   *
+   * @return The UCC communicator.
+   */
+  [[nodiscard]] UCCCommunicator* find_ucc_comm_(legate::comm::coll::CollComm global_comm,
+                                                std::string_view coll_name);
+
   /**
    * @brief Initialize UCC library, this will call ucc_init() and abort the program if the UCC
    * library initialization fails.
@@ -465,6 +702,20 @@ void UCCNetwork::Impl::all_to_all_v(const void* sendbuf,
                                     const int rdispls[],
                                     legate::comm::coll::CollDataType type,
                                     legate::comm::coll::CollComm global_comm)
+{
+  iall_to_all_v(sendbuf, sendcounts, sdispls, recvbuf, recvcounts, rdispls, type, global_comm)
+    ->wait();
+}
+
+std::unique_ptr<CollRequest> UCCNetwork::Impl::iall_to_all_v(
+  const void* sendbuf,
+  const int sendcounts[],
+  const int sdispls[],
+  void* recvbuf,
+  const int recvcounts[],
+  const int rdispls[],
+  legate::comm::coll::CollDataType type,
+  legate::comm::coll::CollComm global_comm)
 {
   LEGATE_CHECK(lib_.has_value());
   LEGATE_CHECK(global_comm != nullptr);
@@ -475,27 +726,18 @@ void UCCNetwork::Impl::all_to_all_v(const void* sendbuf,
   LEGATE_CHECK(recvcounts != nullptr);
   LEGATE_CHECK(rdispls != nullptr);
 
-  UCCCommunicator* ucc_comm = [&]() -> UCCCommunicator* {
-    const std::scoped_lock<std::mutex> lock{ucc_comms_lock_};
-    auto it = ucc_comms_.find(global_comm->global_rank);
-
-    if (it == ucc_comms_.end()) {
-      LEGATE_ABORT(
-        fmt::format("Invalid communicator for all_to_all_v, rank: {}", global_comm->global_rank));
-    }
-
-    return it->second.get();
-  }();
-
+  auto* const ucc_comm = find_ucc_comm_(global_comm, "all_to_all_v");
   const auto ucc_dtype = dtype_to_ucc_dtype_(type);
-  // create ucc_count_t arrays for sendcounts, sdispls, recvcounts, rdispls
-  // ucc_count_t std::uint64_t
+  // UCC wants ucc_count_t (std::uint64_t) arrays for sendcounts, sdispls, recvcounts and rdispls,
+  // which must stay alive until the collective completes, so they are owned by the request.
   const auto comm_size = ucc_comm->get_size();
-  // using () for the cunstructor to avoid confusion with initializer_list
-  std::vector<ucc_count_t> sendcounts_count(sendcounts, sendcounts + comm_size);
-  std::vector<ucc_count_t> sdispls_count(sdispls, sdispls + comm_size);
-  std::vector<ucc_count_t> recvcounts_count(recvcounts, recvcounts + comm_size);
-  std::vector<ucc_count_t> rdispls_count(rdispls, rdispls + comm_size);
+  std::vector<ucc_count_t> counts{};
+
+  counts.reserve(4 * comm_size);
+  counts.insert(counts.end(), sendcounts, sendcounts + comm_size);
+  counts.insert(counts.end(), sdispls, sdispls + comm_size);
+  counts.insert(counts.end(), recvcounts, recvcounts + comm_size);
+  counts.insert(counts.end(), rdispls, rdispls + comm_size);
 
   ucc_coll_args_t coll_args{};  // NOLINT(bugprone-invalid-enum-default-initialization)
 
@@ -504,15 +746,16 @@ void UCCNetwork::Impl::all_to_all_v(const void* sendbuf,
   coll_args.coll_type = UCC_COLL_TYPE_ALLTOALLV;
   coll_args.src.info.mem_type        = UCC_MEMORY_TYPE_HOST;
   coll_args.src.info_v.buffer        = const_cast<void*>(sendbuf);
-  coll_args.src.info_v.counts        = static_cast<ucc_count_t*>(sendcounts_count.data());
-  coll_args.src.info_v.displacements = static_cast<ucc_count_t*>(sdispls_count.data());
+  coll_args.src.info_v.counts        = counts.data();
+  coll_args.src.info_v.displacements = counts.data() + comm_size;
   coll_args.src.info_v.datatype      = ucc_dtype;
   coll_args.dst.info_v.buffer        = recvbuf;
-  coll_args.dst.info_v.counts        = static_cast<ucc_count_t*>(recvcounts_count.data());
-  coll_args.dst.info_v.displacements = static_cast<ucc_count_t*>(rdispls_count.data());
+  coll_args.dst.info_v.counts        = counts.data() + (2 * comm_size);
+  coll_args.dst.info_v.displacements = counts.data() + (3 * comm_size);
   coll_args.dst.info_v.datatype      = ucc_dtype;
 
-  LEGATE_CHECK_UCC(ucc_comm->ucc_collective(&coll_args));
+  // Moving the vector into the request does not move its elements, so the pointers stay valid
+  return post_(ucc_comm, &coll_args, std::move(counts));
 }
 
 ucc_coll_args_t UCCNetwork::Impl::make_ucc_coll_args_(const void* sendbuf,
@@ -631,6 +874,190 @@ void UCCNetwork::Impl::all_reduce(const void* sendbuf,
   LEGATE_CHECK_UCC(ucc_comm->ucc_collective(&coll_args));
 }
 
+UCCCommunicator* UCCNetwork::Impl::find_ucc_comm_(legate::comm::coll::CollComm global_comm,
+                                                  std::string_view coll_name)
+{
+  const std::scoped_lock<std::mutex> lock{ucc_comms_lock_};
+  const auto it = ucc_comms_.find(global_comm->global_rank);
+
+  if (it == ucc_comms_.end()) {
+    LEGATE_ABORT(fmt::format(
+      "Invalid communicator for {}, rank: {}", coll_name, global_comm->global_rank));
+  }
+  return it->second.get();
+}
+
+void UCCNetwork::Impl::broadcast(void* buf,
+                                 int count,
+                                 legate::comm::coll::CollDataType type,
+                                 int root,
+                                 legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(lib_.has_value());
+  LEGATE_CHECK(global_comm != nullptr);
+  LEGATE_CHECK(buf != nullptr);
+  LEGATE_CHECK(count >= 0);
+
+  auto* const ucc_comm = find_ucc_comm_(global_comm, "broadcast");
+  // Broadcast only uses the source buffer info, which is the destination on non-root ranks
+  ucc_coll_args_t coll_args =
+    make_ucc_coll_args_(buf, nullptr, count, 0, UCC_COLL_TYPE_BCAST, type);
+
+  coll_args.root = static_cast<ucc_rank_t>(root);
+  LEGATE_CHECK_UCC(ucc_comm->ucc_collective(&coll_args));
+}
+
+void UCCNetwork::Impl::gather(const void* sendbuf,
+                              void* recvbuf,
+                              int count,
+                              legate::comm::coll::CollDataType type,
+                              int root,
+                              legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(lib_.has_value());
+  LEGATE_CHECK(global_comm != nullptr);
+  LEGATE_CHECK(sendbuf != nullptr);
+  LEGATE_CHECK(count >= 0);
+
+  auto* const ucc_comm = find_ucc_comm_(global_comm, "gather");
+  ucc_coll_args_t coll_args =
+    make_ucc_coll_args_(sendbuf,
+                        recvbuf,
+                        count,
+                        static_cast<std::uint64_t>(count) * ucc_comm->get_size(),
+                        UCC_COLL_TYPE_GATHER,
+                        type);
+
+  coll_args.root = static_cast<ucc_rank_t>(root);
+  LEGATE_CHECK_UCC(ucc_comm->ucc_collective(&coll_args));
+}
+
+void UCCNetwork::Impl::reduce(const void* sendbuf,
+                              void* recvbuf,
+                              int count,
+                              legate::comm::coll::CollDataType type,
+                              ReductionOpKind op,
+                              int root,
+                              legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(lib_.has_value());
+  LEGATE_CHECK(global_comm != nullptr);
+  LEGATE_CHECK(sendbuf != nullptr);
+  LEGATE_CHECK(count >= 0);
+
+  auto* const ucc_comm = find_ucc_comm_(global_comm, "reduce");
+  ucc_coll_args_t coll_args =
+    make_ucc_coll_args_(sendbuf, recvbuf, count, count, UCC_COLL_TYPE_REDUCE, type);
+
+  coll_args.op   = redop_to_ucc_redop_(op);
+  coll_args.root = static_cast<ucc_rank_t>(root);
+  if (global_comm->global_rank == root && sendbuf == recvbuf) {
+    coll_args.flags |= UCC_COLL_ARGS_FLAG_IN_PLACE;
+  }
+  LEGATE_CHECK_UCC(ucc_comm->ucc_collective(&coll_args));
+}
+
+void UCCNetwork::Impl::reduce_scatter(const void* sendbuf,
+                                      void* recvbuf,
+                                      int recvcount,
+                                      legate::comm::coll::CollDataType type,
+                                      ReductionOpKind op,
+                                      legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(lib_.has_value());
+  LEGATE_CHECK(global_comm != nullptr);
+  LEGATE_CHECK(sendbuf != nullptr);
+  LEGATE_CHECK(recvbuf != nullptr);
+  LEGATE_CHECK(recvcount >= 0);
+
+  auto* const ucc_comm = find_ucc_comm_(global_comm, "reduce_scatter");
+  ucc_coll_args_t coll_args =
+    make_ucc_coll_args_(sendbuf,
+                        recvbuf,
+                        static_cast<std::uint64_t>(recvcount) * ucc_comm->get_size(),
+                        recvcount,
+                        UCC_COLL_TYPE_REDUCE_SCATTER,
+                        type);
+
+  coll_args.op = redop_to_ucc_redop_(op);
+  LEGATE_CHECK_UCC(ucc_comm->ucc_collective(&coll_args));
+}
+
+std::unique_ptr<CollRequest> UCCNetwork::Impl::iall_to_all(
+  const void* sendbuf,
+  void* recvbuf,
+  int count,
+  legate::comm::coll::CollDataType type,
+  legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(lib_.has_value());
+  LEGATE_CHECK(global_comm != nullptr);
+  LEGATE_CHECK(sendbuf != nullptr);
+  LEGATE_CHECK(recvbuf != nullptr);
+
+  auto* const ucc_comm = find_ucc_comm_(global_comm, "all_to_all");
+  ucc_coll_args_t coll_args =
+    make_ucc_coll_args_(sendbuf, recvbuf, count, count, UCC_COLL_TYPE_ALLTOALL, type);
+
+  return post_(ucc_comm, &coll_args);
+}
+
+std::unique_ptr<CollRequest> UCCNetwork::Impl::iall_gather(
+  const void* sendbuf,
+  void* recvbuf,
+  int count,
+  legate::comm::coll::CollDataType type,
+  legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(lib_.has_value());
+  LEGATE_CHECK(global_comm != nullptr);
+  LEGATE_CHECK(sendbuf != nullptr);
+  LEGATE_CHECK(recvbuf != nullptr);
+
+  auto* const ucc_comm = find_ucc_comm_(global_comm, "all_gather");
+  ucc_coll_args_t coll_args =
+    make_ucc_coll_args_(sendbuf,
+                        recvbuf,
+                        count,
+                        static_cast<std::uint64_t>(count) * ucc_comm->get_size(),
+                        UCC_COLL_TYPE_ALLGATHER,
+                        type);
+
+  return post_(ucc_comm, &coll_args);
+}
+
+std::unique_ptr<CollRequest> UCCNetwork::Impl::iall_reduce(
+  const void* sendbuf,
+  void* recvbuf,
+  int count,
+  legate::comm::coll::CollDataType type,
+  ReductionOpKind op,
+  legate::comm::coll::CollComm global_comm)
+{
+  LEGATE_CHECK(lib_.has_value());
+  LEGATE_CHECK(global_comm != nullptr);
+  LEGATE_CHECK(sendbuf != nullptr);
+  LEGATE_CHECK(recvbuf != nullptr);
+  LEGATE_CHECK(count >= 0);
+
+  auto* const ucc_comm = find_ucc_comm_(global_comm, "all_reduce");
+  ucc_coll_args_t coll_args =
+    make_ucc_coll_args_(sendbuf, recvbuf, count, count, UCC_COLL_TYPE_ALLREDUCE, type);
+
+  coll_args.op = redop_to_ucc_redop_(op);
+  return post_(ucc_comm, &coll_args);
+}
+
+std::unique_ptr<CollRequest> UCCNetwork::Impl::post_(UCCCommunicator* ucc_comm,
+                                                     ucc_coll_args_t* coll_args,
+                                                     std::vector<ucc_count_t> counts)
+{
+  ucc_coll_req_h req{};
+
+  LEGATE_CHECK_UCC(ucc_comm->post_collective(coll_args, &req));
+  return std::make_unique<UCCRequest>(ucc_comm, req, std::move(counts));
+}
+
 // UCCNetwork public interface implementation
 UCCNetwork::UCCNetwork(OOBAllgatherFactory oob_factory, std::uint32_t timeout)
   : impl_{std::make_unique<Impl>(std::move(oob_factory), timeout)}
@@ -715,6 +1142,87 @@ void UCCNetwork::all_reduce(const void* sendbuf,
   impl_->all_reduce(sendbuf, recvbuf, count, type, op, global_comm);
 }
 
+void UCCNetwork::broadcast(void* buf,
+                           int count,
+                           legate::comm::coll::CollDataType type,
+                           int root,
+                           legate::comm::coll::CollComm global_comm)
+{
+  impl_->broadcast(buf, count, type, root, global_comm);
+}
+
+void UCCNetwork::gather(const void* sendbuf,
+                        void* recvbuf,
+                        int count,
+                        legate::comm::coll::CollDataType type,
+                        int root,
+                        legate::comm::coll::CollComm global_comm)
+{
+  impl_->gather(sendbuf, recvbuf, count, type, root, global_comm);
+}
+
+void UCCNetwork::reduce(const void* sendbuf,
+                        void* recvbuf,
+                        int count,
+                        legate::comm::coll::CollDataType type,
+                        ReductionOpKind op,
+                        int root,
+                        legate::comm::coll::CollComm global_comm)
+{
+  impl_->reduce(sendbuf, recvbuf, count, type, op, root, global_comm);
+}
+
+void UCCNetwork::reduce_scatter(const void* sendbuf,
+                                void* recvbuf,
+                                int recvcount,
+                                legate::comm::coll::CollDataType type,
+                                ReductionOpKind op,
+                                legate::comm::coll::CollComm global_comm)
+{
+  impl_->reduce_scatter(sendbuf, recvbuf, recvcount, type, op, global_comm);
+}
+
+std::unique_ptr<CollRequest> UCCNetwork::iall_to_all_v(const void* sendbuf,
+                                                       const int sendcounts[],
+                                                       const int sdispls[],
+                                                       void* recvbuf,
+                                                       const int recvcounts[],
+                                                       const int rdispls[],
+                                                       legate::comm::coll::CollDataType type,
+                                                       legate::comm::coll::CollComm global_comm)
+{
+  return impl_->iall_to_all_v(
+    sendbuf, sendcounts, sdispls, recvbuf, recvcounts, rdispls, type, global_comm);
+}
+
+std::unique_ptr<CollRequest> UCCNetwork::iall_to_all(const void* sendbuf,
+                                                     void* recvbuf,
+                                                     int count,
+                                                     legate::comm::coll::CollDataType type,
+                                                     legate::comm::coll::CollComm global_comm)
+{
+  return impl_->iall_to_all(sendbuf, recvbuf, count, type, global_comm);
+}
+
+std::unique_ptr<CollRequest> UCCNetwork::iall_gather(const void* sendbuf,
+                                                     void* recvbuf,
+                                                     int count,
+                                                     legate::comm::coll::CollDataType type,
+                                                     legate::comm::coll::CollComm global_comm)
+{
+  return impl_->iall_gather(sendbuf, recvbuf, count, type, global_comm);
+}
+
+std::unique_ptr<CollRequest> UCCNetwork::iall_reduce(const void* sendbuf,
+                                                     void* recvbuf,
+                                                     int count,
+                                                     legate::comm::coll::CollDataType type,
+                                                     ReductionOpKind op,
+                                                     legate::comm::coll::CollComm global_comm)
+{
+  return impl_->iall_reduce(sendbuf, recvbuf, count, type, op, global_comm);
+}
+
 void UCCNetwork::shutdown() { impl_->shutdown(); }
 
 UCCCommunicator::UCCCommunicator(int global_rank,
@@ -903,32 +1411,79 @@ ucc_status_t UCCCommunicator::ucc_collective(ucc_coll_args_t* coll_args)
 {
   ucc_coll_req_h req;
 
-  auto status = ucc_collective_init(coll_args, &req, team_);
+  auto status = post_collective(coll_args, &req);
 
   if (status != UCC_OK) {
     return status;
   }
 
-  status = ucc_collective_post(req);
+  status = ucc_collective_test(req);
+  while (status == UCC_INPROGRESS) {
+    status = test_collective(req);
+  }
+
+  ucc_collective_finalize(req);
+  return status;
+}
+
+ucc_status_t UCCCommunicator::post_collective(ucc_coll_args_t* coll_args, ucc_coll_req_h* req)
+{
+  ucc_coll_req_h new_req;
+
+  auto status = ucc_collective_init(coll_args, &new_req, team_);
+
   if (status != UCC_OK) {
-    ucc_collective_finalize(req);
     return status;
   }
 
-  status = ucc_collective_test(req);
-  while (status == UCC_INPROGRESS) {
-    status = ucc_context_progress(context_);
-    if (status != UCC_OK && status != UCC_INPROGRESS) {
-      ucc_collective_finalize(req);
-      return status;
-    }
-    status = ucc_collective_test(req);
+  status = ucc_collective_post(new_req);
+  if (status != UCC_OK) {
+    ucc_collective_finalize(new_req);
+    return status;
   }
 
-  ucc_collective_finalize(req);
+  *req = new_req;
   return status;
 }
 
+ucc_status_t UCCCommunicator::test_collective(ucc_coll_req_h req)
+{
+  const auto status = ucc_context_progress(context_);
+
+  if (status != UCC_OK && status != UCC_INPROGRESS) {
+    return status;
+  }
+  return ucc_collective_test(req);
+}
+
 std::size_t UCCCommunicator::get_size() const { return size_; }
 
+UCCRequest::UCCRequest(UCCCommunicator* ucc_comm,
+                       ucc_coll_req_h req,
+                       std::vector<ucc_count_t> counts)
+  : ucc_comm_{ucc_comm}, req_{req}, counts_{std::move(counts)}
+{
+}
+
+bool UCCRequest::test()
+{
+  return completed_ || complete_(ucc_comm_->test_collective(req_));
+}
+
+void UCCRequest::wait()
+{
+  while (!test()) {}
+}
+
+bool UCCRequest::complete_(ucc_status_t status)
+{
+  if (status == UCC_INPROGRESS) {
+    return false;
+  }
+  ucc_collective_finalize(req_);
+  completed_ = true;
+  LEGATE_CHECK_UCC(status);
+  return true;
+}
+
 }  // namespace legate::detail::comm::coll
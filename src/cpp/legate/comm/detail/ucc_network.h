@@ -27,7 +27,8 @@ class OOBAllgather;
  * (MPIOOBAllgather). Future work will bring in other mechanisms such as TCP/IP or third party
  * services for the allgather operation. This AllGather function is used at UCC context creation,
  * team creation, and team destruction. The UCCNetwork implements the collective operations:
- * alltoallv, alltoall, allgather, and allreduce. They use the UCC functions directly for these
+ * alltoallv, alltoall, allgather, allreduce, broadcast, gather, reduce and reduce-scatter, as well
+ * as non-blocking variants of the first four. They use the UCC functions directly for these
  * operations.
  */
 class UCCNetwork final : public BackendNetwork {
@@ -176,6 +177,160 @@ class UCCNetwork final : public BackendNetwork {
                   ReductionOpKind op,
                   legate::comm::coll::CollComm global_comm) override;
 
+  /**
+   * @brief Perform broadcast operation using UCC. This sends the buffer of the root rank to all
+   * other ranks.
+   *
+   * @param buf Buffer to send from on the root, and to receive into on all other ranks
+   * @param count Number of elements to broadcast
+   * @param type Data type of the elements
+   * @param root Global rank to broadcast from
+   * @param global_comm Global communicator
+   */
+  void broadcast(void* buf,
+                 int count,
+                 legate::comm::coll::CollDataType type,
+                 int root,
+                 legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Perform gather operation using UCC. This gathers data from all ranks into a single
+   * buffer in the root rank.
+   *
+   * @param sendbuf Input buffer containing data to be gathered from this rank
+   * @param recvbuf Output buffer to receive gathered data from all ranks, only used on the root
+   * @param count Number of elements to gather from each rank
+   * @param type Data type of the elements
+   * @param root Global rank to gather into
+   * @param global_comm Global communicator
+   */
+  void gather(const void* sendbuf,
+              void* recvbuf,
+              int count,
+              legate::comm::coll::CollDataType type,
+              int root,
+              legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Perform reduce operation using UCC. This performs a reduction operation across all
+   * ranks and delivers the result to the root rank.
+   *
+   * @param sendbuf Input buffer containing data to be reduced from this rank.
+   * @param recvbuf Output buffer to receive reduced data, only used on the root.
+   * @param count Number of elements to reduce.
+   * @param type Data type of the elements.
+   * @param op Reduction operation to perform.
+   * @param root Global rank to reduce into.
+   * @param global_comm Global communicator.
+   */
+  void reduce(const void* sendbuf,
+              void* recvbuf,
+              int count,
+              legate::comm::coll::CollDataType type,
+              ReductionOpKind op,
+              int root,
+              legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Perform reduce-scatter operation using UCC. This performs a reduction operation across
+   * all ranks and distributes one block of the result to each rank.
+   *
+   * @param sendbuf Input buffer containing global_comm_size x recvcount elements to be reduced
+   * from this rank.
+   * @param recvbuf Output buffer to receive this rank's block of the reduced data.
+   * @param recvcount Number of elements each rank receives.
+   * @param type Data type of the elements.
+   * @param op Reduction operation to perform.
+   * @param global_comm Global communicator.
+   */
+  void reduce_scatter(const void* sendbuf,
+                      void* recvbuf,
+                      int recvcount,
+                      legate::comm::coll::CollDataType type,
+                      ReductionOpKind op,
+                      legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Start a non-blocking alltoallv operation using UCC. The counts and displacements are
+   * copied, so only the send and receive buffers need to outlive the collective.
+   *
+   * @param sendbuf Input buffer containing data to be sent from this rank
+   * @param sendcounts Number of elements to send to each rank
+   * @param sdispls Displacements of the send buffer for each rank
+   * @param recvbuf Output buffer to receive data from all ranks
+   * @param recvcounts Number of elements to receive from each rank
+   * @param rdispls Displacements of the receive data from each rank into the receive buffer
+   * @param type Data type of the elements
+   * @param global_comm Global communicator
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_to_all_v(
+    const void* sendbuf,
+    const int sendcounts[],
+    const int sdispls[],
+    void* recvbuf,
+    const int recvcounts[],
+    const int rdispls[],
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Start a non-blocking alltoall operation using UCC.
+   *
+   * @param sendbuf Input buffer containing data to be sent from this rank
+   * @param recvbuf Output buffer to receive data from all ranks
+   * @param count Number of elements to exchange with each rank
+   * @param type Data type of the elements
+   * @param global_comm Global communicator
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_to_all(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Start a non-blocking allgather operation using UCC.
+   *
+   * @param sendbuf Input buffer containing data to be gathered from this rank
+   * @param recvbuf Output buffer to receive gathered data from all ranks
+   * @param count Number of elements to gather
+   * @param type Data type of the elements
+   * @param global_comm Global communicator
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_gather(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    legate::comm::coll::CollComm global_comm) override;
+
+  /**
+   * @brief Start a non-blocking allreduce operation using UCC.
+   *
+   * @param sendbuf Input buffer containing data to be reduced from this rank.
+   * @param recvbuf Output buffer to receive reduced data.
+   * @param count Number of elements to reduce.
+   * @param type Data type of the elements.
+   * @param op Reduction operation to perform.
+   * @param global_comm Global communicator.
+   *
+   * @return The request tracking the collective.
+   */
+  [[nodiscard]] std::unique_ptr<CollRequest> iall_reduce(
+    const void* sendbuf,
+    void* recvbuf,
+    int count,
+    legate::comm::coll::CollDataType type,
+    ReductionOpKind op,
+    legate::comm::coll::CollComm global_comm) override;
+
   /**
    * @brief Shutdown the UCCNetwork
    */
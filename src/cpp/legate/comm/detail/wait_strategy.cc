@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/comm/detail/wait_strategy.h>
+
+#include <legate_defines.h>
+
+#include <legate/utilities/assert.h>
+#include <legate/utilities/macros.h>
+
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+
+#if LEGATE_DEFINED(LEGATE_LINUX)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace legate::detail::comm::coll {
+
+#if LEGATE_DEFINED(LEGATE_LINUX)
+
+namespace {
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t));
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free);
+
+// The futex word is the atomic itself, which is layout compatible with its value
+[[nodiscard]] std::uint32_t* futex_word(std::atomic<std::uint32_t>* word)
+{
+  return reinterpret_cast<std::uint32_t*>(word);
+}
+
+void futex_wait(std::atomic<std::uint32_t>* word, std::uint32_t expected)
+{
+  // Spurious wake-ups (EINTR) and stale expectations (EAGAIN) are fine, the caller re-checks
+  static_cast<void>(syscall(
+    SYS_futex, futex_word(word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0));
+}
+
+void futex_wake_all(std::atomic<std::uint32_t>* word)
+{
+  static_cast<void>(
+    syscall(SYS_futex, futex_word(word), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0));
+}
+
+}  // namespace
+
+#endif
+
+void WaitEvent::notify_all()
+{
+  // Pairs with prepare_sleep_(): either the sleeper sees the condition become true, or we see the
+  // sleeper and wake it up
+  epoch_.fetch_add(1, std::memory_order_seq_cst);
+  if (num_sleepers_.load(std::memory_order_seq_cst) == 0) {
+    return;
+  }
+#if LEGATE_DEFINED(LEGATE_LINUX)
+  futex_wake_all(&epoch_);
+#else
+  {
+    // Taking the lock guarantees that no sleeper is between its epoch check and its wait
+    const std::scoped_lock<std::mutex> lock{mutex_};
+  }
+  cond_.notify_all();
+#endif
+}
+
+void WaitEvent::pause_()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+std::uint32_t WaitEvent::prepare_sleep_()
+{
+  const auto epoch = epoch_.load(std::memory_order_seq_cst);
+
+  num_sleepers_.fetch_add(1, std::memory_order_seq_cst);
+  return epoch;
+}
+
+void WaitEvent::sleep_(std::uint32_t epoch)
+{
+#if LEGATE_DEFINED(LEGATE_LINUX)
+  futex_wait(&epoch_, epoch);
+#else
+  std::unique_lock<std::mutex> lock{mutex_};
+
+  cond_.wait(lock, [&] { return epoch_.load(std::memory_order_seq_cst) != epoch; });
+#endif
+  cancel_sleep_();
+}
+
+void WaitEvent::cancel_sleep_() { num_sleepers_.fetch_sub(1, std::memory_order_seq_cst); }
+
+// ==========================================================================================
+
+void ThreadBarrier::init(std::int32_t num_threads)
+{
+  LEGATE_CHECK(num_threads > 0);
+  num_threads_ = num_threads;
+  remaining_.store(num_threads, std::memory_order_relaxed);
+  sense_.store(false, std::memory_order_relaxed);
+}
+
+void ThreadBarrier::arrive_and_wait(WaitEvent& event, WaitStrategy strategy)
+{
+  const auto sense = sense_.load(std::memory_order_seq_cst);
+
+  if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    // Nobody arrives at the next barrier before seeing the flip, so the reset cannot race
+    remaining_.store(num_threads_, std::memory_order_relaxed);
+    sense_.store(!sense, std::memory_order_seq_cst);
+    event.notify_all();
+    return;
+  }
+  event.wait_until([&] { return sense_.load(std::memory_order_seq_cst) != sense; }, strategy);
+}
+
+}  // namespace legate::detail::comm::coll
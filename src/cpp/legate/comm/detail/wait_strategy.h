@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate_defines.h>
+
+#include <legate/utilities/macros.h>
+
+#include <atomic>
+#include <cstdint>
+
+#if !LEGATE_DEFINED(LEGATE_LINUX)
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace legate::detail::comm::coll {
+
+/**
+ * @brief How the ranks of a communicator wait for each other.
+ */
+enum class WaitStrategy : std::uint8_t {
+  /**
+   * @brief Busy-wait. Lowest latency, but every waiting rank keeps a core busy, so this should
+   * only be used when each rank has a core to itself.
+   */
+  SPIN,
+  /**
+   * @brief Busy-wait for a short while, then yield the core to other threads between checks.
+   */
+  YIELD,
+  /**
+   * @brief Busy-wait for a short while, then yield for a short while, then sleep until woken up.
+   * Waiting ranks stop consuming CPU time altogether, which keeps oversubscribed communicators
+   * (more ranks than free cores) making progress.
+   */
+  BLOCK,
+};
+
+/**
+ * @brief An event count on which threads can wait for a condition to become true.
+ *
+ * Threads that make a condition true must call `notify_all()` afterwards, so that waiters that
+ * have gone to sleep re-check their condition. Notifying is cheap while nobody sleeps. The
+ * conditions must be evaluated on sequentially consistent atomics.
+ */
+class WaitEvent {
+ public:
+  /**
+   * @brief Wait until `done()` returns `true`.
+   *
+   * @param done The condition to wait for.
+   * @param strategy How to wait.
+   */
+  template <typename F>
+  void wait_until(F&& done, WaitStrategy strategy);
+
+  /**
+   * @brief Wake up all threads sleeping in `wait_until()`.
+   */
+  void notify_all();
+
+ private:
+  // Busy-waiting rounds before the YIELD and BLOCK strategies start yielding
+  static constexpr std::uint32_t MAX_SPINS = 1024;
+  // Yielding rounds before the BLOCK strategy starts sleeping
+  static constexpr std::uint32_t MAX_YIELDS = 64;
+
+  static void pause_();
+  // Announces that the caller is about to sleep, and returns the epoch to sleep on
+  [[nodiscard]] std::uint32_t prepare_sleep_();
+  // Sleeps until the epoch moves past `epoch`, or returns right away if it already has
+  void sleep_(std::uint32_t epoch);
+  void cancel_sleep_();
+
+  std::atomic<std::uint32_t> epoch_{};
+  std::atomic<std::uint32_t> num_sleepers_{};
+#if !LEGATE_DEFINED(LEGATE_LINUX)
+  std::mutex mutex_{};
+  std::condition_variable cond_{};
+#endif
+};
+
+/**
+ * @brief A sense-reversing barrier for a fixed number of threads.
+ *
+ * The last thread to arrive resets the arrival count and flips the sense, which releases the
+ * others. A thread reads the sense on arrival instead of keeping a local copy, which is safe
+ * because the sense cannot flip before the thread has arrived.
+ */
+class ThreadBarrier {
+ public:
+  /**
+   * @param num_threads The number of threads taking part in the barrier.
+   */
+  void init(std::int32_t num_threads);
+
+  /**
+   * @brief Block until all threads have arrived at the barrier.
+   *
+   * @param event The event on which the waiting threads sleep.
+   * @param strategy How to wait.
+   */
+  void arrive_and_wait(WaitEvent& event, WaitStrategy strategy);
+
+ private:
+  std::int32_t num_threads_{};
+  std::atomic<std::int32_t> remaining_{};
+  std::atomic<bool> sense_{};
+};
+
+}  // namespace legate::detail::comm::coll
+
+#include <legate/comm/detail/wait_strategy.inl>
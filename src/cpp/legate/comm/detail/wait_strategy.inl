@@ -0,0 +1,41 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/comm/detail/wait_strategy.h>
+
+#include <algorithm>
+#include <thread>
+
+namespace legate::detail::comm::coll {
+
+template <typename F>
+void WaitEvent::wait_until(F&& done, WaitStrategy strategy)
+{
+  std::uint32_t rounds = 0;
+
+  while (!done()) {
+    if (strategy == WaitStrategy::SPIN || rounds < MAX_SPINS) {
+      pause_();
+    } else if (strategy == WaitStrategy::YIELD || rounds < MAX_SPINS + MAX_YIELDS) {
+      std::this_thread::yield();
+    } else {
+      const auto epoch = prepare_sleep_();
+
+      // Anybody making the condition true from now on will wake us up
+      if (done()) {
+        cancel_sleep_();
+        break;
+      }
+      sleep_(epoch);
+      continue;
+    }
+    rounds = std::min(rounds + 1, MAX_SPINS + MAX_YIELDS);
+  }
+}
+
+}  // namespace legate::detail::comm::coll
@@ -604,7 +604,13 @@ void LogicalStore::set_key_partition(const mapping::detail::Machine& machine,
                                      const ParallelPolicy& parallel_policy,
                                      InternalSharedPtr<Partition> partition)
 {
-  num_pieces_ = machine.count() * parallel_policy.overdecompose_factor();
+  const auto num_pieces = machine.count() * parallel_policy.overdecompose_factor();
+
+  if (num_pieces_ != num_pieces || !key_partition_.has_value() ||
+      !equivalent(**key_partition_, *partition)) {
+    key_partition_epoch_ = Storage::next_key_partition_epoch();
+  }
+  num_pieces_ = num_pieces;
   get_storage()->set_key_partition(machine, partition->invert(partition, transform()));
   key_partition_ = std::move(partition);
 }
@@ -615,16 +621,28 @@ void LogicalStore::reset_key_partition(bool flush)
   if (flush) {
     Runtime::get_runtime().flush_scheduling_window();
   }
-  key_partition_.reset();
+  if (key_partition_.has_value()) {
+    key_partition_.reset();
+    key_partition_epoch_ = Storage::next_key_partition_epoch();
+  }
   get_storage()->reset_key_partition();
 }
 
+SmallVector<std::uint64_t> LogicalStore::key_partition_epochs() const
+{
+  auto result = get_storage()->key_partition_epochs();
+
+  result.push_back(key_partition_epoch_);
+  return result;
+}
+
 void LogicalStore::maybe_reset_key_partition_(const Partition* to_match) noexcept
 {
   if (!key_partition_.has_value() || key_partition_->get() != to_match) {
     return;
   }
   key_partition_.reset();
+  key_partition_epoch_ = Storage::next_key_partition_epoch();
   get_storage()->reset_key_partition();
 }
 
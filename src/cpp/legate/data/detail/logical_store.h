@@ -18,6 +18,8 @@
 #include <legate/utilities/internal_shared_ptr.h>
 #include <legate/utilities/span.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
 
@@ -200,6 +202,16 @@ class LogicalStore {
                          const ParallelPolicy& parallel_policy,
                          InternalSharedPtr<Partition> partition);
   void reset_key_partition(bool flush = true);
+  /**
+   * @brief Returns the epochs of the key partitions this store may be partitioned by.
+   *
+   * The epochs cover the key partitions of the storage (see `Storage::key_partition_epochs()`),
+   * followed by that of the store, and stay the same for as long as none of them is replaced by a
+   * partition that isn't equivalent.
+   *
+   * @return The key partition epochs.
+   */
+  [[nodiscard]] SmallVector<std::uint64_t> key_partition_epochs() const;
 
  private:
   /**
@@ -275,6 +287,7 @@ class LogicalStore {
 
   std::uint32_t num_pieces_{};
   std::optional<InternalSharedPtr<Partition>> key_partition_{};
+  std::uint64_t key_partition_epoch_{};
   std::optional<InternalSharedPtr<PhysicalStore>> mapped_{};
   bool non_transformable_{false};
   bool non_owning_{false};
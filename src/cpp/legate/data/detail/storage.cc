@@ -28,6 +28,7 @@
 #include <legate/utilities/detail/tuple.h>
 #include <legate/utilities/detail/type_traits.h>
 #include <legate/utilities/dispatch.h>
+#include <legate/utilities/hash.h>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -465,6 +466,17 @@ const InternalSharedPtr<LogicalRegionField>& Storage::get_region_field() const
   return *rf;
 }
 
+std::optional<std::reference_wrapper<const LogicalRegionField>> Storage::find_region_field() const
+{
+  const auto* const rf =
+    std::get_if<std::optional<InternalSharedPtr<LogicalRegionField>>>(&storage_data_);
+
+  if (rf == nullptr || !rf->has_value()) {
+    return std::nullopt;
+  }
+  return *rf->value();
+}
+
 Legion::Future Storage::get_future() const
 {
   return std::visit(
@@ -779,11 +791,41 @@ std::optional<InternalSharedPtr<Partition>> Storage::find_key_partition(
 void Storage::set_key_partition(const mapping::detail::Machine& machine,
                                 InternalSharedPtr<Partition> key_partition)
 {
-  num_pieces_    = machine.count();
+  const auto num_pieces = machine.count();
+
+  // Stores with non-trivial transforms set a freshly inverted partition every time they are
+  // written, so the partitions are compared by value
+  if (num_pieces_ != num_pieces || !key_partition_.has_value() ||
+      !equivalent(**key_partition_, *key_partition)) {
+    key_partition_epoch_ = next_key_partition_epoch();
+  }
+  num_pieces_    = num_pieces;
   key_partition_ = std::move(key_partition);
 }
 
-void Storage::reset_key_partition() noexcept { key_partition_.reset(); }
+void Storage::reset_key_partition() noexcept
+{
+  if (key_partition_.has_value()) {
+    key_partition_.reset();
+    key_partition_epoch_ = next_key_partition_epoch();
+  }
+}
+
+SmallVector<std::uint64_t> Storage::key_partition_epochs() const
+{
+  auto result =
+    parent_.has_value() ? (*parent_)->key_partition_epochs() : SmallVector<std::uint64_t>{};
+
+  result.push_back(key_partition_epoch_);
+  return result;
+}
+
+/*static*/ std::uint64_t Storage::next_key_partition_epoch() noexcept
+{
+  static std::uint64_t next_epoch = 0;
+
+  return ++next_epoch;
+}
 
 InternalSharedPtr<StoragePartition> Storage::create_partition(
   const InternalSharedPtr<Storage>& self,
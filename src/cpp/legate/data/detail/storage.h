@@ -164,6 +164,14 @@ class Storage {
   [[nodiscard]] InternalSharedPtr<Storage> get_root(const InternalSharedPtr<Storage>& self);
 
   [[nodiscard]] const InternalSharedPtr<LogicalRegionField>& get_region_field() const;
+  /**
+   * @brief Look up the region field of the storage, without requiring it to exist.
+   *
+   * @return The region field, or `std::nullopt` if the storage isn't backed by a region field
+   * or doesn't have one yet.
+   */
+  [[nodiscard]] std::optional<std::reference_wrapper<const LogicalRegionField>> find_region_field()
+    const;
   [[nodiscard]] Legion::Future get_future() const;
   [[nodiscard]] Legion::FutureMap get_future_map() const;
   [[nodiscard]] std::variant<Legion::Future, Legion::FutureMap> get_future_or_future_map(
@@ -194,6 +202,21 @@ class Storage {
   void set_key_partition(const mapping::detail::Machine& machine,
                          InternalSharedPtr<Partition> key_partition);
   void reset_key_partition() noexcept;
+  /**
+   * @brief Returns the epochs of the key partitions of the storages this storage was sliced
+   * from, starting from the root, followed by the epoch of its own key partition.
+   *
+   * The epochs stay the same for as long as none of these key partitions is replaced by one that
+   * isn't equivalent, so that anything derived from the key partitions found for this storage
+   * can be cached under them.
+   *
+   * @return The key partition epochs.
+   */
+  [[nodiscard]] SmallVector<std::uint64_t> key_partition_epochs() const;
+  /**
+   * @return A key partition epoch distinct from all epochs returned before.
+   */
+  [[nodiscard]] static std::uint64_t next_key_partition_epoch() noexcept;
 
   [[nodiscard]] InternalSharedPtr<StoragePartition> create_partition(
     const InternalSharedPtr<Storage>& self,
@@ -271,6 +294,7 @@ class Storage {
 
   std::uint32_t num_pieces_{};
   std::optional<InternalSharedPtr<Partition>> key_partition_{};
+  std::uint64_t key_partition_epoch_{};
 };
 
 [[nodiscard]] InternalSharedPtr<Storage> slice_storage(
@@ -80,6 +80,11 @@ std::optional<InternalSharedPtr<Partition>> StoragePartition::find_key_partition
   return parent_->find_key_partition(machine, parallel_policy, restrictions);
 }
 
+SmallVector<std::uint64_t> StoragePartition::key_partition_epochs() const
+{
+  return parent_->key_partition_epochs();
+}
+
 Legion::LogicalPartition StoragePartition::get_legion_partition()
 {
   return parent_->get_region_field()->get_legion_partition(partition_.get(), complete_);
@@ -13,6 +13,7 @@
 #include <legate/utilities/internal_shared_ptr.h>
 #include <legate/utilities/span.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 
@@ -52,6 +53,7 @@ class StoragePartition {
     const mapping::detail::Machine& machine,
     const ParallelPolicy& parallel_policy,
     const Restrictions& restrictions) const;
+  [[nodiscard]] SmallVector<std::uint64_t> key_partition_epochs() const;
   [[nodiscard]] Legion::LogicalPartition get_legion_partition();
 
   [[nodiscard]] std::int32_t level() const;
@@ -7,6 +7,7 @@
 #include <legate/data/detail/transform/delinearize.h>
 
 #include <legate/data/detail/transform/non_invertible_transformation.h>
+#include <legate/operation/detail/operation_signature.h>
 #include <legate/utilities/assert.h>
 #include <legate/utilities/detail/array_algorithms.h>
 #include <legate/utilities/detail/buffer_builder.h>
@@ -295,6 +296,13 @@ void Delinearize::pack(BufferBuilder& buffer) const
   }
 }
 
+void Delinearize::add_to_signature(OperationSignature& signature) const
+{
+  signature.append(CoreTransform::DELINEARIZE);
+  signature.append(dim_);
+  signature.append_all(sizes_);
+}
+
 void Delinearize::print(std::ostream& out) const
 {
   out << fmt::format("Delinearize(dim: {}, sizes: {})", dim_, fmt::join(sizes_, ", "));
@@ -6,6 +6,7 @@
 
 #include <legate/data/detail/transform/dim_broadcast.h>
 
+#include <legate/operation/detail/operation_signature.h>
 #include <legate/utilities/detail/buffer_builder.h>
 #include <legate/utilities/detail/core_ids.h>
 #include <legate/utilities/detail/small_vector.h>
@@ -118,6 +119,13 @@ void DimBroadcast::pack(BufferBuilder& buffer) const
   buffer.pack<std::uint64_t>(dim_size_);
 }
 
+void DimBroadcast::add_to_signature(OperationSignature& signature) const
+{
+  signature.append(CoreTransform::BROADCAST);
+  signature.append(dim_);
+  signature.append(dim_size_);
+}
+
 void DimBroadcast::print(std::ostream& out) const
 {
   out << fmt::format("Broadcast(dim: {}, dim_size: {})", dim_, dim_size_);
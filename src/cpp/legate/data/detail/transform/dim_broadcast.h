@@ -17,6 +17,7 @@
 namespace legate::detail {
 
 class BufferBuilder;
+class OperationSignature;
 
 /**
  * @brief Store transformation that logically broadcasts a unit-size dimension
@@ -160,6 +161,7 @@ class DimBroadcast final : public StoreTransform {
    * @brief Serialize this `DimBroadcast` into the passed `buffer`.
    */
   void pack(BufferBuilder& buffer) const override;
+  void add_to_signature(OperationSignature& signature) const override;
   /**
    * @brief Print a human-readable string of this `DimBroadcast` to the `out` stream.
    */
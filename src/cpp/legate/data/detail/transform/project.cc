@@ -6,6 +6,7 @@
 
 #include <legate/data/detail/transform/project.h>
 
+#include <legate/operation/detail/operation_signature.h>
 #include <legate/utilities/detail/buffer_builder.h>
 #include <legate/utilities/detail/core_ids.h>
 #include <legate/utilities/detail/small_vector.h>
@@ -164,6 +165,13 @@ void Project::pack(BufferBuilder& buffer) const
   buffer.pack<std::int64_t>(coord_);
 }
 
+void Project::add_to_signature(OperationSignature& signature) const
+{
+  signature.append(CoreTransform::PROJECT);
+  signature.append(dim_);
+  signature.append(coord_);
+}
+
 void Project::print(std::ostream& out) const
 {
   out << fmt::format("Project(dim: {}, coord: {})", dim_, coord_);
@@ -17,6 +17,7 @@
 namespace legate::detail {
 
 class BufferBuilder;
+class OperationSignature;
 
 class Project final : public StoreTransform {
  public:
@@ -51,6 +52,7 @@ class Project final : public StoreTransform {
 
   [[nodiscard]] bool is_convertible() const override;
   void pack(BufferBuilder& buffer) const override;
+  void add_to_signature(OperationSignature& signature) const override;
   void print(std::ostream& out) const override;
 
   [[nodiscard]] std::int32_t target_ndim(std::int32_t source_ndim) const override;
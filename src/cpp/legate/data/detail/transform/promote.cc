@@ -6,6 +6,7 @@
 
 #include <legate/data/detail/transform/promote.h>
 
+#include <legate/operation/detail/operation_signature.h>
 #include <legate/utilities/detail/buffer_builder.h>
 #include <legate/utilities/detail/core_ids.h>
 #include <legate/utilities/detail/small_vector.h>
@@ -165,6 +166,13 @@ void Promote::pack(BufferBuilder& buffer) const
   buffer.pack<std::int64_t>(dim_size_);
 }
 
+void Promote::add_to_signature(OperationSignature& signature) const
+{
+  signature.append(CoreTransform::PROMOTE);
+  signature.append(extra_dim_);
+  signature.append(dim_size_);
+}
+
 void Promote::print(std::ostream& out) const
 {
   out << fmt::format("Promote(extra_dim: {}, dim_size: {})", extra_dim_, dim_size_);
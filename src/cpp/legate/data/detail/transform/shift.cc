@@ -6,6 +6,7 @@
 
 #include <legate/data/detail/transform/shift.h>
 
+#include <legate/operation/detail/operation_signature.h>
 #include <legate/utilities/detail/buffer_builder.h>
 #include <legate/utilities/detail/core_ids.h>
 #include <legate/utilities/detail/small_vector.h>
@@ -66,6 +67,13 @@ void Shift::pack(BufferBuilder& buffer) const
   buffer.pack<std::int64_t>(offset_);
 }
 
+void Shift::add_to_signature(OperationSignature& signature) const
+{
+  signature.append(CoreTransform::SHIFT);
+  signature.append(dim_);
+  signature.append(offset_);
+}
+
 void Shift::print(std::ostream& out) const
 {
   out << "Shift(dim: " << dim_ << ", "
@@ -17,6 +17,7 @@
 namespace legate::detail {
 
 class BufferBuilder;
+class OperationSignature;
 
 class Transform {
  public:
@@ -54,6 +55,13 @@ class Transform {
   virtual void pack(BufferBuilder& buffer) const    = 0;
   virtual void print(std::ostream& out) const       = 0;
 
+  /**
+   * @brief Append the kind and the parameters of the transform to an operation signature.
+   *
+   * @param signature The signature to append to.
+   */
+  virtual void add_to_signature(OperationSignature& signature) const = 0;
+
   /**
    * @brief Applies the inverse transform (based on the derived class) to a tuple of
    * integers representing dimensions. For example, Transpose logically reorders the dims,
@@ -6,6 +6,7 @@
 
 #include <legate/data/detail/transform/transform_stack.h>
 
+#include <legate/operation/detail/operation_signature.h>
 #include <legate/utilities/assert.h>
 #include <legate/utilities/detail/buffer_builder.h>
 #include <legate/utilities/detail/core_ids.h>
@@ -194,6 +195,16 @@ void TransformStack::print(std::ostream& out) const
   }
 }
 
+void TransformStack::add_to_signature(OperationSignature& signature) const
+{
+  if (identity()) {
+    signature.append(CoreTransform::INVALID);
+  } else {
+    transform_->add_to_signature(signature);
+    parent_->add_to_signature(signature);
+  }
+}
+
 std::unique_ptr<StoreTransform> TransformStack::pop()
 {
   LEGATE_ASSERT(transform_ != nullptr);
@@ -20,6 +20,7 @@
 namespace legate::detail {
 
 class BufferBuilder;
+class OperationSignature;
 
 class TransformStack final : public Transform {
  public:
@@ -59,6 +60,7 @@ class TransformStack final : public Transform {
   [[nodiscard]] bool is_convertible() const override;
   void pack(BufferBuilder& buffer) const override;
   void print(std::ostream& out) const override;
+  void add_to_signature(OperationSignature& signature) const override;
 
   [[nodiscard]] std::unique_ptr<StoreTransform> pop();
   [[nodiscard]] bool identity() const;
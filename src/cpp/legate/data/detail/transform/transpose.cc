@@ -6,6 +6,7 @@
 
 #include <legate/data/detail/transform/transpose.h>
 
+#include <legate/operation/detail/operation_signature.h>
 #include <legate/utilities/assert.h>
 #include <legate/utilities/detail/array_algorithms.h>
 #include <legate/utilities/detail/buffer_builder.h>
@@ -177,6 +178,12 @@ void Transpose::pack(BufferBuilder& buffer) const
   }
 }
 
+void Transpose::add_to_signature(OperationSignature& signature) const
+{
+  signature.append(CoreTransform::TRANSPOSE);
+  signature.append_all(axes_);
+}
+
 void Transpose::print(std::ostream& out) const
 {
   out << fmt::format("Transpose(axes: {})", fmt::join(axes_, ", "));
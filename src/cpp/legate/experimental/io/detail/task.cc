@@ -15,6 +15,7 @@
 #include <legate/io/hdf5/detail/combine_vds.h>
 #include <legate/io/hdf5/detail/read.h>
 #include <legate/io/hdf5/detail/write_vds.h>
+#include <legate/runtime/runtime.h>
 
 namespace legate::experimental::io::detail {
 
@@ -33,6 +34,9 @@ void register_tasks()
     legate::io::hdf5::detail::HDF5Read::register_variants(lib);
     legate::io::hdf5::detail::HDF5WriteVDS::register_variants(lib);
     legate::io::hdf5::detail::HDF5CombineVDS::register_variants(lib);
+    // The read tasks keep files open across launches, which must be closed while HDF5 is
+    // still usable
+    legate::register_shutdown_callback(&legate::io::hdf5::detail::HDF5Read::close_cached_files);
   }
 }
 
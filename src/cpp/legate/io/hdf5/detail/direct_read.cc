@@ -0,0 +1,514 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/io/hdf5/detail/direct_read.h>
+
+#include <legate/utilities/abort.h>
+#include <legate/utilities/detail/small_vector.h>
+#include <legate/utilities/detail/traced_exception.h>
+#include <legate/utilities/detail/type_traits.h>
+
+#include <fmt/format.h>
+
+#include <H5Dpublic.h>
+#include <H5Zpublic.h>
+
+#include <unistd.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+namespace legate::io::hdf5::detail {
+
+namespace {
+
+using Coordinates = legate::detail::SmallVector<hsize_t, LEGATE_MAX_DIM>;
+
+// Strided rows are read whole and then gathered, unless their elements are further apart than
+// this, in which case each element is read on its own
+constexpr std::size_t MAX_GATHER_STEP = 4096;
+
+void read_exactly(int fd, std::byte* buf, std::size_t size, std::uint64_t offset)
+{
+  while (size > 0) {
+    const auto ret = ::pread(fd, buf, size, static_cast<off_t>(offset));
+
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw legate::detail::TracedException<std::system_error>{
+        errno, std::generic_category(), "Failed to read the raw data of a HDF5 dataset"};
+    }
+    if (ret == 0) {
+      throw legate::detail::TracedException<std::runtime_error>{
+        "Unexpected end of file while reading the raw data of a HDF5 dataset"};
+    }
+
+    const auto nread = static_cast<std::size_t>(ret);
+
+    buf += nread;
+    size -= nread;
+    offset += nread;
+  }
+}
+
+[[nodiscard]] bool is_stored_as_is(wrapper::HDF5Type::Class cls)
+{
+  switch (cls) {
+    case wrapper::HDF5Type::Class::BOOL: [[fallthrough]];
+    case wrapper::HDF5Type::Class::SIGNED_INTEGER: [[fallthrough]];
+    case wrapper::HDF5Type::Class::UNSIGNED_INTEGER: [[fallthrough]];
+    case wrapper::HDF5Type::Class::FLOAT: [[fallthrough]];
+    case wrapper::HDF5Type::Class::COMPLEX: [[fallthrough]];
+    case wrapper::HDF5Type::Class::BITFIELD: [[fallthrough]];
+    case wrapper::HDF5Type::Class::OPAQUE: [[fallthrough]];
+    case wrapper::HDF5Type::Class::ENUM: return true;
+    // These may be variable-length, or hold references to other objects in the file, which
+    // HDF5 resolves when reading them
+    case wrapper::HDF5Type::Class::TIME: [[fallthrough]];
+    case wrapper::HDF5Type::Class::STRING: [[fallthrough]];
+    case wrapper::HDF5Type::Class::COMPOUND: [[fallthrough]];
+    case wrapper::HDF5Type::Class::REFERENCE: [[fallthrough]];
+    case wrapper::HDF5Type::Class::VARIABLE_LENGTH: [[fallthrough]];
+    case wrapper::HDF5Type::Class::ARRAY: return false;
+  }
+  LEGATE_ABORT("Unhandled HDF5 type class ", legate::detail::to_underlying(cls));
+}
+
+/**
+ * @return The row-major linear index of `point` in an array of shape `extents`.
+ */
+[[nodiscard]] std::size_t linearize(Span<const hsize_t> point, Span<const hsize_t> extents)
+{
+  std::size_t ret = 0;
+
+  for (std::size_t dim = 0; dim < point.size(); ++dim) {
+    ret = (ret * extents[dim]) + point[dim];
+  }
+  return ret;
+}
+
+/**
+ * @brief Advance `point` to the next point of `[lo, hi)` in row-major order, only considering
+ * the first `ndim` dimensions.
+ *
+ * @return `false` if `point` was the last point, `true` otherwise.
+ */
+[[nodiscard]] bool advance(Span<hsize_t> point,
+                           Span<const hsize_t> lo,
+                           Span<const hsize_t> hi,
+                           std::size_t ndim)
+{
+  for (auto dim = ndim; dim > 0; --dim) {
+    if (++point[dim - 1] < hi[dim - 1]) {
+      return true;
+    }
+    point[dim - 1] = lo[dim - 1];
+  }
+  return false;
+}
+
+/**
+ * @brief The selection to read, and the buffer to read it into.
+ */
+class Selection {
+ public:
+  Span<const hsize_t> offset{};
+  Span<const hsize_t> stride{};
+  Span<const hsize_t> count{};
+  Span<const hsize_t> mem_extents{};
+  std::size_t elem_size{};
+  std::byte* dst{};
+
+  [[nodiscard]] std::size_t ndim() const { return count.size(); }
+
+  /**
+   * @return Where the element at `point` of the selection goes in the buffer.
+   */
+  [[nodiscard]] std::byte* dst_ptr(Span<const hsize_t> point) const
+  {
+    return dst + (linearize(point, mem_extents) * elem_size);
+  }
+
+  /**
+   * @brief Convert a point of the selection to a point of the dataset.
+   */
+  void to_file_point(Span<const hsize_t> point, Span<hsize_t> file_point) const
+  {
+    for (std::size_t dim = 0; dim < ndim(); ++dim) {
+      file_point[dim] = offset[dim] + (point[dim] * stride[dim]);
+    }
+  }
+};
+
+void read_contiguous(int fd,
+                     std::uint64_t base,
+                     Span<const hsize_t> extents,
+                     const Selection& sel)
+{
+  const auto ndim     = sel.ndim();
+  const auto is_whole = [&](std::size_t dim) {
+    return sel.offset[dim] == 0 && sel.stride[dim] == 1 && sel.count[dim] == extents[dim] &&
+           sel.mem_extents[dim] == sel.count[dim];
+  };
+  // Each read covers the selected elements of the `inner` dimension, along with the trailing
+  // dimensions if they are selected whole, since these are contiguous in both the file and the
+  // buffer
+  auto inner = ndim - 1;
+
+  while (inner > 0 && is_whole(inner) && sel.stride[inner - 1] == 1) {
+    --inner;
+  }
+
+  std::size_t run_size = sel.elem_size;
+
+  for (auto dim = inner + 1; dim < ndim; ++dim) {
+    run_size *= extents[dim];
+  }
+
+  const auto zeros = Coordinates{legate::detail::tags::size_tag, ndim, 0};
+  auto point       = zeros;
+  auto file_point  = zeros;
+  auto gather_buf  = std::vector<std::byte>{};
+  const auto step  = sel.stride[inner] * run_size;
+  const auto num   = sel.count[inner];
+
+  do {
+    sel.to_file_point(point, file_point);
+
+    const auto file_offset = base + (linearize(file_point, extents) * sel.elem_size);
+    auto* const out        = sel.dst_ptr(point);
+
+    if (sel.stride[inner] == 1) {
+      read_exactly(fd, out, num * run_size, file_offset);
+    } else if (step <= MAX_GATHER_STEP) {
+      gather_buf.resize(((num - 1) * step) + run_size);
+      read_exactly(fd, gather_buf.data(), gather_buf.size(), file_offset);
+      for (std::size_t i = 0; i < num; ++i) {
+        std::memcpy(out + (i * run_size), gather_buf.data() + (i * step), run_size);
+      }
+    } else {
+      for (std::size_t i = 0; i < num; ++i) {
+        read_exactly(fd, out + (i * run_size), run_size, file_offset + (i * step));
+      }
+    }
+  } while (advance(point, zeros, sel.count, inner));
+}
+
+/**
+ * @brief The filters of the pipeline of a chunked dataset that are decoded without HDF5.
+ *
+ * Each is set to the position of the filter in the pipeline, which is also the bit of the filter
+ * mask of a chunk that is set if the filter was skipped for the chunk.
+ */
+class ChunkFilters {
+ public:
+  std::optional<std::uint32_t> shuffle{};
+  std::optional<std::uint32_t> deflate{};
+
+  /**
+   * @return Whether the filter at `index` was applied to a chunk with filter mask
+   * `filter_mask`.
+   */
+  [[nodiscard]] static bool applied(const std::optional<std::uint32_t>& index,
+                                    std::uint32_t filter_mask)
+  {
+    return index.has_value() && (filter_mask & (std::uint32_t{1} << *index)) == 0;
+  }
+};
+
+/**
+ * @return The filters of the pipeline of a chunked dataset, or `std::nullopt` if it has filters
+ * that only HDF5 can decode. Only the shuffle filter, the deflate filter, and the shuffle filter
+ * followed by the deflate filter, are decoded without HDF5.
+ */
+[[nodiscard]] std::optional<ChunkFilters> decodable_filters(
+  const wrapper::HDF5DataSetCreatePropertyList& dcpl)
+{
+  const auto num_filters = dcpl.filter_count();
+  auto ret               = ChunkFilters{};
+
+  if (num_filters == 0) {
+    return ret;
+  }
+  // Partial edge chunks left unfiltered are not flagged as such in their filter mask
+  if (!dcpl.filters_partial_chunks()) {
+    return std::nullopt;
+  }
+  for (std::uint32_t idx = 0; idx < num_filters; ++idx) {
+    const auto filter = dcpl.filter(idx);
+
+    if (filter == H5Z_FILTER_SHUFFLE && !ret.shuffle.has_value() && !ret.deflate.has_value()) {
+      ret.shuffle = idx;
+    } else if (filter == H5Z_FILTER_DEFLATE && !ret.deflate.has_value()) {
+      ret.deflate = idx;
+    } else {
+      return std::nullopt;
+    }
+  }
+  return ret;
+}
+
+/**
+ * @brief Decompress a chunk compressed by the deflate filter, which stores it as a zlib stream.
+ */
+void inflate_chunk(Span<const std::byte> src, Span<std::byte> dst)
+{
+  auto dst_size  = static_cast<uLongf>(dst.size());
+  const auto ret = ::uncompress(reinterpret_cast<Bytef*>(dst.data()),
+                                &dst_size,
+                                reinterpret_cast<const Bytef*>(src.data()),
+                                static_cast<uLong>(src.size()));
+
+  if (ret != Z_OK) {
+    throw legate::detail::TracedException<std::runtime_error>{
+      fmt::format("Failed to decompress a chunk of a HDF5 dataset: {}", ::zError(ret))};
+  }
+  if (dst_size != dst.size()) {
+    throw legate::detail::TracedException<std::runtime_error>{
+      fmt::format("A chunk of a HDF5 dataset decompressed to {} bytes instead of {}",
+                  dst_size,
+                  dst.size())};
+  }
+}
+
+/**
+ * @brief Undo the shuffle filter, which stores the first byte of every element, then the second
+ * byte of every element, and so on.
+ */
+void unshuffle_chunk(Span<const std::byte> src, std::size_t elem_size, Span<std::byte> dst)
+{
+  const auto num_elems = src.size() / elem_size;
+
+  for (std::size_t byte = 0; byte < elem_size; ++byte) {
+    const auto* const plane = src.data() + (byte * num_elems);
+
+    for (std::size_t i = 0; i < num_elems; ++i) {
+      dst[(i * elem_size) + byte] = plane[i];
+    }
+  }
+}
+
+/**
+ * @brief The part of the selection in the chunks at a given index along one dimension.
+ */
+class ChunkSlice {
+ public:
+  hsize_t chunk_offset{};  ///< The coordinate in the dataset of the first element of the chunks
+  hsize_t lo{};            ///< The index in the selection of the first element in the chunks
+  hsize_t hi{};            ///< One past the index in the selection of the last one
+};
+
+/**
+ * @return The chunks holding elements of the selection along dimension `dim`.
+ */
+[[nodiscard]] std::vector<ChunkSlice> slice_chunks(const Selection& sel,
+                                                   std::size_t dim,
+                                                   hsize_t chunk_extent)
+{
+  const auto first  = sel.offset[dim];
+  const auto stride = sel.stride[dim];
+  const auto last   = first + ((sel.count[dim] - 1) * stride);
+  auto ret          = std::vector<ChunkSlice>{};
+
+  for (auto chunk = first / chunk_extent; chunk <= last / chunk_extent; ++chunk) {
+    const auto chunk_lo = chunk * chunk_extent;
+    const auto chunk_hi = std::min(chunk_lo + chunk_extent, last + 1);
+    const auto lo       = chunk_lo <= first ? 0 : (chunk_lo - first + stride - 1) / stride;
+    const auto hi       = ((chunk_hi - 1 - first) / stride) + 1;
+
+    // With strides larger than the chunks, some chunks hold no element of the selection
+    if (lo < hi) {
+      ret.push_back({chunk_lo, lo, hi});
+    }
+  }
+  return ret;
+}
+
+[[nodiscard]] bool read_chunked(const wrapper::HDF5DataSet& dataset,
+                                int fd,
+                                Span<const hsize_t> chunk_extents,
+                                const ChunkFilters& filters,
+                                const Selection& sel)
+{
+  const auto ndim = sel.ndim();
+  auto slices     = legate::detail::SmallVector<std::vector<ChunkSlice>, LEGATE_MAX_DIM>{};
+
+  for (std::size_t dim = 0; dim < ndim; ++dim) {
+    slices.emplace_back(slice_chunks(sel, dim, chunk_extents[dim]));
+  }
+
+  // Enumerate the chunks holding elements of the selection, by their index in `slices`
+  const auto zeros       = Coordinates{legate::detail::tags::size_tag, ndim, 0};
+  auto num_slices        = zeros;
+  auto chunk_index       = zeros;
+  auto chunk_offsets     = std::vector<hsize_t>{};
+  std::size_t num_chunks = 1;
+
+  for (std::size_t dim = 0; dim < ndim; ++dim) {
+    num_slices[dim] = slices[dim].size();
+    num_chunks *= num_slices[dim];
+  }
+  chunk_offsets.reserve(num_chunks * ndim);
+  do {
+    for (std::size_t dim = 0; dim < ndim; ++dim) {
+      chunk_offsets.push_back(slices[dim][chunk_index[dim]].chunk_offset);
+    }
+  } while (advance(chunk_index, zeros, num_slices, ndim));
+
+  // The only part of the read that needs the lock
+  auto locations = std::vector<std::optional<wrapper::HDF5DataSet::ChunkLocation>>(num_chunks);
+
+  dataset.chunk_locations(chunk_offsets, locations);
+
+  std::size_t chunk_size = sel.elem_size;
+
+  for (auto&& extent : chunk_extents) {
+    chunk_size *= extent;
+  }
+  // Unallocated chunks hold the fill value, which HDF5 knows how to produce
+  if (std::any_of(locations.begin(), locations.end(), [&](const auto& location) {
+        return !location.has_value() ||
+               (!ChunkFilters::applied(filters.deflate, location->filter_mask) &&
+                location->size != chunk_size);
+      })) {
+    return false;
+  }
+
+  auto raw_buf    = std::vector<std::byte>{};
+  auto chunk_buf  = std::vector<std::byte>(chunk_size);
+  auto decode_buf = std::vector<std::byte>{};
+  auto point      = zeros;
+  auto lo         = zeros;
+  auto hi         = zeros;
+  auto file_point = zeros;
+  auto local      = zeros;
+  const auto last = ndim - 1;
+
+  chunk_index = zeros;
+  for (auto&& location : locations) {
+    // Decoded outside of the HDF5 lock, in the reverse order of the pipeline
+    if (ChunkFilters::applied(filters.deflate, location->filter_mask)) {
+      raw_buf.resize(location->size);
+      read_exactly(fd, raw_buf.data(), raw_buf.size(), location->offset);
+      inflate_chunk(raw_buf, chunk_buf);
+    } else {
+      read_exactly(fd, chunk_buf.data(), chunk_size, location->offset);
+    }
+
+    const auto* chunk = chunk_buf.data();
+
+    if (ChunkFilters::applied(filters.shuffle, location->filter_mask) && sel.elem_size > 1) {
+      decode_buf.resize(chunk_size);
+      unshuffle_chunk(chunk_buf, sel.elem_size, decode_buf);
+      chunk = decode_buf.data();
+    }
+    for (std::size_t dim = 0; dim < ndim; ++dim) {
+      const auto& slice = slices[dim][chunk_index[dim]];
+
+      lo[dim]    = slice.lo;
+      hi[dim]    = slice.hi;
+      point[dim] = slice.lo;
+    }
+
+    // Copy the selected elements of the chunk, row by row
+    const auto num       = hi[last] - lo[last];
+    const auto step      = sel.stride[last] * sel.elem_size;
+    const auto row_bytes = num * sel.elem_size;
+
+    do {
+      sel.to_file_point(point, file_point);
+      for (std::size_t dim = 0; dim < ndim; ++dim) {
+        local[dim] = file_point[dim] - slices[dim][chunk_index[dim]].chunk_offset;
+      }
+
+      const auto* const src = chunk + (linearize(local, chunk_extents) * sel.elem_size);
+      auto* const out       = sel.dst_ptr(point);
+
+      if (sel.stride[last] == 1) {
+        std::memcpy(out, src, row_bytes);
+      } else {
+        for (std::size_t i = 0; i < num; ++i) {
+          std::memcpy(out + (i * sel.elem_size), src + (i * step), sel.elem_size);
+        }
+      }
+    } while (advance(point, lo, hi, last));
+    std::ignore = advance(chunk_index, zeros, num_slices, ndim);
+  }
+  return true;
+}
+
+}  // namespace
+
+bool try_direct_read(const wrapper::HDF5DataSet& dataset,
+                     Span<const hsize_t> offset,
+                     Span<const hsize_t> stride,
+                     Span<const hsize_t> count,
+                     Span<const hsize_t> mem_extents,
+                     void* dst)
+{
+  const auto type = dataset.type();
+
+  if (!is_stored_as_is(type.type_class())) {
+    return false;
+  }
+
+  const auto extents = dataset.data_space().extents();
+
+  if (extents.empty() || std::find(count.begin(), count.end(), 0) != count.end()) {
+    return false;
+  }
+
+  const auto fd = dataset.posix_file_descriptor();
+
+  if (!fd.has_value()) {
+    return false;
+  }
+
+  const auto sel =
+    Selection{offset, stride, count, mem_extents, type.size(), static_cast<std::byte*>(dst)};
+
+  const auto dcpl   = dataset.get_create_plist();
+  const auto layout = dcpl.get_layout();
+
+  switch (layout) {
+    case H5D_CONTIGUOUS: {
+      const auto base = dataset.contiguous_offset();
+
+      if (!base.has_value()) {
+        return false;
+      }
+      read_contiguous(*fd, *base, extents, sel);
+      return true;
+    }
+    case H5D_CHUNKED: {
+      const auto filters = decodable_filters(dcpl);
+
+      if (!filters.has_value()) {
+        return false;
+      }
+      return read_chunked(dataset, *fd, dcpl.get_chunk_dims(extents.size()), *filters, sel);
+    }
+    // Compact datasets are stored in their object header, and virtual ones in other datasets
+    case H5D_COMPACT: [[fallthrough]];
+    case H5D_VIRTUAL: return false;
+    case H5D_LAYOUT_ERROR: [[fallthrough]];
+    case H5D_NLAYOUTS: break;
+  }
+  LEGATE_ABORT("Unhandled HDF5 layout ", legate::detail::to_underlying(layout));
+}
+
+}  // namespace legate::io::hdf5::detail
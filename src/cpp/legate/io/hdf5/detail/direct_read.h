@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/io/hdf5/detail/hdf5_wrapper.h>
+#include <legate/utilities/span.h>
+
+#include <H5public.h>
+
+namespace legate::io::hdf5::detail {
+
+/**
+ * @brief Read a hyperslab of a dataset with positional POSIX reads, bypassing the HDF5 I/O
+ * pipeline.
+ *
+ * Every HDF5 call, and so every `HDF5DataSet::read()`, is serialized within a process: either
+ * by `HDF5MaybeLockGuard` if HDF5 isn't thread-safe, or by the global lock of HDF5 itself if
+ * it is. This path only holds the lock to look up where the raw data of the dataset is in the
+ * file, and then reads it with `pread()` on the descriptor of HDF5, so that tasks reading
+ * different parts of the file concurrently don't wait on each other.
+ *
+ * Only contiguous datasets and chunked datasets qualify, of a fixed-size type accessed through
+ * the default POSIX driver, and whose storage is allocated for every element of the hyperslab.
+ * The chunks may be filtered by the shuffle filter, the deflate filter, or both, which are
+ * undone with zlib, also outside of the lock. The elements are stored in memory as they are in
+ * the file, as `HDF5DataSet::read()` does with the type of the dataset as memory type.
+ *
+ * @param dataset The dataset to read.
+ * @param offset The coordinates in the dataset of the first element of the hyperslab.
+ * @param stride The distance in the dataset between consecutive elements of the hyperslab.
+ * @param count The number of elements of the hyperslab in each dimension.
+ * @param mem_extents The extents of the row-major buffer to read the hyperslab into, at least
+ * `count` in each dimension. The hyperslab is read to the origin of the buffer.
+ * @param dst The buffer.
+ *
+ * @return `true` if the hyperslab was read, `false` if the dataset doesn't qualify, in which
+ * case nothing was read.
+ *
+ * @throw std::system_error If reading from the file fails.
+ * @throw std::runtime_error If a compressed chunk cannot be decompressed.
+ */
+[[nodiscard]] bool try_direct_read(const wrapper::HDF5DataSet& dataset,
+                                   Span<const hsize_t> offset,
+                                   Span<const hsize_t> stride,
+                                   Span<const hsize_t> count,
+                                   Span<const hsize_t> mem_extents,
+                                   void* dst);
+
+}  // namespace legate::io::hdf5::detail
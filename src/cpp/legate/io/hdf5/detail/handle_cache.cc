@@ -0,0 +1,202 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/io/hdf5/detail/handle_cache.h>
+
+#include <legate_defines.h>
+
+#include <legate/utilities/abort.h>
+#include <legate/utilities/detail/traced_exception.h>
+#include <legate/utilities/macros.h>
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <filesystem>
+#include <iterator>
+#include <optional>
+#include <system_error>
+
+namespace legate::io::hdf5::detail::wrapper {
+
+namespace {
+
+[[nodiscard]] std::string normalize_path(std::string_view filepath)
+{
+  // Purely lexical, the identity of the file is checked separately
+  return std::filesystem::absolute(std::filesystem::path{filepath}).lexically_normal().native();
+}
+
+[[nodiscard]] HDF5File open_file(legate::detail::ZStringView filepath, bool gds_on)
+{
+  if (gds_on) {
+    constexpr auto BLOCK_SIZE = 4096;
+    constexpr auto BUF_SIZE   = 16 * 1024 * 1024;
+    auto props                = HDF5FileAccessPropertyList{};
+
+    props.set_gds(BLOCK_SIZE, BLOCK_SIZE, BUF_SIZE);
+    return HDF5File{filepath, HDF5File::OpenMode::READ_ONLY, props};
+  }
+  return HDF5File{filepath, HDF5File::OpenMode::READ_ONLY};
+}
+
+}  // namespace
+
+HDF5HandleCache::Entry::Entry(std::string path_,
+                              bool gds_on_,
+                              const FileIdentity& identity_,
+                              HDF5File file_)
+  : path{std::move(path_)}, gds_on{gds_on_}, identity{identity_}, file{std::move(file_)}
+{
+}
+
+HDF5HandleCache::HDF5HandleCache(std::size_t capacity) : capacity_{capacity}
+{
+  LEGATE_CHECK(capacity_ > 0);
+}
+
+/*static*/ HDF5HandleCache& HDF5HandleCache::get()
+{
+  static HDF5HandleCache cache{};
+
+  return cache;
+}
+
+/*static*/ HDF5HandleCache::FileIdentity HDF5HandleCache::identify(std::string_view filepath)
+{
+  const auto path = std::string{filepath};
+  struct stat st{};
+
+  if (::stat(path.c_str(), &st) != 0) {
+    throw legate::detail::TracedException<std::system_error>{
+      std::error_code{errno, std::generic_category()}, path};
+  }
+
+#if LEGATE_DEFINED(LEGATE_LINUX)
+  const auto& mtime = st.st_mtim;
+#else
+  const auto& mtime = st.st_mtimespec;
+#endif
+
+  return {static_cast<std::uint64_t>(st.st_ino),
+          static_cast<std::uint64_t>(st.st_size),
+          static_cast<std::uint64_t>(mtime.tv_sec),
+          static_cast<std::uint64_t>(mtime.tv_nsec)};
+}
+
+std::list<HDF5HandleCache::Entry>::iterator HDF5HandleCache::find_(std::string_view path,
+                                                                    bool gds_on)
+{
+  return std::find_if(entries_.begin(), entries_.end(), [&](const Entry& entry) {
+    return entry.gds_on == gds_on && entry.path == path;
+  });
+}
+
+/*static*/ const HDF5DataSet* HDF5HandleCache::find_data_set_(const Entry& entry,
+                                                              std::string_view dataset_name)
+{
+  const auto it = std::find_if(entry.data_sets.begin(),
+                               entry.data_sets.end(),
+                               [&](const auto& pair) { return pair.first == dataset_name; });
+
+  return it == entry.data_sets.end() ? nullptr : &it->second;
+}
+
+HDF5DataSet HDF5HandleCache::data_set(legate::detail::ZStringView filepath,
+                                      legate::detail::ZStringView dataset_name,
+                                      bool gds_on,
+                                      const FileIdentity& identity)
+{
+  auto path = normalize_path(filepath.as_string_view());
+  // Declared before the locks, so that the evicted files are closed after they are released
+  auto evicted = std::list<Entry>{};
+  auto file    = std::optional<HDF5File>{};
+
+  {
+    const std::lock_guard lock{mutex_};
+
+    if (const auto it = find_(path, gds_on); it != entries_.end()) {
+      // The file was replaced or modified since it was opened, possibly by another process, so
+      // the cached handles may no longer reflect its contents
+      if (it->identity != identity) {
+        evicted.splice(evicted.end(), entries_, it);
+      } else {
+        entries_.splice(entries_.begin(), entries_, it);
+        if (const auto* data_set = find_data_set_(*it, dataset_name.as_string_view())) {
+          return *data_set;
+        }
+        file.emplace(it->file);
+      }
+    }
+  }
+
+  // Opening means I/O, and may take a while on a parallel filesystem, so lookups of other files
+  // go on in the meantime
+  if (!file.has_value()) {
+    file.emplace(open_file(filepath, gds_on));
+  }
+
+  auto data_set = file->data_set(dataset_name);
+  const std::lock_guard lock{mutex_};
+  auto it = find_(path, gds_on);
+
+  // Another thread may have cached the file, or a newer version of it, in the meantime
+  if (it != entries_.end() && it->identity != identity) {
+    evicted.splice(evicted.end(), entries_, it);
+    it = entries_.end();
+  }
+  if (it == entries_.end()) {
+    entries_.emplace_front(std::move(path), gds_on, identity, std::move(*file));
+    if (entries_.size() > capacity_) {
+      evicted.splice(evicted.end(), entries_, std::prev(entries_.end()));
+    }
+  } else if (it != entries_.begin()) {
+    entries_.splice(entries_.begin(), entries_, it);
+  }
+
+  auto&& entry = entries_.front();
+
+  if (const auto* cached = find_data_set_(entry, dataset_name.as_string_view())) {
+    return *cached;
+  }
+  return entry.data_sets.emplace_back(dataset_name.to_string(), std::move(data_set)).second;
+}
+
+void HDF5HandleCache::invalidate(std::string_view filepath)
+{
+  const auto path = normalize_path(filepath);
+  auto evicted    = std::list<Entry>{};
+  const std::lock_guard lock{mutex_};
+
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    const auto next = std::next(it);
+
+    if (it->path == path) {
+      evicted.splice(evicted.end(), entries_, it);
+    }
+    it = next;
+  }
+}
+
+void HDF5HandleCache::clear()
+{
+  auto evicted = std::list<Entry>{};
+  const std::lock_guard lock{mutex_};
+
+  evicted.swap(entries_);
+}
+
+std::size_t HDF5HandleCache::size() const
+{
+  const std::lock_guard lock{mutex_};
+
+  return entries_.size();
+}
+
+std::size_t HDF5HandleCache::capacity() const noexcept { return capacity_; }
+
+}  // namespace legate::io::hdf5::detail::wrapper
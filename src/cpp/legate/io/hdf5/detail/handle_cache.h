@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/io/hdf5/detail/hdf5_wrapper.h>
+#include <legate/utilities/detail/zstring_view.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace legate::io::hdf5::detail::wrapper {
+
+/**
+ * @brief A per-process cache of the HDF5 files, and the datasets within them, opened for
+ * reading.
+ *
+ * Opening a file means a round-trip to the metadata server on most parallel filesystems, and
+ * reading its superblock. Read tasks of the same dataset (e.g. the point tasks of an
+ * over-decomposed launch, or the launches of a streaming section) instead share the handles
+ * opened by the first of them.
+ *
+ * The cache holds at most `capacity()` files, and closes the least recently used one when it
+ * needs to open another. Files are keyed by their absolute, lexically normalized path (symbolic
+ * links are not resolved) and by whether they are accessed through the GDS virtual file
+ * driver.
+ *
+ * Each lookup is given the identity of the file, taken once when the read was launched (see
+ * `identify()`), and reopens the file if it differs from the identity the file had when it was
+ * cached. This catches files overwritten by other processes between two launches, without a
+ * round-trip to the metadata server per read task. Opening a file in
+ * `HDF5File::OpenMode::OVERWRITE` additionally clears the cache of the calling process, since
+ * HDF5 refuses to truncate a file that is still open, which includes the source files of cached
+ * virtual datasets.
+ *
+ * All members are thread-safe. Files and datasets are opened and closed without the cache
+ * locked, so that cold lookups of different files don't wait for each other. The cache is
+ * locked before `HDF5MaybeLockGuard`, never after.
+ */
+class HDF5HandleCache {
+ public:
+  static constexpr std::size_t DEFAULT_CAPACITY = 64;
+
+  /**
+   * @brief The inode, size and modification time (seconds and nanoseconds) of a file.
+   *
+   * The device is left out, as the nodes mounting a shared filesystem may number it
+   * differently.
+   */
+  using FileIdentity = std::array<std::uint64_t, 4>;
+
+  /**
+   * @brief Construct an empty cache.
+   *
+   * @param capacity The maximum number of files kept open, must be at least 1.
+   */
+  explicit HDF5HandleCache(std::size_t capacity = DEFAULT_CAPACITY);
+
+  /**
+   * @return The cache of the process.
+   */
+  [[nodiscard]] static HDF5HandleCache& get();
+
+  /**
+   * @brief Take the identity of a file.
+   *
+   * @param filepath The path to the file.
+   *
+   * @return The identity of the file.
+   *
+   * @throw std::system_error If the file cannot be queried.
+   */
+  [[nodiscard]] static FileIdentity identify(std::string_view filepath);
+
+  /**
+   * @brief Open a dataset for reading, or return the handle opened by a previous call.
+   *
+   * @param filepath The path to the file containing the dataset.
+   * @param dataset_name The name of the dataset.
+   * @param gds_on Whether to access the file through the GDS virtual file driver.
+   * @param identity The identity of the file, as returned by `identify()`. A cached file with
+   * another identity is reopened.
+   *
+   * @return A new reference to the dataset. It remains valid if the dataset is later evicted
+   * from the cache, or the file is modified.
+   *
+   * @throw std::runtime_error If the file or the dataset cannot be opened.
+   */
+  [[nodiscard]] HDF5DataSet data_set(legate::detail::ZStringView filepath,
+                                     legate::detail::ZStringView dataset_name,
+                                     bool gds_on,
+                                     const FileIdentity& identity);
+
+  /**
+   * @brief Drop a file, and all of its datasets, from the cache.
+   *
+   * The file is closed once the handles returned by `data_set()` for it are destroyed as
+   * well. Does nothing if the file is not cached.
+   *
+   * @param filepath The path to the file.
+   */
+  void invalidate(std::string_view filepath);
+
+  /**
+   * @brief Drop every file from the cache.
+   */
+  void clear();
+
+  /**
+   * @return The number of files currently cached.
+   */
+  [[nodiscard]] std::size_t size() const;
+
+  /**
+   * @return The maximum number of files kept open.
+   */
+  [[nodiscard]] std::size_t capacity() const noexcept;
+
+ private:
+  class Entry {
+   public:
+    Entry(std::string path, bool gds_on, const FileIdentity& identity, HDF5File file);
+
+    std::string path{};
+    bool gds_on{};
+    // Taken at launch, before the file was opened, so a concurrent modification at worst
+    // reopens it later
+    FileIdentity identity{};
+    HDF5File file;
+    std::vector<std::pair<std::string, HDF5DataSet>> data_sets{};
+  };
+
+  // Must be called with the cache locked
+  [[nodiscard]] std::list<Entry>::iterator find_(std::string_view path, bool gds_on);
+  // Must be called with the cache locked
+  [[nodiscard]] static const HDF5DataSet* find_data_set_(const Entry& entry,
+                                                         std::string_view dataset_name);
+
+  std::size_t capacity_{};
+  mutable std::mutex mutex_{};
+  // Most recently used first
+  std::list<Entry> entries_{};
+};
+
+}  // namespace legate::io::hdf5::detail::wrapper
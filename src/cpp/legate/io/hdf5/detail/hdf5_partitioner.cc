@@ -13,21 +13,25 @@
 #include <legate/io/hdf5/detail/partitioners/vds_partitioner.h>
 #include <legate/utilities/abort.h>
 
+#include <algorithm>
+
 namespace legate::io::hdf5::detail {
 
 std::optional<legate::detail::SmallVector<std::uint64_t, LEGATE_MAX_DIM>> get_partition_tile_shape(
   const Shape& shape,
   std::size_t num_tiles,
   const std::filesystem::path& vds_path,
-  const wrapper::HDF5DataSet& dataset)
+  const wrapper::HDF5DataSet& dataset,
+  Span<const std::uint64_t> stride)
 {
   switch (dataset.get_layout()) {
     case H5D_VIRTUAL:
-      return VDSPartitioner{}.partition_tile_shape(shape, num_tiles, vds_path, dataset);
+      return VDSPartitioner{}.partition_tile_shape(shape, num_tiles, vds_path, dataset, stride);
     case H5D_CHUNKED:
-      return ChunkedPartitioner{}.partition_tile_shape(shape, num_tiles, vds_path, dataset);
+      return ChunkedPartitioner{}.partition_tile_shape(shape, num_tiles, vds_path, dataset, stride);
     case H5D_CONTIGUOUS:
-      return ContiguousPartitioner{}.partition_tile_shape(shape, num_tiles, vds_path, dataset);
+      return ContiguousPartitioner{}.partition_tile_shape(
+        shape, num_tiles, vds_path, dataset, stride);
     case H5D_LAYOUT_ERROR: [[fallthrough]];
     case H5D_COMPACT: [[fallthrough]];
     case H5D_NLAYOUTS: return std::nullopt;
@@ -35,4 +39,16 @@ std::optional<legate::detail::SmallVector<std::uint64_t, LEGATE_MAX_DIM>> get_pa
   LEGATE_ABORT("Unsupported dataset layout");
 }
 
+void to_selection_extents(Span<std::uint64_t> extents, Span<const std::uint64_t> stride)
+{
+  if (stride.empty()) {
+    return;
+  }
+  LEGATE_CHECK(extents.size() == stride.size());
+  for (std::size_t i = 0; i < extents.size(); ++i) {
+    // A block of n elements holds at most ceil(n / stride) selected elements
+    extents[i] = std::max<std::uint64_t>((extents[i] + stride[i] - 1) / stride[i], 1);
+  }
+}
+
 }  // namespace legate::io::hdf5::detail
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <legate/utilities/detail/small_vector.h>
+#include <legate/utilities/span.h>
 
 #include <cstddef>
 #include <cstdint>
@@ -36,12 +37,14 @@ class HDF5Partitioner {
   virtual ~HDF5Partitioner() = default;
 
   /**
-   * @brief Partition the dataset into the given number of tiles.
+   * @brief Partition the selected part of the dataset into the given number of tiles.
    *
-   * @param shape The shape of the dataset.
+   * @param shape The shape of the selected part of the dataset.
    * @param num_tiles The number of tiles to partition the dataset into.
    * @param vds_path The path to the VDS file.
    * @param dataset The dataset.
+   * @param stride The stride of the selection in each dimension of the dataset, or empty if
+   * the selection is dense.
    *
    * @return The tile shape if partitioning is possible, otherwise std::nullopt.
    */
@@ -49,18 +52,22 @@ class HDF5Partitioner {
   partition_tile_shape(const Shape& shape,
                        std::size_t num_tiles,
                        const std::filesystem::path& vds_path,
-                       const wrapper::HDF5DataSet& dataset) = 0;
+                       const wrapper::HDF5DataSet& dataset,
+                       Span<const std::uint64_t> stride) = 0;
 };
 
 /**
  * @brief Get the partition tile shape for a given dataset.
  *
  * Determines the optimal tile shape based on the dataset layout (chunked, contiguous, or VDS).
+ * If only a hyperslab of the dataset is read, the tiles cover the hyperslab only.
  *
- * @param shape The shape of the dataset.
+ * @param shape The shape of the selected part of the dataset.
  * @param num_tiles The number of tiles to partition the dataset into.
  * @param vds_path The path to the VDS file.
  * @param dataset The dataset.
+ * @param stride The stride of the selection in each dimension of the dataset, or empty if the
+ * selection is dense.
  *
  * @return The tile shape if partitioning is possible, otherwise std::nullopt.
  */
@@ -68,6 +75,16 @@ class HDF5Partitioner {
 get_partition_tile_shape(const Shape& shape,
                          std::size_t num_tiles,
                          const std::filesystem::path& vds_path,
-                         const wrapper::HDF5DataSet& dataset);
+                         const wrapper::HDF5DataSet& dataset,
+                         Span<const std::uint64_t> stride = {});
+
+/**
+ * @brief Convert the extents of a block of a dataset into the extents of the part of a strided
+ * selection that it holds, in place.
+ *
+ * @param extents The extents of the block.
+ * @param stride The stride of the selection, or empty if the selection is dense.
+ */
+void to_selection_extents(Span<std::uint64_t> extents, Span<const std::uint64_t> stride);
 
 }  // namespace legate::io::hdf5::detail
@@ -6,6 +6,7 @@
 
 #include <legate/io/hdf5/detail/hdf5_wrapper.h>
 
+#include <legate/io/hdf5/detail/handle_cache.h>
 #include <legate/utilities/detail/formatters.h>
 #include <legate/utilities/detail/traced_exception.h>
 
@@ -13,10 +14,12 @@
 
 #include <H5Dpublic.h>
 #include <H5Epublic.h>
+#include <H5FDsec2.h>
 #include <H5Fpublic.h>
 #include <H5Ppublic.h>
 #include <H5Spublic.h>
 #include <H5Tpublic.h>
+#include <H5Zpublic.h>
 #include <H5public.h>
 
 #include <algorithm>
@@ -26,6 +29,7 @@
 #include <cstdint>
 #include <iterator>
 #include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -541,6 +545,70 @@ void h5d_read(const HDF5MaybeLockGuard& lock,
   return plist_id;
 }
 
+[[nodiscard]] std::optional<std::uint64_t> h5d_get_offset(const HDF5MaybeLockGuard&, hid_t dset_id)
+{
+  // HADDR_UNDEF is also returned on error, e.g. for chunked datasets. In every case, the raw data
+  // just isn't at a single offset in the file.
+  const haddr_t addr = HDF5_CALL_NO_ERROR_PRINTING(H5Dget_offset(dset_id));
+
+  if (addr == HADDR_UNDEF) {
+    return std::nullopt;
+  }
+  return std::uint64_t{addr};
+}
+
+[[nodiscard]] std::optional<HDF5DataSet::ChunkLocation> h5d_get_chunk_info_by_coord(
+  const HDF5MaybeLockGuard& lock, hid_t dset_id, const hsize_t* offset)
+{
+  auto filter_mask = unsigned{};
+  auto addr        = haddr_t{};
+  auto size        = hsize_t{};
+  const herr_t err = HDF5_CALL_NO_ERROR_PRINTING(
+    H5Dget_chunk_info_by_coord(dset_id, offset, &filter_mask, &addr, &size));
+
+  if (err < 0) {
+    throw_hdf5_exception(lock, "Failed to get the location of a chunk of the dataset");
+  }
+  if (addr == HADDR_UNDEF) {
+    return std::nullopt;
+  }
+  return HDF5DataSet::ChunkLocation{std::uint64_t{addr}, std::uint64_t{size}, filter_mask};
+}
+
+[[nodiscard]] std::optional<int> h5d_get_posix_file_descriptor(const HDF5MaybeLockGuard&,
+                                                               hid_t dset_id)
+{
+  // The closers of the wrapped objects take the lock, which is already held here, so this
+  // manages the identifiers by hand. Any failure just means that there is no usable descriptor.
+  const hid_t file = HDF5_CALL_NO_ERROR_PRINTING(H5Iget_file_id(dset_id));
+
+  if (file == H5I_INVALID_HID) {
+    return std::nullopt;
+  }
+
+  const hid_t fapl = HDF5_CALL_NO_ERROR_PRINTING(H5Fget_access_plist(file));
+  const hid_t fcpl = HDF5_CALL_NO_ERROR_PRINTING(H5Fget_create_plist(file));
+  auto userblock   = hsize_t{};
+  void* handle     = nullptr;
+  auto ret         = std::optional<int>{};
+
+  if (fapl != H5I_INVALID_HID && fcpl != H5I_INVALID_HID &&
+      HDF5_CALL_NO_ERROR_PRINTING(H5Pget_driver(fapl)) == H5FD_SEC2 &&
+      HDF5_CALL_NO_ERROR_PRINTING(H5Pget_userblock(fcpl, &userblock)) >= 0 && userblock == 0 &&
+      HDF5_CALL_NO_ERROR_PRINTING(H5Fget_vfd_handle(file, fapl, &handle)) >= 0 &&
+      handle != nullptr) {
+    ret = *static_cast<const int*>(handle);
+  }
+  if (fcpl != H5I_INVALID_HID) {
+    std::ignore = H5Pclose(fcpl);
+  }
+  if (fapl != H5I_INVALID_HID) {
+    std::ignore = H5Pclose(fapl);
+  }
+  std::ignore = H5Fclose(file);
+  return ret;
+}
+
 /**
  * @brief Get the layout of a property list.
  *
@@ -749,6 +817,48 @@ h5s_get_select_bounds(const HDF5MaybeLockGuard& lock, hid_t space_id, std::size_
   return {std::move(block), std::move(offset)};
 }
 
+void h5p_set_chunk(const HDF5MaybeLockGuard& lock, hid_t dcpl, Span<const hsize_t> chunk_dims)
+{
+  const auto err = HDF5_CALL_NO_ERROR_PRINTING(
+    H5Pset_chunk(dcpl, static_cast<int>(chunk_dims.size()), chunk_dims.data()));
+
+  if (err < 0) {
+    throw_hdf5_exception(lock, "Failed to set chunk dimensions");
+  }
+}
+
+void h5p_set_shuffle(const HDF5MaybeLockGuard& lock, hid_t dcpl)
+{
+  const auto err = HDF5_CALL_NO_ERROR_PRINTING(H5Pset_shuffle(dcpl));
+
+  if (err < 0) {
+    throw_hdf5_exception(lock, "Failed to set shuffle filter");
+  }
+}
+
+void h5p_set_deflate(const HDF5MaybeLockGuard& lock, hid_t dcpl, std::uint32_t level)
+{
+  const auto err = HDF5_CALL_NO_ERROR_PRINTING(H5Pset_deflate(dcpl, level));
+
+  if (err < 0) {
+    throw_hdf5_exception(lock, fmt::format("Failed to set deflate filter with level {}", level));
+  }
+}
+
+void h5p_set_filter(const HDF5MaybeLockGuard& lock,
+                    hid_t dcpl,
+                    H5Z_filter_t filter,
+                    std::uint32_t flags,
+                    Span<const std::uint32_t> cd_values)
+{
+  const auto err = HDF5_CALL_NO_ERROR_PRINTING(
+    H5Pset_filter(dcpl, filter, flags, cd_values.size(), cd_values.data()));
+
+  if (err < 0) {
+    throw_hdf5_exception(lock, fmt::format("Failed to set filter {}", filter));
+  }
+}
+
 void h5p_set_fapl_gds(const HDF5MaybeLockGuard& lock,
                       hid_t fapl_id,
                       std::size_t alignment,
@@ -789,6 +899,18 @@ void h5p_set_fapl_gds(const HDF5MaybeLockGuard& lock,
 
 // ==========================================================================================
 
+[[nodiscard]] bool h5z_filter_avail(const HDF5MaybeLockGuard& lock, H5Z_filter_t filter)
+{
+  const auto ret = HDF5_CALL_NO_ERROR_PRINTING(H5Zfilter_avail(filter));
+
+  if (ret < 0) {
+    throw_hdf5_exception(lock, fmt::format("Failed to query availability of filter {}", filter));
+  }
+  return ret > 0;
+}
+
+// ==========================================================================================
+
 [[nodiscard]] H5O_info_t h5o_get_info_by_name(const HDF5MaybeLockGuard& lock,
                                               hid_t loc_id,
                                               legate::detail::ZStringView name,
@@ -1176,6 +1298,34 @@ void HDF5DataSet::read(
   h5d_read({}, hid(), mem_type_id, mem_space_id, file_space_id, dxpl_id, buf);
 }
 
+std::optional<std::uint64_t> HDF5DataSet::contiguous_offset() const
+{
+  return h5d_get_offset({}, hid());
+}
+
+void HDF5DataSet::chunk_locations(Span<const hsize_t> chunk_offsets,
+                                  Span<std::optional<ChunkLocation>> locations) const
+{
+  if (locations.empty()) {
+    return;
+  }
+
+  const auto ndim = chunk_offsets.size() / locations.size();
+
+  LEGATE_CHECK(ndim * locations.size() == chunk_offsets.size());
+
+  const auto lock = HDF5MaybeLockGuard{};
+
+  for (std::size_t i = 0; i < locations.size(); ++i) {
+    locations[i] = h5d_get_chunk_info_by_coord(lock, hid(), chunk_offsets.data() + (i * ndim));
+  }
+}
+
+std::optional<int> HDF5DataSet::posix_file_descriptor() const
+{
+  return h5d_get_posix_file_descriptor({}, hid());
+}
+
 HDF5VirtualSpace::HDF5VirtualSpace(hid_t hid, std::size_t index)
   : HDF5Object{[&] {
                  const auto lock = HDF5MaybeLockGuard{};
@@ -1214,6 +1364,13 @@ namespace {
 
 HDF5File::HDF5File(legate::detail::ZStringView filepath, OpenMode mode, hid_t fapl_id)
   : HDF5Object{[&] {
+                 if (mode == OpenMode::OVERWRITE) {
+                   // HDF5 refuses to truncate a file that is still open, either directly or as
+                   // the source of a cached virtual dataset, so drop every cached file. Must be
+                   // done before locking, since closing the cached handles takes the lock.
+                   HDF5HandleCache::get().clear();
+                 }
+
                  const auto lock    = HDF5MaybeLockGuard{};
                  const auto h5_mode = to_hdf5_open_mode(lock, mode);
 
@@ -1319,6 +1476,68 @@ legate::detail::SmallVector<hsize_t> HDF5DataSetCreatePropertyList::get_chunk_di
   return chunk_dims;
 }
 
+std::size_t HDF5DataSetCreatePropertyList::filter_count() const
+{
+  const auto lock = HDF5MaybeLockGuard{};
+  const auto ret  = HDF5_CALL_NO_ERROR_PRINTING(H5Pget_nfilters(hid()));
+
+  if (ret < 0) {
+    throw_hdf5_exception(lock, "Failed to get the number of filters");
+  }
+  return static_cast<std::size_t>(ret);
+}
+
+H5Z_filter_t HDF5DataSetCreatePropertyList::filter(std::size_t index) const
+{
+  const auto lock        = HDF5MaybeLockGuard{};
+  auto flags             = unsigned{};
+  auto num_cd_values     = std::size_t{0};
+  auto filter_config     = unsigned{};
+  const H5Z_filter_t ret = HDF5_CALL_NO_ERROR_PRINTING(H5Pget_filter2(hid(),
+                                                                      static_cast<unsigned>(index),
+                                                                      &flags,
+                                                                      &num_cd_values,
+                                                                      nullptr,
+                                                                      0,
+                                                                      nullptr,
+                                                                      &filter_config));
+
+  if (ret < 0) {
+    throw_hdf5_exception(lock, fmt::format("Failed to get filter {} of the pipeline", index));
+  }
+  return ret;
+}
+
+bool HDF5DataSetCreatePropertyList::filters_partial_chunks() const
+{
+  const auto lock = HDF5MaybeLockGuard{};
+  auto opts       = unsigned{};
+  const auto err  = HDF5_CALL_NO_ERROR_PRINTING(H5Pget_chunk_opts(hid(), &opts));
+
+  if (err < 0) {
+    throw_hdf5_exception(lock, "Failed to get the chunk options");
+  }
+  return (opts & H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS) == 0;
+}
+
+void HDF5DataSetCreatePropertyList::set_chunk(Span<const hsize_t> chunk_dims)
+{
+  h5p_set_chunk({}, hid(), chunk_dims);
+}
+
+void HDF5DataSetCreatePropertyList::set_shuffle() { h5p_set_shuffle({}, hid()); }
+
+void HDF5DataSetCreatePropertyList::set_deflate(std::uint32_t level)
+{
+  h5p_set_deflate({}, hid(), level);
+}
+
+void HDF5DataSetCreatePropertyList::set_filter(H5Z_filter_t filter,
+                                               Span<const std::uint32_t> cd_values)
+{
+  h5p_set_filter({}, hid(), filter, H5Z_FLAG_MANDATORY, cd_values);
+}
+
 void HDF5DataSetCreatePropertyList::set_virtual(const HDF5DataSpace& vds_space,
                                                 legate::detail::ZStringView file,
                                                 const HDF5DataSet& src_dset,
@@ -1361,4 +1580,24 @@ void HDF5FileAccessPropertyList::set_gds(std::size_t alignment,
   h5p_set_fapl_gds({}, hid(), alignment, block_size, cbuf_size);
 }
 
+// ==========================================================================================
+
+H5Z_filter_t to_hdf5_filter(Compression compression)
+{
+  // The identifiers of the Zstandard and LZ4 filters registered with the HDF Group. Their
+  // implementations are plugins, which HDF5 loads on first use.
+  constexpr H5Z_filter_t H5Z_FILTER_ZSTD = 32015;
+  constexpr H5Z_filter_t H5Z_FILTER_LZ4  = 32004;
+
+  switch (compression) {
+    case Compression::NONE: return H5Z_FILTER_NONE;
+    case Compression::DEFLATE: return H5Z_FILTER_DEFLATE;
+    case Compression::ZSTD: return H5Z_FILTER_ZSTD;
+    case Compression::LZ4: return H5Z_FILTER_LZ4;
+  }
+  LEGATE_ABORT("Unhandled compression ", legate::detail::to_underlying(compression));
+}
+
+bool is_filter_available(H5Z_filter_t filter) { return h5z_filter_avail({}, filter); }
+
 }  // namespace legate::io::hdf5::detail::wrapper
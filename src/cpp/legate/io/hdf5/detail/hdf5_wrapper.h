@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <legate/io/hdf5/interface.h>
 #include <legate/type/types.h>
 #include <legate/utilities/detail/small_vector.h>
 #include <legate/utilities/detail/zstring_view.h>
@@ -14,11 +15,13 @@
 
 #include <H5Ipublic.h>
 #include <H5Ppublic.h>
+#include <H5Zpublic.h>
 #include <H5public.h>
 
 #include <cstddef>
 #include <cstdint>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 
@@ -319,6 +322,49 @@ class HDF5DataSet : public HDF5Object {
   void read(hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id, void* buf) const;
   void read(
     hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id, void* buf) const;
+
+  /**
+   * @brief The location of the raw data of a chunk in the file.
+   */
+  class ChunkLocation {
+   public:
+    std::uint64_t offset{};       ///< The offset of the chunk in the file, in bytes.
+    std::uint64_t size{};         ///< The size of the chunk in the file, in bytes.
+    std::uint32_t filter_mask{};  ///< The filters of the pipeline skipped for this chunk.
+  };
+
+  /**
+   * @brief Get the offset in the file of the raw data of a contiguous dataset.
+   *
+   * @return The offset in bytes, or `std::nullopt` if the dataset isn't contiguous, its storage
+   * isn't allocated yet, or it is stored in external files.
+   */
+  [[nodiscard]] std::optional<std::uint64_t> contiguous_offset() const;
+
+  /**
+   * @brief Get the locations in the file of chunks of a chunked dataset.
+   *
+   * The lookups are done while holding the HDF5 lock only once.
+   *
+   * @param chunk_offsets The coordinates of the first element of each chunk, concatenated.
+   * Must hold `locations.size()` times the number of dimensions of the dataset values.
+   * @param locations The locations of the chunks, set to `std::nullopt` for chunks whose
+   * storage isn't allocated.
+   */
+  void chunk_locations(Span<const hsize_t> chunk_offsets,
+                       Span<std::optional<ChunkLocation>> locations) const;
+
+  /**
+   * @brief Get the POSIX file descriptor HDF5 reads the raw data of the dataset through.
+   *
+   * The descriptor is owned by HDF5, and stays valid as long as the dataset is open. It may be
+   * used concurrently with HDF5, but only with positional reads (e.g. `pread()`).
+   *
+   * @return The file descriptor, or `std::nullopt` if the file is accessed through another
+   * driver than the default POSIX one, or has a user block (in which case the offsets reported
+   * by HDF5 are not offsets in the file).
+   */
+  [[nodiscard]] std::optional<int> posix_file_descriptor() const;
 };
 
 /**
@@ -443,6 +489,55 @@ class HDF5DataSetCreatePropertyList : public HDF5PropertyList {
    */
   [[nodiscard]] legate::detail::SmallVector<hsize_t> get_chunk_dims(std::size_t ndim) const;
 
+  /**
+   * @return The number of filters in the filter pipeline of the dataset.
+   */
+  [[nodiscard]] std::size_t filter_count() const;
+
+  /**
+   * @brief Get a filter of the filter pipeline of the dataset.
+   *
+   * @param index The position of the filter in the pipeline, in `[0, filter_count())`.
+   *
+   * @return The identifier of the filter.
+   */
+  [[nodiscard]] H5Z_filter_t filter(std::size_t index) const;
+
+  /**
+   * @return Whether the filter pipeline is applied to the chunks at the edges of the dataset
+   * that are only partially covered by it, which HDF5 does unless told otherwise.
+   */
+  [[nodiscard]] bool filters_partial_chunks() const;
+
+  /**
+   * @brief Lay the dataset out in chunks.
+   *
+   * @param chunk_dims The extents of a chunk, one per dimension of the dataset.
+   */
+  void set_chunk(Span<const hsize_t> chunk_dims);
+
+  /**
+   * @brief Append the shuffle filter to the filter pipeline of the dataset.
+   */
+  void set_shuffle();
+
+  /**
+   * @brief Append the deflate filter to the filter pipeline of the dataset.
+   *
+   * @param level The compression level, in `[0, 9]`.
+   */
+  void set_deflate(std::uint32_t level);
+
+  /**
+   * @brief Append a filter to the filter pipeline of the dataset.
+   *
+   * The filter is mandatory: writing the dataset fails if the filter fails.
+   *
+   * @param filter The identifier of the filter.
+   * @param cd_values The parameters of the filter.
+   */
+  void set_filter(H5Z_filter_t filter, Span<const std::uint32_t> cd_values);
+
   /**
    * @brief Define a virtual dataset mapping to a source dataset.
    *
@@ -515,4 +610,22 @@ class HDF5FileAccessPropertyList : public HDF5PropertyList {
   void set_gds(std::size_t alignment, std::size_t block_size, std::size_t cbuf_size);
 };
 
+/**
+ * @brief Get the HDF5 filter implementing a compression filter.
+ *
+ * @param compression The compression filter.
+ *
+ * @return The identifier of the HDF5 filter, or `H5Z_FILTER_NONE` for `Compression::NONE`.
+ */
+[[nodiscard]] H5Z_filter_t to_hdf5_filter(Compression compression);
+
+/**
+ * @brief Check whether the HDF5 library can apply a filter, loading its plugin if needed.
+ *
+ * @param filter The identifier of the filter.
+ *
+ * @return `true` if the filter is available, `false` otherwise.
+ */
+[[nodiscard]] bool is_filter_available(H5Z_filter_t filter);
+
 }  // namespace legate::io::hdf5::detail::wrapper
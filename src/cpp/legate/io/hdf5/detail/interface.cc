@@ -10,6 +10,7 @@
 #include <legate/data/shape.h>
 #include <legate/experimental/io/detail/library.h>
 #include <legate/io/hdf5/detail/combine_vds.h>
+#include <legate/io/hdf5/detail/handle_cache.h>
 #include <legate/io/hdf5/detail/hdf5_partitioner.h>
 #include <legate/io/hdf5/detail/hdf5_wrapper.h>
 #include <legate/io/hdf5/detail/read.h>
@@ -26,6 +27,7 @@
 #include <legate/utilities/detail/type_traits.h>
 
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 #include <fmt/std.h>
 
 #include <cstddef>
@@ -144,16 +146,23 @@ namespace {
  * a parallel read task.
  *
  * @param native_path The path to the HDF5 file.
- * @param shape The shape of the dataset.
+ * @param shape The shape of the selection to read.
  * @param tile_shape The shape of each tile for partitioning.
  * @param dataset The dataset to read.
+ * @param start The start of the selection in the dataset.
+ * @param stride The stride of the selection in the dataset.
+ * @param identity The identity of the file when the read was launched.
  *
  * @return The LogicalStore that will contain the read data.
  */
-[[nodiscard]] LogicalStore submit_tiled_read_task(std::string_view native_path,
-                                                  const Shape& shape,
-                                                  Span<const std::uint64_t> tile_shape,
-                                                  const wrapper::HDF5DataSet& dataset)
+[[nodiscard]] LogicalStore submit_tiled_read_task(
+  std::string_view native_path,
+  const Shape& shape,
+  Span<const std::uint64_t> tile_shape,
+  const wrapper::HDF5DataSet& dataset,
+  Span<const std::uint64_t> start,
+  Span<const std::uint64_t> stride,
+  const wrapper::HDF5HandleCache::FileIdentity& identity)
 {
   auto ret       = create_output_store(dataset, shape);
   auto partition = ret.partition_by_tiling(tile_shape);
@@ -167,13 +176,26 @@ namespace {
   task.add_output(partition);
   task.add_scalar_arg(Scalar{native_path});
   task.add_scalar_arg(Scalar{dataset.name()});
+  task.add_scalar_arg(Scalar{start});
+  task.add_scalar_arg(Scalar{stride});
+  task.add_scalar_arg(Scalar{Span<const std::uint64_t>{identity}});
   rt->submit(std::move(task));
   return ret;
 }
 
-}  // namespace
-
-LogicalStore from_file(const std::filesystem::path& file_path, std::string_view dataset_name)
+/**
+ * @brief Open a dataset of a HDF5 file.
+ *
+ * @param file_path The path to the file.
+ * @param dataset_name The name of the dataset.
+ *
+ * @return The dataset.
+ *
+ * @throw std::system_error If the file does not exist.
+ * @throw InvalidDataSetError If the dataset does not exist.
+ */
+[[nodiscard]] wrapper::HDF5DataSet open_data_set(const std::filesystem::path& file_path,
+                                                 std::string_view dataset_name)
 {
   if (!std::filesystem::exists(file_path)) {
     throw legate::detail::TracedException<std::system_error>{
@@ -181,7 +203,6 @@ LogicalStore from_file(const std::filesystem::path& file_path, std::string_view
   }
 
   auto&& native_path = file_path.native();
-  auto* rt           = Runtime::get_runtime();
   const auto f       = wrapper::HDF5File{native_path, wrapper::HDF5File::OpenMode::READ_ONLY};
 
   if (!f.has_data_set(std::string{dataset_name})) {
@@ -190,10 +211,28 @@ LogicalStore from_file(const std::filesystem::path& file_path, std::string_view
       native_path,
       std::string{dataset_name}};
   }
+  // The dataset keeps the file open
+  return f.data_set(std::string{dataset_name});
+}
 
-  const auto dataset = f.data_set(std::string{dataset_name});
-  const auto shape   = deduce_shape_from_dataset(dataset);
-
+/**
+ * @brief Read a hyperslab of a dataset into a new store.
+ *
+ * @param native_path The path to the HDF5 file.
+ * @param dataset The dataset to read.
+ * @param shape The shape of the selection to read.
+ * @param start The start of the selection in the dataset.
+ * @param stride The stride of the selection in the dataset.
+ *
+ * @return The LogicalStore that will contain the read data.
+ */
+[[nodiscard]] LogicalStore read_data_set(std::string_view native_path,
+                                         const wrapper::HDF5DataSet& dataset,
+                                         const Shape& shape,
+                                         Span<const std::uint64_t> start,
+                                         Span<const std::uint64_t> stride)
+{
+  auto* rt                    = Runtime::get_runtime();
   const auto&& machine        = rt->get_machine();
   const auto& parallel_policy = Scope::parallel_policy();
   const std::size_t num_tiles =
@@ -202,10 +241,14 @@ LogicalStore from_file(const std::filesystem::path& file_path, std::string_view
   // try to use a tiling strategy to match the layout of the dataset in files. If the dataset layout
   // is not supported, then we use an auto task, which will be parallelized automatically
   // by the runtime
-  auto tile_shape = get_partition_tile_shape(shape, num_tiles, native_path, dataset);
+  auto tile_shape = get_partition_tile_shape(shape, num_tiles, native_path, dataset, stride);
+  // Taken once here rather than by every point task, so that the read tasks only compare it
+  // against the identity of the file they have cached
+  const auto identity = wrapper::HDF5HandleCache::identify(native_path);
 
   if (tile_shape) {
-    return submit_tiled_read_task(native_path, shape, *tile_shape, dataset);
+    return submit_tiled_read_task(
+      native_path, shape, *tile_shape, dataset, start, stride, identity);
   }
 
   // this is the fallback case, we use an auto task, which will be parallelized automatically
@@ -215,12 +258,70 @@ LogicalStore from_file(const std::filesystem::path& file_path, std::string_view
                               detail::HDF5Read::TASK_CONFIG.task_id());
 
   task.add_scalar_arg(Scalar{native_path});
-  task.add_scalar_arg(Scalar{dataset_name});
+  task.add_scalar_arg(Scalar{dataset.name()});
+  task.add_scalar_arg(Scalar{start});
+  task.add_scalar_arg(Scalar{stride});
+  task.add_scalar_arg(Scalar{Span<const std::uint64_t>{identity}});
   task.add_output(ret);
   rt->submit(std::move(task));
   return ret;
 }
 
+}  // namespace
+
+LogicalStore from_file(const std::filesystem::path& file_path, std::string_view dataset_name)
+{
+  const auto dataset = open_data_set(file_path, dataset_name);
+  const auto shape   = deduce_shape_from_dataset(dataset);
+  const auto start   = legate::detail::SmallVector<std::uint64_t, LEGATE_MAX_DIM>{
+    legate::detail::tags::size_tag, shape.ndim(), 0};
+  const auto stride = legate::detail::SmallVector<std::uint64_t, LEGATE_MAX_DIM>{
+    legate::detail::tags::size_tag, shape.ndim(), 1};
+
+  return read_data_set(file_path.native(), dataset, shape, start, stride);
+}
+
+LogicalStore from_file(const std::filesystem::path& file_path,
+                       std::string_view dataset_name,
+                       const Hyperslab& selection)
+{
+  const auto dataset = open_data_set(file_path, dataset_name);
+  const auto extents = dataset.data_space().extents();
+  const auto& start  = selection.start();
+  const auto& count  = selection.count();
+  const auto& stride = selection.stride();
+
+  if (extents.empty()) {
+    throw legate::detail::TracedException<std::invalid_argument>{
+      fmt::format("Cannot select a hyperslab of scalar dataset '{}'", dataset_name)};
+  }
+  if (start.size() != extents.size()) {
+    throw legate::detail::TracedException<std::invalid_argument>{
+      fmt::format("Hyperslab has {} dimensions, but dataset '{}' has {}",
+                  start.size(),
+                  dataset_name,
+                  extents.size())};
+  }
+  for (std::size_t dim = 0; dim < extents.size(); ++dim) {
+    if (count[dim] == 0) {
+      continue;
+    }
+    // Same as start + (count - 1) * stride >= extent, without overflowing
+    if (start[dim] >= extents[dim] ||
+        count[dim] - 1 > (extents[dim] - 1 - start[dim]) / stride[dim]) {
+      throw legate::detail::TracedException<std::invalid_argument>{
+        fmt::format("Hyperslab (start {}, count {}, stride {}) selects elements outside of "
+                    "dataset '{}' of shape {}",
+                    start,
+                    count,
+                    stride,
+                    dataset_name,
+                    extents)};
+    }
+  }
+  return read_data_set(file_path.native(), dataset, Shape{count}, start, stride);
+}
+
 namespace {
 
 /**
@@ -255,11 +356,97 @@ namespace {
   return std::filesystem::weakly_canonical(path).make_preferred();
 }
 
+/**
+ * @brief Check that the write options can be applied to a store.
+ *
+ * @param store The store to write.
+ * @param options The write options.
+ *
+ * @return The compression level to use, which is the default level of the compression filter
+ * if `options` doesn't set one.
+ *
+ * @throw std::invalid_argument If the options are invalid for `store`, or if the HDF5 library
+ * doesn't support the compression filter.
+ */
+[[nodiscard]] std::uint32_t validate_write_options(const LogicalStore& store,
+                                                   const WriteOptions& options)
+{
+  // HDF5 cannot store chunks of 4 GiB or more
+  constexpr std::uint64_t MAX_CHUNK_BYTES   = (std::uint64_t{1} << 32) - 1;
+  constexpr std::uint32_t MAX_DEFLATE_LEVEL = 9;
+  constexpr std::uint32_t DEFLATE_LEVEL     = 6;
+  constexpr std::uint32_t MAX_ZSTD_LEVEL    = 22;
+  constexpr std::uint32_t ZSTD_LEVEL        = 3;
+
+  if (const auto& chunk_shape = options.chunk_shape(); !chunk_shape.empty()) {
+    if (chunk_shape.size() != store.dim()) {
+      throw legate::detail::TracedException<std::invalid_argument>{
+        fmt::format("Chunk shape {} must have as many dimensions as the store ({})",
+                    chunk_shape,
+                    store.dim())};
+    }
+
+    auto chunk_bytes = std::uint64_t{store.type().size()};
+
+    for (auto&& extent : chunk_shape) {
+      if (extent == 0) {
+        throw legate::detail::TracedException<std::invalid_argument>{
+          fmt::format("Chunk shape {} must not contain zeros", chunk_shape)};
+      }
+      if (chunk_bytes > MAX_CHUNK_BYTES / extent) {
+        throw legate::detail::TracedException<std::invalid_argument>{fmt::format(
+          "Chunk shape {} is too large, chunks must be smaller than 4 GiB", chunk_shape)};
+      }
+      chunk_bytes *= extent;
+    }
+  }
+
+  const auto compression = options.compression();
+  const auto& level      = options.compression_level();
+  const auto name        = [&]() -> std::string_view {
+    switch (compression) {
+      case Compression::NONE: return "no compression";
+      case Compression::DEFLATE: return "deflate";
+      case Compression::ZSTD: return "Zstandard";
+      case Compression::LZ4: return "LZ4";
+    }
+    LEGATE_ABORT("Unhandled compression ", legate::detail::to_underlying(compression));
+  }();
+  const auto resolve_level = [&](std::uint32_t lo, std::uint32_t hi, std::uint32_t dflt) {
+    if (level.has_value() && (*level < lo || *level > hi)) {
+      throw legate::detail::TracedException<std::invalid_argument>{fmt::format(
+        "Compression level {} is out of range for {}, must be in [{}, {}]", *level, name, lo, hi)};
+    }
+    return level.value_or(dflt);
+  };
+  const auto ret = [&] {
+    switch (compression) {
+      case Compression::DEFLATE: return resolve_level(0, MAX_DEFLATE_LEVEL, DEFLATE_LEVEL);
+      case Compression::ZSTD: return resolve_level(1, MAX_ZSTD_LEVEL, ZSTD_LEVEL);
+      case Compression::NONE: [[fallthrough]];
+      case Compression::LZ4: break;
+    }
+    if (level.has_value()) {
+      throw legate::detail::TracedException<std::invalid_argument>{
+        fmt::format("Compression level {} given, but {} does not take a level", *level, name)};
+    }
+    return std::uint32_t{0};
+  }();
+
+  if (compression != Compression::NONE &&
+      !wrapper::is_filter_available(wrapper::to_hdf5_filter(compression))) {
+    throw legate::detail::TracedException<std::invalid_argument>{
+      fmt::format("The HDF5 library does not support {} compression", name)};
+  }
+  return ret;
+}
+
 }  // namespace
 
 void to_file(const LogicalStore& store,
              std::filesystem::path file_path,
-             std::string_view dataset_name)
+             std::string_view dataset_name,
+             const WriteOptions& options)
 {
   file_path = normalize_path(file_path);
 
@@ -268,10 +455,11 @@ void to_file(const LogicalStore& store,
       fmt::format("File path ({}) must be the name of a file, not a directory", file_path)};
   }
 
-  auto* const runtime     = Runtime::get_runtime();
-  const auto vds_dir      = to_vds_dir(file_path);
-  const auto vds_dir_scal = Scalar{vds_dir.native()};
-  const auto dset_scal    = Scalar{dataset_name};
+  const auto compression_level = validate_write_options(store, options);
+  auto* const runtime          = Runtime::get_runtime();
+  const auto vds_dir           = to_vds_dir(file_path);
+  const auto vds_dir_scal      = Scalar{vds_dir.native()};
+  const auto dset_scal         = Scalar{dataset_name};
 
   // This dummy argument exists because the HDF5CombineVDS task requires that all the separate
   // VDS files have been written to disk first. We want to make it as small as possible because
@@ -279,12 +467,23 @@ void to_file(const LogicalStore& store,
   // be gathered to a single node by legion.
   const auto dummy_data_dependence = runtime->create_store(Scalar{bool{}});
 
+  // Every process runs this, so this closes the file in the processes that already read it but
+  // won't run the tasks overwriting it, which HDF5 may otherwise prevent from truncating it. Reads
+  // still in flight may cache the file again, so the write tasks invalidate it once more when
+  // they run.
+  wrapper::HDF5HandleCache::get().invalidate(file_path.native());
+
   {
     auto task = runtime->create_task(experimental::io::detail::core_io_library(),
                                      detail::HDF5WriteVDS::TASK_CONFIG.task_id());
 
     task.add_scalar_arg(vds_dir_scal);
     task.add_scalar_arg(dset_scal);
+    task.add_scalar_arg(Scalar{options.chunk_shape()});
+    task.add_scalar_arg(Scalar{legate::detail::to_underlying(options.compression())});
+    task.add_scalar_arg(Scalar{compression_level});
+    task.add_scalar_arg(Scalar{options.shuffle()});
+    task.add_scalar_arg(Scalar{file_path.native()});
     task.add_input(store);
     task.add_reduction(dummy_data_dependence, ReductionOpKind::ADD);
     // The point of no return. Once we submit the task, the user will be unable to potentially
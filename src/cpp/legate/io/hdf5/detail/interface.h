@@ -7,6 +7,7 @@
 #pragma once
 
 #include <legate/data/logical_store.h>
+#include <legate/io/hdf5/interface.h>
 
 #include <filesystem>
 #include <string_view>
@@ -16,6 +17,21 @@ namespace legate::io::hdf5::detail {
 [[nodiscard]] LogicalStore from_file(const std::filesystem::path& file_path,
                                      std::string_view dataset_name);
 
+/**
+ * @brief Load a hyperslab of a HDF5 dataset into a LogicalStore.
+ *
+ * See `legate::io::hdf5::from_file()` for further discussion on the semantics of this routine.
+ *
+ * @param file_path The path to the file to load.
+ * @param dataset_name The name of the HDF5 dataset to load from the file.
+ * @param selection The elements of the dataset to load.
+ *
+ * @return The loaded store.
+ */
+[[nodiscard]] LogicalStore from_file(const std::filesystem::path& file_path,
+                                     std::string_view dataset_name,
+                                     const Hyperslab& selection);
+
 /**
  * @brief Write a LogicalArray to disk as a HDF5 dataset.
  *
@@ -28,9 +44,11 @@ namespace legate::io::hdf5::detail {
  * @param dataset_name The HDF5 dataset name to write the store under. See
  * https://support.hdfgroup.org/documentation/hdf5/latest/_h5_d__u_g.html for further
  * discussion on datasets.
+ * @param options The layout of the dataset.
  */
 void to_file(const LogicalStore& store,
              std::filesystem::path file_path,
-             std::string_view dataset_name);
+             std::string_view dataset_name,
+             const WriteOptions& options);
 
 }  // namespace legate::io::hdf5::detail
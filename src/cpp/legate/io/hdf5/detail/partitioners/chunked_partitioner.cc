@@ -18,7 +18,8 @@ std::optional<legate::detail::SmallVector<std::uint64_t, LEGATE_MAX_DIM>>
 ChunkedPartitioner::partition_tile_shape(const Shape& shape,
                                          std::size_t num_tiles,
                                          const std::filesystem::path& /*vds_path*/,
-                                         const wrapper::HDF5DataSet& dataset)
+                                         const wrapper::HDF5DataSet& dataset,
+                                         Span<const std::uint64_t> stride)
 {
   LEGATE_CHECK(num_tiles > 0);
 
@@ -38,6 +39,7 @@ ChunkedPartitioner::partition_tile_shape(const Shape& shape,
   for (std::uint32_t i = 0; i < shape.ndim(); ++i) {
     tile_shape[i] = chunk_shape[i];
   }
+  to_selection_extents(tile_shape, stride);
 
   // tile along the slowest dimension
   const auto slowest_dim = 0;
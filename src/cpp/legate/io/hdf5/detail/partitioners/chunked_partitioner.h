@@ -21,7 +21,8 @@ class ChunkedPartitioner final : public HDF5Partitioner {
    * @brief Partition a chunked dataset into the given number of tiles.
    *
    * Uses the dataset's chunk dimensions as a basis for tiling with the following logic:
-   * - Non-slowest dimensions use chunk sizes (respecting shape boundaries)
+   * - Non-slowest dimensions use chunk sizes, converted to the number of selected elements they
+   *   hold (respecting shape boundaries)
    * - Slowest dimension is adjusted using a factor. This is calculated as the
    *   number of tiles needed if we use the chunk sizes for tiling divided by the number of tiles
    * requested.
@@ -37,7 +38,8 @@ class ChunkedPartitioner final : public HDF5Partitioner {
   partition_tile_shape(const Shape& shape,
                        std::size_t num_tiles,
                        const std::filesystem::path& vds_path,
-                       const wrapper::HDF5DataSet& dataset) override;
+                       const wrapper::HDF5DataSet& dataset,
+                       Span<const std::uint64_t> stride) override;
 };
 
 }  // namespace legate::io::hdf5::detail
@@ -17,7 +17,8 @@ std::optional<legate::detail::SmallVector<std::uint64_t, LEGATE_MAX_DIM>>
 ContiguousPartitioner::partition_tile_shape(const Shape& shape,
                                             std::size_t num_tiles,
                                             const std::filesystem::path& /*vds_path*/,
-                                            const wrapper::HDF5DataSet& /*dataset*/)
+                                            const wrapper::HDF5DataSet& /*dataset*/,
+                                            Span<const std::uint64_t> /*stride*/)
 {
   if (shape.ndim() <= 1 || shape.volume() == 0 || num_tiles > shape[0]) {
     return std::nullopt;
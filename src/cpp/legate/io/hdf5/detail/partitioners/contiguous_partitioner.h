@@ -28,7 +28,8 @@ class ContiguousPartitioner final : public HDF5Partitioner {
   partition_tile_shape(const Shape& shape,
                        std::size_t num_tiles,
                        const std::filesystem::path& vds_path,
-                       const wrapper::HDF5DataSet& dataset) override;
+                       const wrapper::HDF5DataSet& dataset,
+                       Span<const std::uint64_t> stride) override;
 };
 
 }  // namespace legate::io::hdf5::detail
@@ -7,6 +7,7 @@
 #include <legate/io/hdf5/detail/partitioners/vds_partitioner.h>
 
 #include <legate/data/shape.h>
+#include <legate/io/hdf5/detail/hdf5_wrapper.h>
 #include <legate/utilities/abort.h>
 
 #include <algorithm>
@@ -17,7 +18,8 @@ std::optional<legate::detail::SmallVector<std::uint64_t, LEGATE_MAX_DIM>>
 VDSPartitioner::partition_tile_shape(const Shape& shape,
                                      std::size_t num_tiles,
                                      const std::filesystem::path& vds_path,
-                                     const wrapper::HDF5DataSet& dataset)
+                                     const wrapper::HDF5DataSet& dataset,
+                                     Span<const std::uint64_t> stride)
 {
   if (shape.ndim() <= 1 || shape.volume() == 0 || shape[0] < num_tiles) {
     return std::nullopt;
@@ -38,7 +40,8 @@ VDSPartitioner::partition_tile_shape(const Shape& shape,
   legate::detail::SmallVector<hsize_t, LEGATE_MAX_DIM> standard_shape{};
 
   if (layout == H5D_CONTIGUOUS) {
-    auto ret = get_contigous_shape_if_uniform_(dataset, shape);
+    // The blocks are laid out over the whole dataset, not just the selected part of it
+    auto ret = get_contigous_shape_if_uniform_(dataset, Shape{dataset.data_space().extents()});
 
     // if blocks are not uniform then we cannot use the tiling strategy
     if (!ret) {
@@ -66,6 +69,7 @@ VDSPartitioner::partition_tile_shape(const Shape& shape,
   for (std::uint32_t i = 0; i < shape.ndim(); ++i) {
     tile_shape[i] = standard_shape[i];
   }
+  to_selection_extents(tile_shape, stride);
 
   // Calculate tiles needed in non-slowest dimensions
   std::uint64_t tiles_needed = 1;
@@ -30,7 +30,8 @@ class VDSPartitioner final : public HDF5Partitioner {
    *
    * Uses the dataset's chunk dimensions or block shapes as a basis for tiling with the following
    * logic:
-   * - Non-slowest dimensions use chunk/block sizes (respecting shape boundaries)
+   * - Non-slowest dimensions use chunk/block sizes, converted to the number of selected elements
+   *   they hold (respecting shape boundaries)
    * - Slowest dimension is adjusted using a factor. This is calculated as the
    *   number of tiles needed if we use the chunk/block sizes for tiling divided by the number of
    * tiles requested.
@@ -40,10 +41,11 @@ class VDSPartitioner final : public HDF5Partitioner {
    * - Dataset has <=1 dimension or is empty
    * - num_tiles exceeds the slowest dimension size
    *
-   * @param shape The shape of the dataset.
+   * @param shape The shape of the selected part of the dataset.
    * @param num_tiles The number of tiles to partition the dataset into.
    * @param vds_path The path to the VDS file.
    * @param dataset The dataset.
+   * @param stride The stride of the selection, or empty if the selection is dense.
    *
    * @return The tile shape if partitioning is possible, otherwise std::nullopt.
    */
@@ -51,7 +53,8 @@ class VDSPartitioner final : public HDF5Partitioner {
   partition_tile_shape(const Shape& shape,
                        std::size_t num_tiles,
                        const std::filesystem::path& vds_path,
-                       const wrapper::HDF5DataSet& dataset) override;
+                       const wrapper::HDF5DataSet& dataset,
+                       Span<const std::uint64_t> stride) override;
 
  private:
   /**
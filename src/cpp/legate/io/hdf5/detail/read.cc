@@ -7,15 +7,20 @@
 #include <legate/io/hdf5/detail/read.h>
 
 #include <legate/cuda/detail/cuda_driver_api.h>
+#include <legate/io/hdf5/detail/direct_read.h>
+#include <legate/io/hdf5/detail/handle_cache.h>
 #include <legate/io/hdf5/detail/hdf5_wrapper.h>
 #include <legate/runtime/detail/runtime.h>
 #include <legate/type/detail/types.h>  // for Type::Code formatter
 #include <legate/type/type_traits.h>
+#include <legate/utilities/assert.h>
 #include <legate/utilities/detail/formatters.h>
 #include <legate/utilities/detail/traced_exception.h>
+#include <legate/utilities/scope_guard.h>
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -27,27 +32,19 @@ namespace legate::io::hdf5::detail {
 namespace {
 
 void read_hdf5_file(legate::detail::ZStringView filepath,
+                    const wrapper::HDF5HandleCache::FileIdentity& identity,
                     bool gds_on,
                     legate::detail::ZStringView dataset_name,
                     Span<const hsize_t> offset,
+                    Span<const hsize_t> stride,
                     Span<const hsize_t> file_space_extents,
                     Span<const hsize_t> mem_space_extents,
                     void* dst)
 {
-  const auto f = [&] {
-    if (gds_on) {
-      constexpr auto BLOCK_SIZE = 4096;
-      constexpr auto BUF_SIZE   = 16 * 1024 * 1024;
-      auto props                = wrapper::HDF5FileAccessPropertyList{};
-
-      props.set_gds(BLOCK_SIZE, BLOCK_SIZE, BUF_SIZE);
-      return wrapper::HDF5File{filepath, wrapper::HDF5File::OpenMode::READ_ONLY, props};
-    }
-    return wrapper::HDF5File{filepath, wrapper::HDF5File::OpenMode::READ_ONLY};
-  }();
-  // Open selected part of the hdf5 file
-  const auto dataset = f.data_set(dataset_name);
-  auto file_space    = dataset.data_space();
+  // Point tasks reading the same dataset share the file and dataset handles
+  const auto dataset =
+    wrapper::HDF5HandleCache::get().data_set(filepath, dataset_name, gds_on, identity);
+  auto file_space = dataset.data_space();
 
   // Handle scalar & null dataspaces
   if (file_space.extents().empty()) {
@@ -61,8 +58,14 @@ void read_hdf5_file(legate::detail::ZStringView filepath,
     return;
   }
 
+  // With GDS, the destination may be device memory, which only the GDS driver can read into
+  if (!gds_on &&
+      try_direct_read(dataset, offset, stride, file_space_extents, mem_space_extents, dst)) {
+    return;
+  }
+
   file_space.select_hyperslab(
-    wrapper::HDF5DataSpace::SelectMode::SELECT_SET, offset, file_space_extents);
+    wrapper::HDF5DataSpace::SelectMode::SELECT_SET, offset, file_space_extents, stride);
 
   auto mem_space          = wrapper::HDF5DataSpace{mem_space_extents};
   const auto zero_offsets = legate::detail::SmallVector<hsize_t, LEGATE_MAX_DIM>{
@@ -101,6 +104,16 @@ class HDF5ReadFn {
     const auto gds_on       = legate::detail::Runtime::get_runtime().config().io_use_vfd_gds();
     const auto filepath     = context.scalar(0).value<std::string>();
     const auto dataset_name = context.scalar(1).value<std::string>();
+    const auto start        = context.scalar(2).values<std::uint64_t>();
+    const auto stride       = context.scalar(3).values<std::uint64_t>();
+    const auto identity     = [&] {
+      const auto values = context.scalar(4).values<std::uint64_t>();
+      auto ret          = wrapper::HDF5HandleCache::FileIdentity{};
+
+      LEGATE_CHECK(values.size() == ret.size());
+      std::copy_n(values.begin(), ret.size(), ret.begin());
+      return ret;
+    }();
     // The binary type will default to a field size of 1, but our actual type might be
     // arbitrarily sized. So we need to tell Legion the true size, otherwise we get a bunch of:
     //
@@ -121,15 +134,23 @@ class HDF5ReadFn {
       }
       return ret;
     }();
-    // Find file offset and size of each dimension
+    // Find file offset and stride of each dimension. The store holds the selected elements of
+    // the dataset, so its point `p` is the element at `start + p * stride` in the file.
     const auto file_offsets = [&] {
       auto ret = std::array<hsize_t, DIM>{};
 
       for (std::uint32_t i = 0; i < DIM; ++i) {
-        ret[i] = static_cast<hsize_t>(shape.lo[i]);
+        ret[i] = static_cast<hsize_t>(start[i] +
+                                      (static_cast<std::uint64_t>(shape.lo[i]) * stride[i]));
       }
       return ret;
     }();
+    const auto file_strides = [&] {
+      auto ret = std::array<hsize_t, DIM>{};
+
+      std::copy_n(stride.begin(), DIM, ret.begin());
+      return ret;
+    }();
 
     if ((is_device && gds_on) || !is_device) {
       // HDF5 requires two sizes when defining a memory space:
@@ -165,8 +186,15 @@ class HDF5ReadFn {
 
       // When running on a CPU, or using GPU with GDS, we can read directly into the
       // destination memory
-      read_hdf5_file(
-        filepath, gds_on, dataset_name, file_offsets, file_space_extents, mem_space_extents, dst);
+      read_hdf5_file(filepath,
+                     identity,
+                     gds_on,
+                     dataset_name,
+                     file_offsets,
+                     file_strides,
+                     file_space_extents,
+                     mem_space_extents,
+                     dst);
       return;
     }
 
@@ -179,8 +207,15 @@ class HDF5ReadFn {
     // anyways.
     const auto mem_space_extents = file_space_extents;
 
-    read_hdf5_file(
-      filepath, gds_on, dataset_name, file_offsets, file_space_extents, mem_space_extents, ptr);
+    read_hdf5_file(filepath,
+                   identity,
+                   gds_on,
+                   dataset_name,
+                   file_offsets,
+                   file_strides,
+                   file_space_extents,
+                   mem_space_extents,
+                   ptr);
     // And then copy from the bounce buffer to the GPU
     cuda::detail::get_cuda_driver_api()->mem_cpy_async(dst, ptr, size * type_size, stream);
   }
@@ -242,4 +277,11 @@ void task_body(const legate::TaskContext& context, bool is_device)
   task_body(context, /*is_device=*/true);
 }
 
+/*static*/ void HDF5Read::close_cached_files()
+{
+  LEGATE_SCOPE_GUARD(wrapper::HDF5HandleCache::get().clear());
+  // Read tasks that are still in flight would otherwise open their files again
+  legate::detail::Runtime::get_runtime().issue_execution_fence(/* block */ true);
+}
+
 }  // namespace legate::io::hdf5::detail
@@ -23,7 +23,12 @@ namespace legate::io::hdf5::detail {
  *   - scalars:
  *     - path: std::string
  *     - dataset_name: std::string
- *   - inputs:
+ *     - start: std::uint64_t[], the index in the dataset of the first element of the store
+ *     - stride: std::uint64_t[], the distance in the dataset between consecutive elements of
+ *       the store
+ *     - identity: std::uint64_t[], the identity of the file when the read was launched (see
+ *       `HDF5HandleCache::identify()`)
+ *   - outputs:
  *     - buffer: store (any dtype)
  *
  * NB: the store must be contiguous. To make Legate enforce this,
@@ -34,19 +39,31 @@ class HDF5Read : public LegateTask<HDF5Read> {
  public:
   static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
     TaskConfig{LocalTaskID{legate::detail::CoreTask::IO_HDF5_FILE_READ}}
-      .with_signature(TaskSignature{}.inputs(0).outputs(1).scalars(2).redops(0).constraints(
+      .with_signature(TaskSignature{}.inputs(0).outputs(1).scalars(5).redops(0).constraints(
         {Span<const legate::ProxyConstraint>{}}) /* some compilers complain with {{}} */)
-      .with_variant_options(
-        VariantOptions{}.with_has_side_effect(true).with_elide_device_ctx_sync(true));
+      .with_variant_options(VariantOptions{}
+                              .with_has_side_effect(true)
+                              .with_elide_device_ctx_sync(true)
+                              .with_read_ahead(true));
 
   static constexpr auto GPU_VARIANT_OPTIONS = VariantOptions{}
                                                 .with_elide_device_ctx_sync(true)
                                                 .with_has_allocations(true)
-                                                .with_has_side_effect(true);
+                                                .with_has_side_effect(true)
+                                                .with_read_ahead(true);
 
   static void cpu_variant(legate::TaskContext context);
   static void omp_variant(legate::TaskContext context);
   static void gpu_variant(legate::TaskContext context);
+
+  /**
+   * @brief Close the files kept open by the read tasks of this process.
+   *
+   * Waits for all outstanding operations first, so that no read task opens a file again
+   * afterwards. Meant to run as a shutdown callback of the runtime, while HDF5 is still usable.
+   * The files are closed even if waiting fails, in which case the exception is rethrown.
+   */
+  static void close_cached_files();
 };
 
 }  // namespace legate::io::hdf5::detail
@@ -7,22 +7,27 @@
 #include <legate/io/hdf5/detail/write_vds.h>
 
 #include <legate/cuda/detail/cuda_driver_api.h>
+#include <legate/io/hdf5/detail/handle_cache.h>
 #include <legate/io/hdf5/detail/hdf5_wrapper.h>
 #include <legate/runtime/detail/runtime.h>
 #include <legate/type/type_traits.h>
 #include <legate/utilities/detail/formatters.h>
+#include <legate/utilities/detail/small_vector.h>
 #include <legate/utilities/detail/traced_exception.h>
+#include <legate/utilities/detail/zip.h>
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
 #include <H5Ppublic.h>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -55,6 +60,110 @@ namespace legate::io::hdf5::detail {
 
 namespace {
 
+/**
+ * @brief The layout of the datasets written by the write tasks, as set by `WriteOptions`.
+ */
+class DataSetLayout {
+ public:
+  /**
+   * @brief Decode the layout from the scalar arguments of a write task.
+   *
+   * @param context The task context.
+   */
+  explicit DataSetLayout(const legate::TaskContext& context);
+
+  /**
+   * @return `true` if the chunks of the datasets are filtered, `false` otherwise.
+   */
+  [[nodiscard]] bool filtered() const;
+
+  /**
+   * @brief Make the creation property list of the dataset holding a tile.
+   *
+   * @param extents The extents of the tile.
+   * @param type_size The size of the elements of the tile.
+   *
+   * @return The property list, or `std::nullopt` if the tile is written contiguously.
+   */
+  [[nodiscard]] std::optional<wrapper::HDF5DataSetCreatePropertyList> make_create_plist(
+    Span<const hsize_t> extents, std::size_t type_size) const;
+
+ private:
+  legate::detail::SmallVector<std::uint64_t, LEGATE_MAX_DIM> chunk_shape_{};
+  Compression compression_{};
+  std::uint32_t compression_level_{};
+  bool shuffle_{};
+};
+
+DataSetLayout::DataSetLayout(const legate::TaskContext& context)
+  : chunk_shape_{context.scalar(2).values<std::uint64_t>()},
+    compression_{static_cast<Compression>(context.scalar(3).value<std::uint8_t>())},
+    compression_level_{context.scalar(4).value<std::uint32_t>()},
+    shuffle_{context.scalar(5).value<bool>()}
+{
+}
+
+bool DataSetLayout::filtered() const { return shuffle_ || compression_ != Compression::NONE; }
+
+std::optional<wrapper::HDF5DataSetCreatePropertyList> DataSetLayout::make_create_plist(
+  Span<const hsize_t> extents, std::size_t type_size) const
+{
+  // Size of the chunks when the user only asked for filters
+  constexpr std::size_t DEFAULT_CHUNK_BYTES = 1 << 20;
+
+  // Tiles are written contiguously unless chunks or filters are requested, or if they are empty
+  // (which HDF5 can't chunk)
+  if ((chunk_shape_.empty() && !filtered()) ||
+      std::any_of(extents.begin(), extents.end(), [](hsize_t extent) { return extent == 0; })) {
+    return std::nullopt;
+  }
+
+  auto chunk_dims = legate::detail::SmallVector<hsize_t, LEGATE_MAX_DIM>{
+    legate::detail::tags::iterator_tag, extents.begin(), extents.end()};
+
+  if (chunk_shape_.empty()) {
+    auto chunk_bytes = type_size;
+
+    for (auto&& extent : chunk_dims) {
+      chunk_bytes *= extent;
+    }
+    // Halve the outermost dimensions until the chunks are small enough
+    for (auto&& extent : chunk_dims) {
+      while (chunk_bytes > DEFAULT_CHUNK_BYTES && extent > 1) {
+        const auto halved = (extent + 1) / 2;
+
+        chunk_bytes = chunk_bytes / extent * halved;
+        extent      = halved;
+      }
+    }
+  } else {
+    LEGATE_CHECK(chunk_shape_.size() == chunk_dims.size());
+    // Chunks can't be larger than the dataset
+    for (auto&& [extent, chunk_extent] : legate::detail::zip_equal(chunk_dims, chunk_shape_)) {
+      extent = std::min(extent, hsize_t{chunk_extent});
+    }
+  }
+
+  auto ret = wrapper::HDF5DataSetCreatePropertyList{};
+
+  ret.set_chunk(chunk_dims);
+  if (shuffle_) {
+    ret.set_shuffle();
+  }
+  switch (compression_) {
+    case Compression::NONE: break;
+    case Compression::DEFLATE: ret.set_deflate(compression_level_); break;
+    case Compression::ZSTD: {
+      const auto cd_values = std::array<std::uint32_t, 1>{compression_level_};
+
+      ret.set_filter(wrapper::to_hdf5_filter(compression_), cd_values);
+      break;
+    }
+    case Compression::LZ4: ret.set_filter(wrapper::to_hdf5_filter(compression_), {}); break;
+  }
+  return ret;
+}
+
 /**
  * @brief Actually create the HDF5 file on disk.
  *
@@ -62,6 +171,7 @@ namespace {
  * @param extents The extents of the array to write.
  * @param dataset_name The name of the dataset to write.
  * @param type The type of the data.
+ * @param layout The layout of the dataset.
  * @param gds_on Whether to enable GDS when opening the file.
  * @param ptr A pointer to the beginning of the buffer to write. It must be of size
  * `extents.volume()`.
@@ -71,6 +181,7 @@ void write_hdf5_file(const std::string& filepath,
                      Span<const hsize_t> mem_space_extents,
                      const std::string& dataset_name,
                      const Type& type,
+                     const DataSetLayout& layout,
                      bool gds_on,
                      const void* ptr)
 {
@@ -86,7 +197,10 @@ void write_hdf5_file(const std::string& filepath,
     return wrapper::HDF5File{filepath, wrapper::HDF5File::OpenMode::OVERWRITE};
   }();
   const auto file_space = wrapper::HDF5DataSpace{file_space_extents};
-  const auto dset       = wrapper::HDF5DataSet{file, dataset_name, type, file_space};
+  const auto dcpl       = layout.make_create_plist(file_space_extents, type.size());
+  const auto dcpl_id    = dcpl.has_value() ? dcpl->hid() : LEGATE_PURE_H5_ENUM(H5P_DEFAULT);
+  const auto dset       = wrapper::HDF5DataSet{
+    file, dataset_name, type, file_space, LEGATE_PURE_H5_ENUM(H5P_DEFAULT), dcpl_id};
   auto mem_space        = wrapper::HDF5DataSpace{mem_space_extents};
   const auto offsets    = legate::detail::SmallVector<hsize_t, LEGATE_MAX_DIM>{
     legate::detail::tags::size_tag, file_space_extents.size(), 0};
@@ -103,6 +217,7 @@ class HDF5WriteFn {
                   const legate::PhysicalStore& store,
                   const std::filesystem::path& filepath,
                   const std::string& dataset_name,
+                  const DataSetLayout& layout,
                   bool is_device) const
   {
     constexpr auto BINARY_TYPE = CODE == Type::Code::BINARY;
@@ -122,7 +237,10 @@ class HDF5WriteFn {
                                               /* VALIDATE_TYPE */ !BINARY_TYPE>(type_size);
 
     const auto* const ptr = acc.data_handle();
-    const auto gds_on     = legate::detail::Runtime::get_runtime().config().io_use_vfd_gds();
+    // HDF5 filters chunks on the host, so filtered tiles can't be written directly from the
+    // device
+    const auto gds_on = legate::detail::Runtime::get_runtime().config().io_use_vfd_gds() &&
+                        !layout.filtered();
     const auto file_space_extents = [&] {
       auto ret = std::array<hsize_t, DIM>{};
 
@@ -165,7 +283,7 @@ class HDF5WriteFn {
       }();
 
       write_hdf5_file(
-        filepath, file_space_extents, mem_space_extents, dataset_name, type, gds_on, ptr);
+        filepath, file_space_extents, mem_space_extents, dataset_name, type, layout, gds_on, ptr);
       return;
     }
 
@@ -182,8 +300,14 @@ class HDF5WriteFn {
     api->mem_cpy_async(tmp_ptr, ptr, size * type_size, stream);
     // Need to synchronize here before we pass to HDF5
     api->stream_synchronize(stream);
-    write_hdf5_file(
-      filepath, file_space_extents, mem_space_extents, dataset_name, type, gds_on, tmp_ptr);
+    write_hdf5_file(filepath,
+                    file_space_extents,
+                    mem_space_extents,
+                    dataset_name,
+                    type,
+                    layout,
+                    gds_on,
+                    tmp_ptr);
   }
 };
 
@@ -235,6 +359,7 @@ void task_body(const legate::TaskContext& context, bool is_device)
   const auto store        = context.input(0);
   const auto base_dir     = std::filesystem::path{context.scalar(0).value<std::string_view>()};
   const auto dataset_name = context.scalar(1).value<std::string>();
+  const auto layout       = DataSetLayout{context};
   const auto&& [domain, index_point] = [&context, &store]() -> std::pair<Domain, DomainPoint> {
     if (!context.is_single_task()) {
       return {context.get_launch_domain(), context.get_task_index()};
@@ -249,6 +374,10 @@ void task_body(const legate::TaskContext& context, bool is_device)
   }();
   const auto index_filepath = make_filepath(base_dir, index_point, store.domain());
 
+  // The reads producing the store ran before this task, and may have cached the file that is about
+  // to be overwritten in this process
+  wrapper::HDF5HandleCache::get().invalidate(context.scalar(6).value<std::string_view>());
+
   // The below is just an unrolled
   //
   // legate::double_dispatch(store.dim(), store.code(), HDF5ReadFn{}, ...);
@@ -256,10 +385,16 @@ void task_body(const legate::TaskContext& context, bool is_device)
   // because double_dispatch() does not support Type::Code::BINARY yet, and it won't until
   // https://github.com/nv-legate/legate.internal/pull/1604 is resolved/merged.
 
-#define TYPE_DISPATCH(__dim__)                                                               \
-  case __dim__:                                                                              \
-    TypeDispatcher<__dim__>{}(                                                               \
-      store.code(), HDF5WriteFn{}, context, store, index_filepath, dataset_name, is_device); \
+#define TYPE_DISPATCH(__dim__)                \
+  case __dim__:                               \
+    TypeDispatcher<__dim__>{}(store.code(),   \
+                              HDF5WriteFn{},  \
+                              context,        \
+                              store,          \
+                              index_filepath, \
+                              dataset_name,   \
+                              layout,         \
+                              is_device);     \
     break;
 
   switch (const auto dim = store.dim()) {
@@ -17,11 +17,29 @@
 
 namespace legate::io::hdf5::detail {
 
+/**
+ * @brief Write the tile of a store to a HDF5 file of its own.
+ *
+ * Task signature:
+ *   - scalars:
+ *     - vds_dir: std::string, the directory of the files of the tiles
+ *     - dataset_name: std::string
+ *     - chunk_shape: std::uint64_t[], empty to pick the chunks of each tile
+ *     - compression: std::uint8_t, a `Compression`
+ *     - compression_level: std::uint32_t
+ *     - shuffle: bool
+ *     - file_path: std::string, the file the tiles are combined into, which is closed if a read
+ *       task of this process has it open
+ *   - inputs:
+ *     - store: store (any dtype)
+ *   - reductions:
+ *     - dummy: bool store, ordering the task before HDF5CombineVDS
+ */
 class HDF5WriteVDS : public LegateTask<HDF5WriteVDS> {
  public:
   static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
     TaskConfig{LocalTaskID{legate::detail::CoreTask::IO_HDF5_FILE_WRITE_VDS}}
-      .with_signature(TaskSignature{}.inputs(1).outputs(0).scalars(2).redops(1).constraints(
+      .with_signature(TaskSignature{}.inputs(1).outputs(0).scalars(7).redops(1).constraints(
         {Span<const legate::ProxyConstraint>{}}) /* some compilers complain with {{}} */)
       .with_variant_options(
         VariantOptions{}.with_has_side_effect(true).with_elide_device_ctx_sync(true));
@@ -11,10 +11,15 @@
 #include <legate/io/hdf5/detail/interface.h>
 #include <legate/utilities/detail/traced_exception.h>
 
+#include <fmt/format.h>
+
+#include <algorithm>
 #include <filesystem>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace legate::io::hdf5 {
 
@@ -31,6 +36,75 @@ std::string_view InvalidDataSetError::dataset_name() const noexcept { return dat
 
 // ==========================================================================================
 
+Hyperslab::Hyperslab(std::vector<std::uint64_t> start,
+                     std::vector<std::uint64_t> count,
+                     std::vector<std::uint64_t> stride)
+  : start_{std::move(start)}, count_{std::move(count)}, stride_{std::move(stride)}
+{
+  if (stride_.empty()) {
+    stride_.resize(start_.size(), 1);
+  }
+  if (start_.size() != count_.size() || start_.size() != stride_.size()) {
+    throw legate::detail::TracedException<std::invalid_argument>{
+      fmt::format("Start ({}), count ({}) and stride ({}) of a hyperslab must have the same size",
+                  start_.size(),
+                  count_.size(),
+                  stride_.size())};
+  }
+  if (std::find(stride_.begin(), stride_.end(), 0) != stride_.end()) {
+    throw legate::detail::TracedException<std::invalid_argument>{
+      "Stride of a hyperslab must not contain zeros"};
+  }
+}
+
+const std::vector<std::uint64_t>& Hyperslab::start() const noexcept { return start_; }
+
+const std::vector<std::uint64_t>& Hyperslab::count() const noexcept { return count_; }
+
+const std::vector<std::uint64_t>& Hyperslab::stride() const noexcept { return stride_; }
+
+// ==========================================================================================
+
+WriteOptions& WriteOptions::with_chunk_shape(std::vector<std::uint64_t> chunk_shape)
+{
+  chunk_shape_ = std::move(chunk_shape);
+  return *this;
+}
+
+WriteOptions& WriteOptions::with_compression(Compression compression)
+{
+  compression_ = compression;
+  return *this;
+}
+
+WriteOptions& WriteOptions::with_compression_level(std::uint32_t level)
+{
+  compression_level_ = level;
+  return *this;
+}
+
+WriteOptions& WriteOptions::with_shuffle(bool shuffle)
+{
+  shuffle_ = shuffle;
+  return *this;
+}
+
+const std::vector<std::uint64_t>& WriteOptions::chunk_shape() const noexcept
+{
+  return chunk_shape_;
+}
+
+Compression WriteOptions::compression() const noexcept { return compression_; }
+
+const std::optional<std::uint32_t>& WriteOptions::compression_level() const noexcept
+{
+  return compression_level_;
+}
+
+bool WriteOptions::shuffle() const noexcept { return shuffle_; }
+
+// ==========================================================================================
+
 LogicalStore from_file(const std::filesystem::path& file_path, std::string_view dataset_name)
 {
   if constexpr (LEGATE_DEFINED(LEGATE_USE_HDF5)) {
@@ -42,12 +116,33 @@ LogicalStore from_file(const std::filesystem::path& file_path, std::string_view
   }
 }
 
+LogicalStore from_file(const std::filesystem::path& file_path,
+                       std::string_view dataset_name,
+                       const Hyperslab& selection)
+{
+  if constexpr (LEGATE_DEFINED(LEGATE_USE_HDF5)) {
+    return detail::from_file(file_path, dataset_name, selection);
+  } else {
+    throw legate::detail::TracedException<std::runtime_error>{
+      "Legate was not configured with HDF5 support. Please reconfigure Legate with HDF5 support to "
+      "use this API."};
+  }
+}
+
 void to_file(const LogicalStore& store,
              std::filesystem::path file_path,
              std::string_view dataset_name)
+{
+  to_file(store, std::move(file_path), dataset_name, WriteOptions{});
+}
+
+void to_file(const LogicalStore& store,
+             std::filesystem::path file_path,
+             std::string_view dataset_name,
+             const WriteOptions& options)
 {
   if constexpr (LEGATE_DEFINED(LEGATE_USE_HDF5)) {
-    detail::to_file(store, std::move(file_path), dataset_name);
+    detail::to_file(store, std::move(file_path), dataset_name, options);
   } else {
     throw legate::detail::TracedException<std::runtime_error>{
       "Legate was not configured with HDF5 support. Please reconfigure Legate with HDF5 support to "
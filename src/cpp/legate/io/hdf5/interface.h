@@ -9,8 +9,11 @@
 #include <legate/data/logical_store.h>
 #include <legate/utilities/detail/doxygen.h>
 
+#include <cstdint>
 #include <filesystem>
+#include <optional>
 #include <string_view>
+#include <vector>
 
 /**
  * @file
@@ -67,6 +70,147 @@ class LEGATE_EXPORT InvalidDataSetError : public std::invalid_argument {
   std::string dataset_name_{};
 };
 
+/**
+ * @brief A regular selection of the elements of a HDF5 dataset, also known as a hyperslab.
+ *
+ * In each dimension `d`, the hyperslab selects the `count[d]` elements at indices `start[d]`,
+ * `start[d] + stride[d]`, `start[d] + 2 * stride[d]`, and so on.
+ */
+class LEGATE_EXPORT Hyperslab {
+ public:
+  /**
+   * @brief Construct a Hyperslab.
+   *
+   * @param start The index of the first selected element in each dimension.
+   * @param count The number of selected elements in each dimension.
+   * @param stride The distance between consecutive selected elements in each dimension. If
+   * empty, consecutive elements are selected in every dimension.
+   *
+   * @throw std::invalid_argument If `start`, `count` and (if not empty) `stride` don't have
+   * the same size, or if `stride` contains zeros.
+   */
+  Hyperslab(std::vector<std::uint64_t> start,
+            std::vector<std::uint64_t> count,
+            std::vector<std::uint64_t> stride = {});
+
+  /**
+   * @return The index of the first selected element in each dimension.
+   */
+  [[nodiscard]] const std::vector<std::uint64_t>& start() const noexcept;
+
+  /**
+   * @return The number of selected elements in each dimension.
+   */
+  [[nodiscard]] const std::vector<std::uint64_t>& count() const noexcept;
+
+  /**
+   * @return The distance between consecutive selected elements in each dimension.
+   */
+  [[nodiscard]] const std::vector<std::uint64_t>& stride() const noexcept;
+
+ private:
+  std::vector<std::uint64_t> start_{};
+  std::vector<std::uint64_t> count_{};
+  std::vector<std::uint64_t> stride_{};
+};
+
+/**
+ * @brief The compression filters that `to_file()` can apply to the chunks of a dataset.
+ */
+enum class Compression : std::uint8_t {
+  NONE,     ///< Don't compress the chunks.
+  DEFLATE,  ///< Compress the chunks with deflate (gzip).
+  ZSTD,     ///< Compress the chunks with Zstandard. Requires the HDF5 Zstandard filter plugin.
+  LZ4,      ///< Compress the chunks with LZ4. Requires the HDF5 LZ4 filter plugin.
+};
+
+/**
+ * @brief Options controlling the layout of the datasets written by `to_file()`.
+ *
+ * By default, datasets are written contiguously and uncompressed. Setting a chunk shape, a
+ * compression filter, or the shuffle filter writes them in chunks instead. Each chunk is
+ * filtered by the task writing the tile of the store it belongs to, so compression runs in
+ * parallel across the launch.
+ */
+class LEGATE_EXPORT WriteOptions {
+ public:
+  /**
+   * @brief Set the shape of the chunks of the dataset.
+   *
+   * Chunks never straddle the tiles written by different tasks. A chunk shape that is larger
+   * than a tile in some dimension is clipped to the tile in that dimension.
+   *
+   * If no chunk shape is set but the dataset is filtered, each tile is split into chunks of
+   * about 1 MiB along its outermost dimensions.
+   *
+   * @param chunk_shape The extents of a chunk. Must have one positive entry per dimension of
+   * the store.
+   *
+   * @return A reference to this object.
+   */
+  WriteOptions& with_chunk_shape(std::vector<std::uint64_t> chunk_shape);
+
+  /**
+   * @brief Set the filter compressing the chunks of the dataset.
+   *
+   * @param compression The compression filter.
+   *
+   * @return A reference to this object.
+   */
+  WriteOptions& with_compression(Compression compression);
+
+  /**
+   * @brief Set the compression level.
+   *
+   * Must be in `[0, 9]` for `Compression::DEFLATE` (default `6`) and in `[1, 22]` for
+   * `Compression::ZSTD` (default `3`). The other filters don't take a level.
+   *
+   * @param level The compression level.
+   *
+   * @return A reference to this object.
+   */
+  WriteOptions& with_compression_level(std::uint32_t level);
+
+  /**
+   * @brief Set whether the bytes of the elements of each chunk are shuffled before the chunk
+   * is compressed.
+   *
+   * Shuffling groups the bytes of equal significance together, which usually improves the
+   * compression ratio of numeric data.
+   *
+   * @param shuffle `true` to shuffle the chunks, `false` otherwise.
+   *
+   * @return A reference to this object.
+   */
+  WriteOptions& with_shuffle(bool shuffle);
+
+  /**
+   * @return The shape of the chunks, or an empty vector if none was set.
+   */
+  [[nodiscard]] const std::vector<std::uint64_t>& chunk_shape() const noexcept;
+
+  /**
+   * @return The compression filter.
+   */
+  [[nodiscard]] Compression compression() const noexcept;
+
+  /**
+   * @return The compression level, if one was set.
+   */
+  [[nodiscard]] const std::optional<std::uint32_t>& compression_level() const noexcept;
+
+  /**
+   * @return `true` if the chunks are shuffled, `false` otherwise.
+   */
+  [[nodiscard]] bool shuffle() const noexcept;
+
+ private:
+  std::vector<std::uint64_t> chunk_shape_{};
+  Compression compression_{Compression::NONE};
+  std::optional<std::uint32_t> compression_level_{};
+  bool shuffle_{};
+};
+
 /**
  * @brief Load a HDF5 dataset into a LogicalStore.
  *
@@ -82,6 +226,30 @@ class LEGATE_EXPORT InvalidDataSetError : public std::invalid_argument {
 [[nodiscard]] LEGATE_EXPORT LogicalStore from_file(const std::filesystem::path& file_path,
                                                    std::string_view dataset_name);
 
+/**
+ * @brief Load a hyperslab of a HDF5 dataset into a LogicalStore.
+ *
+ * Only the selected elements are read from the file. The store has the shape of the selection,
+ * i.e. `selection.count()`, and its element at index `i` is the element of the dataset at
+ * index `selection.start() + i * selection.stride()`. The tasks reading the store are tiled
+ * over the selection only.
+ *
+ * @param file_path The path to the file to load.
+ * @param dataset_name The name of the HDF5 dataset to load from the file.
+ * @param selection The elements of the dataset to load.
+ *
+ * @return LogicalStore The loaded store.
+ *
+ * @throws std::system_error If file_path does not exist.
+ * @throws UnsupportedHDF5DataTypeError If the data type cannot be converted to a Type.
+ * @throws InvalidDataSetError If the dataset is invalid, or is not found.
+ * @throws std::invalid_argument If `selection` doesn't have one entry per dimension of the
+ * dataset, or selects elements outside of the dataset.
+ */
+[[nodiscard]] LEGATE_EXPORT LogicalStore from_file(const std::filesystem::path& file_path,
+                                                   std::string_view dataset_name,
+                                                   const Hyperslab& selection);
+
 /**
  * @brief Write a LogicalStore to disk as a HDF5 dataset.
  *
@@ -111,6 +279,27 @@ LEGATE_EXPORT void to_file(const LogicalStore& store,
                            std::filesystem::path file_path,
                            std::string_view dataset_name);
 
+/**
+ * @brief Write a LogicalStore to disk as a chunked, and optionally compressed, HDF5 dataset.
+ *
+ * Behaves like `to_file(const LogicalStore&, std::filesystem::path, std::string_view)`, except
+ * that the dataset is laid out as described by `options`.
+ *
+ * @param store The store to write.
+ * @param file_path The resulting HDF5 file.
+ * @param dataset_name The HDF5 dataset name to write the store under.
+ * @param options The layout of the dataset.
+ *
+ * @throw std::invalid_argument If `file_path` would not be a valid path name, if the chunk
+ * shape in `options` doesn't match the dimension of `store` or contains zeros, if the
+ * compression level is out of range for the compression filter, or if the HDF5 library
+ * doesn't support the compression filter.
+ */
+LEGATE_EXPORT void to_file(const LogicalStore& store,
+                           std::filesystem::path file_path,
+                           std::string_view dataset_name,
+                           const WriteOptions& options);
+
 /** @} */
 
 }  // namespace legate::io::hdf5
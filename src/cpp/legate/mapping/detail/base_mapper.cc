@@ -31,12 +31,15 @@
 #include <fmt/ranges.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <functional>
 #include <limits>
 #include <mappers/mapping_utilities.h>
+#include <numeric>
 #include <sstream>
+#include <string_view>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -103,7 +106,9 @@ BaseMapper::BaseMapper()
       fmt::format("{} on Node {}",
                   legate::detail::Runtime::get_runtime().core_library().get_library_name(),
                   local_machine_selector_.get_local().node_id)},
-    show_mapper_usage_{legate::detail::Runtime::get_runtime().config().show_mapper_usage()}
+    show_mapper_usage_{legate::detail::Runtime::get_runtime().config().show_mapper_usage()},
+    profiling_enabled_{legate::detail::Runtime::get_runtime().config().mapper_profiling()},
+    read_ahead_budget_{legate::detail::Runtime::get_runtime().config().streaming_read_ahead()}
 {
 }
 
@@ -148,6 +153,13 @@ const std::vector<Processor>& BaseMapper::omps() const
   return local_machine_selector_.get_local().omps();
 }
 
+std::optional<TaskStatistics> BaseMapper::task_statistics(GlobalTaskID task_id,
+                                                          VariantCode variant,
+                                                          Processor proc) const
+{
+  return task_statistics_.find(task_id, variant, proc);
+}
+
 namespace {
 
 void populate_input_collective_regions(Legion::Mapping::MapperRuntime* runtime,
@@ -255,7 +267,10 @@ void BaseMapper::select_task_options(Legion::Mapping::MapperContext ctx,
                                      const Legion::Task& task,
                                      TaskOptions& output)
 {
-  const auto legate_task = Task{task, *runtime, ctx};
+  // Index tasks are sliced, and single tasks are mapped, by this mapper next, which reuses the
+  // arguments deserialized here
+  const auto cached_task  = task_cache_.find_or_create(task, *runtime, ctx);
+  const auto& legate_task = *cached_task;
 
   populate_input_collective_regions(
     runtime, ctx, task, legate_task, &output.check_collective_regions);
@@ -291,7 +306,8 @@ void BaseMapper::slice_task(Legion::Mapping::MapperContext ctx,
                             const SliceTaskInput& input,
                             SliceTaskOutput& output)
 {
-  const Task legate_task{task, *runtime, ctx};
+  const auto cached_task  = task_cache_.take(task, *runtime, ctx);
+  const auto& legate_task = *cached_task;
 
   auto&& machine_desc = legate_task.machine();
   auto proc_range     = [&]() {
@@ -320,6 +336,58 @@ void BaseMapper::slice_task(Legion::Mapping::MapperContext ctx,
 
   const auto start_proc_id     = machine_desc.processor_range().low;
   const auto total_tasks_count = legate::detail::linearize(lo, hi, hi) + 1;
+  // Stealing only pays off when the launch is over-decomposed. With at most one point per
+  // processor, there is nothing queued up that an idle processor could take over.
+  const auto stealable =
+    legate_task.stealable() && input.domain.get_volume() > proc_range.local_proc_count();
+
+  if (stealable) {
+    has_stealable_tasks_ = true;
+  }
+
+  // With profiling feedback, over-decomposed launches are split by the measured throughput of the
+  // local processors instead. Single controller execution slices over the whole machine, for which
+  // this mapper has no measurements.
+  const auto weights =
+    profiling_enabled_ && input.domain.get_volume() > proc_range.local_proc_count() &&
+        !legate::detail::Runtime::get_runtime().config().single_controller_execution()
+      ? processor_weights_(
+          legate::GlobalTaskID{task.task_id}, to_variant_code(legate_task.target()), proc_range)
+      : std::vector<double>{};
+
+  if (!weights.empty()) {
+    std::vector<std::pair<std::size_t, DomainPoint>> points;
+
+    points.reserve(input.domain.get_volume());
+    for (Domain::DomainPointIterator itr{input.domain, /*fortran_order=*/false}; itr; ++itr) {
+      points.emplace_back(legate::detail::linearize(lo, hi, key_functor->project_point(itr.p)),
+                          itr.p);
+    }
+    // Sort by the linearized index so that each processor gets a contiguous run of points, as in
+    // the positional split below
+    std::sort(points.begin(), points.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs.first < rhs.first;
+    });
+
+    const auto total_weight = std::accumulate(weights.begin(), weights.end(), 0.0);
+    const auto num_points   = static_cast<double>(points.size());
+    auto proc_idx           = std::size_t{0};
+    // Number of points up to and including the current processor's run
+    auto run_end = weights.front() / total_weight * num_points;
+
+    for (auto&& [i, point] : legate::detail::enumerate(points)) {
+      // Assign each point to the processor whose share of the points covers the point's center
+      while (static_cast<double>(i) + 0.5 > run_end && proc_idx + 1 < weights.size()) {
+        run_end += weights[++proc_idx] / total_weight * num_points;
+      }
+      output.slices.emplace_back(
+        Domain{point.second, point.second},
+        proc_range[proc_range.offset() + static_cast<std::uint32_t>(proc_idx)],
+        false /*recurse*/,
+        stealable);
+    }
+    return;
+  }
 
   // Enumerate points in the launch domain in C order so that downstream map_task calls would likely
   // distribute evenly across all local processors in the scope. This is particularly useful in the
@@ -334,7 +402,7 @@ void BaseMapper::slice_task(Legion::Mapping::MapperContext ctx,
     output.slices.emplace_back(Domain{itr.p, itr.p},
                                proc_range[static_cast<std::uint32_t>(idx)],
                                false /*recurse*/,
-                               false /*stealable*/);
+                               stealable);
   }
 }
 
@@ -640,7 +708,8 @@ void BaseMapper::map_task(Legion::Mapping::MapperContext ctx,
       ? local_machine_selector_.get_local_to(task.target_proc)
       : local_machine_selector_.get_local();
 
-  auto legate_task = Task{task, *runtime, ctx};
+  const auto cached_task = task_cache_.take(task, *runtime, ctx);
+  auto& legate_task      = *cached_task;
 
   // Let's populate easy outputs first
   output.chosen_variant     = legate_task.legion_task_variant();
@@ -669,6 +738,12 @@ void BaseMapper::map_task(Legion::Mapping::MapperContext ctx,
   }();
   output.target_procs.push_back(target_proc);
 
+  if (profiling_enabled_) {
+    output.task_prof_requests.add_measurement<Legion::ProfilingMeasurements::OperationTimeline>();
+    output.task_prof_requests
+      .add_measurement<Legion::ProfilingMeasurements::OperationProcessorUsage>();
+  }
+
   const auto& options = default_store_targets(target_proc.kind());
 
   auto [mapped_futures, for_futures, mapped_regions, for_unbound_stores, for_stores] =
@@ -711,6 +786,23 @@ void BaseMapper::map_task(Legion::Mapping::MapperContext ctx,
   calculate_pool_sizes(
     runtime, ctx, task, target_proc, local_machine, &logger(), &legate_task, &output);
 
+  if (profiling_enabled_) {
+    std::unordered_set<Legion::Mapping::PhysicalInstance> instances;
+    std::size_t footprint = 0;
+
+    for (auto&& chosen : output.chosen_instances) {
+      for (auto&& instance : chosen) {
+        if (instance.exists() && instances.insert(instance).second) {
+          footprint += instance.get_instance_size();
+        }
+      }
+    }
+    task_statistics_.record_footprint(legate::GlobalTaskID{task.task_id},
+                                      static_cast<VariantCode>(output.chosen_variant),
+                                      target_proc,
+                                      footprint);
+  }
+
   for (auto&& mapping : for_stores) {
     if (!mapping->policy().redundant) {
       continue;
@@ -1658,10 +1750,60 @@ void BaseMapper::legate_select_sources_(
 }
 
 void BaseMapper::report_profiling(Legion::Mapping::MapperContext,
-                                  const Legion::Task&,
-                                  const TaskProfilingInfo&)
+                                  const Legion::Task& task,
+                                  const TaskProfilingInfo& input)
+{
+  // Profiling responses are only requested by map_task() when profiling is enabled
+  LEGATE_CHECK(profiling_enabled_);
+
+  Legion::ProfilingMeasurements::OperationTimeline timeline{};
+  Legion::ProfilingMeasurements::OperationProcessorUsage usage{};
+
+  if (!input.profiling_responses.get_measurement(timeline) ||
+      !input.profiling_responses.get_measurement(usage)) {
+    // The task failed to run (e.g., it was cancelled), so there is nothing to learn from it
+    return;
+  }
+  task_statistics_.record_execution(
+    legate::GlobalTaskID{task.task_id},
+    static_cast<VariantCode>(task.selected_variant),
+    usage.proc,
+    std::chrono::nanoseconds{timeline.end_time - timeline.start_time});
+}
+
+std::vector<double> BaseMapper::processor_weights_(GlobalTaskID task_id,
+                                                   VariantCode variant,
+                                                   const ProcessorSpan& proc_range) const
 {
-  LEGATE_ABORT("Shouldn't get any profiling feedback currently");
+  std::vector<double> weights;
+  auto known_weight = 0.0;
+  auto num_known    = std::uint32_t{0};
+
+  weights.reserve(proc_range.local_proc_count());
+  for (std::uint32_t idx = 0; idx < proc_range.local_proc_count(); ++idx) {
+    const auto& proc = proc_range[proc_range.offset() + idx];
+    const auto stats = task_statistics_.find(task_id, variant, proc);
+    // A weight of 0 marks a processor without a measurement
+    auto weight = 0.0;
+
+    if (stats.has_value()) {
+      // Guard against zero-length measurements of very short tasks
+      const auto time = std::max(stats->execution_time, std::chrono::nanoseconds{1});
+
+      weight = 1.0 / static_cast<double>(time.count());
+      known_weight += weight;
+      ++num_known;
+    }
+    weights.push_back(weight);
+  }
+  if (num_known == 0) {
+    return {};
+  }
+
+  const auto mean_weight = known_weight / static_cast<double>(num_known);
+
+  std::replace(weights.begin(), weights.end(), 0.0, mean_weight);
+  return weights;
 }
 
 Legion::ShardingID BaseMapper::find_mappable_sharding_functor_id_(const Legion::Mappable& mappable)
@@ -2173,11 +2315,11 @@ bool BaseMapper::StreamingInfo::task_matches_processing_column(const Legion::Tas
   return task_column == processing_column;
 }
 
-void BaseMapper::StreamingInfo::select_column(const Legion::Task& task,
-                                              const legate::detail::StreamingGeneration& stream_gen,
-                                              Legion::Logger* logger)
+BaseMapper::ColumnStreamingInfo& BaseMapper::StreamingInfo::column_info_(
+  const DomainPoint& task_column,
+  const legate::detail::StreamingGeneration& stream_gen,
+  Legion::Logger* logger)
 {
-  const auto& task_column  = task.index_point;
   auto& col_streaming_info = col_streaming_info_[task_column];
   if (col_streaming_info.streaming_gen != stream_gen.generation) {
     // We have encountered a new matrix of streaming tasks. We should reset all the
@@ -2189,12 +2331,58 @@ void BaseMapper::StreamingInfo::select_column(const Legion::Task& task,
     LEGATE_CHECK(col_streaming_info.streaming_rows_mapped == 0);
     col_streaming_info.streaming_gen = stream_gen.generation;
   }
+  return col_streaming_info;
+}
+
+void BaseMapper::StreamingInfo::count_mapped_row_(
+  const DomainPoint& task_column,
+  ColumnStreamingInfo* col_streaming_info,
+  const legate::detail::StreamingGeneration& stream_gen,
+  Legion::Logger* logger)
+{
+  if (++col_streaming_info->streaming_rows_mapped != stream_gen.size) {
+    return;
+  }
+
+  col_streaming_info->streaming_rows_mapped = 0;
+  logger->debug() << "------ Fully mapped row";
+  // Clear all the processors this column was being mapped in
+  for (auto proc : col_streaming_info->procs) {
+    proc_streaming_info[proc].reset();
+  }
+  // Column is done mapping clear the processors being tracked
+  col_streaming_info->procs.clear();
+  // The processors that read the column ahead but never got to map it can read ahead another one
+  for (auto proc : col_streaming_info->read_ahead_procs) {
+    if (const auto it = proc_read_ahead_.find(proc);
+        it != proc_read_ahead_.end() && it->second.column == task_column) {
+      proc_read_ahead_.erase(it);
+    }
+  }
+  col_streaming_info->read_ahead_procs.clear();
+}
+
+void BaseMapper::StreamingInfo::select_column(const Legion::Task& task,
+                                              const legate::detail::StreamingGeneration& stream_gen,
+                                              Legion::Logger* logger)
+{
+  const auto& task_column = task.index_point;
+
+  static_cast<void>(column_info_(task_column, stream_gen, logger));
 
   // Either we mapped all the points in a previous column (of the same matrix), or we
   // switched to a new matrix. In any case, we arbitrarily pick the current column as our
   // target column. We will now map all rows matching this column.
   proc_streaming_info[task.target_proc] = task_column;
   logger->debug() << "---- No selected index point, using current task index point " << task_column;
+
+  // The rows read ahead are now part of the column being mapped, so the processor can read the
+  // next column ahead
+  if (const auto it = proc_read_ahead_.find(task.target_proc);
+      it != proc_read_ahead_.end() && it->second.column == task_column) {
+    logger->debug() << "---- Releasing " << it->second.bytes << " bytes read ahead";
+    proc_read_ahead_.erase(it);
+  }
 }
 
 void BaseMapper::StreamingInfo::update_streaming_info(
@@ -2209,20 +2397,100 @@ void BaseMapper::StreamingInfo::update_streaming_info(
 
   // Keep track of all processors this column is being mapped on
   col_streaming_info.procs.insert(task.target_proc);
+  count_mapped_row_(task_column, &col_streaming_info, stream_gen, logger);
+}
+
+bool BaseMapper::StreamingInfo::try_read_ahead(
+  const Legion::Task& task,
+  const legate::detail::StreamingGeneration& stream_gen,
+  std::uint64_t footprint,
+  std::uint64_t budget,
+  Legion::Logger* logger)
+{
+  const auto& processing_column = proc_streaming_info[task.target_proc];
+
+  // Only read ahead of a column of the same matrix, the next matrix can only start once the
+  // current one is fully mapped
+  if (!processing_column.has_value() ||
+      col_streaming_info_[*processing_column].streaming_gen != stream_gen.generation) {
+    return false;
+  }
+
+  const auto& task_column = task.index_point;
+  const auto it           = proc_read_ahead_.find(task.target_proc);
+  const auto used         = it == proc_read_ahead_.end() ? 0 : it->second.bytes;
+
+  if (it != proc_read_ahead_.end() && it->second.column != task_column) {
+    logger->debug() << "---- Processor " << task.target_proc << " already reading ahead "
+                    << it->second.column;
+    return false;
+  }
+  if (footprint > budget - used) {
+    logger->debug() << "---- Reading ahead " << footprint << " bytes would exceed the budget ("
+                    << used << " of " << budget << " bytes used)";
+    return false;
+  }
+
+  auto& read_ahead = proc_read_ahead_[task.target_proc];
+
+  read_ahead.column = task_column;
+  read_ahead.bytes += footprint;
+  logger->debug() << "---- Reading ahead " << task_column << " (" << read_ahead.bytes << " of "
+                  << budget << " bytes used)";
+
+  auto& col_streaming_info = column_info_(task_column, stream_gen, logger);
+
+  col_streaming_info.read_ahead_procs.insert(task.target_proc);
+  count_mapped_row_(task_column, &col_streaming_info, stream_gen, logger);
+  return true;
+}
+
+std::uint64_t BaseMapper::StreamingInfo::read_ahead_bytes(Processor proc) const
+{
+  const auto it = proc_read_ahead_.find(proc);
+
+  return it == proc_read_ahead_.end() ? 0 : it->second.bytes;
+}
+
+namespace {
+
+[[nodiscard]] bool is_io_read_task(const Task& task)
+{
+  const auto maybe_vinfo = task.task_info().find_variant(to_variant_code(task.target()));
+
+  // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+  return maybe_vinfo.has_value() && maybe_vinfo->get().options.read_ahead;
+}
+
+}  // namespace
+
+std::optional<std::uint64_t> BaseMapper::read_ahead_footprint_(Legion::Mapping::MapperContext ctx,
+                                                               const Legion::Task& task)
+{
+  // The view is handed over to map_task() if the task is selected
+  const auto legate_task = task_cache_.find_or_create(task, *runtime, ctx);
+
+  if (!is_io_read_task(*legate_task)) {
+    return std::nullopt;
+  }
 
-  if (++col_streaming_info.streaming_rows_mapped == stream_gen.size) {
-    col_streaming_info.streaming_rows_mapped = 0;
-    logger->debug() << "------ Fully mapped row";
-    // Clear all the processors this column was being mapped in
-    for (auto proc : col_streaming_info.procs) {
-      proc_streaming_info[proc].reset();
+  std::uint64_t footprint = 0;
+
+  for (auto&& store : legate_task->outputs()) {
+    if (store->is_future()) {
+      continue;
     }
-    // Column is done mapping clear the processors being tracked
-    col_streaming_info.procs.clear();
+    // The size of unbound stores is only known once the task has run
+    if (store->unbound()) {
+      return std::nullopt;
+    }
+    footprint += static_cast<std::uint64_t>(store->domain().get_volume()) * store->type()->size();
   }
+  return footprint;
 }
 
 void BaseMapper::select_streaming_tasks_to_map_(
+  Legion::Mapping::MapperContext ctx,
   const Legion::Task& task,
   const legate::detail::StreamingGeneration& stream_gen,
   std::set<const Legion::Task*>* mapped_tasks)
@@ -2250,9 +2518,35 @@ void BaseMapper::select_streaming_tasks_to_map_(
     logger().debug() << "---- Matches index point, mapping";
     mapped_tasks->insert(&task);
     streaming_info_.update_streaming_info(task, stream_gen, &logger());
+    return;
+  }
+
+  // Reads of the next column can run while the tasks of the current column compute
+  if (read_ahead_budget_ == 0) {
+    return;
+  }
+  if (const auto footprint = read_ahead_footprint_(ctx, task);
+      footprint.has_value() &&
+      streaming_info_.try_read_ahead(task, stream_gen, *footprint, read_ahead_budget_, &logger())) {
+    logger().debug() << "---- Read task, mapping ahead";
+    mapped_tasks->insert(&task);
+
+    const auto bytes = streaming_info_.read_ahead_bytes(task.target_proc);
+
+    // The mapper calls are serialized, so there is no other writer to race with
+    read_ahead_tasks_.fetch_add(1, std::memory_order_relaxed);
+    if (bytes > read_ahead_max_bytes_.load(std::memory_order_relaxed)) {
+      read_ahead_max_bytes_.store(bytes, std::memory_order_relaxed);
+    }
   }
 }
 
+BaseMapper::ReadAheadStatistics BaseMapper::read_ahead_statistics() const
+{
+  return {read_ahead_tasks_.load(std::memory_order_relaxed),
+          read_ahead_max_bytes_.load(std::memory_order_relaxed)};
+}
+
 void BaseMapper::select_tasks_to_map(Legion::Mapping::MapperContext ctx,
                                      const SelectMappingInput& input,
                                      SelectMappingOutput& output)
@@ -2286,7 +2580,7 @@ void BaseMapper::select_tasks_to_map(Legion::Mapping::MapperContext ctx,
       logger().debug() << "-- IS a streaming task, generation " << stream_gen->generation
                        << ", num_rows " << stream_gen->size;
 
-      select_streaming_tasks_to_map_(*task, *stream_gen, &map_tasks);
+      select_streaming_tasks_to_map_(ctx, *task, *stream_gen, &map_tasks);
       continue;
     }
 
@@ -2304,17 +2598,91 @@ void BaseMapper::select_tasks_to_map(Legion::Mapping::MapperContext ctx,
 }
 
 void BaseMapper::select_steal_targets(Legion::Mapping::MapperContext /*ctx*/,
-                                      const SelectStealingInput& /*input*/,
-                                      SelectStealingOutput& /*output*/)
+                                      const SelectStealingInput& input,
+                                      SelectStealingOutput& output)
 {
-  // Nothing to do, no stealing in the leagte mapper currently
+  if (!has_stealable_tasks_) {
+    return;
+  }
+
+  // This mapper serves all local processors, so we don't know which one of them is the thief
+  // here. We therefore only pick a victim among the processors that can have stealable tasks, and
+  // leave the locality checks to permit_steal_request() on the victim's side. GPUs are not
+  // candidates, because each of them has its own framebuffer that a thief would not have access
+  // to.
+  auto&& local_machine = local_machine_selector_.get_local();
+  auto&& cpus          = local_machine.cpus();
+  auto&& omps          = local_machine.omps();
+  const auto num_procs = static_cast<std::uint32_t>(cpus.size() + omps.size());
+  const auto proc_at   = [&](std::uint32_t idx) -> const Processor& {
+    return idx < cpus.size() ? cpus[idx] : omps[idx - cpus.size()];
+  };
+
+  // Ask one victim at a time, so that a processor running out of work doesn't flood all the others
+  // with steal requests
+  for (std::uint32_t i = 0; i < num_procs; ++i) {
+    const auto& victim = proc_at(next_steal_target_++ % num_procs);
+
+    if (input.blacklist.count(victim) == 0) {
+      output.targets.insert(victim);
+      return;
+    }
+  }
 }
 
 void BaseMapper::permit_steal_request(Legion::Mapping::MapperContext /*ctx*/,
-                                      const StealRequestInput& /*input*/,
-                                      StealRequestOutput& /*output*/)
+                                      const StealRequestInput& input,
+                                      StealRequestOutput& output)
+{
+  auto&& stealable_tasks = input.stealable_tasks;
+  // Give away at most half of the queue, so that the victim is left with work to do as well
+  auto num_to_steal = (stealable_tasks.size() + 1) / 2;
+
+  // The victim works through its queue front to back, so steal from the back
+  for (auto it = stealable_tasks.rbegin(); it != stealable_tasks.rend() && num_to_steal > 0;
+       ++it) {
+    if (can_steal_(**it, input.thief_proc)) {
+      output.stolen_tasks.insert(*it);
+      --num_to_steal;
+    }
+  }
+}
+
+bool BaseMapper::can_steal_(const Legion::Task& task, Processor thief) const
 {
-  LEGATE_ABORT("no stealing in the legate mapper currently");
+  const auto victim = task.target_proc;
+
+  if (thief.kind() != victim.kind() || thief.address_space() != victim.address_space()) {
+    return false;
+  }
+
+  const Mappable legate_mappable{task};
+
+  if (!legate_mappable.stealable()) {
+    return false;
+  }
+
+  auto&& local_machine = local_machine_selector_.get_local();
+  // OpenMP processors on different sockets, for example, map their stores to different socket
+  // memories
+  const auto store_target = default_store_targets(victim.kind()).front();
+
+  if (local_machine.get_memory(thief, store_target) !=
+      local_machine.get_memory(victim, store_target)) {
+    return false;
+  }
+
+  const auto proc_range =
+    local_machine.slice(legate_mappable.machine().only(to_target(victim.kind())));
+
+  const auto first = proc_range.offset();
+
+  for (auto idx = first; idx < first + proc_range.local_proc_count(); ++idx) {
+    if (proc_range[idx] == thief) {
+      return true;
+    }
+  }
+  return false;
 }
 
 void BaseMapper::handle_message(Legion::Mapping::MapperContext /*ctx*/,
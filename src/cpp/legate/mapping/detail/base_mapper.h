@@ -11,11 +11,14 @@
 #include <legate/mapping/detail/local_machine_selector.h>
 #include <legate/mapping/detail/machine.h>
 #include <legate/mapping/detail/mapping.h>
+#include <legate/mapping/detail/task_cache.h>
+#include <legate/mapping/detail/task_statistics.h>
 #include <legate/utilities/detail/hash.h>
 #include <legate/utilities/typedefs.h>
 
 #include <legion.h>
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -53,11 +56,31 @@ class BaseMapper final : public Legion::Mapping::Mapper, public MachineQueryInte
   [[nodiscard]] const std::vector<Processor>& gpus() const override;
   [[nodiscard]] const std::vector<Processor>& omps() const override;
   [[nodiscard]] std::uint32_t total_nodes() const override;
+  [[nodiscard]] std::optional<TaskStatistics> task_statistics(GlobalTaskID task_id,
+                                                              VariantCode variant,
+                                                              Processor proc) const override;
   [[nodiscard]] const char* get_mapper_name() const override;
   [[nodiscard]] Legion::Mapping::Mapper::MapperSyncModel get_mapper_sync_model() const override;
 
   [[nodiscard]] bool request_valid_instances() const override;
 
+  /**
+   * @brief What the streaming sections have read ahead since the mapper was created.
+   */
+  class ReadAheadStatistics {
+   public:
+    // The number of I/O read tasks mapped ahead of the column of their processor
+    std::uint64_t num_tasks{};
+    // The most bytes a single processor has read ahead at once
+    std::uint64_t max_bytes{};
+  };
+
+  /**
+   * @return The read-ahead statistics of the mapper. Unlike the mapper calls, this can be
+   * called from any thread.
+   */
+  [[nodiscard]] ReadAheadStatistics read_ahead_statistics() const;
+
   // Task mapping calls
   void select_task_options(Legion::Mapping::MapperContext ctx,
                            const Legion::Task& task,
@@ -293,9 +316,25 @@ class BaseMapper final : public Legion::Mapping::Mapper, public MachineQueryInte
    *   prerequisite, in that it guarantees all rows of the matrix have the same number of
    *   columns, because it says that for row `N`, it has `M` *unique* columns.
    */
-  void select_streaming_tasks_to_map_(const Legion::Task& task,
+  void select_streaming_tasks_to_map_(Legion::Mapping::MapperContext ctx,
+                                      const Legion::Task& task,
                                       const legate::detail::StreamingGeneration& stream_gen,
                                       std::set<const Legion::Task*>* mapped_tasks);
+  /*
+   * @brief Compute the number of bytes a streaming task may read ahead of its column.
+   *
+   * Only the I/O read tasks (`HDF5Read` and the kvikio reads) read ahead, since they only
+   * depend on the file they read from, and their outputs are the inputs of the compute tasks of
+   * their column.
+   *
+   * @param ctx The mapper context.
+   * @param task The task.
+   *
+   * @return The total size of the outputs of the task, or `std::nullopt` if the task must not
+   * be read ahead.
+   */
+  [[nodiscard]] std::optional<std::uint64_t> read_ahead_footprint_(
+    Legion::Mapping::MapperContext ctx, const Legion::Task& task);
 
  public:
   // Mapping control and stealing
@@ -381,6 +420,38 @@ class BaseMapper final : public Legion::Mapping::Mapper, public MachineQueryInte
                                                       Legion::FieldSpace fs,
                                                       Legion::FieldID fid);
 
+  /**
+   * @brief Check whether a processor may steal a point task.
+   *
+   * Stealing is restricted to processors of the same kind on the same node, with affinity to
+   * the same memory as the original target of the task, so that the instances mapped for the
+   * task stay local. The thief must also lie within the machine scope of the task.
+   *
+   * @param task The point task to steal.
+   * @param thief The processor that wants to steal the task.
+   *
+   * @return `true` if `thief` may steal `task`, `false` otherwise.
+   */
+  [[nodiscard]] bool can_steal_(const Legion::Task& task, Processor thief) const;
+
+  /**
+   * @brief Compute the relative throughput of the local processors for a task variant.
+   *
+   * Each processor is weighted by the inverse of the average execution time of the variant on
+   * it. Processors without any measurement yet are assumed to be as fast as the average of those
+   * that have one.
+   *
+   * @param task_id The task to compute the weights for.
+   * @param variant The variant to compute the weights for.
+   * @param proc_range The processors to compute the weights for.
+   *
+   * @return The weights, one for each local processor in `proc_range`, or an empty vector if the
+   * variant hasn't run on any of the processors yet.
+   */
+  [[nodiscard]] std::vector<double> processor_weights_(GlobalTaskID task_id,
+                                                       VariantCode variant,
+                                                       const ProcessorSpan& proc_range) const;
+
   Legion::Machine legion_machine_{Legion::Machine::get_machine()};
   Legion::Logger logger_{std::string{LOGGER_NAME}};
 
@@ -398,6 +469,27 @@ class BaseMapper final : public Legion::Mapping::Mapper, public MachineQueryInte
   std::string mapper_name_{};
   bool show_mapper_usage_{};
 
+  // Set once a launch has been sliced into stealable point tasks. Until then, idle processors
+  // don't send any steal requests.
+  bool has_stealable_tasks_{};
+  // Rotates the victim chosen by select_steal_targets() through the local processors
+  std::uint32_t next_steal_target_{};
+
+  // Set when the runtime has been started with --mapper-profiling. The mapper then requests
+  // profiling responses for every task it maps and weights slices by the measured throughput.
+  bool profiling_enabled_{};
+  TaskStatisticsTable task_statistics_{};
+
+  // Mapper views of the tasks between select_task_options() and slice_task() or map_task()
+  TaskCache task_cache_{};
+
+  // Set by --streaming-read-ahead. The number of bytes the I/O read tasks of a streaming section
+  // may read on each processor ahead of the column the processor is mapping. 0 disables it.
+  std::uint64_t read_ahead_budget_{};
+  // Only updated by the (serialized) mapper calls, but read by read_ahead_statistics()
+  std::atomic<std::uint64_t> read_ahead_tasks_{};
+  std::atomic<std::uint64_t> read_ahead_max_bytes_{};
+
   // Streaming transformation related objects
   class ColumnStreamingInfo {
    public:
@@ -406,6 +498,16 @@ class BaseMapper final : public Legion::Mapping::Mapper, public MachineQueryInte
     // For each column we track which processors this column is being mapped on.
     // We reset the processor's tracking data structure at the end of the column.
     std::unordered_set<Processor> procs;
+    // The processors that read rows of this column ahead, while mapping another column.
+    std::unordered_set<Processor> read_ahead_procs;
+  };
+
+  class ReadAhead {
+   public:
+    // The column whose rows are read ahead
+    DomainPoint column{};
+    // The total size of the outputs of the rows read ahead
+    std::uint64_t bytes{};
   };
 
   std::queue<Legion::Mapping::MapperEvent> deferral_events_{};
@@ -413,6 +515,25 @@ class BaseMapper final : public Legion::Mapping::Mapper, public MachineQueryInte
   class StreamingInfo {
     // We group all the accounting data structures per column and use this map for that.
     std::unordered_map<DomainPoint, ColumnStreamingInfo, hasher<DomainPoint>> col_streaming_info_{};
+    // A processor reads ahead at most one column at a time, the one it will likely map next.
+    std::unordered_map<Processor, ReadAhead, hasher<Processor>> proc_read_ahead_{};
+
+    /*
+     * @brief Retrieve the bookkeeping of a column, resetting it if the column belongs to a new
+     * generation.
+     */
+    [[nodiscard]] ColumnStreamingInfo& column_info_(
+      const DomainPoint& task_column,
+      const legate::detail::StreamingGeneration& stream_gen,
+      Legion::Logger* logger);
+    /*
+     * @brief Count one more mapped row of a column, and release the processors mapping the
+     * column, or reading it ahead, once all of its rows are mapped.
+     */
+    void count_mapped_row_(const DomainPoint& task_column,
+                           ColumnStreamingInfo* col_streaming_info,
+                           const legate::detail::StreamingGeneration& stream_gen,
+                           Legion::Logger* logger);
 
    public:
     // We use this map to track if and which column is being mapped in a processor.
@@ -454,6 +575,37 @@ class BaseMapper final : public Legion::Mapping::Mapper, public MachineQueryInte
     void update_streaming_info(const Legion::Task& task,
                                const legate::detail::StreamingGeneration& stream_gen,
                                Legion::Logger* logger);
+    /*
+     * @brief Map a task of another column than the one its target processor is mapping, ahead
+     * of that column.
+     *
+     * The task is read ahead if it belongs to the same generation as the column being mapped,
+     * if the processor isn't already reading another column ahead, and if the outputs of the
+     * rows read ahead fit in the budget. The budget used by a column is released once the
+     * processor starts mapping it, or once all of its rows are mapped.
+     *
+     * @param task The task we want to read ahead.
+     * @param stream_gen The generation of the current streaming section.
+     * @param footprint The total size of the outputs of the task.
+     * @param budget The number of bytes the processor may read ahead.
+     * @param logger To add logging details in debug mode.
+     *
+     * @return True if the task was selected to be read ahead, in which case it is accounted
+     * for as a mapped row of its column.
+     */
+    [[nodiscard]] bool try_read_ahead(const Legion::Task& task,
+                                      const legate::detail::StreamingGeneration& stream_gen,
+                                      std::uint64_t footprint,
+                                      std::uint64_t budget,
+                                      Legion::Logger* logger);
+    /*
+     * @brief Get the number of bytes a processor is currently reading ahead.
+     *
+     * @param proc The processor to query.
+     *
+     * @return The total size of the outputs of the rows the processor reads ahead.
+     */
+    [[nodiscard]] std::uint64_t read_ahead_bytes(Processor proc) const;
   };
 
   // In order for us to be able to enforce a "column by column" mapping scheduling inside a
@@ -179,11 +179,8 @@ template <std::int32_t DIM>
 class ConstructOverlappingRegionGroupFn {
  public:
   template <std::int32_t DIM>
-  [[nodiscard]] InternalSharedPtr<RegionGroup> operator()(
-    InternalSharedPtr<RegionGroup> group,
-    const std::unordered_map<RegionGroup*, InstanceSet::InstanceSpec>& instances,
-    const std::unordered_map<InternalSharedPtr<RegionGroup>, std::uint64_t>& pending_instances)
-    const
+  [[nodiscard]] InternalSharedPtr<RegionGroup> operator()(InternalSharedPtr<RegionGroup> group,
+                                                          const RegionGroupIndex& group_index) const
   {
     if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
       log_instmgr().debug() << " construct_overlapping_region_group( " << *group << ")";
@@ -192,24 +189,28 @@ class ConstructOverlappingRegionGroupFn {
     auto bbox     = group->bounding_box.template bounds<DIM, coord_t>();
     auto bbox_vol = bbox.volume();
     std::vector<RegionGroup*> to_combine{};
-
-    const auto combine_new_region_group = [&](auto&& new_group) {
-      // Avoid self-comparison
-      if (new_group == group.get()) {
-        return;
-      }
-      if (can_combine(new_group->bounding_box.template bounds<DIM, coord_t>(), &bbox, &bbox_vol)) {
-        to_combine.push_back(new_group);
+    std::vector<RegionGroup*> candidates{};
+    // Each group is considered at most once, including the one we are growing
+    std::unordered_set<const RegionGroup*> visited{group.get()};
+    auto bbox_grew = true;
+
+    // Find all the overlapping groups that are worth combining with the current group. Merging a
+    // group grows the bounding box, which can bring new groups into range, so keep querying the
+    // index until the box stops growing.
+    while (bbox_grew) {
+      bbox_grew = false;
+      candidates.clear();
+      group_index.find_overlapping(Domain{bbox}, &candidates);
+      for (auto&& next_group : candidates) {
+        if (!visited.insert(next_group).second) {
+          continue;
+        }
+        if (can_combine(
+              next_group->bounding_box.template bounds<DIM, coord_t>(), &bbox, &bbox_vol)) {
+          to_combine.push_back(next_group);
+          bbox_grew = true;
+        }
       }
-    };
-
-    // Find all the overlapping groups that are worth combining with the current group
-    for (auto&& [next_group, _] : instances) {
-      combine_new_region_group(next_group);
-    }
-
-    for (auto&& [next_group, _] : pending_instances) {
-      combine_new_region_group(next_group.get());
     }
 
     if (to_combine.empty()) {
@@ -273,8 +274,7 @@ InternalSharedPtr<RegionGroup> InstanceSet::find_or_create_region_group(
   return dim_dispatch(domain.get_dim(),
                       ConstructOverlappingRegionGroupFn{},
                       std::move(group),
-                      instances_,
-                      pending_instances_);
+                      group_index_);
 }
 
 void InstanceSet::record_instance(const Legion::LogicalRegion& region,
@@ -291,9 +291,13 @@ void InstanceSet::record_instance(const Legion::LogicalRegion& region,
   // If this is the last pending request of a region group, we should remove it from the map
   remove_pending_instance(group);
 
-  const auto& inst =
-    instances_.insert_or_assign(group.get(), InstanceSpec{std::move(instance), std::move(policy)})
-      .first->second.instance;
+  const auto [inst_it, inserted] =
+    instances_.insert_or_assign(group.get(), InstanceSpec{std::move(instance), std::move(policy)});
+  const auto& inst = inst_it->second.instance;
+
+  if (inserted) {
+    group_index_.insert(group.get());
+  }
 
   // Use of InternalSharedPtr vs raw RegionGroup * is deliberate. We swap the group down below,
   // and if the old region group is the last one left, we should delete it until we can remove
@@ -324,7 +328,9 @@ void InstanceSet::record_instance(const Legion::LogicalRegion& region,
 
     if (can_remove) {
       // ... and erased here
-      instances_.erase(removed_group.get());
+      if (instances_.erase(removed_group.get()) > 0) {
+        group_index_.erase(removed_group.get());
+      }
     }
   }
 
@@ -344,7 +350,12 @@ void InstanceSet::record_pending_instance_creation(InternalSharedPtr<RegionGroup
   }
 
   // Increment the pending instance counter
-  auto&& [grp, counter] = *pending_instances_.try_emplace(std::move(group)).first;
+  auto&& [it, inserted] = pending_instances_.try_emplace(std::move(group));
+  auto&& [grp, counter] = *it;
+
+  if (inserted) {
+    group_index_.insert(grp.get());
+  }
   ++counter;
 
   if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
@@ -356,6 +367,7 @@ void InstanceSet::record_pending_instance_creation(InternalSharedPtr<RegionGroup
 void InstanceSet::remove_pending_instance(const InternalSharedPtr<RegionGroup>& group)
 {
   if (const auto it = pending_instances_.find(group); --it->second == 0) {
+    group_index_.erase(it->first.get());
     pending_instances_.erase(it);
   }
 }
@@ -373,6 +385,7 @@ bool InstanceSet::erase(const Legion::Mapping::PhysicalInstance& inst)
   for (auto it = instances_.begin(); it != instances_.end(); /*nothing*/) {
     if (it->second.instance == inst) {
       filtered_groups.insert(it->first);
+      group_index_.erase(it->first);
       it        = instances_.erase(it);
       did_erase = true;
     } else {
@@ -442,6 +455,15 @@ void InstanceSet::dump_and_sanity_check_() const
       LEGATE_CHECK(false);
     }
   }
+
+  std::unordered_set<const RegionGroup*> indexed_groups;
+  for (auto&& [group, _] : instances_) {
+    indexed_groups.insert(group);
+  }
+  for (auto&& [group, _] : pending_instances_) {
+    indexed_groups.insert(group.get());
+  }
+  LEGATE_CHECK(indexed_groups.size() == group_index_.size());
 }
 
 std::optional<Legion::Mapping::PhysicalInstance> ReductionInstanceSet::find_instance(
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <legate/mapping/detail/region_group_index.h>
 #include <legate/mapping/mapping.h>
 #include <legate/utilities/detail/hash.h>
 #include <legate/utilities/hash.h>
@@ -103,6 +104,9 @@ class InstanceSet {  // NOLINT(bugprone-forward-declaration-namespace)
   std::unordered_map<RegionGroup*, InstanceSpec> instances_{};
   std::unordered_map<InternalSharedPtr<RegionGroup>, std::uint64_t> pending_instances_{};
   std::unordered_map<Legion::LogicalRegion, InternalSharedPtr<RegionGroup>> groups_{};
+  // Spatial index over the groups in instances_ and pending_instances_, used to find coalescing
+  // candidates without scanning both tables
+  RegionGroupIndex group_index_{};
 };
 
 class ReductionInstanceSet {
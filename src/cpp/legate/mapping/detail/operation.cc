@@ -34,7 +34,8 @@ Mappable::Mappable(private_tag, MapperDataDeserializer dez)
     machine_{dez.unpack<Machine>()},
     key_projection_id_{dez.unpack<std::uint32_t>()},
     sharding_id_{dez.unpack<std::uint32_t>()},
-    priority_{dez.unpack<std::int32_t>()}
+    priority_{dez.unpack<std::int32_t>()},
+    stealable_{dez.unpack<bool>()}
 {
   static_assert(sizeof(std::uint32_t) >= sizeof(Legion::ProjectionID));
   static_assert(sizeof(std::uint32_t) >= sizeof(Legion::ShardingID));
@@ -80,6 +81,15 @@ Legion::VariantID Task::legion_task_variant() const
   return legate::detail::to_underlying(to_variant_code(target()));
 }
 
+void Task::set_mapper_context(Legion::Mapping::MapperContext context)
+{
+  for (auto&& stores : {inputs(), outputs(), reductions()}) {
+    for (auto&& store : stores) {
+      store->set_mapper_context(context);
+    }
+  }
+}
+
 // ==========================================================================================
 
 Copy::Copy(const Legion::Copy& copy,
@@ -104,6 +114,7 @@ Copy::Copy(const Legion::Copy& copy,
   key_projection_id_ = dez.unpack<std::uint32_t>();
   sharding_id_       = dez.unpack<std::uint32_t>();
   priority_          = dez.unpack<std::int32_t>();
+  stealable_         = dez.unpack<bool>();
 
   // Copy
   inputs_ = dez.unpack<legate::detail::SmallVector<Store>>();
@@ -49,6 +49,10 @@ class Mappable {
   [[nodiscard]] std::uint32_t key_projection_id() const;
   [[nodiscard]] std::uint32_t sharding_id() const;
   [[nodiscard]] std::int32_t priority() const;
+  /**
+   * @return `true` if the leaf tasks of this operation may be stolen by idle processors.
+   */
+  [[nodiscard]] bool stealable() const;
 
   /**
    * @return The streaming generation.
@@ -64,6 +68,7 @@ class Mappable {
   std::uint32_t key_projection_id_{};
   std::uint32_t sharding_id_{};
   std::int32_t priority_{static_cast<std::int32_t>(legate::detail::TaskPriority::DEFAULT)};
+  bool stealable_{};
 
  private:
   struct private_tag {};
@@ -103,6 +108,15 @@ class Task : public Mappable {
 
   [[nodiscard]] const Legion::Task& legion_task() const;
 
+  /**
+   * @brief Set the mapper context used by the stores of the task.
+   *
+   * @param context The context of the current mapper call.
+   *
+   * @see Store::set_mapper_context().
+   */
+  void set_mapper_context(Legion::Mapping::MapperContext context);
+
  private:
   std::reference_wrapper<const Legion::Task> task_;
   // This is a pointer (not a reference_wrapper) because it cannot be initialized from
@@ -23,6 +23,8 @@ inline std::uint32_t Mappable::sharding_id() const { return sharding_id_; }
 
 inline std::int32_t Mappable::priority() const { return priority_; }
 
+inline bool Mappable::stealable() const { return stealable_; }
+
 inline const std::optional<legate::detail::StreamingGeneration>& Mappable::streaming_generation()
   const
 {
@@ -0,0 +1,237 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/mapping/detail/region_group_index.h>
+
+#include <legate/mapping/detail/instance_manager.h>
+#include <legate/utilities/assert.h>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace legate::mapping::detail {
+
+class RegionGroupIndex::Node {
+ public:
+  Node(RegionGroup* g, coord_t l, coord_t h, std::uint64_t p)
+    : group{g}, lo{l}, hi{h}, max_hi{h}, priority{p}
+  {
+  }
+
+  // Recomputes the augmented upper bound from the children
+  void update()
+  {
+    max_hi = hi;
+    if (left) {
+      max_hi = std::max(max_hi, left->max_hi);
+    }
+    if (right) {
+      max_hi = std::max(max_hi, right->max_hi);
+    }
+  }
+
+  RegionGroup* group{};
+  coord_t lo{};
+  coord_t hi{};
+  coord_t max_hi{};
+  std::uint64_t priority{};
+  std::unique_ptr<Node> left{};
+  std::unique_ptr<Node> right{};
+};
+
+namespace {
+
+using NodePtr = std::unique_ptr<RegionGroupIndex::Node>;
+
+// Nodes are ordered by the lower bound of the first dimension, using the group pointer to break
+// ties, so each group has a unique position in the tree
+[[nodiscard]] bool key_less(coord_t lhs_lo,
+                            const RegionGroup* lhs_group,
+                            coord_t rhs_lo,
+                            const RegionGroup* rhs_group)
+{
+  if (lhs_lo != rhs_lo) {
+    return lhs_lo < rhs_lo;
+  }
+  return std::less<const RegionGroup*>{}(lhs_group, rhs_group);
+}
+
+// Splits the tree into the nodes ordered before the key and the rest
+void split(NodePtr tree, coord_t lo, const RegionGroup* group, NodePtr* left, NodePtr* right)
+{
+  if (!tree) {
+    left->reset();
+    right->reset();
+    return;
+  }
+  if (key_less(tree->lo, tree->group, lo, group)) {
+    split(std::move(tree->right), lo, group, &tree->right, right);
+    tree->update();
+    *left = std::move(tree);
+  } else {
+    split(std::move(tree->left), lo, group, left, &tree->left);
+    tree->update();
+    *right = std::move(tree);
+  }
+}
+
+// Merges two trees, all nodes in the left one being ordered before those in the right one
+[[nodiscard]] NodePtr merge(NodePtr left, NodePtr right)
+{
+  if (!left) {
+    return right;
+  }
+  if (!right) {
+    return left;
+  }
+  if (left->priority > right->priority) {
+    left->right = merge(std::move(left->right), std::move(right));
+    left->update();
+    return left;
+  }
+  right->left = merge(std::move(left), std::move(right->left));
+  right->update();
+  return right;
+}
+
+// Returns true if the node was found and removed
+[[nodiscard]] bool remove(NodePtr* tree, coord_t lo, const RegionGroup* group)
+{
+  auto& node = *tree;
+
+  if (!node) {
+    return false;
+  }
+  if (node->group == group) {
+    *tree = merge(std::move(node->left), std::move(node->right));
+    return true;
+  }
+
+  const auto removed =
+    remove(key_less(lo, group, node->lo, node->group) ? &node->left : &node->right, lo, group);
+
+  if (removed) {
+    node->update();
+  }
+  return removed;
+}
+
+[[nodiscard]] bool overlaps(const Domain& lhs, const Domain& rhs)
+{
+  LEGATE_ASSERT(lhs.get_dim() == rhs.get_dim());
+
+  const auto lhs_lo = lhs.lo();
+  const auto lhs_hi = lhs.hi();
+  const auto rhs_lo = rhs.lo();
+  const auto rhs_hi = rhs.hi();
+
+  for (std::int32_t dim = 0; dim < lhs.get_dim(); ++dim) {
+    if (lhs_hi[dim] < rhs_lo[dim] || rhs_hi[dim] < lhs_lo[dim]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void collect_overlapping(const RegionGroupIndex::Node* node,
+                         const Domain& bbox,
+                         coord_t lo,
+                         coord_t hi,
+                         std::vector<RegionGroup*>* result)
+{
+  // Nothing in this subtree reaches the query's lower bound
+  if (!node || node->max_hi < lo) {
+    return;
+  }
+  collect_overlapping(node->left.get(), bbox, lo, hi, result);
+  // Neither this node nor anything to the right of it starts before the query's upper bound
+  if (node->lo > hi) {
+    return;
+  }
+  if (overlaps(node->group->bounding_box, bbox)) {
+    result->push_back(node->group);
+  }
+  collect_overlapping(node->right.get(), bbox, lo, hi, result);
+}
+
+}  // namespace
+
+RegionGroupIndex::RegionGroupIndex() = default;
+
+RegionGroupIndex::~RegionGroupIndex() = default;
+
+RegionGroupIndex::RegionGroupIndex(RegionGroupIndex&&) noexcept = default;
+
+RegionGroupIndex& RegionGroupIndex::operator=(RegionGroupIndex&&) noexcept = default;
+
+void RegionGroupIndex::insert(RegionGroup* group)
+{
+  auto&& [it, inserted] = entries_.try_emplace(group);
+  auto& entry           = it->second;
+
+  ++entry.refs;
+  if (!inserted) {
+    return;
+  }
+
+  const auto& bbox = group->bounding_box;
+
+  // Empty boxes never overlap anything, so there is no point in putting them in the tree
+  if (bbox.empty()) {
+    return;
+  }
+
+  auto node = std::make_unique<Node>(group, bbox.lo()[0], bbox.hi()[0], next_priority_());
+  NodePtr left{};
+  NodePtr right{};
+
+  entry.lo      = node->lo;
+  entry.indexed = true;
+  split(std::move(root_), node->lo, group, &left, &right);
+  root_ = merge(merge(std::move(left), std::move(node)), std::move(right));
+}
+
+void RegionGroupIndex::erase(const RegionGroup* group)
+{
+  const auto it = entries_.find(group);
+
+  if (it == entries_.end() || --it->second.refs > 0) {
+    return;
+  }
+  if (it->second.indexed) {
+    [[maybe_unused]] const auto removed = remove(&root_, it->second.lo, group);
+
+    LEGATE_ASSERT(removed);
+  }
+  entries_.erase(it);
+}
+
+void RegionGroupIndex::find_overlapping(const Domain& bbox,
+                                        std::vector<RegionGroup*>* result) const
+{
+  if (bbox.empty()) {
+    return;
+  }
+  collect_overlapping(root_.get(), bbox, bbox.lo()[0], bbox.hi()[0], result);
+}
+
+std::uint64_t RegionGroupIndex::next_priority_()
+{
+  // splitmix64, which is plenty random for balancing purposes and keeps the tree shape
+  // reproducible from run to run
+  constexpr std::uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ULL;
+  constexpr std::uint64_t MIX_1        = 0xBF58476D1CE4E5B9ULL;
+  constexpr std::uint64_t MIX_2        = 0x94D049BB133111EBULL;
+
+  auto z = (priority_state_ += GOLDEN_GAMMA);
+
+  z = (z ^ (z >> 30)) * MIX_1;
+  z = (z ^ (z >> 27)) * MIX_2;
+  return z ^ (z >> 31);
+}
+
+}  // namespace legate::mapping::detail
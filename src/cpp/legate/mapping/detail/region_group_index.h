@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/utilities/typedefs.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace legate::mapping::detail {
+
+class RegionGroup;
+
+/**
+ * @brief A spatial index over the bounding boxes of region groups.
+ *
+ * The index is an interval tree keyed on the extent of each group's bounding box along its
+ * first dimension. Every node is augmented with the largest upper bound found in its subtree,
+ * so that an overlap query only descends into subtrees that can possibly intersect the query
+ * box. The remaining dimensions are checked on the candidates before they are reported. The
+ * tree is kept balanced with randomized (treap) priorities, making insertions and removals
+ * logarithmic in the number of indexed groups.
+ *
+ * A group may be inserted multiple times (for example, once for its instance and once for a
+ * pending instance creation), in which case it stays in the index until every insertion has
+ * been matched by an erasure.
+ */
+class RegionGroupIndex {
+ public:
+  RegionGroupIndex();
+  ~RegionGroupIndex();
+
+  RegionGroupIndex(const RegionGroupIndex&)            = delete;
+  RegionGroupIndex& operator=(const RegionGroupIndex&) = delete;
+  RegionGroupIndex(RegionGroupIndex&&) noexcept;
+  RegionGroupIndex& operator=(RegionGroupIndex&&) noexcept;
+
+  /**
+   * @brief Add a reference to a region group to the index.
+   *
+   * The group's bounding box must not change while the group is in the index.
+   *
+   * @param group The group to add.
+   */
+  void insert(RegionGroup* group);
+
+  /**
+   * @brief Remove a reference to a region group from the index.
+   *
+   * The group is dropped from the index once its last reference is removed. The group itself
+   * is never dereferenced, so it is safe to call this on a group that is about to be destroyed.
+   *
+   * @param group The group to remove.
+   */
+  void erase(const RegionGroup* group);
+
+  /**
+   * @brief Collect the indexed groups whose bounding boxes intersect a box.
+   *
+   * @param bbox The query box.
+   * @param result The vector to which the overlapping groups are appended.
+   */
+  void find_overlapping(const Domain& bbox, std::vector<RegionGroup*>* result) const;
+
+  [[nodiscard]] bool empty() const;
+  [[nodiscard]] std::size_t size() const;
+
+  class Node;
+
+ private:
+  class Entry {
+   public:
+    std::uint32_t refs{};
+    coord_t lo{};
+    bool indexed{};
+  };
+
+  [[nodiscard]] std::uint64_t next_priority_();
+
+  std::unique_ptr<Node> root_{};
+  std::unordered_map<const RegionGroup*, Entry> entries_{};
+  std::uint64_t priority_state_{};
+};
+
+}  // namespace legate::mapping::detail
+
+#include <legate/mapping/detail/region_group_index.inl>
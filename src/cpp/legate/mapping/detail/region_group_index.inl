@@ -0,0 +1,17 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/mapping/detail/region_group_index.h>
+
+namespace legate::mapping::detail {
+
+inline bool RegionGroupIndex::empty() const { return entries_.empty(); }
+
+inline std::size_t RegionGroupIndex::size() const { return entries_.size(); }
+
+}  // namespace legate::mapping::detail
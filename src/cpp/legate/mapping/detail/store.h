@@ -125,6 +125,16 @@ class Store {
 
   [[nodiscard]] Domain domain() const;
 
+  /**
+   * @brief Set the mapper context used to query the domain of the store.
+   *
+   * A mapper context is only valid for the duration of a mapper call, so a store kept across
+   * mapper calls must be given the context of the current call before it is queried.
+   *
+   * @param context The context of the current mapper call.
+   */
+  void set_mapper_context(Legion::Mapping::MapperContext context);
+
   [[nodiscard]] legate::detail::SmallVector<std::int32_t, LEGATE_MAX_DIM> find_imaginary_dims()
     const;
 
@@ -58,6 +58,11 @@ inline const Legion::Domain& FutureWrapper::domain() const { return domain_; }
 
 inline bool Store::is_future() const { return is_future_; }
 
+inline void Store::set_mapper_context(Legion::Mapping::MapperContext context)
+{
+  context_ = context;
+}
+
 inline bool Store::unbound() const { return is_unbound_store_; }
 
 inline std::int32_t Store::dim() const { return dim_; }
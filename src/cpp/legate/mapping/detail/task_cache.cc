@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/mapping/detail/task_cache.h>
+
+#include <utility>
+
+namespace legate::mapping::detail {
+
+InternalSharedPtr<Task> TaskCache::find_or_create(const Legion::Task& task,
+                                                  Legion::Mapping::MapperRuntime& runtime,
+                                                  Legion::Mapping::MapperContext context)
+{
+  const auto key = key_(task);
+
+  // Don't hand out a view created for a different task object that happens to have the same key
+  if (const auto it = tasks_.find(key);
+      it != tasks_.end() && &it->second->legion_task() == &task) {
+    it->second->set_mapper_context(context);
+    return it->second;
+  }
+
+  auto legate_task = make_internal_shared<Task>(task, runtime, context);
+
+  if (tasks_.size() >= MAX_SIZE) {
+    tasks_.clear();
+  }
+  tasks_.insert_or_assign(key, legate_task);
+  return legate_task;
+}
+
+InternalSharedPtr<Task> TaskCache::take(const Legion::Task& task,
+                                        Legion::Mapping::MapperRuntime& runtime,
+                                        Legion::Mapping::MapperContext context)
+{
+  const auto it = tasks_.find(key_(task));
+
+  if (it == tasks_.end()) {
+    return make_internal_shared<Task>(task, runtime, context);
+  }
+
+  auto legate_task = std::move(it->second);
+
+  tasks_.erase(it);
+  if (&legate_task->legion_task() != &task) {
+    return make_internal_shared<Task>(task, runtime, context);
+  }
+  legate_task->set_mapper_context(context);
+  return legate_task;
+}
+
+}  // namespace legate::mapping::detail
@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/mapping/detail/operation.h>
+#include <legate/utilities/detail/hash.h>
+#include <legate/utilities/internal_shared_ptr.h>
+#include <legate/utilities/typedefs.h>
+
+#include <legion.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+namespace legate::mapping::detail {
+
+/**
+ * @brief Keeps the mapper view of Legion tasks across the mapper calls made for them, so that
+ * the task arguments are only deserialized once per task.
+ *
+ * Entries are keyed by the unique ID and the point of the Legion task. They are created by the
+ * mapper calls made before the task is mapped or sliced, and removed by the call that maps or
+ * slices it, which is the last one to need them. Since some tasks never reach that call on this
+ * mapper (e.g., a single task mapped by another shard), the cache is cleared whenever it holds
+ * more than `MAX_SIZE` entries.
+ *
+ * The mapper calls are serialized, but may be reentrant, so the cached tasks are shared with
+ * the callers, which keep them alive even if they are evicted while in use.
+ */
+class TaskCache {
+ public:
+  static constexpr std::size_t MAX_SIZE = 1024;
+
+  /**
+   * @brief Find the mapper view of a task, creating and caching it if it doesn't exist yet.
+   *
+   * @param task The Legion task.
+   * @param runtime The mapper runtime.
+   * @param context The context of the current mapper call.
+   *
+   * @return The mapper view of the task.
+   */
+  [[nodiscard]] InternalSharedPtr<Task> find_or_create(const Legion::Task& task,
+                                                       Legion::Mapping::MapperRuntime& runtime,
+                                                       Legion::Mapping::MapperContext context);
+
+  /**
+   * @brief Remove the mapper view of a task from the cache, creating it if it isn't cached.
+   *
+   * Used by the last mapper call made for the task.
+   *
+   * @param task The Legion task.
+   * @param runtime The mapper runtime.
+   * @param context The context of the current mapper call.
+   *
+   * @return The mapper view of the task.
+   */
+  [[nodiscard]] InternalSharedPtr<Task> take(const Legion::Task& task,
+                                             Legion::Mapping::MapperRuntime& runtime,
+                                             Legion::Mapping::MapperContext context);
+
+  /**
+   * @return The number of cached tasks.
+   */
+  [[nodiscard]] std::size_t size() const;
+
+ private:
+  using Key = std::pair<Legion::UniqueID, DomainPoint>;
+
+  [[nodiscard]] static Key key_(const Legion::Task& task);
+
+  std::unordered_map<Key, InternalSharedPtr<Task>, hasher<Key>> tasks_{};
+};
+
+}  // namespace legate::mapping::detail
+
+#include <legate/mapping/detail/task_cache.inl>
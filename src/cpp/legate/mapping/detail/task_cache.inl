@@ -0,0 +1,20 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/mapping/detail/task_cache.h>
+
+namespace legate::mapping::detail {
+
+inline std::size_t TaskCache::size() const { return tasks_.size(); }
+
+inline TaskCache::Key TaskCache::key_(const Legion::Task& task)
+{
+  return {task.get_unique_id(), task.index_point};
+}
+
+}  // namespace legate::mapping::detail
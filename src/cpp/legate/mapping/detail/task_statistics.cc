@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/mapping/detail/task_statistics.h>
+
+namespace legate::mapping::detail {
+
+void TaskStatisticsTable::record_execution(GlobalTaskID task_id,
+                                           VariantCode variant,
+                                           Processor proc,
+                                           std::chrono::nanoseconds execution_time)
+{
+  auto&& stats = entries_[Key{task_id, variant, proc}].stats;
+
+  if (stats.num_executions++ == 0) {
+    stats.execution_time = execution_time;
+  } else {
+    stats.execution_time += (execution_time - stats.execution_time) / EXECUTION_TIME_SMOOTHING;
+  }
+}
+
+void TaskStatisticsTable::record_footprint(GlobalTaskID task_id,
+                                           VariantCode variant,
+                                           Processor proc,
+                                           std::size_t footprint)
+{
+  auto&& entry = entries_[Key{task_id, variant, proc}];
+  auto&& mean  = entry.stats.instance_footprint;
+
+  ++entry.num_mappings;
+  // Update the mean in floating point, as the difference to the mean can be negative
+  mean = static_cast<std::size_t>(
+    static_cast<double>(mean) +
+    ((static_cast<double>(footprint) - static_cast<double>(mean)) /
+     static_cast<double>(entry.num_mappings)));
+}
+
+std::optional<TaskStatistics> TaskStatisticsTable::find(GlobalTaskID task_id,
+                                                        VariantCode variant,
+                                                        Processor proc) const
+{
+  const auto it = entries_.find(Key{task_id, variant, proc});
+
+  if (it == entries_.end() || it->second.stats.num_executions == 0) {
+    return std::nullopt;
+  }
+  return it->second.stats;
+}
+
+}  // namespace legate::mapping::detail
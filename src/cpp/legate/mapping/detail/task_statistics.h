@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/mapping/mapping.h>
+#include <legate/utilities/detail/hash.h>
+#include <legate/utilities/typedefs.h>
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+
+namespace legate::mapping::detail {
+
+/**
+ * @brief Running statistics of task variants, per processor, built from the profiling feedback
+ * the mapper receives from Legion.
+ */
+class TaskStatisticsTable {
+ public:
+  /**
+   * @brief Weight of the newest sample in the moving average of execution times, as
+   * 1 / `EXECUTION_TIME_SMOOTHING`. Recent executions count more than old ones, so that changes
+   * in the load of a processor show up after a few executions.
+   */
+  static constexpr std::uint32_t EXECUTION_TIME_SMOOTHING = 4;
+
+  /**
+   * @brief Record the execution time of a task.
+   *
+   * @param task_id The task that has run.
+   * @param variant The variant that has run.
+   * @param proc The processor the task has run on.
+   * @param execution_time The time between the start and the end of the execution.
+   */
+  void record_execution(GlobalTaskID task_id,
+                        VariantCode variant,
+                        Processor proc,
+                        std::chrono::nanoseconds execution_time);
+
+  /**
+   * @brief Record the footprint of the instances a task has been mapped to.
+   *
+   * @param task_id The task that has been mapped.
+   * @param variant The variant that has been mapped.
+   * @param proc The processor the task has been mapped to.
+   * @param footprint The total size, in bytes, of the instances chosen for the task.
+   */
+  void record_footprint(GlobalTaskID task_id,
+                        VariantCode variant,
+                        Processor proc,
+                        std::size_t footprint);
+
+  /**
+   * @param task_id The task to look up.
+   * @param variant The variant to look up.
+   * @param proc The processor to look up.
+   *
+   * @return The statistics of the variant on the processor, or `std::nullopt` if the variant
+   * hasn't run on the processor yet.
+   */
+  [[nodiscard]] std::optional<TaskStatistics> find(GlobalTaskID task_id,
+                                                   VariantCode variant,
+                                                   Processor proc) const;
+
+ private:
+  class Entry {
+   public:
+    TaskStatistics stats{};
+    std::uint64_t num_mappings{};
+  };
+
+  using Key = std::tuple<GlobalTaskID, VariantCode, Processor>;
+
+  std::unordered_map<Key, Entry, hasher<Key>> entries_{};
+};
+
+}  // namespace legate::mapping::detail
@@ -12,8 +12,12 @@
 #include <legate/utilities/internal_shared_ptr.h>
 #include <legate/utilities/shared_ptr.h>
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <memory>
+#include <optional>
 #include <vector>
 
 /**
@@ -443,6 +447,27 @@ class LEGATE_EXPORT StoreMapping {
   std::unique_ptr<detail::StoreMapping> impl_{};
 };
 
+/**
+ * @brief Statistics of a task variant on a processor, collected from profiling feedback
+ *
+ * Statistics are only collected when the runtime is started with ``--mapper-profiling``.
+ */
+class LEGATE_EXPORT TaskStatistics {
+ public:
+  /**
+   * @brief Number of executions the statistics are computed from
+   */
+  std::uint64_t num_executions{};
+  /**
+   * @brief Moving average of the execution time, weighted towards the most recent executions
+   */
+  std::chrono::nanoseconds execution_time{};
+  /**
+   * @brief Mean total size, in bytes, of the instances the task has been mapped to
+   */
+  std::size_t instance_footprint{};
+};
+
 /**
  * @brief An abstract class that defines machine query APIs
  */
@@ -473,6 +498,19 @@ class LEGATE_EXPORT MachineQueryInterface {
    * @return Total number of nodes
    */
   [[nodiscard]] virtual std::uint32_t total_nodes() const = 0;
+  /**
+   * @brief Returns the statistics of a task variant on a local processor
+   *
+   * @param task_id Global ID of the task
+   * @param variant Variant of the task
+   * @param proc Processor the variant has run on
+   *
+   * @return Statistics of the variant on the processor; ``std::nullopt`` if the variant hasn't run
+   * on the processor yet or profiling is disabled.
+   */
+  [[nodiscard]] virtual std::optional<TaskStatistics> task_statistics(GlobalTaskID task_id,
+                                                                      VariantCode variant,
+                                                                      Processor proc) const = 0;
 };
 
 /**
@@ -143,4 +143,12 @@ void Copy::add_to_solver(ConstraintSolver& solver)
 
 bool Copy::needs_flush() const { return target_.needs_flush() || source_.needs_flush(); }
 
+std::optional<OperationSignature> Copy::signature() const
+{
+  auto result = make_signature_();
+
+  result.append(redop_kind_.value_or(-1));
+  return result;
+}
+
 }  // namespace legate::detail
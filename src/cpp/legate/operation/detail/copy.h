@@ -39,6 +39,8 @@ class Copy final : public Operation {
    */
   [[nodiscard]] bool needs_partitioning() const override;
 
+  [[nodiscard]] std::optional<OperationSignature> signature() const override;
+
  private:
   StoreArg target_{};
   StoreArg source_{};
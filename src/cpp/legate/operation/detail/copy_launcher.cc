@@ -129,6 +129,8 @@ void CopyLauncher::pack_args(BufferBuilder& buffer)
   static_assert(sizeof(std::uint32_t) >= sizeof(Legion::ShardingID));
   buffer.pack<std::uint32_t>(Runtime::get_runtime().get_sharding(machine_, key_proj_id_));
   buffer.pack(priority_);
+  // stealable
+  buffer.pack<bool>(false);
 
   auto pack_args = [&buffer](Span<const CopyArg> args) {
     buffer.pack<std::uint32_t>(static_cast<std::uint32_t>(args.size()));
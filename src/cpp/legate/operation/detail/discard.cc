@@ -21,4 +21,15 @@ void Discard::launch()
   Legion::Runtime::get_runtime()->discard_fields(Legion::Runtime::get_context(), launcher);
 }
 
+std::optional<OperationSignature> Discard::signature() const
+{
+  auto result = make_signature_();
+
+  result.append(region().get_tree_id());
+  result.append(region().get_index_space().get_id());
+  result.append(region().get_field_space().get_id());
+  result.append(field_id());
+  return result;
+}
+
 }  // namespace legate::detail
@@ -9,6 +9,7 @@
 #include <legate/operation/detail/operation.h>
 
 #include <cstdint>
+#include <optional>
 
 namespace legate::detail {
 
@@ -34,6 +35,8 @@ class Discard final : public Operation {
    */
   [[nodiscard]] bool needs_partitioning() const override;
 
+  [[nodiscard]] std::optional<OperationSignature> signature() const override;
+
   /**
    * Discard operations are always streamable.
    *
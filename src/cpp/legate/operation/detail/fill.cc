@@ -156,6 +156,15 @@ bool Fill::needs_flush() const
     value_);
 }
 
+std::optional<OperationSignature> Fill::signature() const
+{
+  auto result = make_signature_();
+
+  // Filling with a future and filling with a value are different Legion operations
+  result.append(value_.index());
+  return result;
+}
+
 Legion::Future Fill::get_fill_value_() const
 {
   return std::visit(
@@ -9,6 +9,7 @@
 #include <legate/operation/detail/operation.h>
 #include <legate/utilities/internal_shared_ptr.h>
 
+#include <optional>
 #include <variant>
 
 namespace legate::detail {
@@ -39,6 +40,13 @@ class Fill final : public Operation {
    */
   [[nodiscard]] bool needs_partitioning() const override;
 
+  [[nodiscard]] std::optional<OperationSignature> signature() const override;
+
+  /**
+   * @return The store to fill.
+   */
+  [[nodiscard]] const InternalSharedPtr<LogicalStore>& lhs() const;
+
  private:
   Legion::Future get_fill_value_() const;
 
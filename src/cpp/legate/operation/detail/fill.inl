@@ -14,4 +14,6 @@ inline Operation::Kind Fill::kind() const { return Kind::FILL; }
 
 inline bool Fill::needs_partitioning() const { return true; }
 
+inline const InternalSharedPtr<LogicalStore>& Fill::lhs() const { return lhs_; }
+
 }  // namespace legate::detail
@@ -89,6 +89,8 @@ BufferBuilder FillLauncher::pack_mapper_arg_(Legion::ProjectionID proj_id) const
   buffer.pack<std::uint32_t>(proj_id);
   buffer.pack<std::uint32_t>(Runtime::get_runtime().get_sharding(machine_, proj_id));
   buffer.pack(priority_);
+  // stealable
+  buffer.pack<bool>(false);
   return buffer;
 }
 
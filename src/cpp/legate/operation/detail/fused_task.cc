@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/operation/detail/fused_task.h>
+
+#include <legate/mapping/detail/machine.h>
+#include <legate/runtime/detail/library.h>
+#include <legate/runtime/detail/runtime.h>
+#include <legate/task/detail/task_context.h>
+#include <legate/task/detail/task_info.h>
+#include <legate/task/detail/variant_info.h>
+#include <legate/utilities/assert.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <utility>
+
+namespace legate::detail {
+
+namespace {
+
+// The context handed to the variant of a member task. It only sees the arguments of the member,
+// and otherwise looks like the context of the fused leaf task it runs in.
+class FusedMemberTaskContext final : public TaskContext {
+ public:
+  FusedMemberTaskContext(const TaskContext& parent, GlobalTaskID task_id, CtorArgs&& args)
+    : TaskContext{std::move(args)}, parent_{parent}, task_id_{task_id}
+  {
+  }
+
+  [[nodiscard]] GlobalTaskID task_id() const noexcept override { return task_id_; }
+
+  [[nodiscard]] bool is_single_task() const noexcept override
+  {
+    return parent_.get().is_single_task();
+  }
+
+  [[nodiscard]] const DomainPoint& get_task_index() const noexcept override
+  {
+    return parent_.get().get_task_index();
+  }
+
+  [[nodiscard]] const Domain& get_launch_domain() const noexcept override
+  {
+    return parent_.get().get_launch_domain();
+  }
+
+  [[nodiscard]] std::string_view get_provenance() const override
+  {
+    return parent_.get().get_provenance();
+  }
+
+  [[nodiscard]] const mapping::detail::Machine& machine() const noexcept override
+  {
+    return parent_.get().machine();
+  }
+
+ private:
+  std::reference_wrapper<const TaskContext> parent_;
+  GlobalTaskID task_id_{};
+};
+
+void run_members(legate::TaskContext context)
+{
+  const auto& parent = *context.impl();
+  const auto layout  = context.scalar(0).values<std::uint64_t>();
+  // The member scalars follow the layout
+  auto scalar_idx = std::size_t{1};
+  auto pos        = std::size_t{0};
+  const auto next = [&] { return layout[pos++]; };
+
+  for (auto num_members = next(); num_members > 0; --num_members) {
+    const auto task_id = static_cast<GlobalTaskID>(next());
+    auto args          = TaskContext::CtorArgs{parent.variant_kind()};
+
+    for (auto num_inputs = next(); num_inputs > 0; --num_inputs) {
+      args.inputs.push_back(parent.inputs()[next()]);
+    }
+    for (auto num_outputs = next(); num_outputs > 0; --num_outputs) {
+      args.outputs.push_back(parent.outputs()[next()]);
+    }
+    for (auto num_scalars = next(); num_scalars > 0; --num_scalars) {
+      args.scalars.push_back(parent.scalars()[scalar_idx++]);
+    }
+
+    // Libraries register the same tasks in every process, so the member task can be looked up
+    // by its global ID in the process running the leaf task
+    const auto library = Runtime::get_runtime().find_library(task_id);
+
+    LEGATE_CHECK(library.has_value());
+
+    const auto& task_info = library->get().find_task(library->get().get_local_task_id(task_id));
+    const auto variant    = task_info->find_variant(parent.variant_kind());
+    // The fusion pass only fuses tasks with a variant for the target of the fused launch
+    LEGATE_CHECK(variant.has_value());
+
+    auto member = FusedMemberTaskContext{parent, task_id, std::move(args)};
+
+    variant->get().body(legate::TaskContext{&member});
+  }
+  LEGATE_ASSERT(pos == layout.size());
+  LEGATE_ASSERT(scalar_idx == parent.scalars().size());
+}
+
+}  // namespace
+
+/*static*/ void FusedTask::cpu_variant(legate::TaskContext context) { run_members(context); }
+
+/*static*/ void FusedTask::gpu_variant(legate::TaskContext context) { run_members(context); }
+
+/*static*/ void FusedTask::omp_variant(legate::TaskContext context) { run_members(context); }
+
+}  // namespace legate::detail
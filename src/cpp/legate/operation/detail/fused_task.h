@@ -0,0 +1,41 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/task/task.h>
+#include <legate/task/task_context.h>
+#include <legate/utilities/detail/core_ids.h>
+
+namespace legate::detail {
+
+// FusedTask runs the variants of a chain of fused tasks back to back on each leaf task. The
+// fusion pass (see fuse_elementwise_tasks()) collects the stores of all member tasks into one
+// launch, and describes the members in the first scalar argument, an array of std::uint64_t:
+//
+//   [num_members,
+//    for each member:
+//      task_id,
+//      num_inputs, <index into the fused inputs>...,
+//      num_outputs, <index into the fused outputs>...,
+//      num_scalars]
+//
+// where task_id is the global task ID of the member, from which the process running the leaf task
+// looks up the member's TaskInfo. The scalar arguments of the members follow the layout, in member
+// order.
+class LEGATE_EXPORT FusedTask : public LegateTask<FusedTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{LocalTaskID{CoreTask::FUSED_TASK}};
+
+  static void cpu_variant(legate::TaskContext context);
+
+  static void gpu_variant(legate::TaskContext context);
+
+  static void omp_variant(legate::TaskContext context);
+};
+
+}  // namespace legate::detail
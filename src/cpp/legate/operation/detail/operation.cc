@@ -6,6 +6,8 @@
 
 #include <legate/operation/detail/operation.h>
 
+#include <legate/data/detail/storage.h>
+#include <legate/data/detail/transform/transform_stack.h>
 #include <legate/operation/detail/access_mode.h>
 #include <legate/partitioning/detail/constraint.h>
 #include <legate/partitioning/detail/partitioner.h>
@@ -82,6 +84,44 @@ std::string Operation::to_string(bool show_provenance) const
   return result;
 }
 
+OperationSignature Operation::make_signature_() const
+{
+  OperationSignature result{};
+  const auto& processor_range = machine().processor_range();
+
+  result.append(kind());
+  result.append(priority());
+  result.append(machine().preferred_target());
+  result.append(processor_range.low);
+  result.append(processor_range.high);
+  result.append(processor_range.per_node_count);
+  result.append(parallel_policy().overdecompose_factor());
+  result.append(parallel_policy().work_stealing());
+
+  const auto append_stores = [&](const SmallVector<StoreArg>& args) {
+    result.append(args.size());
+    for (auto&& [store, variable] : args) {
+      const auto& storage = store->get_storage();
+
+      // Stores are identified by the storage they view rather than by their own ID, so that views
+      // recreated by each iteration of a loop (e.g. the same slice of an array) match
+      result.append(variable->id());
+      result.append(storage->get_root()->id());
+      result.append_all(storage->offsets());
+      result.append_all(store->extents());
+      store->transform()->add_to_signature(result);
+      // The partitioner favors the key partitions of a store and its storage, so the partitions
+      // chosen for the operation depend on them
+      result.append_all(store->key_partition_epochs());
+    }
+  };
+
+  append_stores(input_stores());
+  append_stores(output_stores());
+  append_stores(reduction_stores());
+  return result;
+}
+
 const Variable* Operation::find_or_declare_partition(const InternalSharedPtr<LogicalStore>& store)
 {
   const auto [it, inserted] = part_mappings_.try_emplace(store);
@@ -10,6 +10,7 @@
 #include <legate/data/detail/logical_store_partition.h>
 #include <legate/mapping/detail/machine.h>
 #include <legate/operation/detail/access_mode.h>
+#include <legate/operation/detail/operation_signature.h>
 #include <legate/operation/detail/store_projection.h>
 #include <legate/partitioning/detail/constraint.h>
 #include <legate/tuning/parallel_policy.h>
@@ -21,7 +22,9 @@
 
 #include <fmt/format.h>
 
+#include <cstddef>
 #include <deque>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -143,6 +146,27 @@ class Operation {
    */
   [[nodiscard]] virtual bool needs_partitioning() const = 0;
 
+  /**
+   * @brief Compute the signature by which automatic tracing and the strategy cache recognize
+   * repeated operations.
+   *
+   * Two operations with equal signatures must be partitioned the same way, and must issue the
+   * same Legion operations, with the same region requirements, when they are launched from the
+   * same runtime state. The values of scalar arguments don't contribute to the signature, as
+   * they affect neither the partitioning nor the dependence analysis that traces memoize.
+   *
+   * @return The signature, or `std::nullopt` if the operation must not be part of a trace.
+   *
+   * @see AutoTracer, StrategyCache.
+   */
+  [[nodiscard]] virtual std::optional<OperationSignature> signature() const;
+
+  /**
+   * @return The hash of the signature of the operation, or `std::nullopt` if the operation must
+   * not be part of a trace.
+   */
+  [[nodiscard]] std::optional<std::size_t> trace_signature() const;
+
   [[nodiscard]] const Variable* find_or_declare_partition(
     const InternalSharedPtr<LogicalStore>& store);
   [[nodiscard]] const Variable* declare_partition();
@@ -154,6 +178,15 @@ class Operation {
    * @return The parallel_policy of this operation.
    */
   [[nodiscard]] const ParallelPolicy& parallel_policy() const;
+  /**
+   * @brief Set the parallel policy of the operation.
+   *
+   * Operations take the policy of the scope they are created in. This is for operations created
+   * on behalf of others that were submitted under a different scope, such as fused launches.
+   *
+   * @param parallel_policy The new parallel policy.
+   */
+  void set_parallel_policy(ParallelPolicy parallel_policy);
   [[nodiscard]] ZStringView provenance() const;
 
   /**
@@ -196,6 +229,12 @@ class Operation {
   [[nodiscard]] static StoreProjection create_store_projection_(const Strategy& strategy,
                                                                 const Domain& launch_domain,
                                                                 const StoreArg& arg);
+  /**
+   * @brief Start a signature with the parts common to all operations: the kind, the machine, the
+   * priority, and the stores the operation accesses along with the epochs of their key
+   * partitions.
+   */
+  [[nodiscard]] OperationSignature make_signature_() const;
 
   std::uint64_t unique_id_{};
   std::int32_t next_part_id_{};
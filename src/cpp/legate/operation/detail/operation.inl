@@ -8,6 +8,8 @@
 
 #include <legate/operation/detail/operation.h>
 
+#include <utility>
+
 namespace legate::detail {
 
 inline bool Operation::StoreArg::needs_flush() const { return store->needs_flush(); }
@@ -22,12 +24,27 @@ inline bool Operation::supports_replicated_write() const { return false; }
 
 inline bool Operation::supports_streaming() const { return needs_partitioning(); }
 
+inline std::optional<OperationSignature> Operation::signature() const { return std::nullopt; }
+
+inline std::optional<std::size_t> Operation::trace_signature() const
+{
+  if (const auto result = signature(); result.has_value()) {
+    return result->hash();
+  }
+  return std::nullopt;
+}
+
 inline std::int32_t Operation::priority() const { return priority_; }
 
 inline const mapping::detail::Machine& Operation::machine() const { return machine_; }
 
 inline const ParallelPolicy& Operation::parallel_policy() const { return parallel_policy_; }
 
+inline void Operation::set_parallel_policy(ParallelPolicy parallel_policy)
+{
+  parallel_policy_ = std::move(parallel_policy);
+}
+
 inline ZStringView Operation::provenance() const { return provenance_; }
 
 inline const SmallVector<Operation::StoreArg>& Operation::input_stores() const
@@ -0,0 +1,23 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/operation/detail/operation_signature.h>
+
+namespace legate::detail {
+
+void OperationSignature::append(std::string_view value)
+{
+  append(value.size());
+  append_bytes_(value.data(), value.size());
+  hash_combine(hash_, value);
+}
+
+void OperationSignature::append_bytes_(const void* data, std::size_t size)
+{
+  key_.append(static_cast<const char*>(data), size);
+}
+
+}  // namespace legate::detail
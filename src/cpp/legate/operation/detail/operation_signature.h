@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace legate::detail {
+
+/**
+ * @brief The structural description of an operation, by which automatic tracing and the strategy
+ * cache recognize repeated operations (see `Operation::signature()`).
+ *
+ * A signature is the sequence of values appended to it. Two signatures are equal only if the same
+ * values were appended to them in the same order, so unlike their hashes, equal signatures can't
+ * come from operations that differ in anything the signature covers.
+ */
+class OperationSignature {
+ public:
+  /**
+   * @brief Append an integral or enumeration value to the signature.
+   */
+  template <typename T, typename = std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>>
+  void append(T value);
+
+  /**
+   * @brief Append a string to the signature.
+   */
+  void append(std::string_view value);
+
+  /**
+   * @brief Append the number of values of a range, followed by the values themselves.
+   */
+  template <typename Range>
+  void append_all(const Range& values);
+
+  [[nodiscard]] std::size_t hash() const noexcept;
+
+  friend bool operator==(const OperationSignature& lhs, const OperationSignature& rhs);
+  friend bool operator!=(const OperationSignature& lhs, const OperationSignature& rhs);
+
+ private:
+  void append_bytes_(const void* data, std::size_t size);
+
+  // The appended values, with strings prefixed by their length so that no two sequences of values
+  // encode to the same bytes
+  std::string key_{};
+  std::size_t hash_{};
+};
+
+}  // namespace legate::detail
+
+#include <legate/operation/detail/operation_signature.inl>
@@ -0,0 +1,51 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/operation/detail/operation_signature.h>
+#include <legate/utilities/hash.h>
+
+#include <cstdint>
+
+namespace legate::detail {
+
+template <typename T, typename>
+void OperationSignature::append(T value)
+{
+  std::uint64_t word;
+
+  if constexpr (std::is_enum_v<T>) {
+    word = static_cast<std::uint64_t>(static_cast<std::underlying_type_t<T>>(value));
+  } else {
+    word = static_cast<std::uint64_t>(value);
+  }
+  append_bytes_(&word, sizeof(word));
+  hash_combine(hash_, word);
+}
+
+template <typename Range>
+void OperationSignature::append_all(const Range& values)
+{
+  append(values.size());
+  for (auto&& value : values) {
+    append(value);
+  }
+}
+
+inline std::size_t OperationSignature::hash() const noexcept { return hash_; }
+
+inline bool operator==(const OperationSignature& lhs, const OperationSignature& rhs)
+{
+  return lhs.hash_ == rhs.hash_ && lhs.key_ == rhs.key_;
+}
+
+inline bool operator!=(const OperationSignature& lhs, const OperationSignature& rhs)
+{
+  return !(lhs == rhs);
+}
+
+}  // namespace legate::detail
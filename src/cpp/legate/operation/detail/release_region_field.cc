@@ -22,4 +22,10 @@ bool ReleaseRegionField::supports_streaming() const
   return !(physical_state_->physical_region().exists() || physical_state_->has_callbacks());
 }
 
+bool ReleaseRegionField::exposes_contents() const
+{
+  return physical_state_->physical_region().exists() || physical_state_->has_attachment() ||
+         physical_state_->has_callbacks();
+}
+
 }  // namespace legate::detail
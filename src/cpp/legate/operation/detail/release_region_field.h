@@ -58,6 +58,13 @@ class ReleaseRegionField final : public Operation {
    */
   [[nodiscard]] bool supports_streaming() const override;
 
+  /**
+   * @return `true` if the contents of the region field may be observed outside of the runtime
+   * when it is released, i.e., if it is mapped, attached to an allocation, or has invalidation
+   * callbacks, `false` otherwise.
+   */
+  [[nodiscard]] bool exposes_contents() const;
+
  private:
   InternalSharedPtr<LogicalRegionField::PhysicalState> physical_state_{};
   bool unordered_{};
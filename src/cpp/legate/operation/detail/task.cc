@@ -11,9 +11,11 @@
 #include <legate/data/detail/logical_region_field.h>
 #include <legate/data/detail/logical_store.h>
 #include <legate/data/detail/physical_store.h>
+#include <legate/mapping/detail/default_mapper.h>
 #include <legate/mapping/detail/mapping.h>
 #include <legate/operation/detail/launcher_arg.h>
 #include <legate/operation/detail/task_launcher.h>
+#include <legate/partitioning/detail/constraint.h>
 #include <legate/partitioning/detail/constraint_solver.h>
 #include <legate/partitioning/detail/partition.h>
 #include <legate/partitioning/detail/partition/no_partition.h>
@@ -67,7 +69,8 @@ TaskBase::TaskBase(const Library& library,
     concurrent_{variant_info.options.concurrent},
     has_side_effect_{variant_info.options.has_side_effect},
     can_throw_exception_{variant_info.options.may_throw_exception},
-    can_elide_device_ctx_sync_{variant_info.options.elide_device_ctx_sync}
+    can_elide_device_ctx_sync_{variant_info.options.elide_device_ctx_sync},
+    stealable_{variant_info.options.stealable}
 {
   if (const auto& signature = variant_info.signature; signature.has_value()) {
     constexpr auto nargs_upper_limit = [](const std::optional<TaskSignature::Nargs>& nargs) {
@@ -190,6 +193,14 @@ void LogicalTask::add_communicator(std::string_view name, bool bypass_signature_
   }
 }
 
+bool LogicalTask::elidable() const
+{
+  return !has_side_effect_ && !can_throw_exception() && !concurrent_ &&
+         !variant_info_().options.communicators.has_value() &&
+         !(outputs_.empty() && reductions_.empty()) && unbound_outputs_.empty() &&
+         scalar_outputs_.empty() && scalar_reductions_.empty() && !streaming_gen_.has_value();
+}
+
 void LogicalTask::record_scalar_output(InternalSharedPtr<LogicalStore> store)
 {
   scalar_outputs_.push_back(std::move(store));
@@ -315,6 +326,7 @@ void LogicalTask::legion_launch_(Strategy* strategy_ptr)
 
   launcher.set_side_effect(has_side_effect_);
   launcher.set_concurrent(concurrent_);
+  launcher.set_stealable(stealable_);
   launcher.throws_exception(can_throw_exception());
   launcher.can_elide_device_ctx_sync(can_elide_device_ctx_sync());
   launcher.set_future_size(future_size);
@@ -588,6 +600,72 @@ void AutoTask::validate()
 
 void AutoTask::launch(Strategy* p_strategy) { launch_task_(p_strategy); }
 
+bool AutoTask::fusable() const
+{
+  const auto& vinfo   = variant_info_();
+  const auto& options = vinfo.options;
+
+  if (!options.fusable || options.has_allocations || options.communicators.has_value() ||
+      !vinfo.body || concurrent_ || has_side_effect_ || can_throw_exception() ||
+      !reductions_.empty() || !scalar_outputs().empty() || streaming_generation().has_value()) {
+    return false;
+  }
+  // Fused launches are mapped by the core mapper, which maps stores the same way as the default
+  // mapper. The store mappings chosen by any other mapper would be lost.
+  if (dynamic_cast<const mapping::detail::DefaultMapper*>(&library().get_mapper()) == nullptr) {
+    return false;
+  }
+
+  constexpr auto is_alignment = [](const InternalSharedPtr<Constraint>& constraint) {
+    return constraint->kind() == Constraint::Kind::ALIGNMENT;
+  };
+  // The fused launch aligns the stores of all members, so their shapes must already be known.
+  // Looking at the extents of any other store would block on the tasks producing them.
+  constexpr auto is_alignable = [](const TaskStoreArg& arg) {
+    auto&& store = std::get<InternalSharedPtr<LogicalStore>>(arg.store);
+
+    return store->shape()->ready() && !store->has_scalar_storage() && !store->needs_flush();
+  };
+
+  return std::all_of(constraints_.begin(), constraints_.end(), is_alignment) &&
+         std::all_of(inputs_.begin(), inputs_.end(), is_alignable) &&
+         std::all_of(outputs_.begin(), outputs_.end(), is_alignable);
+}
+
+std::optional<OperationSignature> AutoTask::signature() const
+{
+  // Partitioning by an image launches a task to compute the image bounds, outside of the
+  // scheduling pipeline, and tasks that can throw exceptions may need to be waited on
+  const auto is_image = [](const InternalSharedPtr<Constraint>& constraint) {
+    return constraint->kind() == Constraint::Kind::IMAGE;
+  };
+
+  // The shapes of unbound stores aren't known until the task has run
+  const auto is_unbound = [](const TaskStoreArg& arg) {
+    return std::get<InternalSharedPtr<LogicalStore>>(arg.store)->unbound();
+  };
+
+  if (can_throw_exception() || streaming_generation().has_value() ||
+      std::any_of(constraints_.begin(), constraints_.end(), is_image) ||
+      std::any_of(outputs_.begin(), outputs_.end(), is_unbound)) {
+    return std::nullopt;
+  }
+
+  auto result = make_signature_();
+
+  result.append(library().get_task_id(local_task_id()));
+  result.append(scalars().size());
+  for (auto&& scalar : scalars()) {
+    result.append(scalar->type()->code);
+  }
+  result.append_all(reduction_ops_);
+  result.append(constraints_.size());
+  for (auto&& constraint : constraints_) {
+    constraint->add_to_signature(result);
+  }
+  return result;
+}
+
 ////////////////////////////////////////////////////
 // legate::ManualTask
 ////////////////////////////////////////////////////
@@ -603,10 +681,10 @@ ManualTask::ManualTask(const Library& library,
     strategy_{make_internal_shared<Strategy>(this)}
 {
   if (Runtime::get_runtime().config().enable_inline_task_launch() &&
-      launch_domain.get_volume() > 1) {
+      launch_domain.get_volume() > 1 && this->machine().preferred_variant() == VariantCode::GPU) {
     LEGATE_ABORT(
-      fmt::format("ManualTask with inline task launch requires a single-point launch domain. "
-                  "Instead, got domain with volume {}",
+      fmt::format("ManualTask with inline task launch on GPUs requires a single-point launch "
+                  "domain. Instead, got domain with volume {}",
                   launch_domain.get_volume()));
   }
 
@@ -733,6 +811,12 @@ void ManualTask::add_store_(Legion::PrivilegeMode priv,
                             std::optional<SymbolicPoint> projection,
                             bool is_key_partition)
 {
+  if (projection.has_value() && strategy_->launch_domain().get_volume() > 1 &&
+      Runtime::get_runtime().config().enable_inline_task_launch()) {
+    throw TracedException<std::invalid_argument>{
+      "Projections are not supported by index launches executed inline"};
+  }
+
   const auto* partition_symbol = declare_partition();
 
   store_args.emplace_back(priv, store, partition_symbol);
@@ -801,8 +885,18 @@ void ManualTask::add_store_(Legion::PrivilegeMode priv,
 void ManualTask::launch()
 {
   if (Runtime::get_runtime().config().enable_inline_task_launch()) {
-    LEGATE_ASSERT(launch_domain().get_volume() == 1);
-    inline_task_body(*this, machine().preferred_variant(), variant_info_().body);
+    if (launch_domain().get_volume() == 1) {
+      inline_task_body(*this, machine().preferred_variant(), variant_info_().body);
+      return;
+    }
+    // The points of the launch run independently of each other, so they can't synchronize or
+    // communicate
+    if (concurrent_) {
+      throw TracedException<std::invalid_argument>{
+        "Concurrent tasks and tasks with communicators are not supported by index launches "
+        "executed inline"};
+    }
+    inline_index_task_body(*this, machine().preferred_variant(), variant_info_().body);
     return;
   }
 
@@ -166,6 +166,7 @@ class TaskBase : public Operation {
   bool has_side_effect_{};
   bool can_throw_exception_{};
   bool can_elide_device_ctx_sync_{};
+  bool stealable_{};
   SmallVector<InternalSharedPtr<Scalar>> scalars_{};
   SmallVector<TaskStoreArg> inputs_{};
   SmallVector<TaskStoreArg> outputs_{};
@@ -204,6 +205,21 @@ class LogicalTask : public TaskBase {
   void set_streaming_generation(std::optional<StreamingGeneration> streaming_gen);
   void add_communicator(std::string_view name, bool bypass_signature_check) override;
 
+  /**
+   * @brief Check whether the task may be dropped when all the stores it writes are discarded
+   * before they are read.
+   *
+   * The task must write at least one store, and must have no effect other than writing its
+   * stores: no side effects, exceptions, communicators, unbound outputs or stores backed by
+   * futures, the values of which are read without going through the scheduling window. Tasks
+   * in a streaming generation are never dropped, as the generation has a fixed size.
+   *
+   * @return `true` if the task may be dropped, `false` otherwise.
+   *
+   * @see eliminate_dead_operations().
+   */
+  [[nodiscard]] bool elidable() const;
+
   /**
    * @return The streaming generation if the task is a streaming task, `std::nullopt` otherwise.
    */
@@ -267,6 +283,32 @@ class AutoTask final : public LogicalTask {
    */
   [[nodiscard]] bool needs_partitioning() const override;
 
+  /**
+   * @brief Check whether the task may be fused with neighboring tasks.
+   *
+   * The variant must be marked fusable, and the task must not use any feature that a fused
+   * launch can't provide to each of its members: constraints other than alignments, reductions,
+   * stores backed by futures, unbound stores, communicators, allocations, exceptions, side
+   * effects or streaming. Fused launches are mapped by the core mapper, so the library of the
+   * task must not have a custom mapper either.
+   *
+   * @return `true` if the task may be fused, `false` otherwise.
+   *
+   * @see fuse_elementwise_tasks().
+   */
+  [[nodiscard]] bool fusable() const;
+
+  /**
+   * @brief Compute the signature of the task.
+   *
+   * In addition to the stores, the signature covers the task ID, the types of the scalar
+   * arguments, the reduction operators and the constraints. Tasks that can throw exceptions, have
+   * unbound outputs or have image constraints are never traced.
+   *
+   * @return The signature, or `std::nullopt` if the task must not be part of a trace.
+   */
+  [[nodiscard]] std::optional<OperationSignature> signature() const override;
+
  private:
   SmallVector<InternalSharedPtr<Constraint>> constraints_{};
 };
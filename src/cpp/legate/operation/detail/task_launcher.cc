@@ -264,6 +264,10 @@ void TaskLauncher::pack_mapper_arg_(BufferBuilder& buffer)
   static_assert(sizeof(std::uint32_t) >= sizeof(Legion::ShardingID));
   buffer.pack<std::uint32_t>(Runtime::get_runtime().get_sharding(machine_, key_projection_id_));
   buffer.pack(priority_);
+  // Concurrent leaf tasks must all be running at once, and streaming leaf tasks are scheduled
+  // column by column on their original targets, so neither can be moved around
+  buffer.pack<bool>((stealable_ || parallel_policy().work_stealing()) && !concurrent_ &&
+                    !streaming_generation().has_value());
 }
 
 void TaskLauncher::import_output_regions_(
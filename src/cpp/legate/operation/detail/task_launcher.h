@@ -96,6 +96,15 @@ class TaskLauncher {
   void set_priority(std::int32_t priority);
   void set_side_effect(bool has_side_effect);
   void set_concurrent(bool is_concurrent);
+  /**
+   * @brief Set whether the leaf tasks of this launch may be stolen by idle processors.
+   *
+   * Regardless of this flag, the leaf tasks can also be stolen when the parallel policy of the
+   * launch enables work stealing. Concurrent and streaming launches are never stolen.
+   *
+   * @param stealable `true` if the leaf tasks may be stolen, `false` otherwise.
+   */
+  void set_stealable(bool stealable);
   void set_insert_barrier(bool insert_barrier);
   /**
    * @brief Set the maximum future size of this task.
@@ -162,6 +171,7 @@ class TaskLauncher {
 
   bool has_side_effect_{true};
   bool concurrent_{};
+  bool stealable_{};
   bool insert_barrier_{};
   bool can_throw_exception_{};
   bool can_elide_device_ctx_sync_{};
@@ -44,6 +44,8 @@ inline void TaskLauncher::set_side_effect(bool has_side_effect)
   has_side_effect_ = has_side_effect;
 }
 
+inline void TaskLauncher::set_stealable(bool stealable) { stealable_ = stealable; }
+
 inline void TaskLauncher::set_insert_barrier(bool insert_barrier)
 {
   insert_barrier_ = insert_barrier;
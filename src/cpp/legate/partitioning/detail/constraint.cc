@@ -7,6 +7,7 @@
 #include <legate/partitioning/detail/constraint.h>
 
 #include <legate/operation/detail/operation.h>
+#include <legate/operation/detail/operation_signature.h>
 #include <legate/partitioning/detail/partition.h>
 #include <legate/partitioning/detail/partition/image.h>
 #include <legate/partitioning/detail/partition/no_partition.h>
@@ -69,6 +70,13 @@ void Alignment::validate() const
 
 std::string Alignment::to_string() const { return fmt::format("Align({}, {})", *lhs(), *rhs()); }
 
+void Alignment::add_to_signature(OperationSignature& signature) const
+{
+  signature.append(kind());
+  signature.append(lhs_->id());
+  signature.append(rhs_->id());
+}
+
 void Broadcast::find_partition_symbols(SmallVector<const Variable*>& partition_symbols) const
 {
   partition_symbols.push_back(variable_);
@@ -96,6 +104,13 @@ std::string Broadcast::to_string() const
   return fmt::format("Broadcast({}, {})", *variable(), axes());
 }
 
+void Broadcast::add_to_signature(OperationSignature& signature) const
+{
+  signature.append(kind());
+  signature.append(variable_->id());
+  signature.append_all(axes_);
+}
+
 void MinExtents::find_partition_symbols(SmallVector<const Variable*>& partition_symbols) const
 {
   partition_symbols.push_back(variable());
@@ -118,6 +133,13 @@ std::string MinExtents::to_string() const
   return fmt::format("MinExtents({}, {})", *variable(), minimum_extents());
 }
 
+void MinExtents::add_to_signature(OperationSignature& signature) const
+{
+  signature.append(kind());
+  signature.append(variable_->id());
+  signature.append_all(minimum_extents_);
+}
+
 void ImageConstraint::find_partition_symbols(SmallVector<const Variable*>& partition_symbols) const
 {
   partition_symbols.push_back(var_function_);
@@ -145,6 +167,14 @@ std::string ImageConstraint::to_string() const
   return fmt::format("ImageConstraint({}, {})", *var_function(), *var_range());
 }
 
+void ImageConstraint::add_to_signature(OperationSignature& signature) const
+{
+  signature.append(kind());
+  signature.append(var_function_->id());
+  signature.append(var_range_->id());
+  signature.append(hint_);
+}
+
 InternalSharedPtr<Partition> ImageConstraint::resolve(const detail::Strategy& strategy) const
 {
   const auto* src = var_function();
@@ -185,6 +215,14 @@ std::string ScaleConstraint::to_string() const
   return fmt::format("ScaleConstraint({}, {}, {})", factors(), *var_smaller(), *var_bigger());
 }
 
+void ScaleConstraint::add_to_signature(OperationSignature& signature) const
+{
+  signature.append(kind());
+  signature.append_all(factors_);
+  signature.append(var_smaller_->id());
+  signature.append(var_bigger_->id());
+}
+
 InternalSharedPtr<Partition> ScaleConstraint::resolve(const detail::Strategy& strategy) const
 {
   return strategy[*var_smaller()]->scale(factors_);
@@ -223,6 +261,15 @@ std::string BloatConstraint::to_string() const
                      high_offsets());
 }
 
+void BloatConstraint::add_to_signature(OperationSignature& signature) const
+{
+  signature.append(kind());
+  signature.append(var_source_->id());
+  signature.append(var_bloat_->id());
+  signature.append_all(low_offsets_);
+  signature.append_all(high_offsets_);
+}
+
 InternalSharedPtr<Partition> BloatConstraint::resolve(const detail::Strategy& strategy) const
 {
   return strategy[*var_source()]->bloat(low_offsets_, high_offsets_);
@@ -19,6 +19,7 @@
 namespace legate::detail {
 
 class Operation;
+class OperationSignature;
 class Partition;
 class Strategy;
 
@@ -62,6 +63,7 @@ class Constraint {
   [[nodiscard]] virtual std::string to_string() const                                        = 0;
   [[nodiscard]] virtual Kind kind() const                                                    = 0;
   virtual void validate() const                                                              = 0;
+  virtual void add_to_signature(OperationSignature& signature) const                         = 0;
 };
 
 class Alignment final : public Constraint {
@@ -69,6 +71,7 @@ class Alignment final : public Constraint {
   Alignment(const Variable* lhs, const Variable* rhs);
 
   [[nodiscard]] Kind kind() const override;
+  void add_to_signature(OperationSignature& signature) const override;
 
   void find_partition_symbols(SmallVector<const Variable*>& partition_symbols) const override;
 
@@ -93,6 +96,7 @@ class Broadcast final : public Constraint {
   Broadcast(const Variable* variable, SmallVector<std::uint32_t, LEGATE_MAX_DIM> axes);
 
   [[nodiscard]] Kind kind() const override;
+  void add_to_signature(OperationSignature& signature) const override;
 
   void find_partition_symbols(SmallVector<const Variable*>& partition_symbols) const override;
 
@@ -114,6 +118,7 @@ class MinExtents final : public Constraint {
   MinExtents(const Variable* variable, SmallVector<std::uint64_t, LEGATE_MAX_DIM> minimum_extents);
 
   [[nodiscard]] Kind kind() const override;
+  void add_to_signature(OperationSignature& signature) const override;
 
   void find_partition_symbols(SmallVector<const Variable*>& partition_symbols) const override;
 
@@ -136,6 +141,7 @@ class ImageConstraint final : public Constraint {
                   ImageComputationHint hint);
 
   [[nodiscard]] Kind kind() const override;
+  void add_to_signature(OperationSignature& signature) const override;
 
   void find_partition_symbols(SmallVector<const Variable*>& partition_symbols) const override;
 
@@ -161,6 +167,7 @@ class ScaleConstraint final : public Constraint {
                   const Variable* var_bigger);
 
   [[nodiscard]] Kind kind() const override;
+  void add_to_signature(OperationSignature& signature) const override;
 
   void find_partition_symbols(SmallVector<const Variable*>& partition_symbols) const override;
 
@@ -188,6 +195,7 @@ class BloatConstraint final : public Constraint {
                   SmallVector<std::uint64_t, LEGATE_MAX_DIM> high_offsets);
 
   [[nodiscard]] Kind kind() const override;
+  void add_to_signature(OperationSignature& signature) const override;
 
   void find_partition_symbols(SmallVector<const Variable*>& partition_symbols) const override;
 
@@ -6,6 +6,9 @@
 
 #include <legate/partitioning/detail/partition.h>
 
+#include <legate/partitioning/detail/partition/no_partition.h>
+#include <legate/partitioning/detail/partition/tiling.h>
+
 #include <iostream>
 
 namespace legate::detail {
@@ -16,4 +19,18 @@ std::ostream& operator<<(std::ostream& out, const Partition& partition)
   return out;
 }
 
+bool equivalent(const Partition& lhs, const Partition& rhs)
+{
+  if (&lhs == &rhs) {
+    return true;
+  }
+  if (const auto* lhs_tiling = dynamic_cast<const Tiling*>(&lhs); lhs_tiling != nullptr) {
+    const auto* rhs_tiling = dynamic_cast<const Tiling*>(&rhs);
+
+    return rhs_tiling != nullptr && *lhs_tiling == *rhs_tiling;
+  }
+  return dynamic_cast<const NoPartition*>(&lhs) != nullptr &&
+         dynamic_cast<const NoPartition*>(&rhs) != nullptr;
+}
+
 }  // namespace legate::detail
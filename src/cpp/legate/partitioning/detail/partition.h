@@ -163,4 +163,16 @@ class Partition {
 
 std::ostream& operator<<(std::ostream& out, const Partition& partition);
 
+/**
+ * @brief Checks whether two partitions divide stores the same way.
+ *
+ * Tilings are compared by value, and all `NoPartition`s are equivalent. Any other partition is
+ * only equivalent to itself.
+ *
+ * @param lhs The first partition.
+ * @param rhs The second partition.
+ * @return True if the partitions are equivalent.
+ */
+[[nodiscard]] bool equivalent(const Partition& lhs, const Partition& rhs);
+
 }  // namespace legate::detail
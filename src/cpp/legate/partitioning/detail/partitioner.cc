@@ -14,11 +14,14 @@
 #include <legate/partitioning/detail/partition.h>
 #include <legate/partitioning/detail/partition/no_partition.h>
 #include <legate/partitioning/detail/partition/opaque.h>
+#include <legate/partitioning/detail/strategy_cache.h>
 #include <legate/runtime/detail/projection.h>
 #include <legate/runtime/detail/region_manager.h>
 #include <legate/runtime/detail/runtime.h>
+#include <legate/utilities/span.h>
 
 #include <algorithm>
+#include <optional>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -214,6 +217,18 @@ void create_placeholder_partitions_for_unbound_stores(const Operation* op,
 
 Strategy Partitioner::partition_stores(Operation* op)
 {
+  auto& strategy_cache = Runtime::get_runtime().strategy_cache();
+  // Operations in streaming scopes are partitioned ahead of the rewrite that turns them into
+  // streaming tasks, so their strategies aren't reused
+  auto signature = op->parallel_policy().streaming() ? std::nullopt : op->signature();
+
+  if (signature.has_value()) {
+    if (auto cached = strategy_cache.find(op, *signature); cached.has_value()) {
+      cached->dump();
+      return *std::move(cached);
+    }
+  }
+
   ConstraintSolver solver;
 
   op->add_to_solver(solver);
@@ -237,6 +252,17 @@ Strategy Partitioner::partition_stores(Operation* op)
 
   strategy.dump();
 
+  // Partitioning unbound stores allocates fields for them, which must not be reused
+  const Span<const ConstraintSolver::EquivClass> equiv_classes = solver.equivalence_classes();
+  const auto is_unbound = [](const ConstraintSolver::EquivClass& equiv_class) {
+    return equiv_class.IS_UNBOUND;
+  };
+
+  if (signature.has_value() &&
+      std::none_of(equiv_classes.begin(), equiv_classes.end(), is_unbound)) {
+    strategy_cache.insert(*std::move(signature), strategy);
+  }
+
   return strategy;
 }
 
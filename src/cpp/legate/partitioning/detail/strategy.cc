@@ -67,6 +67,30 @@ const std::pair<Legion::FieldSpace, Legion::FieldID>& Strategy::find_field_for_u
   return finder->second;
 }
 
+Strategy Strategy::rebind(const Operation* operation) const
+{
+  const auto rebind_symbol = [&](const Variable& symbol) {
+    return Variable{operation, symbol.id()};
+  };
+  const auto rebind_map = [&](const auto& from, auto* to) {
+    to->reserve(from.size());
+    for (auto&& [symbol, value] : from) {
+      to->insert({rebind_symbol(symbol), value});
+    }
+  };
+  auto result = Strategy{operation};
+
+  result.launch_domain_ = launch_domain_;
+  rebind_map(assignments_, &result.assignments_);
+  rebind_map(fields_for_unbound_stores_, &result.fields_for_unbound_stores_);
+  rebind_map(color_spaces_for_unbound_stores_, &result.color_spaces_for_unbound_stores_);
+  rebind_map(projection_ids_, &result.projection_ids_);
+  if (key_partition_.has_value()) {
+    result.key_partition_ = rebind_symbol(*key_partition_);
+  }
+  return result;
+}
+
 void Strategy::dump() const
 {
   if (!log_legate_partitioner().want_debug()) {
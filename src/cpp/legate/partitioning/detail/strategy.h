@@ -47,6 +47,19 @@ class Strategy {
   [[nodiscard]] const std::pair<Legion::FieldSpace, Legion::FieldID>& find_field_for_unbound_store(
     const Variable& partition_symbol) const;
 
+  /**
+   * @brief Copy the strategy for another operation.
+   *
+   * Each partition symbol is replaced by the symbol of `operation` with the same ID, so the
+   * operation must declare its partition symbols in the same order as the one the strategy was
+   * computed for.
+   *
+   * @param operation The operation to copy the strategy for.
+   *
+   * @return The copy.
+   */
+  [[nodiscard]] Strategy rebind(const Operation* operation) const;
+
   void dump() const;
 
   class PrivateKey {
@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/partitioning/detail/strategy_cache.h>
+
+#include <legate/utilities/assert.h>
+
+#include <utility>
+
+namespace legate::detail {
+
+std::optional<Strategy> StrategyCache::find(const Operation* op,
+                                            const OperationSignature& signature)
+{
+  const auto it = entries_.find(signature);
+
+  if (it == entries_.end()) {
+    ++num_misses_;
+    return std::nullopt;
+  }
+  ++num_hits_;
+  recency_.splice(recency_.begin(), recency_, it->second.position);
+  return it->second.strategy.rebind(op);
+}
+
+void StrategyCache::insert(OperationSignature signature, const Strategy& strategy)
+{
+  auto unbound = strategy.rebind(nullptr);
+
+  if (const auto it = entries_.find(signature); it != entries_.end()) {
+    it->second.strategy = std::move(unbound);
+    recency_.splice(recency_.begin(), recency_, it->second.position);
+    return;
+  }
+
+  // Make room first, so that the new entry is never the one evicted
+  if (entries_.size() >= MAX_NUM_ENTRIES) {
+    const auto victim = entries_.find(*recency_.back());
+
+    LEGATE_ASSERT(victim != entries_.end());
+    recency_.pop_back();
+    entries_.erase(victim);
+    ++num_evictions_;
+  }
+
+  const auto it = entries_.try_emplace(std::move(signature), Entry{std::move(unbound)}).first;
+
+  try {
+    it->second.position = recency_.insert(recency_.begin(), &it->first);
+  } catch (...) {
+    // strong exception guarantee
+    entries_.erase(it);
+    throw;
+  }
+}
+
+}  // namespace legate::detail
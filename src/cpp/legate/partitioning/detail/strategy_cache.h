@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/operation/detail/operation_signature.h>
+#include <legate/partitioning/detail/strategy.h>
+#include <legate/utilities/hash.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <unordered_map>
+
+namespace legate::detail {
+
+class Operation;
+
+/**
+ * @brief Memoizes the strategies computed by the partitioner.
+ *
+ * Strategies are keyed by the signature of the operation they were computed for (see
+ * `Operation::signature()`), which covers everything the partitioner looks at: the kind
+ * of the operation, its task ID, machine and parallel policy, its constraints, and the storages
+ * and transforms of its stores, along with the epochs of their key partitions. A strategy
+ * found in the cache is therefore the one the partitioner would compute, and no explicit
+ * invalidation is needed: changing the key partition of a store changes its epoch, so the
+ * entries computed for the old key partition are simply no longer found. Entries keep the whole
+ * signature, not just its hash, so operations whose signatures merely collide never share a
+ * strategy.
+ *
+ * Strategies of operations with unbound stores are never cached, as partitioning them
+ * allocates fields for the stores.
+ */
+class StrategyCache {
+ public:
+  /**
+   * @brief The maximum number of strategies the cache keeps. Once the limit is reached, the
+   * least recently used strategy is evicted for each new one. Entries made unreachable by key
+   * partition changes are never used again, so they are the first to go.
+   */
+  static constexpr std::size_t MAX_NUM_ENTRIES = 1024;
+
+  /**
+   * @brief Look up the strategy of an operation.
+   *
+   * @param op The operation to partition.
+   * @param signature The signature of the operation.
+   *
+   * @return A copy of the cached strategy, rebound to `op`, or `std::nullopt` if the cache has
+   * no strategy for the signature.
+   */
+  [[nodiscard]] std::optional<Strategy> find(const Operation* op,
+                                              const OperationSignature& signature);
+
+  /**
+   * @brief Record the strategy computed for an operation.
+   *
+   * @param signature The signature of the operation.
+   * @param strategy The strategy the partitioner computed for the operation.
+   */
+  void insert(OperationSignature signature, const Strategy& strategy);
+
+  /**
+   * @brief Remove all strategies from the cache. The counters are left untouched.
+   */
+  void clear();
+
+  /**
+   * @return The number of lookups that found a strategy.
+   */
+  [[nodiscard]] std::uint64_t num_hits() const;
+  /**
+   * @return The number of lookups that didn't find a strategy.
+   */
+  [[nodiscard]] std::uint64_t num_misses() const;
+  /**
+   * @return The number of strategies evicted to make room for new ones.
+   */
+  [[nodiscard]] std::uint64_t num_evictions() const;
+  /**
+   * @return The number of strategies currently in the cache.
+   */
+  [[nodiscard]] std::size_t num_entries() const;
+
+ private:
+  // The cached strategies aren't bound to any operation, as the ones they were computed for may
+  // be long gone
+  class Entry {
+   public:
+    Strategy strategy;
+    // The position of the signature of the entry in `recency_`
+    std::list<const OperationSignature*>::iterator position{};
+  };
+
+  std::unordered_map<OperationSignature, Entry, hasher<OperationSignature>> entries_{};
+  // The signatures of the entries, which the nodes of `entries_` keep in place, from the most
+  // recently used to the least recently used
+  std::list<const OperationSignature*> recency_{};
+  std::uint64_t num_hits_{};
+  std::uint64_t num_misses_{};
+  std::uint64_t num_evictions_{};
+};
+
+}  // namespace legate::detail
+
+#include <legate/partitioning/detail/strategy_cache.inl>
@@ -0,0 +1,27 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/partitioning/detail/strategy_cache.h>
+
+namespace legate::detail {
+
+inline void StrategyCache::clear()
+{
+  entries_.clear();
+  recency_.clear();
+}
+
+inline std::uint64_t StrategyCache::num_hits() const { return num_hits_; }
+
+inline std::uint64_t StrategyCache::num_misses() const { return num_misses_; }
+
+inline std::uint64_t StrategyCache::num_evictions() const { return num_evictions_; }
+
+inline std::size_t StrategyCache::num_entries() const { return entries_.size(); }
+
+}  // namespace legate::detail
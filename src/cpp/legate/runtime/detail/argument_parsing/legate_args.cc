@@ -29,6 +29,7 @@
 #include <fmt/core.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <stdexcept>
 #include <vector>
 
@@ -79,6 +80,12 @@ Config prefill_config(const ParsedArgs& args)
   cfg.set_disable_mpi(args.disable_mpi.value());
   cfg.set_io_use_vfd_gds(args.io_use_vfd_gds.value());
   cfg.set_experimental_copy_path(args.experimental_copy_path.value());
+  cfg.set_mapper_profiling(args.mapper_profiling.value());
+  cfg.set_auto_trace(args.auto_trace.value());
+  cfg.set_launch_thread(args.launch_thread.value());
+  cfg.set_adaptive_window(args.adaptive_window.value());
+  cfg.set_streaming_read_ahead(
+    static_cast<std::uint64_t>(args.streaming_read_ahead.value().scaled_value()));
   // Disable MPI in legate if the network bootstrap is p2p
   if (REALM_UCP_BOOTSTRAP_MODE.get() == "p2p") {
     cfg.set_disable_mpi(true);
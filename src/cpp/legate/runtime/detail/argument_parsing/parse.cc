@@ -125,6 +125,11 @@ std::string ParsedArgs::config_summary() const
   print_var(freeze_on_error);
   print_var(cuda_driver_path);
   print_var(experimental_copy_path);
+  print_var(mapper_profiling);
+  print_var(auto_trace);
+  print_var(launch_thread);
+  print_var(adaptive_window);
+  print_var(streaming_read_ahead);
   ret += "==============================================";
   return ret;
 }
@@ -831,6 +836,50 @@ ParsedArgs parse_args(std::vector<std::string> args)
 
   experimental_copy_path.argparse_argument().hidden();
 
+  auto mapper_profiling = parser.add_argument(
+    "--mapper-profiling",
+    "Collect profiling feedback on task executions in the mapper, and use it to balance the point "
+    "tasks of index launches across processors by their measured throughput.",
+    /*init=*/false);
+
+  mapper_profiling.argparse_argument().hidden();
+
+  auto auto_trace = parser.add_argument(
+    "--auto-trace",
+    "Detect repeated sequences of operations, such as the bodies of loops, and trace them "
+    "automatically, so that Legion can memoize their dependence analysis.",
+    /*init=*/false);
+
+  auto_trace.argparse_argument().hidden();
+
+  auto launch_thread = parser.add_argument(
+    "--launch-thread",
+    "Partition and launch operations on a dedicated thread, so that the application thread "
+    "returns from submitting a task while the runtime processes the operations submitted "
+    "before it. Blocking calls wait for the submitted operations to be launched.",
+    /*init=*/false);
+
+  launch_thread.argparse_argument().hidden();
+
+  auto adaptive_window = parser.add_argument(
+    "--adaptive-window",
+    "Size the scheduling window adaptively, starting from --window-size. The window grows while "
+    "operations are submitted faster than they are launched, and shrinks when operations wait in "
+    "it for longer than it takes to launch them.",
+    /*init=*/false);
+
+  adaptive_window.argparse_argument().hidden();
+
+  auto streaming_read_ahead = parser.add_scaled_argument(
+    "--streaming-read-ahead",
+    "Size (in MiB) of memory per processor that the I/O read tasks of a streaming scope may use "
+    "to read the data of the next column ahead, while the current column is being processed. 0 "
+    "disables read-ahead.",
+    Scaled{std::int64_t{0}, MB, "MiB"});
+
+  streaming_read_ahead.action(CheckNonNegative{"Size (in MiB) of the streaming read-ahead"});
+  streaming_read_ahead.argparse_argument().hidden();
+
   parser.parse_args(std::move(args));
 
   const auto add_logger = [&](std::string_view logger, std::string_view level = "info") {
@@ -892,7 +941,12 @@ ParsedArgs parse_args(std::vector<std::string> args)
           /* log_to_file */ std::move(log_to_file),
           /* freeze_on_error */ std::move(freeze_on_error),
           /* cuda_driver_path */ std::move(cuda_driver_path),
-          /* experimental_copy_path */ std::move(experimental_copy_path)};
+          /* experimental_copy_path */ std::move(experimental_copy_path),
+          /* mapper_profiling */ std::move(mapper_profiling),
+          /* auto_trace */ std::move(auto_trace),
+          /* launch_thread */ std::move(launch_thread),
+          /* adaptive_window */ std::move(adaptive_window),
+          /* streaming_read_ahead */ std::move(streaming_read_ahead)};
 }
 
 }  // namespace legate::detail
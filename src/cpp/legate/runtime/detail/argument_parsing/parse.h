@@ -57,6 +57,11 @@ class ParsedArgs {
   Argument<bool> freeze_on_error;
   Argument<std::string> cuda_driver_path;
   Argument<bool> experimental_copy_path;
+  Argument<bool> mapper_profiling;
+  Argument<bool> auto_trace;
+  Argument<bool> launch_thread;
+  Argument<bool> adaptive_window;
+  Argument<Scaled<std::int64_t>> streaming_read_ahead;
 
   /**
    * @brief Return a summary of the current configuration options suitable for printing.
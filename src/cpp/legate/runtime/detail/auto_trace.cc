@@ -0,0 +1,204 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/runtime/detail/auto_trace.h>
+
+#include <legate/operation/detail/operation.h>
+#include <legate/runtime/detail/runtime.h>
+#include <legate/utilities/assert.h>
+#include <legate/utilities/scope_guard.h>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace legate::detail {
+
+std::optional<std::vector<std::size_t>> RepetitionDetector::record(std::size_t signature)
+{
+  history_.push_back(signature);
+  if (history_.size() > 2 * MAX_LENGTH) {
+    history_.pop_front();
+  }
+
+  const auto size = history_.size();
+  const auto last = history_.end();
+
+  for (auto length = MIN_LENGTH; length <= MAX_LENGTH && 2 * length <= size; ++length) {
+    const auto length_diff = static_cast<std::ptrdiff_t>(length);
+    const auto second      = last - length_diff;
+    const auto first       = second - length_diff;
+
+    // Comparing the newest operation first rules out most lengths right away
+    if (*(last - 1) == *(second - 1) && std::equal(first, second, second)) {
+      auto sequence = std::vector<std::size_t>{second, last};
+
+      history_.clear();
+      return sequence;
+    }
+  }
+  return std::nullopt;
+}
+
+// ==========================================================================================
+
+void AutoTracer::set_enabled(bool enabled)
+{
+  if (!enabled) {
+    drain();
+  }
+  detector_.reset();
+  enabled_ = enabled;
+}
+
+void AutoTracer::begin_manual_trace()
+{
+  drain();
+  detector_.reset();
+  ++manual_trace_depth_;
+}
+
+void AutoTracer::end_manual_trace()
+{
+  LEGATE_ASSERT(manual_trace_depth_ > 0);
+  --manual_trace_depth_;
+}
+
+void AutoTracer::submit(InternalSharedPtr<Operation> op)
+{
+  if (replaying_) {
+    deferred_.emplace_back(std::move(op));
+    return;
+  }
+
+  // Operations that flush the scheduling window right away, and operations in streaming scopes,
+  // which the flush rewrites, are never traced
+  const auto signature = op->needs_flush() || op->parallel_policy().streaming()
+                           ? std::nullopt
+                           : op->trace_signature();
+
+  if (!signature.has_value()) {
+    drain();
+    // No trace may span an operation that can't be traced
+    detector_.reset();
+    launch_untraced_(std::move(op), std::nullopt);
+    return;
+  }
+
+  if (candidate_.has_value()) {
+    const auto& expected = traces_.at(*candidate_).signatures;
+
+    if (expected[held_.size()] == *signature) {
+      held_.emplace_back(std::move(op), *signature);
+      if (held_.size() == expected.size()) {
+        replay_();
+      }
+      return;
+    }
+    miss_();
+  }
+
+  if (traces_.find(*signature) != traces_.end()) {
+    candidate_ = *signature;
+    held_.emplace_back(std::move(op), *signature);
+    return;
+  }
+  launch_untraced_(std::move(op), signature);
+}
+
+void AutoTracer::drain()
+{
+  if (candidate_.has_value()) {
+    miss_();
+  }
+}
+
+void AutoTracer::launch_untraced_(InternalSharedPtr<Operation> op,
+                                  std::optional<std::size_t> signature)
+{
+  Runtime::get_runtime().submit_untraced(std::move(op), Runtime::PrivateKey{});
+  if (!signature.has_value()) {
+    return;
+  }
+  if (auto sequence = detector_.record(*signature); sequence.has_value()) {
+    add_trace_(*std::move(sequence));
+  }
+}
+
+void AutoTracer::add_trace_(std::vector<std::size_t> signatures)
+{
+  const auto first = signatures.front();
+
+  if (const auto it = traces_.find(first); it != traces_.end()) {
+    if (it->second.signatures == signatures) {
+      return;
+    }
+  } else if (traces_.size() >= MAX_NUM_TRACES) {
+    return;
+  }
+
+  auto& runtime = Runtime::get_runtime();
+  // A trace starting with the same operation is replaced, as the held operations can only be
+  // matched against one trace
+  auto& trace = traces_[first];
+
+  trace.trace_id           = runtime.get_legion_runtime()->generate_dynamic_trace_id();
+  trace.signatures         = std::move(signatures);
+  trace.consecutive_misses = 0;
+}
+
+void AutoTracer::miss_()
+{
+  const auto it = traces_.find(*candidate_);
+
+  ++num_misses_;
+  if (++it->second.consecutive_misses >= MAX_CONSECUTIVE_MISSES) {
+    traces_.erase(it);
+  }
+  candidate_.reset();
+  // Launching the operations may flush the scheduling window, which calls drain(), so the held
+  // operations must be taken out first
+  for (auto&& [op, signature] : std::exchange(held_, {})) {
+    launch_untraced_(std::move(op), signature);
+  }
+}
+
+void AutoTracer::replay_()
+{
+  auto& runtime       = Runtime::get_runtime();
+  auto& trace         = traces_.at(*candidate_);
+  const auto trace_id = trace.trace_id;
+  auto held           = std::exchange(held_, {});
+
+  trace.consecutive_misses = 0;
+  candidate_.reset();
+  detector_.reset();
+  ++num_hits_;
+
+  // The operations submitted before the held ones must not be part of the trace
+  runtime.flush_scheduling_window();
+  // Only memoize the dependence analysis. Physical traces also memoize the mapping, which
+  // requires the tasks to have return sizes known at registration, which Legate tasks don't.
+  runtime.get_legion_runtime()->begin_trace(
+    runtime.get_legion_context(), trace_id, /*logical_only=*/true);
+  replaying_ = true;
+  {
+    LEGATE_SCOPE_GUARD(
+      runtime.get_legion_runtime()->end_trace(runtime.get_legion_context(), trace_id);
+      replaying_ = false;);
+
+    for (auto&& [op, _] : held) {
+      runtime.submit_untraced(std::move(op), Runtime::PrivateKey{});
+    }
+    runtime.flush_scheduling_window();
+  }
+  // Operations submitted during the replay, e.g. by the destructors of the replayed operations,
+  // may differ from one replay to the next, so they are launched after the trace
+  for (auto&& op : std::exchange(deferred_, {})) {
+    submit(std::move(op));
+  }
+}
+
+}  // namespace legate::detail
@@ -0,0 +1,165 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/utilities/internal_shared_ptr.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace legate::detail {
+
+class Operation;
+
+/**
+ * @brief Detects sequences of operations that repeat back to back, such as the body of a loop.
+ */
+class RepetitionDetector {
+ public:
+  /**
+   * @brief The length of the shortest sequence the detector reports. Loops with shorter bodies
+   * are detected as several iterations.
+   */
+  static constexpr std::size_t MIN_LENGTH = 4;
+  /**
+   * @brief The length of the longest sequence the detector reports.
+   */
+  static constexpr std::size_t MAX_LENGTH = 256;
+
+  /**
+   * @brief Record the signature of an operation.
+   *
+   * @param signature The trace signature of the operation.
+   *
+   * @return The signatures of the shortest sequence of which the newest operations form two
+   * back-to-back occurrences, or `std::nullopt` if there is no such sequence. Once a sequence is
+   * reported, the operations recorded so far are forgotten.
+   */
+  [[nodiscard]] std::optional<std::vector<std::size_t>> record(std::size_t signature);
+
+  /**
+   * @brief Forget the operations recorded so far, so that no reported sequence spans the
+   * operations recorded before and after the call.
+   */
+  void reset();
+
+ private:
+  std::deque<std::size_t> history_{};
+};
+
+/**
+ * @brief Wraps repeated sequences of operations in Legion traces, without the user having to
+ * mark them.
+ *
+ * The tracer sits in front of the scheduling window. Operations pass through it untraced, and
+ * their signatures (see `Operation::trace_signature()`) are fed to a `RepetitionDetector`. Each
+ * sequence the detector reports becomes a trace, with an ID of its own.
+ *
+ * When an operation matches the first operation of a known trace, the tracer holds it back, as
+ * well as the following operations for as long as they match the trace. Once the whole
+ * sequence has been submitted, the held operations are launched inside a Legion trace, so that
+ * Legion can replay the dependence analysis it recorded for them.
+ *
+ * If an operation doesn't match, or if anything flushes the scheduling window while operations
+ * are held back, the held operations are launched untraced, in the order they were submitted.
+ * Since no operation of a trace is launched before the whole trace is known to match, a
+ * divergent sequence never reaches Legion as part of a trace. A trace that misses
+ * `MAX_CONSECUTIVE_MISSES` times in a row is forgotten.
+ */
+class AutoTracer {
+ public:
+  /**
+   * @brief The maximum number of traces the tracer keeps. Once the limit is reached, newly
+   * detected sequences are ignored until a trace is forgotten.
+   */
+  static constexpr std::size_t MAX_NUM_TRACES = 64;
+  static constexpr std::uint32_t MAX_CONSECUTIVE_MISSES = 3;
+
+  /**
+   * @return `true` if operations should be submitted to the tracer, `false` if they should go
+   * straight to the scheduling window.
+   */
+  [[nodiscard]] bool active() const;
+  [[nodiscard]] bool enabled() const;
+  /**
+   * @brief Turn automatic tracing on or off. Operations held back are launched untraced when
+   * tracing is turned off.
+   */
+  void set_enabled(bool enabled);
+
+  /**
+   * @brief Inform the tracer that the user opened a trace. Automatic tracing is suspended until
+   * the matching `end_manual_trace()`, as Legion traces can't be nested.
+   */
+  void begin_manual_trace();
+  void end_manual_trace();
+
+  /**
+   * @brief Submit an operation.
+   *
+   * @param op The operation to submit.
+   */
+  void submit(InternalSharedPtr<Operation> op);
+
+  /**
+   * @brief Launch the operations held back, untraced. Must be called before the scheduling
+   * window is flushed.
+   */
+  void drain();
+
+  /**
+   * @return The number of times a trace was replayed.
+   */
+  [[nodiscard]] std::uint64_t num_hits() const;
+  /**
+   * @return The number of times operations were held back for a trace, but were then launched
+   * untraced.
+   */
+  [[nodiscard]] std::uint64_t num_misses() const;
+  /**
+   * @return The number of traces the tracer currently knows.
+   */
+  [[nodiscard]] std::size_t num_traces() const;
+
+ private:
+  class Trace {
+   public:
+    std::uint32_t trace_id{};
+    std::vector<std::size_t> signatures{};
+    std::uint32_t consecutive_misses{};
+  };
+
+  using HeldOperation = std::pair<InternalSharedPtr<Operation>, std::size_t>;
+
+  void launch_untraced_(InternalSharedPtr<Operation> op, std::optional<std::size_t> signature);
+  void add_trace_(std::vector<std::size_t> signatures);
+  void miss_();
+  void replay_();
+
+  bool enabled_{};
+  std::uint32_t manual_trace_depth_{};
+  bool replaying_{};
+  RepetitionDetector detector_{};
+  // Keyed by the signature of the first operation
+  std::unordered_map<std::size_t, Trace> traces_{};
+  // The trace the held operations are matched against
+  std::optional<std::size_t> candidate_{};
+  std::vector<HeldOperation> held_{};
+  // Operations submitted while a trace is being replayed, which must not become part of it
+  std::vector<InternalSharedPtr<Operation>> deferred_{};
+  std::uint64_t num_hits_{};
+  std::uint64_t num_misses_{};
+};
+
+}  // namespace legate::detail
+
+#include <legate/runtime/detail/auto_trace.inl>
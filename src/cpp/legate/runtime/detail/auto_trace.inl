@@ -0,0 +1,27 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/runtime/detail/auto_trace.h>
+
+namespace legate::detail {
+
+inline void RepetitionDetector::reset() { history_.clear(); }
+
+// ==========================================================================================
+
+inline bool AutoTracer::active() const { return enabled() && manual_trace_depth_ == 0; }
+
+inline bool AutoTracer::enabled() const { return enabled_; }
+
+inline std::uint64_t AutoTracer::num_hits() const { return num_hits_; }
+
+inline std::uint64_t AutoTracer::num_misses() const { return num_misses_; }
+
+inline std::size_t AutoTracer::num_traces() const { return traces_.size(); }
+
+}  // namespace legate::detail
@@ -53,6 +53,11 @@ class LEGATE_PYTHON_EXPORT Config {
   LEGATE_CONFIG_VAR(std::string, profile_name, std::string{"legate"});
   LEGATE_CONFIG_VAR(bool, provenance, false);
   LEGATE_CONFIG_VAR(bool, experimental_copy_path, false);
+  LEGATE_CONFIG_VAR(bool, mapper_profiling, false);
+  LEGATE_CONFIG_VAR(bool, auto_trace, false);
+  LEGATE_CONFIG_VAR(bool, launch_thread, false);
+  LEGATE_CONFIG_VAR(bool, adaptive_window, false);
+  LEGATE_CONFIG_VAR(std::uint64_t, streaming_read_ahead, 0);
 };
 
 #undef LEGATE_CONFIG_VAR
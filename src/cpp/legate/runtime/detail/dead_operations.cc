@@ -0,0 +1,190 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/runtime/detail/dead_operations.h>
+
+#include <legate/data/detail/logical_region_field.h>
+#include <legate/data/detail/logical_store.h>
+#include <legate/data/detail/storage.h>
+#include <legate/operation/detail/discard.h>
+#include <legate/operation/detail/fill.h>
+#include <legate/operation/detail/operation.h>
+#include <legate/operation/detail/release_region_field.h>
+#include <legate/operation/detail/task.h>
+#include <legate/utilities/abort.h>
+#include <legate/utilities/assert.h>
+#include <legate/utilities/detail/type_traits.h>
+#include <legate/utilities/hash.h>
+#include <legate/utilities/typedefs.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace legate::detail {
+
+namespace {
+
+using FieldKey     = std::pair<Legion::FieldID, Legion::LogicalRegion>;
+using DeadFieldSet = std::unordered_set<FieldKey, hasher<>>;
+
+/**
+ * @return The root region field of the store, in the form `Discard` operations name it, or
+ * `std::nullopt` if the store isn't backed by a region field yet. The region field is only looked
+ * up, never created.
+ */
+[[nodiscard]] std::optional<FieldKey> field_key(const LogicalStore& store)
+{
+  const auto* const root = store.get_storage()->get_root();
+
+  // The region fields of unbound stores only come into existence when their producers run
+  if (root->unbound() || root->deferred_bound()) {
+    return std::nullopt;
+  }
+
+  const auto rf = root->find_region_field();
+
+  if (!rf.has_value()) {
+    return std::nullopt;
+  }
+
+  auto&& root_rf = rf->get().get_root();
+
+  return {{root_rf.field_id(), root_rf.region()}};
+}
+
+[[nodiscard]] std::optional<FieldKey> field_key(const TaskStoreArg& arg)
+{
+  const auto* const store = std::get_if<InternalSharedPtr<LogicalStore>>(&arg.store);
+
+  if (!store) {
+    return std::nullopt;
+  }
+  return field_key(**store);
+}
+
+[[nodiscard]] bool is_dead(const std::optional<FieldKey>& key, const DeadFieldSet& dead_fields)
+{
+  return key.has_value() && dead_fields.find(*key) != dead_fields.end();
+}
+
+[[nodiscard]] bool is_dead_task(const LogicalTask& task, const DeadFieldSet& dead_fields)
+{
+  const auto writes_dead_field = [&](const TaskStoreArg& arg) {
+    return is_dead(field_key(arg), dead_fields);
+  };
+
+  return task.elidable() &&
+         std::all_of(task.outputs().begin(), task.outputs().end(), writes_dead_field) &&
+         std::all_of(task.reductions().begin(), task.reductions().end(), writes_dead_field);
+}
+
+void record_task_reads(const LogicalTask& task, DeadFieldSet* dead_fields)
+{
+  const auto record_read = [&](const TaskStoreArg& arg) {
+    if (const auto key = field_key(arg); key.has_value()) {
+      dead_fields->erase(*key);
+    }
+  };
+
+  // Reductions combine the values they produce with the existing ones, so they read the store
+  std::for_each(task.inputs().begin(), task.inputs().end(), record_read);
+  std::for_each(task.reductions().begin(), task.reductions().end(), record_read);
+}
+
+/**
+ * @brief Check whether an operation only writes dead fields, and update the set of dead fields
+ * to the point right before the operation otherwise.
+ *
+ * @param op The operation to check.
+ * @param dead_fields The fields that are dead right after the operation.
+ *
+ * @return `true` if the operation can be removed, `false` otherwise.
+ */
+[[nodiscard]] bool is_dead_operation(const Operation& op, DeadFieldSet* dead_fields)
+{
+  switch (op.kind()) {
+    case Operation::Kind::DISCARD: {
+      const auto& discard = static_cast<const Discard&>(op);
+
+      dead_fields->emplace(discard.field_id(), discard.region());
+      return false;
+    }
+    case Operation::Kind::FILL: {
+      const auto& fill = static_cast<const Fill&>(op);
+
+      return is_dead(field_key(*fill.lhs()), *dead_fields);
+    }
+    case Operation::Kind::AUTO_TASK: [[fallthrough]];
+    case Operation::Kind::MANUAL_TASK: {
+      LEGATE_ASSERT(dynamic_cast<const LogicalTask*>(&op) != nullptr);
+
+      const auto& task = static_cast<const LogicalTask&>(op);
+
+      if (is_dead_task(task, *dead_fields)) {
+        return true;
+      }
+      record_task_reads(task, dead_fields);
+      return false;
+    }
+    case Operation::Kind::RELEASE_REGION_FIELD: {
+      // The region field being released is usually the one discarded right after
+      if (static_cast<const ReleaseRegionField&>(op).exposes_contents()) {
+        dead_fields->clear();
+      }
+      return false;
+    }
+    case Operation::Kind::EXECUTION_FENCE: [[fallthrough]];
+    case Operation::Kind::MAPPING_FENCE: [[fallthrough]];
+    case Operation::Kind::TIMING: return false;
+    // These operations aren't analyzed, so we conservatively assume they read every field
+    case Operation::Kind::ATTACH: [[fallthrough]];
+    case Operation::Kind::COPY: [[fallthrough]];
+    case Operation::Kind::GATHER: [[fallthrough]];
+    case Operation::Kind::INDEX_ATTACH: [[fallthrough]];
+    case Operation::Kind::PHYSICAL_TASK: [[fallthrough]];
+    case Operation::Kind::REDUCE: [[fallthrough]];
+    case Operation::Kind::SCATTER: [[fallthrough]];
+    case Operation::Kind::SCATTER_GATHER: {
+      dead_fields->clear();
+      return false;
+    }
+  }
+  LEGATE_ABORT("Unhandled operation kind: ", to_underlying(op.kind()));
+}
+
+}  // namespace
+
+void eliminate_dead_operations(std::deque<InternalSharedPtr<Operation>>* window)
+{
+  auto dead_fields = DeadFieldSet{};
+  // The removed operations may release the last references to stores, which submits new
+  // operations to the window, so they must outlive the scan
+  auto removed = std::vector<InternalSharedPtr<Operation>>{};
+
+  // The scan goes backwards, so that a field is dead at the point of an operation if it is
+  // discarded later in the window, with no operation reading it in between
+  for (auto idx = window->size(); idx > 0; --idx) {
+    const auto it = std::next(window->begin(), static_cast<std::ptrdiff_t>(idx - 1));
+
+    if (!is_dead_operation(**it, &dead_fields)) {
+      continue;
+    }
+    if (log_legate().want_debug()) {
+      log_legate().debug() << (*it)->to_string(true /*show_provenance*/)
+                           << " eliminated, as it only writes discarded stores";
+    }
+    removed.emplace_back(std::move(*it));
+    window->erase(it);
+  }
+}
+
+}  // namespace legate::detail
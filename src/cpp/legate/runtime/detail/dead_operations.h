@@ -0,0 +1,36 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/utilities/internal_shared_ptr.h>
+
+#include <deque>
+
+namespace legate::detail {
+
+class Operation;
+
+/**
+ * @brief Remove the operations in a scheduling window whose results are never read.
+ *
+ * A store is dead from the point its storage is discarded (usually because the store was
+ * destroyed) back to the last operation that reads it. The following operations are removed if
+ * they only write dead stores:
+ *
+ * 1. Fills.
+ * 2. Tasks that may be dropped without changing the results of the program (see
+ *    `LogicalTask::elidable()`).
+ *
+ * Stores are tracked by the root region field of their storage, so a read of any view of a
+ * storage keeps all writes to that storage alive. Operations other than fills, tasks, discards
+ * and fences are not analyzed, so no write submitted before them is removed.
+ *
+ * @param window The operations to analyze, in submission order.
+ */
+void eliminate_dead_operations(std::deque<InternalSharedPtr<Operation>>* window);
+
+}  // namespace legate::detail
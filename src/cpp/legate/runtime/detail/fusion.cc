@@ -0,0 +1,283 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/runtime/detail/fusion.h>
+
+#include <legate/data/detail/logical_store.h>
+#include <legate/data/detail/storage.h>
+#include <legate/data/scalar.h>
+#include <legate/operation/detail/fused_task.h>
+#include <legate/operation/detail/operation.h>
+#include <legate/operation/detail/task.h>
+#include <legate/partitioning/detail/constraint.h>
+#include <legate/runtime/detail/library.h>
+#include <legate/runtime/detail/runtime.h>
+#include <legate/task/detail/task_info.h>
+#include <legate/utilities/assert.h>
+#include <legate/utilities/detail/small_vector.h>
+#include <legate/utilities/detail/type_traits.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace legate::detail {
+
+namespace {
+
+[[nodiscard]] const InternalSharedPtr<LogicalStore>& logical_store(const TaskStoreArg& arg)
+{
+  return std::get<InternalSharedPtr<LogicalStore>>(arg.store);
+}
+
+// A run of consecutive tasks to fuse into one launch
+class FusionRun {
+ public:
+  [[nodiscard]] bool empty() const;
+  [[nodiscard]] Span<const InternalSharedPtr<AutoTask>> tasks() const;
+
+  /**
+   * @brief Check whether a fusable task may join the run. See fuse_elementwise_tasks() for the
+   * criteria.
+   */
+  [[nodiscard]] bool accepts(const AutoTask& task) const;
+  void append(InternalSharedPtr<AutoTask> task);
+  void clear();
+
+  /**
+   * @brief Create the launch that runs all tasks of the run.
+   */
+  [[nodiscard]] InternalSharedPtr<AutoTask> fuse() const;
+
+ private:
+  // How the tasks of the run access a storage
+  class Access {
+   public:
+    const LogicalStore* store{};
+    bool written{};
+    // Set if the storage is accessed through more than one store
+    bool aliased{};
+  };
+
+  [[nodiscard]] bool conflicts_(const TaskStoreArg& arg, bool write) const;
+  void record_(const TaskStoreArg& arg, bool write);
+
+  SmallVector<InternalSharedPtr<AutoTask>> tasks_{};
+  SmallVector<std::uint64_t, LEGATE_MAX_DIM> extents_{};
+  std::unordered_map<const Storage*, Access> accesses_{};
+};
+
+bool FusionRun::empty() const { return tasks_.empty(); }
+
+Span<const InternalSharedPtr<AutoTask>> FusionRun::tasks() const { return tasks_; }
+
+bool FusionRun::accepts(const AutoTask& task) const
+{
+  // A task without stores is launched once, not once per leaf task of the run
+  if (task.inputs().empty() && task.outputs().empty()) {
+    return false;
+  }
+  if (!empty()) {
+    const auto& first = *tasks_.front();
+
+    // The fused launch takes the machine, priority and parallel policy of the first task of the
+    // run, so all tasks of the run must share them
+    if (!(task.machine() == first.machine()) || task.priority() != first.priority() ||
+        !(task.parallel_policy() == first.parallel_policy())) {
+      return false;
+    }
+  }
+
+  auto extents       = extents_;
+  auto have_extents  = !empty();
+  const auto matches = [&](const TaskStoreArg& arg, bool write) {
+    const auto store_extents = logical_store(arg)->extents();
+
+    if (!have_extents) {
+      extents.assign(tags::iterator_tag, store_extents.begin(), store_extents.end());
+      have_extents = true;
+    } else if (!std::equal(
+                 store_extents.begin(), store_extents.end(), extents.begin(), extents.end())) {
+      return false;
+    }
+    return !conflicts_(arg, write);
+  };
+
+  return std::all_of(task.inputs().begin(),
+                     task.inputs().end(),
+                     [&](const TaskStoreArg& arg) { return matches(arg, /*write=*/false); }) &&
+         std::all_of(task.outputs().begin(), task.outputs().end(), [&](const TaskStoreArg& arg) {
+           return matches(arg, /*write=*/true);
+         });
+}
+
+void FusionRun::append(InternalSharedPtr<AutoTask> task)
+{
+  if (empty()) {
+    const auto& first_arg =
+      task->inputs().empty() ? task->outputs().front() : task->inputs().front();
+    const auto extents = logical_store(first_arg)->extents();
+
+    extents_.assign(tags::iterator_tag, extents.begin(), extents.end());
+  }
+  for (auto&& arg : task->inputs()) {
+    record_(arg, /*write=*/false);
+  }
+  for (auto&& arg : task->outputs()) {
+    record_(arg, /*write=*/true);
+  }
+  tasks_.emplace_back(std::move(task));
+}
+
+void FusionRun::clear()
+{
+  tasks_.clear();
+  extents_.clear();
+  accesses_.clear();
+}
+
+bool FusionRun::conflicts_(const TaskStoreArg& arg, bool write) const
+{
+  const auto& store = logical_store(arg);
+  const auto it     = accesses_.find(store->get_storage()->get_root());
+
+  if (it == accesses_.end()) {
+    return false;
+  }
+
+  const auto& access = it->second;
+
+  // Accesses through the same store touch the same part of the storage in each leaf task. Any
+  // other view (a slice, a transpose, etc.) may touch the parts of other leaf tasks.
+  return (access.aliased || access.store != store.get()) && (access.written || write);
+}
+
+void FusionRun::record_(const TaskStoreArg& arg, bool write)
+{
+  const auto& store         = logical_store(arg);
+  const auto [it, inserted] = accesses_.try_emplace(store->get_storage()->get_root());
+  auto& access              = it->second;
+
+  if (inserted) {
+    access.store = store.get();
+  } else if (access.store != store.get()) {
+    access.aliased = true;
+  }
+  access.written |= write;
+}
+
+InternalSharedPtr<AutoTask> FusionRun::fuse() const
+{
+  auto& runtime      = Runtime::get_runtime();
+  const auto& core   = runtime.core_library();
+  const auto task_id = FusedTask::TASK_CONFIG.task_id();
+  const auto& first  = *tasks_.front();
+  const auto variant = core.find_task(task_id)->find_variant(first.machine().preferred_variant());
+
+  LEGATE_CHECK(variant.has_value());
+
+  auto fused = make_internal_shared<AutoTask>(
+    core, variant->get(), task_id, runtime.new_op_id(), first.priority(), first.machine());
+
+  // The scope the tasks were submitted under may be gone by the time they are fused
+  fused->set_parallel_policy(first.parallel_policy());
+  // Positions of the stores in the inputs and outputs of the fused launch
+  std::unordered_map<const LogicalStore*, std::uint64_t> input_indices{};
+  std::unordered_map<const LogicalStore*, std::uint64_t> output_indices{};
+  std::unordered_set<const Variable*> aligned{};
+  const Variable* first_var = nullptr;
+
+  const auto add_store = [&](const TaskStoreArg& arg, bool is_output) {
+    auto&& store              = logical_store(arg);
+    auto& indices             = is_output ? output_indices : input_indices;
+    const auto [it, inserted] = indices.try_emplace(store.get(), indices.size());
+
+    if (inserted) {
+      const auto* var = is_output ? fused->add_output(store) : fused->add_input(store);
+
+      // A store used both as input and output gets the same partition symbol both times
+      if (first_var == nullptr) {
+        first_var = var;
+      } else if (var != first_var && aligned.insert(var).second) {
+        fused->add_constraint(align(first_var, var), /*bypass_signature_check=*/true);
+      }
+    }
+    return it->second;
+  };
+
+  std::vector<std::uint64_t> layout{};
+
+  layout.push_back(tasks_.size());
+  for (auto&& task : tasks_) {
+    layout.push_back(to_underlying(task->library().get_task_id(task->local_task_id())));
+    layout.push_back(task->inputs().size());
+    for (auto&& arg : task->inputs()) {
+      layout.push_back(add_store(arg, /*is_output=*/false));
+    }
+    layout.push_back(task->outputs().size());
+    for (auto&& arg : task->outputs()) {
+      layout.push_back(add_store(arg, /*is_output=*/true));
+    }
+    layout.push_back(task->scalars().size());
+  }
+
+  fused->add_scalar_arg(legate::Scalar{layout}.impl());
+  for (auto&& task : tasks_) {
+    for (auto&& scalar : task->scalars()) {
+      fused->add_scalar_arg(scalar);
+    }
+  }
+  return fused;
+}
+
+}  // namespace
+
+void fuse_elementwise_tasks(std::deque<InternalSharedPtr<Operation>>* window)
+{
+  std::deque<InternalSharedPtr<Operation>> result{};
+  FusionRun run{};
+
+  const auto flush_run = [&] {
+    if (run.tasks().size() > 1) {
+      result.emplace_back(run.fuse());
+    } else {
+      result.insert(result.end(), run.tasks().begin(), run.tasks().end());
+    }
+    run.clear();
+  };
+  const auto as_fusable = [](const InternalSharedPtr<Operation>& op) {
+    auto task = op->kind() == Operation::Kind::AUTO_TASK ? static_pointer_cast<AutoTask>(op)
+                                                           : InternalSharedPtr<AutoTask>{};
+
+    return task && task->fusable() ? task : InternalSharedPtr<AutoTask>{};
+  };
+
+  for (auto&& op : *window) {
+    auto task = as_fusable(op);
+
+    if (!task) {
+      flush_run();
+      result.emplace_back(std::move(op));
+      continue;
+    }
+    if (!run.accepts(*task)) {
+      flush_run();
+      if (!run.accepts(*task)) {
+        result.emplace_back(std::move(op));
+        continue;
+      }
+    }
+    run.append(std::move(task));
+  }
+  flush_run();
+  *window = std::move(result);
+}
+
+}  // namespace legate::detail
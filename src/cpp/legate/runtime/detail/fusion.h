@@ -0,0 +1,35 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/utilities/internal_shared_ptr.h>
+
+#include <deque>
+
+namespace legate::detail {
+
+class Operation;
+
+/**
+ * @brief Fuse runs of elementwise tasks in a scheduling window.
+ *
+ * Each run of two or more consecutive `AutoTask`s that are fusable (see `AutoTask::fusable()`)
+ * is replaced with a single `FusedTask` launch, which runs the member variants back to back on
+ * each leaf task. The stores of all members are aligned in the fused launch, so tasks only join a
+ * run if they:
+ *
+ * 1. Target the same machine, with the same priority and parallel policy.
+ * 2. Have stores of the same shape as the rest of the run.
+ * 3. Don't access a store written by the run (or write a store accessed by the run) through a
+ *    different view of the same storage, e.g., a slice or a transpose. With identical views,
+ *    each leaf task only depends on the preceding members in the same leaf task.
+ *
+ * @param window The operations to fuse, in submission order.
+ */
+void fuse_elementwise_tasks(std::deque<InternalSharedPtr<Operation>>* window);
+
+}  // namespace legate::detail
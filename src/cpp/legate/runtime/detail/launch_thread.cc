@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/runtime/detail/launch_thread.h>
+
+#include <legate/operation/detail/operation.h>
+#include <legate/runtime/detail/runtime.h>
+#include <legate/utilities/assert.h>
+
+#include <utility>
+
+namespace legate::detail {
+
+void LaunchThread::start(Legion::Runtime* legion_runtime, Legion::Context legion_context)
+{
+  LEGATE_CHECK(!active());
+
+  legion_runtime_ = legion_runtime;
+  legion_context_ = legion_context;
+  app_thread_id_  = std::this_thread::get_id();
+  stopping_       = false;
+  // The application thread is running the runtime, and the top-level task is already bound to it
+  runtime_mutex_.lock();
+  app_holds_lock_ = true;
+
+  thread_           = std::thread{[this] { run_(); }};
+  launch_thread_id_ = thread_.get_id();
+  active_.store(true, std::memory_order_release);
+}
+
+void LaunchThread::stop()
+{
+  if (!active()) {
+    return;
+  }
+
+  acquire();
+  launch_pending_();
+  {
+    const std::lock_guard lock{queue_mutex_};
+
+    stopping_ = true;
+  }
+  queue_cv_.notify_one();
+  // The launch thread may be waiting for the lock to launch a window this thread has launched
+  // already
+  unlock_();
+  thread_.join();
+  active_.store(false, std::memory_order_release);
+  legion_runtime_->bind_implicit_task_to_external_thread(legion_context_);
+}
+
+void LaunchThread::release()
+{
+  if (!active() || std::this_thread::get_id() != app_thread_id_ || !app_holds_lock_) {
+    return;
+  }
+  {
+    const std::lock_guard lock{queue_mutex_};
+
+    // The launch thread has nothing to launch, so this thread might as well keep the runtime
+    if (queue_.empty()) {
+      return;
+    }
+  }
+  unlock_();
+}
+
+void LaunchThread::push(Window window)
+{
+  {
+    const std::lock_guard lock{queue_mutex_};
+
+    queue_.emplace_back(std::move(window));
+  }
+  queue_cv_.notify_one();
+}
+
+void LaunchThread::sync()
+{
+  if (!active()) {
+    return;
+  }
+
+  LEGATE_ASSERT(std::this_thread::get_id() == app_thread_id_);
+  acquire();
+  launch_pending_();
+  if (pending_exception_) {
+    std::rethrow_exception(std::exchange(pending_exception_, nullptr));
+  }
+}
+
+void LaunchThread::lock_()
+{
+  runtime_mutex_.lock();
+  app_holds_lock_ = true;
+  legion_runtime_->bind_implicit_task_to_external_thread(legion_context_);
+}
+
+void LaunchThread::unlock_()
+{
+  legion_runtime_->unbind_implicit_task_from_external_thread(legion_context_);
+  app_holds_lock_ = false;
+  runtime_mutex_.unlock();
+}
+
+void LaunchThread::run_()
+{
+  while (true) {
+    {
+      std::unique_lock lock{queue_mutex_};
+
+      queue_cv_.wait(lock, [&] { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        return;
+      }
+    }
+
+    const std::lock_guard lock{runtime_mutex_};
+
+    legion_runtime_->bind_implicit_task_to_external_thread(legion_context_);
+    // The application thread may have launched the windows while this thread was waiting for
+    // the lock, in which case there is nothing left to launch
+    launch_pending_();
+    legion_runtime_->unbind_implicit_task_from_external_thread(legion_context_);
+  }
+}
+
+void LaunchThread::launch_pending_()
+{
+  auto& runtime = Runtime::get_runtime();
+
+  // Launching an operation may flush the scheduling window, which calls this function again.
+  // The nested call continues with the rest of the current window, like a nested flush would.
+  while (true) {
+    if (window_.empty()) {
+      const std::lock_guard lock{queue_mutex_};
+
+      if (queue_.empty()) {
+        return;
+      }
+      window_ = std::move(queue_.front());
+      queue_.pop_front();
+    }
+
+    try {
+      runtime.launch_window(&window_, Runtime::PrivateKey{});
+    } catch (...) {
+      // Only the first exception is kept, the same way a flush stops at the first one. The rest
+      // of the window is launched regardless, as it would be by the next flush.
+      if (!pending_exception_) {
+        pending_exception_ = std::current_exception();
+      }
+    }
+  }
+}
+
+}  // namespace legate::detail
@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/utilities/internal_shared_ptr.h>
+
+#include <legion.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace legate::detail {
+
+class Operation;
+
+/**
+ * @brief Launches the operations in the scheduling window on a thread of its own, so that the
+ * application thread can return from `submit()` while the operations are being partitioned and
+ * launched.
+ *
+ * The application thread hands whole scheduling windows over to the launch thread, which
+ * partitions and launches them in the order they were handed over. The two threads take turns
+ * running the runtime: the thread that holds the runtime lock is the only one allowed to touch
+ * the state of the runtime, and the Legion top-level task is bound to it. The launch thread
+ * holds the lock while it launches a window. The application thread takes the lock at the entry
+ * of the `Runtime` methods that touch state the launch thread also uses, i.e., the scheduling
+ * window, the field, region, partition and communicator managers, the caches and the Legion
+ * context (see `acquire()`). It gives the lock up at the end of the public methods that submit
+ * operations (see `release()`), so that the launch thread makes progress while the application
+ * does work of its own.
+ *
+ * Anything that needs the effects of the submitted operations, i.e., anything that flushes the
+ * scheduling window, is a synchronization point: the windows not launched yet are launched
+ * right away by the application thread (see `sync()`), and exceptions thrown while launching
+ * windows on the launch thread are rethrown.
+ */
+class LaunchThread {
+ public:
+  using Window = std::deque<InternalSharedPtr<Operation>>;
+
+  LaunchThread() = default;
+
+  LaunchThread(const LaunchThread&)            = delete;
+  LaunchThread& operator=(const LaunchThread&) = delete;
+  LaunchThread(LaunchThread&&)                 = delete;
+  LaunchThread& operator=(LaunchThread&&)      = delete;
+
+  /**
+   * @brief Start the launch thread. Must be called by the application thread, while the Legion
+   * top-level task is bound to it.
+   *
+   * @param legion_runtime The Legion runtime.
+   * @param legion_context The context of the Legion top-level task.
+   */
+  void start(Legion::Runtime* legion_runtime, Legion::Context legion_context);
+  /**
+   * @brief Launch the pending windows and stop the launch thread. The Legion top-level task is
+   * bound to the application thread afterwards.
+   */
+  void stop();
+
+  /**
+   * @return `true` if the launch thread is running, `false` otherwise.
+   */
+  [[nodiscard]] bool active() const;
+  /**
+   * @return `true` if the calling thread is the launch thread, `false` otherwise.
+   */
+  [[nodiscard]] bool on_launch_thread() const;
+
+  /**
+   * @brief Take the runtime lock, if the calling thread is the application thread and doesn't
+   * already hold it. Does nothing if the launch thread isn't running.
+   *
+   * The application thread keeps the lock until the next `release()`, so only the first call
+   * after a release waits for the launch thread.
+   */
+  void acquire();
+  /**
+   * @brief Give up the runtime lock, if the calling thread is the application thread and holds
+   * it, so that the launch thread can launch the windows handed over to it.
+   */
+  void release();
+
+  /**
+   * @brief Hand a scheduling window over to the launch thread.
+   *
+   * @param window The operations to launch.
+   */
+  void push(Window window);
+  /**
+   * @brief Launch the windows the launch thread hasn't launched yet, on the calling thread.
+   *
+   * Must be called by the application thread.
+   *
+   * @throw Any exception thrown while launching the windows, including the ones previously
+   * launched by the launch thread.
+   */
+  void sync();
+
+  /**
+   * @return The window being launched, to which the operations submitted by the launch thread
+   * itself (e.g., by the destructors of the operations it launches) are appended, if the calling
+   * thread is the launch thread. `nullptr` otherwise.
+   */
+  [[nodiscard]] Window* current_window();
+
+ private:
+  void lock_();
+  void unlock_();
+  void run_();
+  // Must be called with the runtime lock held
+  void launch_pending_();
+
+  Legion::Runtime* legion_runtime_{};
+  Legion::Context legion_context_{};
+  std::atomic<bool> active_{};
+  std::thread::id app_thread_id_{};
+  std::thread::id launch_thread_id_{};
+  std::thread thread_{};
+
+  // Serializes the application thread and the launch thread
+  std::mutex runtime_mutex_{};
+  // Only accessed by the application thread
+  bool app_holds_lock_{};
+
+  std::mutex queue_mutex_{};
+  std::condition_variable queue_cv_{};
+  std::deque<Window> queue_{};
+  bool stopping_{};
+
+  // Only accessed with the runtime lock held
+  Window window_{};
+  std::exception_ptr pending_exception_{};
+};
+
+}  // namespace legate::detail
+
+#include <legate/runtime/detail/launch_thread.inl>
@@ -0,0 +1,32 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/runtime/detail/launch_thread.h>
+
+namespace legate::detail {
+
+inline bool LaunchThread::active() const { return active_.load(std::memory_order_acquire); }
+
+inline bool LaunchThread::on_launch_thread() const
+{
+  return active() && std::this_thread::get_id() == launch_thread_id_;
+}
+
+inline void LaunchThread::acquire()
+{
+  if (active() && std::this_thread::get_id() == app_thread_id_ && !app_holds_lock_) {
+    lock_();
+  }
+}
+
+inline LaunchThread::Window* LaunchThread::current_window()
+{
+  return on_launch_thread() ? &window_ : nullptr;
+}
+
+}  // namespace legate::detail
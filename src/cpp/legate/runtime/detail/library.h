@@ -38,6 +38,7 @@ class Library {
     [[nodiscard]] std::int64_t invert(std::int64_t resource_id) const;
     [[nodiscard]] std::int64_t generate_id();
     [[nodiscard]] bool in_scope(std::int64_t resource_id) const;
+    [[nodiscard]] std::int64_t base() const;
     [[nodiscard]] std::int64_t size() const;
 
    private:
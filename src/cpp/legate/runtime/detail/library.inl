@@ -54,6 +54,8 @@ inline bool Library::ResourceIdScope::in_scope(std::int64_t resource_id) const
   return base_ <= resource_id && resource_id < base_ + size_;
 }
 
+inline std::int64_t Library::ResourceIdScope::base() const { return base_; }
+
 inline std::int64_t Library::ResourceIdScope::size() const { return size_; }
 
 // ==========================================================================================
@@ -28,7 +28,11 @@ MapperManager::MapperManager(Legion::Runtime* legion_runtime)
     auto* const base_mapper = new mapping::detail::BaseMapper{};
 
     try {
-      return new Legion::Mapping::LoggingWrapper{base_mapper, &base_mapper->logger()};
+      auto* const wrapper =
+        new Legion::Mapping::LoggingWrapper{base_mapper, &base_mapper->logger()};
+
+      base_mapper_ = base_mapper;
+      return wrapper;
     } catch (...) {
       delete base_mapper;
       throw;
@@ -25,11 +25,14 @@ class MapperManager {
   MapperManager();
 
   [[nodiscard]] Legion::MapperID mapper_id() const;
+  [[nodiscard]] const mapping::detail::BaseMapper& base_mapper() const;
 
  private:
   explicit MapperManager(Legion::Runtime* legion_runtime);
 
   Legion::MapperID mapper_id_{};
+  // Owned by Legion, which keeps it alive until the runtime shuts down
+  mapping::detail::BaseMapper* base_mapper_{};
 };
 
 }  // namespace legate::detail
@@ -12,4 +12,9 @@ namespace legate::detail {
 
 inline Legion::MapperID MapperManager::mapper_id() const { return mapper_id_; }
 
+inline const mapping::detail::BaseMapper& MapperManager::base_mapper() const
+{
+  return *base_mapper_;
+}
+
 }  // namespace legate::detail
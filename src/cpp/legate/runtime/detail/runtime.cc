@@ -27,6 +27,7 @@
 #include <legate/operation/detail/execution_fence.h>
 #include <legate/operation/detail/extract_scalar.h>
 #include <legate/operation/detail/fill.h>
+#include <legate/operation/detail/fused_task.h>
 #include <legate/operation/detail/gather.h>
 #include <legate/operation/detail/index_attach.h>
 #include <legate/operation/detail/mapping_fence.h>
@@ -44,7 +45,9 @@
 #include <legate/runtime/detail/argument_parsing/legate_args.h>
 #include <legate/runtime/detail/argument_parsing/util.h>
 #include <legate/runtime/detail/config.h>
+#include <legate/runtime/detail/dead_operations.h>
 #include <legate/runtime/detail/field_manager.h>
+#include <legate/runtime/detail/fusion.h>
 #include <legate/runtime/detail/library.h>
 #include <legate/runtime/detail/mpi_detection.h>
 #include <legate/runtime/detail/projection.h>
@@ -80,6 +83,7 @@
 #include <fmt/ranges.h>
 
 #include <atomic>
+#include <chrono>
 #include <cstdlib>
 #include <mappers/logging_wrapper.h>
 // GCC 14 alloc-zero warning when using Conda installed compiler
@@ -88,6 +92,7 @@ LEGATE_PRAGMA_GCC_IGNORE("-Walloc-zero");
 #include <regex>
 LEGATE_PRAGMA_POP();
 #include <cstdint>
+#include <iterator>
 #include <stdexcept>
 #include <unordered_set>
 #include <utility>
@@ -128,6 +133,8 @@ Runtime::Runtime(Config config)
     field_reuse_size_{local_machine().calculate_field_reuse_size(this->config().field_reuse_frac())}
 {
   static_cast<void>(scope_.exchange_scheduling_window_size(this->config().window_size()));
+  auto_tracer_.set_enabled(this->config().auto_trace());
+  window_monitor_.set_adaptive(this->config().adaptive_window());
 }
 
 Library& Runtime::create_library(
@@ -147,6 +154,8 @@ Library& Runtime::create_library(
   // NOLINTNEXTLINE(performance-unnecessary-value-param)
   std::map<VariantCode, VariantOptions> default_options)
 {
+  // The launch thread looks libraries up when it fuses tasks
+  launch_thread_.acquire();
   if (libraries_.find(library_name) != libraries_.end()) {
     throw TracedException<std::invalid_argument>{
       fmt::format("Library {} already exists", library_name)};
@@ -157,14 +166,26 @@ Library& Runtime::create_library(
     mapper = std::make_unique<mapping::detail::DefaultMapper>();
   }
 
-  return libraries_
-    .try_emplace(std::string{library_name},
-                 Library::ConstructKey{},
-                 std::string{library_name},
-                 config,
-                 std::move(mapper),
-                 std::move(default_options))
-    .first->second;
+  auto& library = libraries_
+                   .try_emplace(std::string{library_name},
+                                Library::ConstructKey{},
+                                std::string{library_name},
+                                config,
+                                std::move(mapper),
+                                std::move(default_options))
+                   .first->second;
+
+  if (library.task_scope_.size() > 0) {
+    try {
+      libraries_by_task_id_.try_emplace(static_cast<GlobalTaskID>(library.task_scope_.base()),
+                                        &library);
+    } catch (...) {
+      // strong exception guarantee
+      libraries_.erase(libraries_.find(library_name));
+      throw;
+    }
+  }
+  return library;
 }
 
 namespace {
@@ -197,6 +218,25 @@ std::optional<std::reference_wrapper<Library>> Runtime::find_library(std::string
   return find_library_impl(libraries_, library_name);
 }
 
+std::optional<std::reference_wrapper<const Library>> Runtime::find_library(
+  GlobalTaskID task_id) const
+{
+  // The task ID ranges of the libraries are disjoint, so the only library that may own the ID is
+  // the one whose range starts last at or before it
+  const auto it = libraries_by_task_id_.upper_bound(task_id);
+
+  if (it == libraries_by_task_id_.begin()) {
+    return std::nullopt;
+  }
+
+  const auto* library = std::prev(it)->second;
+
+  if (!library->valid_task_id(task_id)) {
+    return std::nullopt;
+  }
+  return *library;
+}
+
 Library& Runtime::find_or_create_library(
   std::string_view library_name,
   const ResourceConfig& config,
@@ -469,6 +509,21 @@ void Runtime::offload_to(mapping::StoreTarget target_mem,
 
 void Runtime::flush_scheduling_window(bool streaming_scope_change)
 {
+  flush_scheduling_window_(SchedulingWindowMonitor::FlushCause::EXPLICIT, streaming_scope_change);
+}
+
+void Runtime::flush_scheduling_window_(SchedulingWindowMonitor::FlushCause cause,
+                                       bool streaming_scope_change)
+{
+  // The launch thread launches whatever it submits as part of the window it is launching
+  if (launch_thread_.on_launch_thread()) {
+    return;
+  }
+  // Operations held back by the tracer were submitted before anything that flushes the window
+  // could observe their effects, so they must be scheduled too
+  auto_tracer_.drain();
+  // So were the windows handed over to the launch thread
+  launch_thread_.sync();
   // whenever the parallel policy changes due to scope change, we flush the
   // scheduling window, so if current scope is streaming, all the tasks in it have
   // their parallel policy with streaming set.
@@ -502,10 +557,22 @@ void Runtime::flush_scheduling_window(bool streaming_scope_change)
     }
 
   } else {
+    record_flush_(cause);
+    eliminate_dead_operations(&operations_);
+    fuse_elementwise_tasks(&operations_);
     schedule_(&operations_);
   }
 }
 
+void Runtime::record_flush_(SchedulingWindowMonitor::FlushCause cause)
+{
+  if (const auto new_size =
+        window_monitor_.record_flush(cause, operations_.size(), scope().scheduling_window_size());
+      new_size.has_value()) {
+    static_cast<void>(scope().exchange_scheduling_window_size(*new_size));
+  }
+}
+
 void Runtime::schedule_(std::deque<InternalSharedPtr<Operation>>* window)
 {
   // We should only execute the operations resident in the queue at the time of flush, no more,
@@ -518,10 +585,17 @@ void Runtime::schedule_(std::deque<InternalSharedPtr<Operation>>* window)
   // already emptied the queue for us.
   //
   // This is why we check flush_size > 0 && !operations_.empty().
+  std::size_t num_launched = 0;
+  // The launch time is only used to size the window adaptively
+  const auto measure = window_monitor_.adaptive();
+  const auto start =
+    measure ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+
   for (auto flush_size = window->size(); flush_size > 0 && !window->empty(); --flush_size) {
     auto op = std::move(window->front());
 
     window->pop_front();
+    ++num_launched;
 
     if constexpr (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
       log_legate().debug() << op->to_string(true /*show_provenance*/) << " launched";
@@ -538,10 +612,22 @@ void Runtime::schedule_(std::deque<InternalSharedPtr<Operation>>* window)
 
     op->launch(&strategy);
   }
+  if (measure) {
+    window_monitor_.record_launch(num_launched, std::chrono::steady_clock::now() - start);
+  }
 }
 
 void Runtime::clear_scheduling_window(PrivateKey) { operations_.clear(); }
 
+void Runtime::launch_window(std::deque<InternalSharedPtr<Operation>>* window, PrivateKey)
+{
+  eliminate_dead_operations(window);
+  fuse_elementwise_tasks(window);
+  while (!window->empty()) {
+    schedule_(window);
+  }
+}
+
 void Runtime::submit(InternalSharedPtr<Operation> op)
 {
   if constexpr (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
@@ -552,15 +638,52 @@ void Runtime::submit(InternalSharedPtr<Operation> op)
   // operations_.
   op->validate();
 
+  // Entering the scheduling window from the application thread, which must wait until the
+  // launch thread is done with the window it is launching
+  launch_thread_.acquire();
+  // The tracer belongs to the application thread
+  if (auto_tracer_.active() && !launch_thread_.on_launch_thread()) {
+    auto_tracer_.submit(std::move(op));
+  } else {
+    enqueue_(std::move(op));
+  }
+}
+
+void Runtime::submit_untraced(InternalSharedPtr<Operation> op, PrivateKey)
+{
+  launch_thread_.acquire();
+  enqueue_(std::move(op));
+}
+
+void Runtime::enqueue_(InternalSharedPtr<Operation> op)
+{
+  // Operations submitted by the launch thread, e.g., by the destructors of the operations it
+  // launches, are launched as part of the window it is launching
+  if (auto* window = launch_thread_.current_window(); window != nullptr) {
+    window->emplace_back(std::move(op));
+    return;
+  }
+
   const auto& submitted = operations_.emplace_back(std::move(op));
 
+  if (operations_.size() == 1) {
+    window_monitor_.record_window_opened();
+  }
+
   // Ignore window size when inside a streaming scope because we want to analyze
   // and stream the entire streaming scope if it's bigger than window size
   const auto win_too_big = !scope().parallel_policy().streaming() &&
                            (operations_.size() >= scope().scheduling_window_size());
 
-  if (submitted->needs_flush() || win_too_big) {
-    flush_scheduling_window();
+  if (submitted->needs_flush()) {
+    flush_scheduling_window_(SchedulingWindowMonitor::FlushCause::NEEDS_FLUSH);
+  } else if (win_too_big) {
+    if (launch_thread_.active()) {
+      record_flush_(SchedulingWindowMonitor::FlushCause::WINDOW_FULL);
+      launch_thread_.push(std::exchange(operations_, {}));
+    } else {
+      flush_scheduling_window_(SchedulingWindowMonitor::FlushCause::WINDOW_FULL);
+    }
   }
 }
 
@@ -982,6 +1105,7 @@ void Runtime::progress_unordered_operations()
 
 RegionManager& Runtime::find_or_create_region_manager(const Legion::IndexSpace& index_space)
 {
+  launch_thread_.acquire();
   return region_managers_.try_emplace(index_space, index_space).first->second;
 }
 
@@ -1076,8 +1200,12 @@ Legion::IndexPartition Runtime::create_image_partition(
 
   buffer.pack<StreamingGeneration>(std::nullopt);
   machine.pack(buffer);
+  // key projection
+  buffer.pack<std::uint32_t>(0);
   buffer.pack<std::uint32_t>(get_sharding(machine, /*proj_id=*/0));
   buffer.pack<std::int32_t>(scope().priority());
+  // stealable
+  buffer.pack<bool>(false);
 
   if (is_range) {
     return get_legion_runtime()->create_partition_by_image_range(get_legion_context(),
@@ -1438,6 +1566,7 @@ InternalSharedPtr<LogicalStore> Runtime::get_timestamp(Timing::Precision precisi
 void Runtime::begin_trace(std::uint32_t trace_id)
 {
   flush_scheduling_window();
+  auto_tracer_.begin_manual_trace();
   get_legion_runtime()->begin_trace(get_legion_context(), trace_id);
 }
 
@@ -1445,6 +1574,7 @@ void Runtime::end_trace(std::uint32_t trace_id)
 {
   flush_scheduling_window();
   get_legion_runtime()->end_trace(get_legion_context(), trace_id);
+  auto_tracer_.end_manual_trace();
 }
 
 InternalSharedPtr<mapping::detail::Machine> Runtime::create_toplevel_machine()
@@ -1472,6 +1602,7 @@ ZStringView Runtime::get_provenance() const { return scope().provenance(); }
 Legion::ProjectionID Runtime::get_affine_projection(std::uint32_t src_ndim,
                                                     const proj::SymbolicPoint& point)
 {
+  launch_thread_.acquire();
   if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
     log_legate().debug() << "Query affine projection {src_ndim: " << src_ndim
                          << ", point: " << point << "}";
@@ -1506,6 +1637,7 @@ Legion::ProjectionID Runtime::get_affine_projection(std::uint32_t src_ndim,
 
 Legion::ProjectionID Runtime::get_delinearizing_projection(Span<const std::uint64_t> color_shape)
 {
+  launch_thread_.acquire();
   if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
     log_legate().debug() << fmt::format("Query delinearizing projection {{color_shape: {}}}",
                                         color_shape);
@@ -1536,6 +1668,7 @@ Legion::ProjectionID Runtime::get_delinearizing_projection(Span<const std::uint6
 Legion::ProjectionID Runtime::get_compound_projection(Span<const std::uint64_t> color_shape,
                                                       const proj::SymbolicPoint& point)
 {
+  launch_thread_.acquire();
   if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
     log_legate().debug() << fmt::format("Query compound projection {{color_shape: {}, point: {}}}",
                                         color_shape,
@@ -1571,6 +1704,7 @@ Legion::ProjectionID Runtime::get_compound_projection(Span<const std::uint64_t>
 Legion::ShardingID Runtime::get_sharding(const mapping::detail::Machine& machine,
                                          Legion::ProjectionID proj_id)
 {
+  launch_thread_.acquire();
   // If we're running on a single node, we don't need to generate sharding functors
   if (Realm::Network::max_node_id == 0) {
     return 0;
@@ -1842,6 +1976,9 @@ void set_env_vars()
     !single_controller_mode /*control replicable*/);
 
   runtime.legion_context_ = ctx;
+  if (runtime.config().launch_thread()) {
+    runtime.launch_thread_.start(runtime.get_legion_runtime(), ctx);
+  }
 }
 
 void Runtime::start_profiling_range()
@@ -1973,6 +2110,25 @@ std::int32_t Runtime::finish()
 
   // Flush any outstanding operations before we tear down the runtime
   flush_scheduling_window();
+  // The clean-up below must run on this thread
+  launch_thread_.stop();
+
+  if (auto_tracer_.enabled()) {
+    log_legate().info() << "Automatic tracing: " << auto_tracer_.num_hits() << " hits, "
+                        << auto_tracer_.num_misses() << " misses, " << auto_tracer_.num_traces()
+                        << " traces";
+    // The clean-up below isn't worth tracing
+    auto_tracer_.set_enabled(false);
+  }
+  log_legate().info() << "Strategy cache: " << strategy_cache_.num_hits() << " hits, "
+                      << strategy_cache_.num_misses() << " misses, "
+                      << strategy_cache_.num_evictions() << " evictions";
+  if (window_monitor_.adaptive()) {
+    const auto stats = window_monitor_.statistics(scope().scheduling_window_size());
+
+    log_legate().info() << "Adaptive scheduling window: final size " << stats.window_size
+                        << " after " << stats.num_resizes << " resizes";
+  }
 
   // Need a fence to make sure all client operations come before the subsequent clean-up tasks
   issue_execution_fence();
@@ -2013,6 +2169,7 @@ std::int32_t Runtime::finish()
   // cleanup tasks, we issue another fence here before we clear the Libraries.
   issue_execution_fence(true);
   mapper_manager_.reset();
+  libraries_by_task_id_.clear();
   libraries_.clear();
   core_library_.reset();
   // Reset this here and now (instead of waiting to destroy it when Runtime gets destroyed)
@@ -2099,6 +2256,7 @@ void register_legate_core_tasks(Library& core_lib)
   comm::register_tasks(core_lib);
   legate::experimental::io::detail::register_tasks();
   OffloadTo::register_variants(pub_core_lib);
+  FusedTask::register_variants(pub_core_lib);
 }
 
 }  // namespace
@@ -2268,6 +2426,11 @@ void Runtime::inline_task_end()  // NOLINT(readability-make-member-function-cons
 
 Legion::MapperID Runtime::mapper_id() const { return get_mapper_manager_().mapper_id(); }
 
+const mapping::detail::BaseMapper& Runtime::base_mapper() const
+{
+  return get_mapper_manager_().base_mapper();
+}
+
 bool has_started() { return the_runtime.state() == RuntimeManager::State::INITIALIZED; }
 
 bool has_finished()
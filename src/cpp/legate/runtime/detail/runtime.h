@@ -13,14 +13,18 @@
 #include <legate/mapping/detail/mapping.h>
 #include <legate/mapping/machine.h>
 #include <legate/operation/detail/timing.h>
+#include <legate/partitioning/detail/strategy_cache.h>
+#include <legate/runtime/detail/auto_trace.h>
 #include <legate/runtime/detail/communicator_manager.h>
 #include <legate/runtime/detail/config.h>
 #include <legate/runtime/detail/consensus_match_result.h>
+#include <legate/runtime/detail/launch_thread.h>
 #include <legate/runtime/detail/library.h>
 #include <legate/runtime/detail/mapper_manager.h>
 #include <legate/runtime/detail/partition_manager.h>
 #include <legate/runtime/detail/projection.h>
 #include <legate/runtime/detail/region_manager.h>
+#include <legate/runtime/detail/scheduling_window.h>
 #include <legate/runtime/detail/scope.h>
 #include <legate/task/detail/returned_exception.h>
 #include <legate/task/variant_options.h>
@@ -106,6 +110,11 @@ class Runtime {
     std::string_view library_name) const;
   [[nodiscard]] std::optional<std::reference_wrapper<Library>> find_library(
     std::string_view library_name);
+  /**
+   * @return The library whose task ID range contains `task_id`, if any.
+   */
+  [[nodiscard]] std::optional<std::reference_wrapper<const Library>> find_library(
+    GlobalTaskID task_id) const;
   [[nodiscard]] Library& find_or_create_library(
     std::string_view library_name,
     const ResourceConfig& config,
@@ -198,20 +207,51 @@ class Runtime {
   void submit(InternalSharedPtr<Operation> op);
   static void launch_immediately(const InternalSharedPtr<Operation>& op);
 
+  /**
+   * @return The tracer that wraps repeated sequences of operations in traces.
+   */
+  [[nodiscard]] AutoTracer& auto_tracer();
+  /**
+   * @return The thread that launches the scheduling windows, if enabled.
+   */
+  [[nodiscard]] LaunchThread& launch_thread();
+  /**
+   * @return The statistics of the scheduling window, which also sizes it in adaptive mode.
+   */
+  [[nodiscard]] const SchedulingWindowMonitor& window_monitor() const;
+
   /**
    * @brief Give access to certain methods via this class.
    */
   class PrivateKey {
     PrivateKey() = default;
     friend class legate::detail::Scope;
+    friend class legate::detail::AutoTracer;
+    friend class legate::detail::LaunchThread;
   };
 
+  /**
+   * @brief Append an already validated operation to the scheduling window, bypassing automatic
+   * tracing.
+   *
+   * @param op The operation to append.
+   */
+  void submit_untraced(InternalSharedPtr<Operation> op, PrivateKey);
+
   /**
    * @brief something went wrong, such as an exception or error inside a streaming
    * scope. So clear the tasks in the queue.
    */
   void clear_scheduling_window(PrivateKey);
 
+  /**
+   * @brief Launch a scheduling window handed over to the launch thread, including the operations
+   * appended to it while it is being launched.
+   *
+   * @param window The operations to launch.
+   */
+  void launch_window(std::deque<InternalSharedPtr<Operation>>* window, PrivateKey);
+
  private:
   /**
    * @brief Launch the operations in the queue provided.
@@ -219,6 +259,11 @@ class Runtime {
    * @param window queue of tasks.
    */
   void schedule_(std::deque<InternalSharedPtr<Operation>>* window);
+  void enqueue_(InternalSharedPtr<Operation> op);
+  void flush_scheduling_window_(SchedulingWindowMonitor::FlushCause cause,
+                                bool streaming_scope_change = false);
+  // Records a flush of the scheduling window, and resizes it if the monitor says so
+  void record_flush_(SchedulingWindowMonitor::FlushCause cause);
 
   [[nodiscard]] std::pair<mapping::detail::Machine, const VariantInfo&> slice_machine_for_task_(
     const TaskInfo& info) const;
@@ -300,6 +345,7 @@ class Runtime {
   [[nodiscard]] const CommunicatorManager& communicator_manager() const;
   [[nodiscard]] PartitionManager& partition_manager();
   [[nodiscard]] const PartitionManager& partition_manager() const;
+  [[nodiscard]] StrategyCache& strategy_cache();
   [[nodiscard]] Scope& scope();
   [[nodiscard]] const Scope& scope() const;
 
@@ -481,6 +527,7 @@ class Runtime {
   [[nodiscard]] Processor get_executing_processor() const;
 
   [[nodiscard]] Legion::MapperID mapper_id() const;
+  [[nodiscard]] const mapping::detail::BaseMapper& base_mapper() const;
 
   [[nodiscard]] bool executing_inline_task() const noexcept;
 
@@ -560,6 +607,7 @@ class Runtime {
   std::unordered_map<RegionManagerKey, RegionManager> region_managers_{};
   std::optional<CommunicatorManager> communicator_manager_{};
   std::optional<PartitionManager> partition_manager_{};
+  StrategyCache strategy_cache_{};
   Scope scope_;
 
   std::unordered_map<Domain, Legion::IndexSpace> cached_index_spaces_{};
@@ -585,16 +633,21 @@ class Runtime {
     registered_shardings_{};
 
   std::deque<InternalSharedPtr<Operation>> operations_{};
+  AutoTracer auto_tracer_{};
+  LaunchThread launch_thread_{};
+  SchedulingWindowMonitor window_monitor_{};
   std::atomic<std::uint64_t> cur_op_id_{};
 
   using RegionFieldID = std::pair<Legion::LogicalRegion, Legion::FieldID>;
-  std::uint64_t next_store_id_{1};
-  std::uint64_t next_storage_id_{1};
+  std::atomic<std::uint64_t> next_store_id_{1};
+  std::atomic<std::uint64_t> next_storage_id_{1};
   std::size_t field_reuse_size_{1};
 
   // This could be a hash map, but kept as an ordered map just in case we may later support
   // library-specific shutdown callbacks that can launch tasks.
   std::map<std::string, Library, std::less<>> libraries_{};
+  // The libraries with task IDs, keyed by the first global task ID of their range
+  std::map<GlobalTaskID, const Library*> libraries_by_task_id_{};
 
   using ReductionOpTableKey = std::pair<std::uint32_t, std::int32_t>;
   std::unordered_map<ReductionOpTableKey, GlobalRedopID, hasher<ReductionOpTableKey>>
@@ -28,7 +28,12 @@ inline const Library& Runtime::core_library() const
 
 inline Legion::Runtime* Runtime::get_legion_runtime() { return legion_runtime_; }
 
-inline Legion::Context Runtime::get_legion_context() { return legion_context_; }
+inline Legion::Context Runtime::get_legion_context()
+{
+  // The Legion top-level task is bound to whichever thread holds the runtime lock
+  launch_thread_.acquire();
+  return legion_context_;
+}
 
 inline std::uint64_t Runtime::new_op_id() { return ++cur_op_id_; }
 
@@ -40,10 +45,15 @@ inline std::uint32_t Runtime::field_reuse_freq() const { return config().field_r
 
 inline std::size_t Runtime::field_reuse_size() const { return field_reuse_size_; }
 
-inline FieldManager& Runtime::field_manager() { return *field_manager_; }
+inline FieldManager& Runtime::field_manager()
+{
+  launch_thread_.acquire();
+  return *field_manager_;
+}
 
 inline PartitionManager& Runtime::partition_manager()
 {
+  launch_thread_.acquire();
   if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
     return partition_manager_.value();  // NOLINT(bugprone-unchecked-optional-access)
   }
@@ -58,8 +68,15 @@ inline const PartitionManager& Runtime::partition_manager() const
   return *partition_manager_;  // NOLINT(bugprone-unchecked-optional-access)
 }
 
+inline StrategyCache& Runtime::strategy_cache()
+{
+  launch_thread_.acquire();
+  return strategy_cache_;
+}
+
 inline CommunicatorManager& Runtime::communicator_manager()
 {
+  launch_thread_.acquire();
   if (LEGATE_DEFINED(LEGATE_USE_DEBUG)) {
     return communicator_manager_.value();  // NOLINT(bugprone-unchecked-optional-access)
   }
@@ -74,7 +91,17 @@ inline const CommunicatorManager& Runtime::communicator_manager() const
   return *communicator_manager_;  // NOLINT(bugprone-unchecked-optional-access)
 }
 
-inline Scope& Runtime::scope() { return scope_; }
+inline Scope& Runtime::scope()
+{
+  launch_thread_.acquire();
+  return scope_;
+}
+
+inline AutoTracer& Runtime::auto_tracer() { return auto_tracer_; }
+
+inline LaunchThread& Runtime::launch_thread() { return launch_thread_; }
+
+inline const SchedulingWindowMonitor& Runtime::window_monitor() const { return window_monitor_; }
 
 inline const Scope& Runtime::scope() const { return scope_; }
 
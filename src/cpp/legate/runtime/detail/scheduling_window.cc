@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/runtime/detail/scheduling_window.h>
+
+#include <algorithm>
+
+namespace legate::detail {
+
+std::optional<std::uint32_t> SchedulingWindowMonitor::record_flush(FlushCause cause,
+                                                                   std::size_t occupancy,
+                                                                   std::uint32_t window_size)
+{
+  if (occupancy == 0) {
+    return std::nullopt;
+  }
+
+  switch (cause) {
+    case FlushCause::WINDOW_FULL: ++stats_.num_full_flushes; break;
+    case FlushCause::NEEDS_FLUSH: ++stats_.num_forced_flushes; break;
+    case FlushCause::EXPLICIT: ++stats_.num_explicit_flushes; break;
+  }
+  stats_.num_flushed_operations += occupancy;
+  stats_.max_occupancy = std::max<std::uint64_t>(stats_.max_occupancy, occupancy);
+
+  auto new_size = resize_(cause, occupancy, window_size);
+
+  if (new_size.has_value()) {
+    ++stats_.num_resizes;
+  }
+  return new_size;
+}
+
+void SchedulingWindowMonitor::record_launch(std::size_t num_operations,
+                                            std::chrono::nanoseconds elapsed)
+{
+  if (num_operations == 0) {
+    return;
+  }
+
+  const auto per_op = static_cast<double>(elapsed.count()) / static_cast<double>(num_operations);
+
+  if (has_launch_time_) {
+    // Weighs the last launch as much as the 7 before it, so that the average follows the changes
+    // of the workload quickly without jumping at every outlier
+    constexpr auto WEIGHT = 0.125;
+
+    launch_time_per_op_ += WEIGHT * (per_op - launch_time_per_op_);
+  } else {
+    launch_time_per_op_ = per_op;
+    has_launch_time_    = true;
+  }
+}
+
+std::optional<std::uint32_t> SchedulingWindowMonitor::resize_(FlushCause cause,
+                                                              std::size_t occupancy,
+                                                              std::uint32_t window_size)
+{
+  // Nothing to compare the waiting time with until some operations have been launched
+  if (!adaptive() || !has_launch_time_) {
+    return std::nullopt;
+  }
+
+  const auto waited =
+    std::chrono::duration<double, std::nano>{std::chrono::steady_clock::now() - opened_at_}
+      .count();
+  const auto launch_time = launch_time_per_op_ * static_cast<double>(occupancy);
+  auto new_size          = window_size;
+
+  if (cause == FlushCause::WINDOW_FULL && waited < launch_time) {
+    // Windows configured larger than the maximum are left alone
+    if (window_size < MAX_WINDOW_SIZE) {
+      new_size = std::min(window_size * 2, MAX_WINDOW_SIZE);
+    }
+  } else if (waited > IDLE_RATIO * launch_time) {
+    new_size = std::max(window_size / 2, MIN_WINDOW_SIZE);
+  }
+  if (new_size == window_size) {
+    return std::nullopt;
+  }
+  return new_size;
+}
+
+}  // namespace legate::detail
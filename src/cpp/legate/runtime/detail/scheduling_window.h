@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/runtime/scheduling_window_statistics.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace legate::detail {
+
+/**
+ * @brief Keeps the statistics of the scheduling window, and sizes it adaptively if asked to.
+ *
+ * A window that is too small starves the analyses that look at more than one operation at a
+ * time (e.g., task fusion and streaming), while a window that is too large holds operations
+ * back when Legion has nothing else to do. When adaptive sizing is enabled, the size of the
+ * window is reconsidered at every flush, by comparing the time the operations waited in the
+ * window with the time it takes to launch them:
+ *
+ * - If the window filled up before its operations could have been launched, the application
+ *   submits operations faster than the runtime launches them, so Legion is kept busy anyway and
+ *   a larger window only helps. The window size is doubled.
+ * - If the operations waited more than `IDLE_RATIO` times as long as it takes to launch them,
+ *   Legion has likely been waiting for them. The window size is halved.
+ *
+ * Flushes forced by operations that need to be launched right away, or requested by the
+ * application, never grow the window, as a larger window wouldn't have collected more
+ * operations.
+ */
+class SchedulingWindowMonitor {
+ public:
+  enum class FlushCause : std::uint8_t { WINDOW_FULL, NEEDS_FLUSH, EXPLICIT };
+
+  static constexpr std::uint32_t MIN_WINDOW_SIZE = 1;
+  static constexpr std::uint32_t MAX_WINDOW_SIZE = 1024;
+  static constexpr std::uint32_t IDLE_RATIO      = 4;
+
+  [[nodiscard]] bool adaptive() const;
+  void set_adaptive(bool adaptive);
+
+  /**
+   * @brief Record that an operation was added to an empty window.
+   */
+  void record_window_opened();
+
+  /**
+   * @brief Record a flush of the window.
+   *
+   * @param cause What triggered the flush.
+   * @param occupancy The number of operations in the window.
+   * @param window_size The current size of the window.
+   *
+   * @return The new size of the window, if it should change.
+   */
+  [[nodiscard]] std::optional<std::uint32_t> record_flush(FlushCause cause,
+                                                          std::size_t occupancy,
+                                                          std::uint32_t window_size);
+
+  /**
+   * @brief Record the time it took to launch operations.
+   *
+   * @param num_operations The number of operations launched.
+   * @param elapsed The time it took to launch them.
+   */
+  void record_launch(std::size_t num_operations, std::chrono::nanoseconds elapsed);
+
+  /**
+   * @param window_size The current size of the window.
+   *
+   * @return The statistics of the window.
+   */
+  [[nodiscard]] SchedulingWindowStatistics statistics(std::uint32_t window_size) const;
+
+ private:
+  [[nodiscard]] std::optional<std::uint32_t> resize_(FlushCause cause,
+                                                     std::size_t occupancy,
+                                                     std::uint32_t window_size);
+
+  bool adaptive_{};
+  std::chrono::steady_clock::time_point opened_at_{};
+  // Moving average of the time it takes to launch an operation, in nanoseconds
+  double launch_time_per_op_{};
+  bool has_launch_time_{};
+  SchedulingWindowStatistics stats_{};
+};
+
+}  // namespace legate::detail
+
+#include <legate/runtime/detail/scheduling_window.inl>
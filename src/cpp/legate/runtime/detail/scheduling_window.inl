@@ -0,0 +1,31 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/runtime/detail/scheduling_window.h>
+
+namespace legate::detail {
+
+inline bool SchedulingWindowMonitor::adaptive() const { return adaptive_; }
+
+inline void SchedulingWindowMonitor::set_adaptive(bool adaptive) { adaptive_ = adaptive; }
+
+inline void SchedulingWindowMonitor::record_window_opened()
+{
+  opened_at_ = std::chrono::steady_clock::now();
+}
+
+inline SchedulingWindowStatistics SchedulingWindowMonitor::statistics(
+  std::uint32_t window_size) const
+{
+  auto stats = stats_;
+
+  stats.window_size = window_size;
+  return stats;
+}
+
+}  // namespace legate::detail
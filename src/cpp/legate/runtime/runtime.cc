@@ -113,6 +113,7 @@ void Runtime::issue_copy(LogicalStore& target,
                          std::optional<std::int32_t> redop_kind)
 {
   impl_->issue_copy(target.impl(), source.impl(), redop_kind);
+  impl_->launch_thread().release();
 }
 
 void Runtime::issue_gather(LogicalStore& target,
@@ -131,6 +132,7 @@ void Runtime::issue_gather(LogicalStore& target,
                            std::optional<std::int32_t> redop_kind)
 {
   impl_->issue_gather(target.impl(), source.impl(), source_indirect.impl(), redop_kind);
+  impl_->launch_thread().release();
 }
 
 void Runtime::issue_scatter(LogicalStore& target,
@@ -149,6 +151,7 @@ void Runtime::issue_scatter(LogicalStore& target,
                             std::optional<std::int32_t> redop_kind)
 {
   impl_->issue_scatter(target.impl(), target_indirect.impl(), source.impl(), redop_kind);
+  impl_->launch_thread().release();
 }
 
 void Runtime::issue_scatter_gather(LogicalStore& target,
@@ -170,16 +173,19 @@ void Runtime::issue_scatter_gather(LogicalStore& target,
 {
   impl_->issue_scatter_gather(
     target.impl(), target_indirect.impl(), source.impl(), source_indirect.impl(), redop_kind);
+  impl_->launch_thread().release();
 }
 
 void Runtime::issue_fill(const LogicalStore& lhs, const LogicalStore& value)
 {
   impl_->issue_fill(lhs.impl(), value.impl());
+  impl_->launch_thread().release();
 }
 
 void Runtime::issue_fill(const LogicalStore& lhs, const Scalar& value)
 {
   impl_->issue_fill(lhs.impl(), *value.impl());
+  impl_->launch_thread().release();
 }
 
 LogicalStore Runtime::tree_reduce(Library library,
@@ -190,6 +196,7 @@ LogicalStore Runtime::tree_reduce(Library library,
   auto out_store = create_store(store.type(), /*dim=*/1);
 
   impl_->tree_reduce(*library.impl(), task_id, store.impl(), out_store.impl(), radix);
+  impl_->launch_thread().release();
   return out_store;
 }
 
@@ -214,6 +221,8 @@ void Runtime::submit(AutoTask&& task)
   // initialized by discard operations as part of their deallocation even before the reader task
   // runs, leading to an uninitialized access error.
   task.clear_user_refs_();
+  // Let the launch thread, if any, launch the task while the application does something else
+  impl_->launch_thread().release();
 }
 
 void Runtime::submit(ManualTask&& task)
@@ -226,6 +235,8 @@ void Runtime::submit(ManualTask&& task)
   // initialized by discard operations as part of their deallocation even before the reader task
   // runs, leading to an uninitialized access error.
   task.clear_user_refs_();
+  // Let the launch thread, if any, launch the task while the application does something else
+  impl_->launch_thread().release();
 }
 
 LogicalStore Runtime::create_store(const Type& type, std::uint32_t dim)
@@ -320,6 +331,11 @@ void Runtime::register_shutdown_callback_(ShutdownCallback callback)
 
 mapping::Machine Runtime::get_machine() const { return Scope::machine(); }
 
+SchedulingWindowStatistics Runtime::scheduling_window_statistics() const
+{
+  return impl_->window_monitor().statistics(impl_->scope().scheduling_window_size());
+}
+
 Processor Runtime::get_executing_processor() const { return impl()->get_executing_processor(); }
 
 void* Runtime::get_cuda_stream() const { return impl()->get_cuda_stream(); }
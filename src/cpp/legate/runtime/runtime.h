@@ -13,6 +13,7 @@
 #include <legate/operation/task.h>
 #include <legate/runtime/library.h>
 #include <legate/runtime/resource.h>
+#include <legate/runtime/scheduling_window_statistics.h>
 #include <legate/task/variant_options.h>
 #include <legate/type/types.h>
 #include <legate/utilities/detail/doxygen.h>
@@ -589,6 +590,14 @@ class LEGATE_EXPORT Runtime {
    */
   [[nodiscard]] Processor get_executing_processor() const;
 
+  /**
+   * @brief Returns the statistics of the scheduling window
+   *
+   * @return The number of flushes of the scheduling window, by cause, its occupancy at the time
+   * of the flushes, and its current size
+   */
+  [[nodiscard]] SchedulingWindowStatistics scheduling_window_statistics() const;
+
   /**
    * @brief Returns a singleton runtime object
    *
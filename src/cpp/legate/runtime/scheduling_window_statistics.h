@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/utilities/detail/doxygen.h>
+
+#include <cstdint>
+
+namespace legate {
+
+/**
+ * @addtogroup runtime
+ * @{
+ */
+
+/**
+ * @brief POD for the statistics of the scheduling window.
+ *
+ * Operations are held in the scheduling window until it is flushed, either because it is full,
+ * because an operation needs to be launched right away, or because something needs the effects
+ * of the submitted operations (e.g., mapping a store, a blocking execution fence, or the end of
+ * a scope). Flushes of empty windows, and of the operations of streaming scopes, are not
+ * counted.
+ */
+struct SchedulingWindowStatistics {
+  /**
+   * @brief The current size of the scheduling window
+   */
+  std::uint32_t window_size{};
+  /**
+   * @brief Number of flushes triggered by the window being full
+   */
+  std::uint64_t num_full_flushes{};
+  /**
+   * @brief Number of flushes triggered by an operation that needs to be launched right away
+   */
+  std::uint64_t num_forced_flushes{};
+  /**
+   * @brief Number of flushes requested by the runtime or the application
+   */
+  std::uint64_t num_explicit_flushes{};
+  /**
+   * @brief Total number of operations in the window at the time of the flushes, which divided
+   * by the number of flushes gives the average occupancy of the window
+   */
+  std::uint64_t num_flushed_operations{};
+  /**
+   * @brief Largest number of operations in the window at the time of a flush
+   */
+  std::uint64_t max_occupancy{};
+  /**
+   * @brief Number of times the size of the window was changed by the adaptive sizing
+   */
+  std::uint64_t num_resizes{};
+};
+
+/** @} */
+
+}  // namespace legate
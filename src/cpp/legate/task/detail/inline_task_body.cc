@@ -15,37 +15,73 @@
 #include <legate/mapping/detail/machine.h>
 #include <legate/operation/detail/task.h>
 #include <legate/operation/detail/task_store_arg.h>
+#include <legate/partitioning/detail/partition/no_partition.h>
+#include <legate/partitioning/detail/partition/tiling.h>
+#include <legate/partitioning/detail/strategy.h>
 #include <legate/runtime/detail/library.h>
 #include <legate/runtime/detail/runtime.h>
+#include <legate/task/detail/inline_thread_pool.h>
 #include <legate/task/detail/task.h>
 #include <legate/task/detail/task_context.h>
 #include <legate/task/detail/task_info.h>
 #include <legate/task/task_context.h>
 #include <legate/utilities/assert.h>
+#include <legate/utilities/detail/enumerate.h>
+#include <legate/utilities/detail/formatters.h>
+#include <legate/utilities/detail/small_vector.h>
+#include <legate/utilities/detail/traced_exception.h>
 #include <legate/utilities/detail/type_traits.h>
+#include <legate/utilities/detail/zip.h>
 #include <legate/utilities/internal_shared_ptr.h>
 #include <legate/utilities/scope_guard.h>
 #include <legate/utilities/typedefs.h>
 
+#include <fmt/format.h>
+
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <optional>
+#include <stdexcept>
 #include <string_view>
 #include <utility>
+#include <variant>
 
 namespace legate::detail {
 
 namespace {
 
+/**
+ * @brief A point of an index launch executed inline.
+ */
+struct InlineTaskPoint {
+  DomainPoint index{};
+  const Domain* launch_domain{};
+  // The store arguments of the point, mapped ahead of time
+  SmallVector<TaskStoreArg> inputs{};
+  SmallVector<TaskStoreArg> outputs{};
+  SmallVector<TaskStoreArg> reductions{};
+  // The tiles of the partitioned stores. The physical stores of the point refer to their
+  // domains, so they must outlive the execution of the point.
+  SmallVector<InternalSharedPtr<LogicalStore>> tiles{};
+};
+
 class InlineTaskContext final : public TaskContext {
  public:
-  InlineTaskContext(VariantCode variant_code,
-                    SmallVector<InternalSharedPtr<PhysicalStore>> inputs,
-                    SmallVector<InternalSharedPtr<PhysicalStore>> outputs,
-                    SmallVector<InternalSharedPtr<PhysicalStore>> reductions,
-                    SmallVector<InternalSharedPtr<Scalar>> scalars,
-                    const TaskBase* task);
+  /**
+   * @param args The arguments of the context.
+   * @param task The task to execute.
+   * @param point The point of the index launch to execute, or `nullptr` for a single task.
+   */
+  InlineTaskContext(CtorArgs&& args, const TaskBase* task, const InlineTaskPoint* point);
+
+  /**
+   * @brief Moves the arguments out of this context, so that their storage can be recycled.
+   *
+   * @return The arguments of the context.
+   */
+  [[nodiscard]] CtorArgs release_args() noexcept;
 
   [[nodiscard]] GlobalTaskID task_id() const noexcept override;
   [[nodiscard]] bool is_single_task() const noexcept override;
@@ -58,6 +94,7 @@ class InlineTaskContext final : public TaskContext {
   [[nodiscard]] const TaskBase& task_() const;
 
   const TaskBase* op_task_{};
+  const InlineTaskPoint* point_{};
 };
 
 // ==========================================================================================
@@ -66,24 +103,15 @@ const TaskBase& InlineTaskContext::task_() const { return *op_task_; }
 
 // ==========================================================================================
 
-InlineTaskContext::InlineTaskContext(VariantCode variant_code,
-                                     SmallVector<InternalSharedPtr<PhysicalStore>> inputs,
-                                     SmallVector<InternalSharedPtr<PhysicalStore>> outputs,
-                                     SmallVector<InternalSharedPtr<PhysicalStore>> reductions,
-                                     SmallVector<InternalSharedPtr<Scalar>> scalars,
-                                     const TaskBase* task)
-  : TaskContext{{variant_code,
-                 task->can_throw_exception(),
-                 task->can_elide_device_ctx_sync(),
-                 std::move(inputs),
-                 std::move(outputs),
-                 std::move(reductions),
-                 std::move(scalars),
-                 SmallVector<legate::comm::Communicator>{}}},
-    op_task_{task}
+InlineTaskContext::InlineTaskContext(CtorArgs&& args,
+                                     const TaskBase* task,
+                                     const InlineTaskPoint* point)
+  : TaskContext{std::move(args)}, op_task_{task}, point_{point}
 {
 }
 
+TaskContext::CtorArgs InlineTaskContext::release_args() noexcept { return release_args_(); }
+
 GlobalTaskID InlineTaskContext::task_id() const noexcept
 {
   const auto& task = task_();
@@ -91,20 +119,20 @@ GlobalTaskID InlineTaskContext::task_id() const noexcept
   return task.library().get_task_id(task.local_task_id());
 }
 
-bool InlineTaskContext::is_single_task() const noexcept { return true; }
+bool InlineTaskContext::is_single_task() const noexcept { return point_ == nullptr; }
 
 const DomainPoint& InlineTaskContext::get_task_index() const noexcept
 {
   static const DomainPoint p{};
 
-  return p;
+  return point_ ? point_->index : p;
 }
 
 const Domain& InlineTaskContext::get_launch_domain() const noexcept
 {
   static const auto launch_domain = Domain{DomainPoint{0}, DomainPoint{0}};
 
-  return launch_domain;
+  return point_ ? *point_->launch_domain : launch_domain;
 }
 
 std::string_view InlineTaskContext::get_provenance() const noexcept
@@ -159,18 +187,16 @@ const mapping::detail::Machine& InlineTaskContext::machine() const noexcept
                     elem.store);
 }
 
-[[nodiscard]] SmallVector<InternalSharedPtr<PhysicalStore>> fill_vector(
-  Span<const TaskStoreArg> src,
-  Span<const mapping::InstanceMappingPolicy> mapping_policies,
-  bool ignore_future_mutability,
-  SmallVector<Legion::UntypedDeferredValue>* deferred_buffers)
+void fill_vector(Span<const TaskStoreArg> src,
+                 Span<const mapping::InstanceMappingPolicy> mapping_policies,
+                 bool ignore_future_mutability,
+                 SmallVector<InternalSharedPtr<PhysicalStore>>* dest,
+                 SmallVector<Legion::UntypedDeferredValue>* deferred_buffers)
 {
-  SmallVector<InternalSharedPtr<PhysicalStore>> dest;
-
-  dest.reserve(src.size());
+  dest->reserve(src.size());
   for (auto&& [elem, policy] : zip_equal(src, mapping_policies)) {
     auto&& phys_store =
-      dest.emplace_back(extract_physical_store(elem, policy, ignore_future_mutability));
+      dest->emplace_back(extract_physical_store(elem, policy, ignore_future_mutability));
 
     if (!ignore_future_mutability) {
       continue;
@@ -182,7 +208,6 @@ const mapping::detail::Machine& InlineTaskContext::machine() const noexcept
       deferred_buffers->emplace_back(fut_store->get_buffer());
     }
   }
-  return dest;
 }
 
 struct TaskStoreMappingPolicies {
@@ -191,6 +216,98 @@ struct TaskStoreMappingPolicies {
   SmallVector<mapping::InstanceMappingPolicy> reduction_policies{};
 };
 
+/**
+ * @brief The containers needed to construct the context of an inline task launch.
+ */
+struct InlineTaskArgs {
+  TaskStoreMappingPolicies mapping_policies{};
+  TaskContext::CtorArgs ctx_args{};
+  SmallVector<Legion::UntypedDeferredValue> deferred_buffers{};
+
+  /**
+   * @brief Drops all the elements, but keeps the capacity of the containers.
+   */
+  void clear() noexcept;
+};
+
+void InlineTaskArgs::clear() noexcept
+{
+  mapping_policies.input_policies.clear();
+  mapping_policies.output_policies.clear();
+  mapping_policies.reduction_policies.clear();
+  ctx_args.inputs.clear();
+  ctx_args.outputs.clear();
+  ctx_args.reductions.clear();
+  ctx_args.scalars.clear();
+  ctx_args.comms.clear();
+  deferred_buffers.clear();
+}
+
+/**
+ * @brief Recycles the containers used to construct the contexts of inline task launches.
+ *
+ * Tasks with more arguments than fit in the inline storage of a `SmallVector` would otherwise
+ * allocate the vectors of mapping policies, stores and scalars anew for every launch. The
+ * containers handed out by the pool are empty, but keep the capacity they grew to in previous
+ * launches. The physical stores themselves are not recreated either, as the logical stores cache
+ * their mapped physical stores.
+ *
+ * The pool holds more than one set of containers, so that a task body can itself launch tasks
+ * inline.
+ */
+class InlineTaskArgsPool {
+ public:
+  static constexpr std::size_t MAX_SIZE = 4;
+
+  /**
+   * @return The pool of the calling thread.
+   */
+  [[nodiscard]] static InlineTaskArgsPool& get();
+
+  /**
+   * @return A set of empty containers.
+   */
+  [[nodiscard]] InlineTaskArgs acquire();
+
+  /**
+   * @brief Returns containers to the pool.
+   *
+   * @param args The containers to return. Their elements are dropped.
+   */
+  void release(InlineTaskArgs&& args);
+
+ private:
+  SmallVector<InlineTaskArgs, MAX_SIZE> free_{};
+};
+
+InlineTaskArgsPool& InlineTaskArgsPool::get()
+{
+  static thread_local InlineTaskArgsPool pool{};
+
+  return pool;
+}
+
+InlineTaskArgs InlineTaskArgsPool::acquire()
+{
+  if (free_.empty()) {
+    return {};
+  }
+
+  auto ret = std::move(free_.back());
+
+  free_.pop_back();
+  return ret;
+}
+
+void InlineTaskArgsPool::release(InlineTaskArgs&& args)
+{
+  if (free_.size() >= MAX_SIZE) {
+    return;
+  }
+  args.clear();
+  free_.emplace_back(std::move(args));
+}
+
 /**
  * @brief Get the default store target options for each variant.
  *
@@ -230,42 +347,61 @@ struct TaskStoreMappingPolicies {
  *
  * @param task The task to generate the policies for.
  * @param variant_code The variant.
- *
- * @return The store mapping policies
+ * @param policies The store mapping policies to fill.
  */
-[[nodiscard]] TaskStoreMappingPolicies make_store_mapping_policies(const TaskBase& task,
-                                                                   VariantCode variant_code)
+void make_store_mapping_policies(const TaskBase& task,
+                                 VariantCode variant_code,
+                                 TaskStoreMappingPolicies* policies)
 {
   const auto target_options = get_default_target_options(variant_code);
-  auto ret                  = [&] {
-    const auto default_policy =
-      mapping::InstanceMappingPolicy{}.with_target(target_options.front());
-
-    return TaskStoreMappingPolicies{
-      /* input_policies */ {tags::size_tag, task.inputs().size(), default_policy},
-      /* output_policies */ {tags::size_tag, task.outputs().size(), default_policy},
-      /* reduction_policies */ {tags::size_tag, task.reductions().size(), default_policy},
-    };
-  }();
+  const auto default_policy = mapping::InstanceMappingPolicy{}.with_target(target_options.front());
+
+  policies->input_policies.assign(tags::size_tag, task.inputs().size(), default_policy);
+  policies->output_policies.assign(tags::size_tag, task.outputs().size(), default_policy);
+  policies->reduction_policies.assign(tags::size_tag, task.reductions().size(), default_policy);
 
   if (auto&& sm = task.library().find_task(task.local_task_id())->task_config()->store_mappings();
       sm.has_value()) {
-    sm->apply_inline(
-      task, target_options, &ret.input_policies, &ret.output_policies, &ret.reduction_policies);
+    sm->apply_inline(task,
+                     target_options,
+                     &policies->input_policies,
+                     &policies->output_policies,
+                     &policies->reduction_policies);
   }
-  return ret;
 }
 
-[[nodiscard]] std::pair<InlineTaskContext, SmallVector<Legion::UntypedDeferredValue>>
-make_inline_task_context(const TaskBase& task, VariantCode variant_code)
+/**
+ * @brief Create the context of an inline task launch.
+ *
+ * @param task The task to create the context for.
+ * @param variant_code The variant.
+ * @param point The point of the index launch to create the context for, or `nullptr` for a single
+ * task.
+ * @param args The (empty) containers to construct the context from. On return, the containers
+ * of the context arguments have been moved into the context, and `args->deferred_buffers` holds
+ * the deferred buffers of the scalar outputs and reductions.
+ *
+ * @return The context.
+ */
+[[nodiscard]] InlineTaskContext make_inline_task_context(const TaskBase& task,
+                                                         VariantCode variant_code,
+                                                         const InlineTaskPoint* point,
+                                                         InlineTaskArgs* args)
 {
-  const auto mapping_policies = make_store_mapping_policies(task, variant_code);
-  auto deferred_buffers       = SmallVector<Legion::UntypedDeferredValue>{};
-
-  auto inputs = fill_vector(task.inputs(),
-                            mapping_policies.input_policies,
-                            /* ignore_future_mutability */ false,
-                            &deferred_buffers);
+  auto&& mapping_policies = args->mapping_policies;
+  auto&& ctx_args         = args->ctx_args;
+  auto&& deferred_buffers = args->deferred_buffers;
+  // The points of index launches have store arguments of their own
+  const auto inputs     = point ? Span<const TaskStoreArg>{point->inputs} : task.inputs();
+  const auto outputs    = point ? Span<const TaskStoreArg>{point->outputs} : task.outputs();
+  const auto reductions = point ? Span<const TaskStoreArg>{point->reductions} : task.reductions();
+
+  make_store_mapping_policies(task, variant_code, &mapping_policies);
+  fill_vector(inputs,
+              mapping_policies.input_policies,
+              /* ignore_future_mutability */ false,
+              &ctx_args.inputs,
+              &deferred_buffers);
   // None of the inputs should ever create an output buffer
   LEGATE_CHECK(deferred_buffers.empty());
   // We do these here instead of inline in the function arguments because the order in which
@@ -301,32 +437,35 @@ make_inline_task_context(const TaskBase& task, VariantCode variant_code)
     LEGATE_ABORT("Unhandled task kind");
   }
 
-  auto outputs    = fill_vector(task.outputs(),
-                                mapping_policies.output_policies,
-                                /* ignore_future_mutability */ true,
-                                &deferred_buffers);
-  auto reductions = fill_vector(task.reductions(),
-                                mapping_policies.reduction_policies,
-                                /* ignore_future_mutability */ true,
-                                &deferred_buffers);
-
-  return {InlineTaskContext{variant_code,
-                            std::move(inputs),
-                            std::move(outputs),
-                            std::move(reductions),
-                            SmallVector<InternalSharedPtr<Scalar>>{task.scalars()},
-                            &task},
-          std::move(deferred_buffers)};
+  fill_vector(outputs,
+              mapping_policies.output_policies,
+              /* ignore_future_mutability */ true,
+              &ctx_args.outputs,
+              &deferred_buffers);
+  fill_vector(reductions,
+              mapping_policies.reduction_policies,
+              /* ignore_future_mutability */ true,
+              &ctx_args.reductions,
+              &deferred_buffers);
+
+  const auto scalars = task.scalars();
+
+  ctx_args.scalars.assign(tags::iterator_tag, scalars.begin(), scalars.end());
+  ctx_args.variant_kind              = variant_code;
+  ctx_args.can_raise_exception       = task.can_throw_exception();
+  ctx_args.can_elide_device_ctx_sync = task.can_elide_device_ctx_sync();
+  return InlineTaskContext{std::move(ctx_args), &task, point};
 }
 
 template <typename F>
-[[nodiscard]] std::pair<std::optional<ReturnedException>, SmallVector<Legion::UntypedDeferredValue>>
-execute_task(const TaskBase& task,
-             VariantCode variant_code,
-             VariantImpl variant_impl,
-             F&& get_task_name)
+[[nodiscard]] std::optional<ReturnedException> execute_task(const TaskBase& task,
+                                                           VariantCode variant_code,
+                                                           VariantImpl variant_impl,
+                                                           F&& get_task_name,
+                                                           const InlineTaskPoint* point,
+                                                           InlineTaskArgs* args)
 {
-  auto [ctx, deferred_buffers] = make_inline_task_context(task, variant_code);
+  auto ctx = make_inline_task_context(task, variant_code, point, args);
   auto exn =
     task_detail::task_body(legate::TaskContext{&ctx}, variant_impl, std::forward<F>(get_task_name));
 
@@ -337,7 +476,8 @@ execute_task(const TaskBase& task,
     cuda::detail::sync_current_ctx();
   }
 
-  return {std::move(exn), std::move(deferred_buffers)};
+  args->ctx_args = ctx.release_args();
+  return exn;
 }
 
 void handle_return_values_impl(const LogicalTask& task,
@@ -424,9 +564,20 @@ void handle_return_values(const TaskBase& task,
   }
 }
 
-}  // namespace
-
-void inline_task_body(const TaskBase& task, VariantCode variant_code, VariantImpl variant_impl)
+/**
+ * @brief Execute a task, or a point of an index launch, inline.
+ *
+ * @param task The task to execute.
+ * @param variant_code The variant to execute.
+ * @param variant_impl The body of the variant.
+ * @param point The point of the index launch to execute, or `nullptr` for a single task.
+ *
+ * @return The exception raised by the task, if any.
+ */
+[[nodiscard]] std::optional<ReturnedException> run_inline_task(const TaskBase& task,
+                                                              VariantCode variant_code,
+                                                              VariantImpl variant_impl,
+                                                              const InlineTaskPoint* point)
 {
   const auto _ = [variant_code] {
     Runtime::get_runtime().inline_task_start(variant_code);
@@ -437,16 +588,214 @@ void inline_task_body(const TaskBase& task, VariantCode variant_code, VariantImp
     task_detail::make_nvtx_range(get_task_name, [&] { return task.provenance().as_string_view(); });
   static_cast<void>(_1);
 
-  show_progress({}, get_task_name(), task.provenance().as_string_view());
+  show_progress(point ? point->index : DomainPoint{},
+                get_task_name(),
+                task.provenance().as_string_view());
 
-  auto [exception, deferred_buffers] =
-    execute_task(task, variant_code, variant_impl, get_task_name);
+  auto&& pool    = InlineTaskArgsPool::get();
+  auto args      = pool.acquire();
+  auto exception = execute_task(task, variant_code, variant_impl, get_task_name, point, &args);
 
-  handle_return_values(task, deferred_buffers);
+  handle_return_values(task, args.deferred_buffers);
+  pool.release(std::move(args));
+  return exception;
+}
+
+/**
+ * @brief Get the tile of a store that a point of an index launch accesses.
+ *
+ * The tile shares the storage and the transform of the store, so that the point sees its tile in
+ * the coordinates of the whole store, as it would if the launch went through Legion.
+ *
+ * @param arg The store argument of the launch.
+ * @param strategy The strategy of the launch.
+ * @param point The point.
+ *
+ * @return The tile.
+ *
+ * @throw std::invalid_argument If the store isn't partitioned in a way inline execution supports.
+ */
+[[nodiscard]] InternalSharedPtr<LogicalStore> get_tile(const TaskStoreArg& arg,
+                                                       const Strategy& strategy,
+                                                       const DomainPoint& point)
+{
+  const auto& store = std::get<InternalSharedPtr<LogicalStore>>(arg.store);
+
+  if (!strategy.has_assignment(*arg.variable)) {
+    throw TracedException<std::invalid_argument>{
+      "Unbound stores are not supported by index launches executed inline"};
+  }
+
+  const auto& partition = strategy[*arg.variable];
+
+  if (dynamic_cast<const NoPartition*>(partition.get())) {
+    return store;
+  }
+
+  const auto* const tiling = dynamic_cast<const Tiling*>(partition.get());
+
+  if (!tiling) {
+    throw TracedException<std::invalid_argument>{fmt::format(
+      "Partition {} is not supported by index launches executed inline", partition->to_string())};
+  }
+
+  auto color = SmallVector<std::uint64_t, LEGATE_MAX_DIM>{};
+
+  color.reserve(static_cast<std::size_t>(point.get_dim()));
+  for (std::int32_t dim = 0; dim < point.get_dim(); ++dim) {
+    color.push_back(static_cast<std::uint64_t>(point[dim]));
+  }
+  if (color.size() != tiling->color_shape().size() || !tiling->has_color(color)) {
+    throw TracedException<std::invalid_argument>{
+      fmt::format("Point {} of the launch does not name a tile of partition {}",
+                  point,
+                  partition->to_string())};
+  }
+
+  auto extents            = tiling->get_child_extents(store->extents(), color);
+  const auto& transform   = store->transform();
+  const auto root_offsets = transform->invert_point(tiling->get_child_offsets(color));
+  const auto root_extents = transform->invert_extents(extents);
+  auto lo                 = DomainPoint{};
+  auto hi                 = DomainPoint{};
+
+  lo.dim = static_cast<std::int32_t>(root_offsets.size());
+  hi.dim = lo.dim;
+  for (auto&& [dim, offset] : enumerate(root_offsets)) {
+    lo[dim] = offset;
+    hi[dim] = offset + static_cast<std::int64_t>(root_extents[dim]) - 1;
+  }
+  return make_internal_shared<LogicalStore>(
+    std::move(extents), store->get_storage(), store->type(), transform, Domain{lo, hi});
+}
+
+/**
+ * @brief Create the points of an index launch, and map the tiles they access.
+ *
+ * The tiles are mapped by the calling thread, as mapping a store may flush the scheduling window.
+ *
+ * @param task The index launch.
+ * @param variant_code The variant to execute.
+ *
+ * @return The points.
+ */
+[[nodiscard]] SmallVector<InlineTaskPoint> make_inline_task_points(const ManualTask& task,
+                                                                   VariantCode variant_code)
+{
+  const auto& strategy      = *task.strategy();
+  const auto& launch_domain = strategy.launch_domain();
+  auto policies             = TaskStoreMappingPolicies{};
+  auto points               = SmallVector<InlineTaskPoint>{};
+
+  make_store_mapping_policies(task, variant_code, &policies);
+  points.reserve(launch_domain.get_volume());
+  for (Domain::DomainPointIterator it{launch_domain}; it; ++it) {
+    auto&& point = points.emplace_back();
+
+    point.index         = *it;
+    point.launch_domain = &launch_domain;
+
+    const auto map_tiles = [&](Span<const TaskStoreArg> args,
+                               Span<const mapping::InstanceMappingPolicy> arg_policies,
+                               bool ignore_future_mutability,
+                               SmallVector<TaskStoreArg>* dest) {
+      for (auto&& [arg, policy] : zip_equal(args, arg_policies)) {
+        auto tile = get_tile(arg, strategy, point.index);
+
+        dest->emplace_back(
+          arg.privilege,
+          extract_physical_store(
+            TaskStoreArg{arg.privilege, tile}, policy, ignore_future_mutability));
+        point.tiles.emplace_back(std::move(tile));
+      }
+    };
+
+    map_tiles(task.inputs(),
+              policies.input_policies,
+              /* ignore_future_mutability */ false,
+              &point.inputs);
+    map_tiles(task.outputs(),
+              policies.output_policies,
+              /* ignore_future_mutability */ true,
+              &point.outputs);
+    map_tiles(task.reductions(),
+              policies.reduction_policies,
+              /* ignore_future_mutability */ true,
+              &point.reductions);
+  }
+  return points;
+}
+
+/**
+ * @brief Decide whether the points of an index launch can run concurrently.
+ *
+ * Points run concurrently only if they are CPU tasks, as OpenMP and GPU tasks already use all
+ * the processors of their kind, and if every store they write is split into disjoint tiles.
+ *
+ * @param task The index launch.
+ * @param variant_code The variant to execute.
+ *
+ * @return `true` if the points can run concurrently, `false` otherwise.
+ */
+[[nodiscard]] bool points_can_run_concurrently(const ManualTask& task, VariantCode variant_code)
+{
+  if (variant_code != VariantCode::CPU) {
+    return false;
+  }
+
+  const auto& strategy       = *task.strategy();
+  const auto writes_own_tile = [&](const TaskStoreArg& arg) {
+    const auto& store     = std::get<InternalSharedPtr<LogicalStore>>(arg.store);
+    const auto& partition = strategy[*arg.variable];
+
+    // The tiles of a store with broadcast dimensions alias each other
+    return dynamic_cast<const Tiling*>(partition.get()) &&
+           partition->is_disjoint_for(strategy.launch_domain()) &&
+           store->transform()->find_imaginary_dims().empty();
+  };
+
+  return std::all_of(task.outputs().begin(), task.outputs().end(), writes_own_tile) &&
+         std::all_of(task.reductions().begin(), task.reductions().end(), writes_own_tile);
+}
+
+}  // namespace
+
+void inline_task_body(const TaskBase& task, VariantCode variant_code, VariantImpl variant_impl)
+{
+  auto exception = run_inline_task(task, variant_code, variant_impl, /* point */ nullptr);
 
   if (exception.has_value()) {
     detail::Runtime::get_runtime().record_pending_exception(*std::move(exception));
   }
 }
 
+void inline_index_task_body(const ManualTask& task,
+                            VariantCode variant_code,
+                            VariantImpl variant_impl)
+{
+  if (!task.scalar_outputs().empty() || !task.scalar_reductions().empty()) {
+    throw TracedException<std::invalid_argument>{
+      "Stores backed by futures are not supported by index launches executed inline"};
+  }
+
+  const auto points      = make_inline_task_points(task, variant_code);
+  const auto num_threads = points_can_run_concurrently(task, variant_code)
+                             ? std::max(task.machine().count(mapping::TaskTarget::CPU), 1U)
+                             : 1U;
+  auto exceptions        =
+    SmallVector<std::optional<ReturnedException>>{tags::size_tag, points.size(), std::nullopt};
+
+  InlineThreadPool::get().run(points.size(), num_threads, [&](std::size_t i) {
+    exceptions[i] = run_inline_task(task, variant_code, variant_impl, &points[i]);
+  });
+
+  // Only the exception of the first point that raised one is reported
+  for (auto&& exception : exceptions) {
+    if (exception.has_value()) {
+      detail::Runtime::get_runtime().record_pending_exception(*std::move(exception));
+      break;
+    }
+  }
+}
+
 }  // namespace legate::detail
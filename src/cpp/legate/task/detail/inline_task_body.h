@@ -13,4 +13,24 @@ namespace legate::detail {
 
 void inline_task_body(const TaskBase& task, VariantCode variant_code, VariantImpl variant_impl);
 
+/**
+ * @brief Execute the points of an index launch inline.
+ *
+ * Each point gets the tiles of the partitioned stores it accesses, and the whole of the stores
+ * that aren't partitioned. The points of CPU tasks run concurrently on local threads, up to the
+ * number of CPUs of the machine of the launch, unless the tiles of the stores they write overlap.
+ * The points of other tasks run one after the other on the calling thread. Exceptions raised by
+ * the points are handled as they would be for a single task launched inline.
+ *
+ * @param task The index launch.
+ * @param variant_code The variant to execute.
+ * @param variant_impl The body of the variant.
+ *
+ * @throw std::invalid_argument If the launch has unbound stores, stores backed by futures, or
+ * stores partitioned other than by tiling.
+ */
+void inline_index_task_body(const ManualTask& task,
+                            VariantCode variant_code,
+                            VariantImpl variant_impl);
+
 }  // namespace legate::detail
@@ -0,0 +1,133 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/task/detail/inline_thread_pool.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace legate::detail {
+
+InlineThreadPool::~InlineThreadPool()
+{
+  {
+    const std::lock_guard lock{mutex_};
+
+    stopping_ = true;
+  }
+  work_cv_.notify_all();
+  for (auto&& thread : threads_) {
+    thread.join();
+  }
+}
+
+/*static*/ InlineThreadPool& InlineThreadPool::get()
+{
+  static InlineThreadPool pool{};
+
+  return pool;
+}
+
+void InlineThreadPool::run(std::size_t num_jobs,
+                           std::uint32_t num_threads,
+                           const std::function<void(std::size_t)>& job)
+{
+  const auto num_helpers = std::min<std::size_t>(num_threads, num_jobs);
+  std::unique_lock lock{mutex_};
+
+  if (busy_ || num_helpers <= 1) {
+    lock.unlock();
+    run_serially_(num_jobs, job);
+    return;
+  }
+
+  // The calling thread is one of the threads running the batch
+  while (threads_.size() < num_helpers - 1) {
+    threads_.emplace_back([this, thread_index = threads_.size()] { work_(thread_index); });
+  }
+  busy_            = true;
+  job_             = &job;
+  num_jobs_        = num_jobs;
+  num_helpers_     = num_helpers - 1;
+  num_working_     = num_helpers_;
+  first_exception_ = nullptr;
+  next_job_.store(0, std::memory_order_relaxed);
+  ++generation_;
+  lock.unlock();
+  work_cv_.notify_all();
+
+  drain_();
+
+  lock.lock();
+  done_cv_.wait(lock, [&] { return num_working_ == 0; });
+  busy_ = false;
+  job_  = nullptr;
+  if (auto exn = std::exchange(first_exception_, nullptr)) {
+    lock.unlock();
+    std::rethrow_exception(std::move(exn));
+  }
+}
+
+void InlineThreadPool::run_serially_(std::size_t num_jobs,
+                                     const std::function<void(std::size_t)>& job)
+{
+  std::exception_ptr first_exception{};
+
+  // Like a batch run on the pool, a job that throws doesn't stop the others
+  for (std::size_t i = 0; i < num_jobs; ++i) {
+    try {
+      job(i);
+    } catch (...) {
+      if (!first_exception) {
+        first_exception = std::current_exception();
+      }
+    }
+  }
+  if (first_exception) {
+    std::rethrow_exception(std::move(first_exception));
+  }
+}
+
+void InlineThreadPool::work_(std::size_t thread_index)
+{
+  std::uint64_t seen_generation = 0;
+  std::unique_lock lock{mutex_};
+
+  while (true) {
+    work_cv_.wait(lock, [&] {
+      return stopping_ || (generation_ != seen_generation && thread_index < num_helpers_);
+    });
+    if (stopping_) {
+      return;
+    }
+    seen_generation = generation_;
+    lock.unlock();
+    drain_();
+    lock.lock();
+    if (--num_working_ == 0) {
+      done_cv_.notify_one();
+    }
+  }
+}
+
+void InlineThreadPool::drain_()
+{
+  for (auto i = next_job_.fetch_add(1, std::memory_order_relaxed); i < num_jobs_;
+       i      = next_job_.fetch_add(1, std::memory_order_relaxed)) {
+    try {
+      (*job_)(i);
+    } catch (...) {
+      const std::lock_guard lock{mutex_};
+
+      if (!first_exception_ || i < first_exception_job_) {
+        first_exception_     = std::current_exception();
+        first_exception_job_ = i;
+      }
+    }
+  }
+}
+
+}  // namespace legate::detail
@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace legate::detail {
+
+/**
+ * @brief Runs the points of index launches executed inline on local threads.
+ *
+ * The pool starts threads on demand, up to the largest number of threads a batch of jobs has
+ * asked for, and keeps them waiting for work between batches. The thread that submits a batch
+ * works on it as well. Only one batch runs at a time: a batch submitted while another is running
+ * (e.g., by a job of that batch) runs on the calling thread alone.
+ */
+class InlineThreadPool {
+ public:
+  InlineThreadPool() = default;
+  ~InlineThreadPool();
+
+  InlineThreadPool(const InlineThreadPool&)            = delete;
+  InlineThreadPool& operator=(const InlineThreadPool&) = delete;
+  InlineThreadPool(InlineThreadPool&&)                 = delete;
+  InlineThreadPool& operator=(InlineThreadPool&&)      = delete;
+
+  /**
+   * @return The pool of the process.
+   */
+  [[nodiscard]] static InlineThreadPool& get();
+
+  /**
+   * @brief Run a batch of jobs, and wait for all of them to finish.
+   *
+   * The jobs run in no particular order. A job that throws doesn't stop the others.
+   *
+   * @param num_jobs The number of jobs. `job` is called once with each of the indices
+   * `[0, num_jobs)`.
+   * @param num_threads The maximum number of threads to run the jobs on, including the calling
+   * thread.
+   * @param job The job.
+   *
+   * @throw The exception thrown by the job with the lowest index, if any.
+   */
+  void run(std::size_t num_jobs,
+           std::uint32_t num_threads,
+           const std::function<void(std::size_t)>& job);
+
+ private:
+  // Runs a batch on the calling thread, when the pool can't help with it
+  static void run_serially_(std::size_t num_jobs, const std::function<void(std::size_t)>& job);
+  void work_(std::size_t thread_index);
+  // Runs jobs of the current batch until there is none left
+  void drain_();
+
+  std::mutex mutex_{};
+  std::condition_variable work_cv_{};
+  std::condition_variable done_cv_{};
+  std::vector<std::thread> threads_{};
+  bool stopping_{};
+
+  // The state of the current batch, protected by mutex_ except for next_job_
+  bool busy_{};
+  std::uint64_t generation_{};
+  const std::function<void(std::size_t)>* job_{};
+  std::size_t num_jobs_{};
+  std::atomic<std::size_t> next_job_{};
+  std::size_t num_helpers_{};
+  std::size_t num_working_{};
+  std::size_t first_exception_job_{};
+  std::exception_ptr first_exception_{};
+};
+
+}  // namespace legate::detail
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <utility>
 
 #if LEGATE_DEFINED(LEGATE_USE_OPENMP)
 #include <legate/runtime/detail/config.h>
@@ -65,6 +66,20 @@ TaskContext::TaskContext(CtorArgs&& args)
   }
 }
 
+TaskContext::CtorArgs TaskContext::release_args_() noexcept
+{
+  unbound_stores_.clear();
+  scalar_stores_.clear();
+  return {variant_kind_,
+          can_raise_exception_,
+          can_elide_device_ctx_sync_,
+          std::move(inputs_),
+          std::move(outputs_),
+          std::move(reductions_),
+          std::move(scalars_),
+          std::move(comms_)};
+}
+
 void TaskContext::make_all_unbound_stores_empty()
 {
   for (auto&& store : get_unbound_stores_()) {
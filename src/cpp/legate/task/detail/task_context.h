@@ -71,6 +71,16 @@ class TaskContext {
   [[nodiscard]] Span<const InternalSharedPtr<PhysicalStore>> get_unbound_stores_() const noexcept;
   [[nodiscard]] Span<const InternalSharedPtr<PhysicalStore>> get_scalar_stores_() const noexcept;
 
+  /**
+   * @brief Moves the arguments out of this context, so that their storage can be reused to
+   * construct another context.
+   *
+   * The context must not be used by a task after this call.
+   *
+   * @return The arguments this context was constructed with.
+   */
+  [[nodiscard]] CtorArgs release_args_() noexcept;
+
  private:
   VariantCode variant_kind_;
   SmallVector<InternalSharedPtr<PhysicalStore>> inputs_{};
@@ -35,6 +35,15 @@ std::ostream& operator<<(std::ostream& os, const VariantOptions& options)
   if (options.may_throw_exception) {
     os << "may_throw_exceptions,";
   }
+  if (options.stealable) {
+    os << "stealable,";
+  }
+  if (options.fusable) {
+    os << "fusable,";
+  }
+  if (options.read_ahead) {
+    os << "read_ahead,";
+  }
   if (const auto& comms = options.communicators; comms.has_value()) {
     os << "communicator(";
     for (auto&& c : *comms) {
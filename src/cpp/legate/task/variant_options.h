@@ -154,6 +154,58 @@ class LEGATE_EXPORT VariantOptions {
    */
   bool may_throw_exception{};
 
+  /**
+   * @brief Whether the leaf tasks of this variant may be stolen by idle processors. `false` by
+   * default.
+   *
+   * Normally, each leaf task of a parallel launch is assigned to a processor up front, and runs
+   * there. If the leaf tasks have irregular costs (for example, because the data is sparse or
+   * ragged), some processors may run out of work while others still have a long queue of leaf
+   * tasks to go through.
+   *
+   * Setting `stealable` to `true` allows an idle processor to take over leaf tasks that have not
+   * started yet from another processor. This only has an effect when a launch is
+   * over-decomposed, i.e. when there are more leaf tasks than processors. Tasks are only ever
+   * stolen by processors of the same kind, on the same node, and with affinity to the same
+   * memory as the original target, so the instances mapped for the task stay local.
+   *
+   * Concurrent tasks (see `concurrent`) and tasks launched in a streaming scope are never
+   * stolen.
+   *
+   * @see ParallelPolicy::with_work_stealing()
+   */
+  bool stealable{};
+
+  /**
+   * @brief Whether launches of this variant may be fused with neighboring launches. `false` by
+   * default.
+   *
+   * A chain of small elementwise tasks pays for one partitioning pass and one launch per task.
+   * If consecutive tasks in the scheduling window all have fusable variants, the runtime may
+   * replace them with a single launch that runs the variants back to back on each leaf task.
+   *
+   * Only mark a variant fusable if it is elementwise: each leaf task must only access the part
+   * of its stores that corresponds to its own part of the launch, and the variant must work with
+   * any partitioning in which all of its stores are aligned. The runtime only fuses tasks that
+   * have no constraints other than alignments, no reductions, no scalar or unbound outputs, no
+   * communicators, no allocations, and that neither throw exceptions, have side effects, nor run
+   * concurrently. Fused launches are mapped by the core mapper, so only tasks of libraries
+   * created without a custom mapper are fused.
+   */
+  bool fusable{};
+
+  /**
+   * @brief Whether the leaf tasks of this variant only read external data, such as a file, into
+   * their outputs. `false` by default.
+   *
+   * In a streaming scope run with ``--streaming-read-ahead``, the mapper may map the leaf tasks
+   * of such variants for the next column of the streaming generation while the current column is
+   * still being computed, so that the reads overlap with the computation. Only mark a variant
+   * this way if it has no inputs, and if the size of each of its outputs is known when the task
+   * is mapped.
+   */
+  bool read_ahead{};
+
   /**
    * @brief The maximum number of communicators allowed per variant.
    *
@@ -220,6 +272,40 @@ class LEGATE_EXPORT VariantOptions {
    */
   constexpr VariantOptions& with_may_throw_exception(bool may_throw) noexcept;
 
+  /**
+   * @brief Sets whether the leaf tasks of the variant may be stolen by idle processors.
+   *
+   * @param `stealable` `true` if the leaf tasks may be stolen, `false` otherwise.
+   *
+   * @return reference to `this`.
+   *
+   * @see stealable.
+   */
+  constexpr VariantOptions& with_stealable(bool stealable) noexcept;
+
+  /**
+   * @brief Sets whether launches of the variant may be fused with neighboring launches.
+   *
+   * @param `fusable` `true` if the launches may be fused, `false` otherwise.
+   *
+   * @return reference to `this`.
+   *
+   * @see fusable.
+   */
+  constexpr VariantOptions& with_fusable(bool fusable) noexcept;
+
+  /**
+   * @brief Sets whether the leaf tasks of the variant may be mapped ahead in streaming scopes.
+   *
+   * @param `read_ahead` `true` if the leaf tasks only read external data into their outputs,
+   * `false` otherwise.
+   *
+   * @return reference to `this`.
+   *
+   * @see read_ahead.
+   */
+  constexpr VariantOptions& with_read_ahead(bool read_ahead) noexcept;
+
   /**
    * @brief Sets the communicator(s) for the variant.
    *
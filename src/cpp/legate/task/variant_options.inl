@@ -41,6 +41,24 @@ constexpr VariantOptions& VariantOptions::with_may_throw_exception(bool may_thro
   return *this;
 }
 
+constexpr VariantOptions& VariantOptions::with_stealable(bool _stealable) noexcept
+{
+  stealable = _stealable;
+  return *this;
+}
+
+constexpr VariantOptions& VariantOptions::with_fusable(bool _fusable) noexcept
+{
+  fusable = _fusable;
+  return *this;
+}
+
+constexpr VariantOptions& VariantOptions::with_read_ahead(bool _read_ahead) noexcept
+{
+  read_ahead = _read_ahead;
+  return *this;
+}
+
 inline VariantOptions& VariantOptions::with_communicators(
   std::initializer_list<std::string_view> comms) noexcept
 {
@@ -73,7 +91,9 @@ constexpr bool VariantOptions::operator==(const VariantOptions& other) const
 {
   return concurrent == other.concurrent && has_allocations == other.has_allocations &&
          elide_device_ctx_sync == other.elide_device_ctx_sync &&
-         has_side_effect == other.has_side_effect && communicators == other.communicators;
+         has_side_effect == other.has_side_effect && stealable == other.stealable &&
+         fusable == other.fusable && read_ahead == other.read_ahead &&
+         communicators == other.communicators;
 }
 
 constexpr bool VariantOptions::operator!=(const VariantOptions& other) const
@@ -41,6 +41,12 @@ ParallelPolicy& ParallelPolicy::with_overdecompose_factor(std::uint32_t overdeco
   return *this;
 }
 
+ParallelPolicy& ParallelPolicy::with_work_stealing(bool work_stealing)
+{
+  work_stealing_ = work_stealing;
+  return *this;
+}
+
 ParallelPolicy& ParallelPolicy::with_partitioning_threshold(mapping::TaskTarget target,
                                                             std::uint64_t threshold)
 {
@@ -68,6 +74,7 @@ bool ParallelPolicy::operator==(const ParallelPolicy& other) const
 {
   return streaming_mode() == other.streaming_mode() &&
          overdecompose_factor() == other.overdecompose_factor() &&
+         work_stealing() == other.work_stealing() &&
          cpu_partitioning_threshold_ == other.cpu_partitioning_threshold_ &&
          gpu_partitioning_threshold_ == other.gpu_partitioning_threshold_ &&
          omp_partitioning_threshold_ == other.omp_partitioning_threshold_;
@@ -91,6 +91,11 @@ enum class StreamingMode : std::uint8_t {
  *   auto-partitioner will over-decompose the stores when partitioning them; by default, the
  *   auto-partitioner creates `N` chunks in a store partition when there are `N` processors, but if
  *   the `overdecompose_factor()` is `k` in the scope, it would create `kN` chunks in the partition.
+ *
+ *   - `work_stealing()` (default: `false`): When `true`, idle processors may steal leaf tasks of
+ *   over-decomposed launches in the scope from other processors of the same kind on the same node.
+ *   This is the scope-wide counterpart of `VariantOptions::stealable`, and is most useful in
+ *   combination with an `overdecompose_factor()` greater than `1`.
  */
 class LEGATE_EXPORT ParallelPolicy {
  public:
@@ -125,6 +130,18 @@ class LEGATE_EXPORT ParallelPolicy {
    */
   ParallelPolicy& with_partitioning_threshold(mapping::TaskTarget target, std::uint64_t threshold);
 
+  /**
+   * @brief Sets the flag that indicates whether leaf tasks in a given scope may be stolen by idle
+   * processors.
+   *
+   * Concurrent tasks and tasks in a streaming scope are never stolen, regardless of this flag.
+   *
+   * @param work_stealing `true` to allow work stealing, `false` otherwise.
+   *
+   * @see VariantOptions::stealable.
+   */
+  ParallelPolicy& with_work_stealing(bool work_stealing);
+
   /**
    * @brief Returns the streaming flag.
    *
@@ -156,6 +173,14 @@ class LEGATE_EXPORT ParallelPolicy {
    */
   [[nodiscard]] std::uint64_t partitioning_threshold(mapping::TaskTarget target) const;
 
+  /**
+   * @brief Returns the work stealing flag.
+   *
+   * @return true If idle processors may steal leaf tasks in the scope.
+   * @return false Otherwise.
+   */
+  [[nodiscard]] bool work_stealing() const;
+
   /**
    * @brief Checks equality between `ParallelPolicy`s.
    *
@@ -187,6 +212,7 @@ class LEGATE_EXPORT ParallelPolicy {
    * - partitioning_threshold(CPU) : ``--cpu_chunk_size`` in ``LEGATE_CONFIG``
    * - partitioning_threshold(GPU) : ``gpu_chunk_size`` in ``LEGATE_CONFIG``
    * - partitioning_threshold(OMP) : ``omp_chunk_size`` in ``LEGATE_CONFIG``
+   * - work_stealing() : false
    *
    * @note Legate runtime must be initialized before creating any ParallelPolicy
    * instance.
@@ -209,6 +235,7 @@ class LEGATE_EXPORT ParallelPolicy {
  private:
   StreamingMode streaming_mode_{StreamingMode::OFF};
   std::uint32_t overdecompose_factor_{1};
+  bool work_stealing_{};
   // these members are initialized to correct values in the constructor
   std::uint64_t cpu_partitioning_threshold_;
   std::uint64_t gpu_partitioning_threshold_;
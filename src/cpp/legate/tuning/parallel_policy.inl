@@ -16,4 +16,6 @@ inline StreamingMode ParallelPolicy::streaming_mode() const { return streaming_m
 
 inline std::uint32_t ParallelPolicy::overdecompose_factor() const { return overdecompose_factor_; }
 
+inline bool ParallelPolicy::work_stealing() const { return work_stealing_; }
+
 }  // namespace legate
@@ -70,6 +70,7 @@ enum CoreTask : std::underlying_type_t<LocalTaskID> {  // NOLINT(performance-enu
   IO_HDF5_FILE_WRITE_VDS,
   IO_HDF5_FILE_COMBINE_VDS,
   OFFLOAD_TO,
+  FUSED_TASK,
   // NOTE: add core specific task IDs above FIRST_DYNAMIC_TASK
   FIRST_DYNAMIC_TASK,
   // Legate core runtime allocates MAX_TASK tasks from Legion upfront. All ID's prior to
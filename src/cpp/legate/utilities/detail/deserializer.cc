@@ -23,6 +23,25 @@
 
 namespace legate::detail {
 
+InternTable<TypeKey, Type>& interned_types()
+{
+  // Programs create few distinct types, so this table is hardly ever cleared
+  constexpr std::size_t MAX_INTERNED_TYPES = 1024;
+  static InternTable<TypeKey, Type> types{MAX_INTERNED_TYPES};
+
+  return types;
+}
+
+InternTable<TransformKey, TransformStack>& interned_transforms()
+{
+  // Each slice of a store has a shift of its own, so there are many more distinct transform
+  // stacks than types
+  constexpr std::size_t MAX_INTERNED_TRANSFORMS = 4096;
+  static InternTable<TransformKey, TransformStack> transforms{MAX_INTERNED_TRANSFORMS};
+
+  return transforms;
+}
+
 TaskDeserializer::TaskDeserializer(const Legion::Task& task,
                                    const std::vector<Legion::PhysicalRegion>& regions)
   : BaseDeserializer{task.args, task.arglen},
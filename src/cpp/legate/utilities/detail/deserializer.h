@@ -17,6 +17,7 @@
 #include <legate/runtime/detail/streaming/generation.h>
 #include <legate/type/detail/types.h>
 #include <legate/type/type_traits.h>
+#include <legate/utilities/detail/intern_table.h>
 #include <legate/utilities/detail/small_vector.h>
 #include <legate/utilities/internal_shared_ptr.h>
 #include <legate/utilities/span.h>
@@ -35,6 +36,31 @@ class FutureWrapper;
 class RegionField;
 class UnboundRegionField;
 
+/**
+ * @brief The codes and parameters of the transforms in a transform stack, in the order they are
+ * serialized.
+ */
+using TransformKey = SmallVector<std::int64_t, 4 * LEGATE_MAX_DIM>;
+
+/**
+ * @brief The serialized description of a type, UID included.
+ *
+ * Type UIDs are only unique within the process that created the type, so a UID received from
+ * another process may name a different type here. The whole description is the key instead.
+ */
+using TypeKey = SmallVector<std::int8_t, 64>;
+
+/**
+ * @return The process-wide table of the fixed-array, struct and list types created by the
+ * deserializers.
+ */
+[[nodiscard]] InternTable<TypeKey, Type>& interned_types();
+
+/**
+ * @return The process-wide table of the transform stacks created by the deserializers.
+ */
+[[nodiscard]] InternTable<TransformKey, TransformStack>& interned_transforms();
+
 template <typename Deserializer>
 class BaseDeserializer {
   BaseDeserializer(const void* args, std::size_t arglen);
@@ -78,9 +104,24 @@ class BaseDeserializer {
   [[nodiscard]] Span<const std::int8_t> current_args() const;
 
  protected:
+  /**
+   * @brief Unpack a transform stack. Transform stacks seen before are returned from
+   * `interned_transforms()`.
+   */
   [[nodiscard]] InternalSharedPtr<TransformStack> unpack_transform_();
+  /**
+   * @brief Unpack a type. Fixed-array, struct and list types whose description has been seen
+   * before are returned from `interned_types()`.
+   */
   [[nodiscard]] InternalSharedPtr<Type> unpack_type_();
 
+  [[nodiscard]] TransformKey unpack_transform_key_();
+  [[nodiscard]] InternalSharedPtr<TransformStack> create_transform_();
+  [[nodiscard]] InternalSharedPtr<Type> create_type_();
+  // Consume the description of a type without creating it
+  void skip_type_();
+  void skip_extension_type_(Type::Code code);
+
   Span<const std::int8_t> args_{};
 };
 
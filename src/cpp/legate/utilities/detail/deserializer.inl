@@ -14,6 +14,7 @@
 #include <legate/data/detail/transform/shift.h>
 #include <legate/data/detail/transform/transform_stack.h>
 #include <legate/data/detail/transform/transpose.h>
+#include <legate/utilities/assert.h>
 #include <legate/utilities/detail/align.h>
 #include <legate/utilities/detail/core_ids.h>
 #include <legate/utilities/detail/deserializer.h>
@@ -232,6 +233,74 @@ Span<const std::int8_t> BaseDeserializer<Deserializer>::current_args() const
 
 template <typename Deserializer>
 InternalSharedPtr<TransformStack> BaseDeserializer<Deserializer>::unpack_transform_()
+{
+  const auto start = args_;
+  auto key         = unpack_transform_key_();
+
+  if (auto transform = interned_transforms().find(key); transform) {
+    return transform;
+  }
+
+  const auto end = args_;
+
+  args_ = start;
+
+  auto transform = create_transform_();
+
+  LEGATE_ASSERT(args_.data() == end.data());
+  return interned_transforms().insert(std::move(key), std::move(transform));
+}
+
+template <typename Deserializer>
+TransformKey BaseDeserializer<Deserializer>::unpack_transform_key_()
+{
+  auto key = TransformKey{};
+
+  while (true) {
+    const auto code = unpack<CoreTransform>();
+
+    key.push_back(static_cast<std::int64_t>(to_underlying(code)));
+    switch (code) {
+      case CoreTransform::INVALID: return key;
+      case CoreTransform::SHIFT: [[fallthrough]];
+      case CoreTransform::PROMOTE: [[fallthrough]];
+      case CoreTransform::PROJECT: {
+        key.push_back(unpack<std::int32_t>());
+        key.push_back(unpack<std::int64_t>());
+        continue;
+      }
+      case CoreTransform::BROADCAST: {
+        key.push_back(unpack<std::int32_t>());
+        key.push_back(static_cast<std::int64_t>(unpack<std::uint64_t>()));
+        continue;
+      }
+      case CoreTransform::TRANSPOSE: {
+        const auto axes = unpack<SmallVector<std::int32_t, LEGATE_MAX_DIM>>();
+
+        key.push_back(static_cast<std::int64_t>(axes.size()));
+        for (auto axis : axes) {
+          key.push_back(axis);
+        }
+        continue;
+      }
+      case CoreTransform::DELINEARIZE: {
+        key.push_back(unpack<std::int32_t>());
+
+        const auto sizes = unpack<SmallVector<std::uint64_t, LEGATE_MAX_DIM>>();
+
+        key.push_back(static_cast<std::int64_t>(sizes.size()));
+        for (auto size : sizes) {
+          key.push_back(static_cast<std::int64_t>(size));
+        }
+        continue;
+      }
+    }
+    LEGATE_ABORT("Unhandled transform code: ", to_underlying(code));
+  }
+}
+
+template <typename Deserializer>
+InternalSharedPtr<TransformStack> BaseDeserializer<Deserializer>::create_transform_()
 {
   const auto code = unpack<CoreTransform>();
 
@@ -240,41 +309,41 @@ InternalSharedPtr<TransformStack> BaseDeserializer<Deserializer>::unpack_transfo
     case CoreTransform::SHIFT: {
       auto dim    = unpack<std::int32_t>();
       auto offset = unpack<std::int64_t>();
-      auto parent = unpack_transform_();
+      auto parent = create_transform_();
       return make_internal_shared<TransformStack>(std::make_unique<Shift>(dim, offset),
                                                   std::move(parent));
     }
     case CoreTransform::PROMOTE: {
       auto extra_dim = unpack<std::int32_t>();
       auto dim_size  = unpack<std::int64_t>();
-      auto parent    = unpack_transform_();
+      auto parent    = create_transform_();
       return make_internal_shared<TransformStack>(std::make_unique<Promote>(extra_dim, dim_size),
                                                   std::move(parent));
     }
     case CoreTransform::PROJECT: {
       auto dim    = unpack<std::int32_t>();
       auto coord  = unpack<std::int64_t>();
-      auto parent = unpack_transform_();
+      auto parent = create_transform_();
       return make_internal_shared<TransformStack>(std::make_unique<Project>(dim, coord),
                                                   std::move(parent));
     }
     case CoreTransform::BROADCAST: {
       auto dim      = unpack<std::int32_t>();
       auto dim_size = unpack<std::uint64_t>();
-      auto parent   = unpack_transform_();
+      auto parent   = create_transform_();
       return make_internal_shared<TransformStack>(std::make_unique<DimBroadcast>(dim, dim_size),
                                                   std::move(parent));
     }
     case CoreTransform::TRANSPOSE: {
       auto axes   = unpack<SmallVector<std::int32_t, LEGATE_MAX_DIM>>();
-      auto parent = unpack_transform_();
+      auto parent = create_transform_();
       return make_internal_shared<TransformStack>(std::make_unique<Transpose>(std::move(axes)),
                                                   std::move(parent));
     }
     case CoreTransform::DELINEARIZE: {
       auto dim    = unpack<std::int32_t>();
       auto sizes  = unpack<SmallVector<std::uint64_t, LEGATE_MAX_DIM>>();
-      auto parent = unpack_transform_();
+      auto parent = create_transform_();
       return make_internal_shared<TransformStack>(
         std::make_unique<Delinearize>(dim, std::move(sizes)), std::move(parent));
     }
@@ -285,6 +354,140 @@ InternalSharedPtr<TransformStack> BaseDeserializer<Deserializer>::unpack_transfo
 
 template <typename Deserializer>
 InternalSharedPtr<Type> BaseDeserializer<Deserializer>::unpack_type_()
+{
+  const auto start = args_;
+  const auto code  = unpack<Type::Code>();
+
+  switch (code) {
+    case Type::Code::FIXED_ARRAY: [[fallthrough]];
+    case Type::Code::STRUCT: [[fallthrough]];
+    case Type::Code::LIST: {
+      // Matching the description, and not just the UID, guarantees the interned type is the one
+      // create_type_() would create
+      args_ = start;
+      skip_type_();
+
+      const auto end = args_;
+      auto key       = TypeKey{start.first(start.size() - end.size())};
+
+      if (auto type = interned_types().find(key); type) {
+        return type;
+      }
+      args_ = start;
+
+      auto type = create_type_();
+
+      LEGATE_ASSERT(args_.data() == end.data());
+      return interned_types().insert(std::move(key), std::move(type));
+    }
+    case Type::Code::NIL: [[fallthrough]];
+    case Type::Code::BOOL: [[fallthrough]];
+    case Type::Code::INT8: [[fallthrough]];
+    case Type::Code::INT16: [[fallthrough]];
+    case Type::Code::INT32: [[fallthrough]];
+    case Type::Code::INT64: [[fallthrough]];
+    case Type::Code::UINT8: [[fallthrough]];
+    case Type::Code::UINT16: [[fallthrough]];
+    case Type::Code::UINT32: [[fallthrough]];
+    case Type::Code::UINT64: [[fallthrough]];
+    case Type::Code::FLOAT16: [[fallthrough]];
+    case Type::Code::FLOAT32: [[fallthrough]];
+    case Type::Code::FLOAT64: [[fallthrough]];
+    case Type::Code::COMPLEX64: [[fallthrough]];
+    case Type::Code::COMPLEX128: [[fallthrough]];
+    case Type::Code::BINARY: [[fallthrough]];
+    case Type::Code::STRING: {
+      // Primitive types are singletons, and binary types are cheap to create
+      args_ = start;
+      return create_type_();
+    }
+  }
+  LEGATE_ABORT("unhandled type code: ", to_underlying(code));
+  return {};
+}
+
+template <typename Deserializer>
+void BaseDeserializer<Deserializer>::skip_type_()
+{
+  const auto code = unpack<Type::Code>();
+
+  switch (code) {
+    case Type::Code::FIXED_ARRAY: [[fallthrough]];
+    case Type::Code::STRUCT: [[fallthrough]];
+    case Type::Code::LIST: {
+      static_cast<void>(unpack<std::uint32_t>());
+      skip_extension_type_(code);
+      return;
+    }
+    case Type::Code::BINARY: {
+      static_cast<void>(unpack<std::uint32_t>());
+      return;
+    }
+    case Type::Code::NIL: [[fallthrough]];
+    case Type::Code::BOOL: [[fallthrough]];
+    case Type::Code::INT8: [[fallthrough]];
+    case Type::Code::INT16: [[fallthrough]];
+    case Type::Code::INT32: [[fallthrough]];
+    case Type::Code::INT64: [[fallthrough]];
+    case Type::Code::UINT8: [[fallthrough]];
+    case Type::Code::UINT16: [[fallthrough]];
+    case Type::Code::UINT32: [[fallthrough]];
+    case Type::Code::UINT64: [[fallthrough]];
+    case Type::Code::FLOAT16: [[fallthrough]];
+    case Type::Code::FLOAT32: [[fallthrough]];
+    case Type::Code::FLOAT64: [[fallthrough]];
+    case Type::Code::COMPLEX64: [[fallthrough]];
+    case Type::Code::COMPLEX128: [[fallthrough]];
+    case Type::Code::STRING: return;
+  }
+  LEGATE_ABORT("unhandled type code: ", to_underlying(code));
+}
+
+template <typename Deserializer>
+void BaseDeserializer<Deserializer>::skip_extension_type_(Type::Code code)
+{
+  switch (code) {
+    case Type::Code::FIXED_ARRAY: {
+      static_cast<void>(unpack<std::uint32_t>());
+      skip_type_();
+      return;
+    }
+    case Type::Code::STRUCT: {
+      const auto num_fields = unpack<std::uint32_t>();
+
+      for (std::uint32_t idx = 0; idx < num_fields; ++idx) {
+        skip_type_();
+      }
+      static_cast<void>(unpack<bool>());
+      return;
+    }
+    case Type::Code::LIST: {
+      skip_type_();
+      return;
+    }
+    case Type::Code::NIL: [[fallthrough]];
+    case Type::Code::BOOL: [[fallthrough]];
+    case Type::Code::INT8: [[fallthrough]];
+    case Type::Code::INT16: [[fallthrough]];
+    case Type::Code::INT32: [[fallthrough]];
+    case Type::Code::INT64: [[fallthrough]];
+    case Type::Code::UINT8: [[fallthrough]];
+    case Type::Code::UINT16: [[fallthrough]];
+    case Type::Code::UINT32: [[fallthrough]];
+    case Type::Code::UINT64: [[fallthrough]];
+    case Type::Code::FLOAT16: [[fallthrough]];
+    case Type::Code::FLOAT32: [[fallthrough]];
+    case Type::Code::FLOAT64: [[fallthrough]];
+    case Type::Code::COMPLEX64: [[fallthrough]];
+    case Type::Code::COMPLEX128: [[fallthrough]];
+    case Type::Code::BINARY: [[fallthrough]];
+    case Type::Code::STRING: break;
+  }
+  LEGATE_ABORT("unhandled type code: ", to_underlying(code));
+}
+
+template <typename Deserializer>
+InternalSharedPtr<Type> BaseDeserializer<Deserializer>::create_type_()
 {
   const auto code = unpack<Type::Code>();
 
@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/utilities/hash.h>
+#include <legate/utilities/internal_shared_ptr.h>
+
+#include <cstddef>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace legate::detail {
+
+/**
+ * @brief A thread-safe table of immutable objects, keyed by a description of the object, that
+ * lets equal objects share one instance.
+ *
+ * The table owns the objects it holds. It is cleared whenever it holds more than its maximum
+ * size, so that descriptions seen only once don't accumulate.
+ *
+ * @tparam K The type of the keys.
+ * @tparam T The type of the objects.
+ */
+template <typename K, typename T>
+class InternTable {
+ public:
+  /**
+   * @param max_size The maximum number of objects the table holds.
+   */
+  explicit InternTable(std::size_t max_size);
+
+  /**
+   * @param key The key to look up.
+   *
+   * @return The object interned for the key, or a null pointer if there is none.
+   */
+  [[nodiscard]] InternalSharedPtr<T> find(const K& key) const;
+
+  /**
+   * @brief Intern an object, unless an object has been interned for the same key already.
+   *
+   * @param key The key of the object.
+   * @param object The object to intern.
+   *
+   * @return The object interned for the key.
+   */
+  [[nodiscard]] InternalSharedPtr<T> insert(K key, InternalSharedPtr<T> object);
+
+  /**
+   * @return The number of interned objects.
+   */
+  [[nodiscard]] std::size_t size() const;
+
+ private:
+  std::size_t max_size_{};
+  mutable std::shared_mutex mutex_{};
+  std::unordered_map<K, InternalSharedPtr<T>, hasher<K>> objects_{};
+};
+
+}  // namespace legate::detail
+
+#include <legate/utilities/detail/intern_table.inl>
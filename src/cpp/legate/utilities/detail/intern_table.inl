@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <legate/utilities/detail/intern_table.h>
+
+#include <mutex>
+#include <utility>
+
+namespace legate::detail {
+
+template <typename K, typename T>
+InternTable<K, T>::InternTable(std::size_t max_size) : max_size_{max_size}
+{
+}
+
+template <typename K, typename T>
+InternalSharedPtr<T> InternTable<K, T>::find(const K& key) const
+{
+  const std::shared_lock lock{mutex_};
+
+  if (const auto it = objects_.find(key); it != objects_.end()) {
+    return it->second;
+  }
+  return {};
+}
+
+template <typename K, typename T>
+InternalSharedPtr<T> InternTable<K, T>::insert(K key, InternalSharedPtr<T> object)
+{
+  const std::lock_guard lock{mutex_};
+
+  // Another thread may have interned an equal object since the caller looked the key up
+  if (const auto it = objects_.find(key); it != objects_.end()) {
+    return it->second;
+  }
+  if (objects_.size() >= max_size_) {
+    objects_.clear();
+  }
+  return objects_.emplace(std::move(key), std::move(object)).first->second;
+}
+
+template <typename K, typename T>
+std::size_t InternTable<K, T>::size() const
+{
+  const std::shared_lock lock{mutex_};
+
+  return objects_.size();
+}
+
+}  // namespace legate::detail
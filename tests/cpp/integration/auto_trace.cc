@@ -0,0 +1,175 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate.h>
+
+#include <legate/runtime/detail/runtime.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <utilities/utilities.h>
+
+namespace auto_trace_test {
+
+namespace {
+
+constexpr std::uint64_t EXT            = 100;
+constexpr std::uint32_t NUM_ITERATIONS = 16;
+
+// Adds the scalar argument to every element of the store
+class IncrementTask : public legate::LegateTask<IncrementTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{0}};
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    auto output      = context.output(0).data();
+    const auto value = context.scalar(0).value<std::int64_t>();
+    const auto shape = output.shape<1>();
+
+    if (shape.empty()) {
+      return;
+    }
+
+    auto acc = output.read_write_accessor<std::int64_t, 1>(shape);
+
+    for (legate::PointInRectIterator<1> it{shape}; it.valid(); ++it) {
+      acc[*it] += value;
+    }
+  }
+};
+
+class Config {
+ public:
+  static constexpr std::string_view LIBRARY_NAME = "test_auto_trace";
+
+  static void registration_callback(legate::Library library)
+  {
+    IncrementTask::register_variants(library);
+  }
+};
+
+class AutoTrace : public RegisterOnceFixture<Config> {
+ protected:
+  void SetUp() override
+  {
+    RegisterOnceFixture<Config>::SetUp();
+    was_enabled_ = tracer().enabled();
+    tracer().set_enabled(true);
+  }
+
+  void TearDown() override
+  {
+    tracer().set_enabled(was_enabled_);
+    RegisterOnceFixture<Config>::TearDown();
+  }
+
+  [[nodiscard]] static legate::detail::AutoTracer& tracer()
+  {
+    return legate::detail::Runtime::get_runtime().auto_tracer();
+  }
+
+ private:
+  bool was_enabled_{};
+};
+
+void increment(const legate::LogicalStore& store, std::int64_t value)
+{
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = runtime->find_library(Config::LIBRARY_NAME);
+  auto task    = runtime->create_task(library, IncrementTask::TASK_CONFIG.task_id());
+  auto in_var  = task.add_input(store);
+  auto out_var = task.add_output(store);
+
+  task.add_constraint(legate::align(in_var, out_var));
+  task.add_scalar_arg(legate::Scalar{value});
+  runtime->submit(std::move(task));
+}
+
+[[nodiscard]] legate::LogicalStore create_store(std::int64_t init)
+{
+  auto runtime = legate::Runtime::get_runtime();
+  auto store   = runtime->create_store(legate::Shape{EXT}, legate::int64());
+
+  runtime->issue_fill(store, legate::Scalar{init});
+  return store;
+}
+
+void check_store(const legate::LogicalStore& store, std::int64_t expected)
+{
+  auto p_store = store.get_physical_store();
+  auto acc     = p_store.read_accessor<std::int64_t, 1>();
+  auto shape   = p_store.shape<1>();
+
+  for (legate::PointInRectIterator<1> it{shape}; it.valid(); ++it) {
+    ASSERT_EQ(acc[*it], expected);
+  }
+}
+
+}  // namespace
+
+TEST_F(AutoTrace, Loop)
+{
+  auto x          = create_store(0);
+  auto y          = create_store(0);
+  const auto hits = tracer().num_hits();
+
+  for (std::uint32_t i = 0; i < NUM_ITERATIONS; ++i) {
+    // The scalar arguments change from one iteration to the next, which doesn't prevent tracing
+    increment(x, 1);
+    increment(y, i);
+    increment(x, 2);
+    increment(y, 1);
+  }
+  legate::Runtime::get_runtime()->issue_execution_fence(/*block=*/true);
+
+  ASSERT_GT(tracer().num_hits(), hits);
+  check_store(x, 3 * NUM_ITERATIONS);
+  check_store(y, (NUM_ITERATIONS * (NUM_ITERATIONS - 1) / 2) + NUM_ITERATIONS);
+}
+
+TEST_F(AutoTrace, Divergence)
+{
+  auto x            = create_store(0);
+  auto y            = create_store(0);
+  auto z            = create_store(0);
+  const auto misses = tracer().num_misses();
+
+  for (std::uint32_t i = 0; i < NUM_ITERATIONS; ++i) {
+    increment(x, 1);
+    increment(y, 1);
+    increment(x, 1);
+    // The last iteration starts like the others, but then touches another store
+    increment(i + 1 == NUM_ITERATIONS ? z : y, 1);
+  }
+  legate::Runtime::get_runtime()->issue_execution_fence(/*block=*/true);
+
+  ASSERT_GT(tracer().num_misses(), misses);
+  check_store(x, 2 * NUM_ITERATIONS);
+  check_store(y, (2 * NUM_ITERATIONS) - 1);
+  check_store(z, 1);
+}
+
+TEST_F(AutoTrace, FlushMidTrace)
+{
+  auto x = create_store(0);
+  auto y = create_store(0);
+
+  for (std::uint32_t i = 0; i < NUM_ITERATIONS; ++i) {
+    increment(x, 1);
+    increment(y, 1);
+    increment(x, 1);
+    increment(y, 1);
+  }
+  // Observing a store flushes the scheduling window, launching anything the tracer holds back
+  increment(x, 1);
+  check_store(x, (2 * NUM_ITERATIONS) + 1);
+  check_store(y, 2 * NUM_ITERATIONS);
+}
+
+}  // namespace auto_trace_test
@@ -7,6 +7,7 @@
 #include <legate.h>
 
 #include <legate/comm/coll.h>
+#include <legate/comm/detail/local_network.h>
 
 #include <gtest/gtest.h>
 
@@ -73,6 +74,41 @@ class CPUAllreduceTypedTester : public legate::LegateTask<CPUAllreduceTypedTeste
     ASSERT_THAT(recv_buffer, ::testing::Each(expected_sum));
   }
 
+  static void test_sum_large(legate::comm::coll::CollComm comm,
+                             std::int64_t num_tasks,
+                             std::int64_t task_index)
+  {
+    // Large enough to take the sliced path of the local network, and not evenly divisible by the
+    // number of tasks
+    constexpr std::size_t count =
+      (legate::detail::comm::coll::LocalNetwork::DEFAULT_ALL_REDUCE_SLICE_THRESHOLD / sizeof(T)) +
+      7;
+
+    std::vector<T> send_buffer(count, static_cast<T>(task_index + 1));
+    std::vector<T> recv_buffer(count, static_cast<T>(0));
+
+    collAllreduce(send_buffer.data(),
+                  recv_buffer.data(),
+                  count,
+                  COLL_TYPE,
+                  legate::ReductionOpKind::ADD,
+                  comm);
+
+    const T expected_sum = static_cast<T>(num_tasks * (num_tasks + 1)) / static_cast<T>(2);
+
+    ASSERT_THAT(recv_buffer, ::testing::Each(expected_sum));
+
+    // In-place
+    collAllreduce(send_buffer.data(),
+                  send_buffer.data(),
+                  count,
+                  COLL_TYPE,
+                  legate::ReductionOpKind::ADD,
+                  comm);
+
+    ASSERT_THAT(send_buffer, ::testing::Each(expected_sum));
+  }
+
   static void test_max(legate::comm::coll::CollComm comm,
                        std::int64_t num_tasks,
                        std::int64_t task_index)
@@ -126,6 +162,7 @@ class CPUAllreduceTypedTester : public legate::LegateTask<CPUAllreduceTypedTeste
     const auto task_index = comm->global_rank;
 
     test_sum(comm, static_cast<std::int64_t>(num_tasks), task_index);
+    test_sum_large(comm, static_cast<std::int64_t>(num_tasks), task_index);
     test_max(comm, static_cast<std::int64_t>(num_tasks), task_index);
     test_min(comm, task_index);
   }
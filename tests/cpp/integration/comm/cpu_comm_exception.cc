@@ -535,6 +535,158 @@ class LocalNetworkAllreduceExceptionTester
   }
 };
 
+class CPURootedCollectiveExceptionTester
+  : public legate::LegateTask<CPURootedCollectiveExceptionTester> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{5}};
+
+  static constexpr auto CPU_VARIANT_OPTIONS = legate::VariantOptions{}.with_concurrent(true);
+
+  static void test_invalid_root(legate::comm::coll::CollComm comm)
+  {
+    std::array<std::int32_t, 2> send_buffer{};
+    std::vector<std::int32_t> recv_buffer(2 * static_cast<std::size_t>(comm->global_comm_size));
+
+    for (auto root : {-1, comm->global_comm_size}) {
+      ASSERT_THAT(
+        [&]() {
+          collBroadcast(
+            send_buffer.data(), 1, legate::comm::coll::CollDataType::CollInt, root, comm);
+        },
+        testing::ThrowsMessage<std::invalid_argument>(::testing::HasSubstr("Invalid root")));
+      ASSERT_THAT(
+        [&]() {
+          collGather(send_buffer.data(),
+                     recv_buffer.data(),
+                     1,
+                     legate::comm::coll::CollDataType::CollInt,
+                     root,
+                     comm);
+        },
+        testing::ThrowsMessage<std::invalid_argument>(::testing::HasSubstr("Invalid root")));
+      ASSERT_THAT(
+        [&]() {
+          collReduce(send_buffer.data(),
+                     recv_buffer.data(),
+                     1,
+                     legate::comm::coll::CollDataType::CollInt,
+                     legate::ReductionOpKind::ADD,
+                     root,
+                     comm);
+        },
+        testing::ThrowsMessage<std::invalid_argument>(::testing::HasSubstr("Invalid root")));
+    }
+  }
+
+  static void test_null_root_recv_buffer(legate::comm::coll::CollComm comm)
+  {
+    std::array<std::int32_t, 2> send_buffer{};
+
+    ASSERT_THAT(
+      [&]() {
+        collGather(send_buffer.data(),
+                   nullptr,
+                   1,
+                   legate::comm::coll::CollDataType::CollInt,
+                   comm->global_rank,
+                   comm);
+      },
+      testing::ThrowsMessage<std::invalid_argument>(
+        ::testing::HasSubstr("Invalid recvbuf: nullptr")));
+    ASSERT_THAT(
+      [&]() {
+        collReduce(send_buffer.data(),
+                   nullptr,
+                   1,
+                   legate::comm::coll::CollDataType::CollInt,
+                   legate::ReductionOpKind::ADD,
+                   comm->global_rank,
+                   comm);
+      },
+      testing::ThrowsMessage<std::invalid_argument>(
+        ::testing::HasSubstr("Invalid recvbuf: nullptr")));
+  }
+
+  static void test_inplace(legate::comm::coll::CollComm comm)
+  {
+    std::vector<std::int32_t> buffer(2 * static_cast<std::size_t>(comm->global_comm_size));
+
+    ASSERT_THAT(
+      [&]() {
+        collGather(buffer.data(),
+                   buffer.data(),
+                   1,
+                   legate::comm::coll::CollDataType::CollInt,
+                   comm->global_rank,
+                   comm);
+      },
+      testing::ThrowsMessage<std::invalid_argument>(
+        ::testing::HasSubstr("Inplace Gather not yet supported")));
+    ASSERT_THAT(
+      [&]() {
+        collReduceScatter(buffer.data(),
+                          buffer.data(),
+                          1,
+                          legate::comm::coll::CollDataType::CollInt,
+                          legate::ReductionOpKind::ADD,
+                          comm);
+      },
+      testing::ThrowsMessage<std::invalid_argument>(
+        ::testing::HasSubstr("Inplace ReduceScatter not yet supported")));
+  }
+
+  static void test_bitwise_ops_on_float(legate::comm::coll::CollComm comm)
+  {
+    std::vector<float> send_buffer(2 * static_cast<std::size_t>(comm->global_comm_size), 1.0F);
+    std::vector<float> recv_buffer(2, 0.0F);
+
+    for (auto op : {legate::ReductionOpKind::OR,
+                    legate::ReductionOpKind::AND,
+                    legate::ReductionOpKind::XOR}) {
+      ASSERT_THAT(
+        [&]() {
+          collReduce(send_buffer.data(),
+                     recv_buffer.data(),
+                     2,
+                     legate::comm::coll::CollDataType::CollFloat,
+                     op,
+                     /* root */ 0,
+                     comm);
+        },
+        testing::ThrowsMessage<std::invalid_argument>(::testing::HasSubstr(
+          "reduce does not support float or double reduction with bitwise operations")));
+      ASSERT_THAT(
+        [&]() {
+          collReduceScatter(send_buffer.data(),
+                            recv_buffer.data(),
+                            2,
+                            legate::comm::coll::CollDataType::CollFloat,
+                            op,
+                            comm);
+        },
+        testing::ThrowsMessage<std::invalid_argument>(::testing::HasSubstr(
+          "reduce_scatter does not support float or double reduction with bitwise operations")));
+    }
+  }
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    ASSERT_TRUE((context.is_single_task() && context.communicators().empty()) ||
+                context.communicators().size() == 1);
+    if (context.is_single_task()) {
+      return;
+    }
+
+    auto comm = context.communicators().at(0).get<legate::comm::coll::CollComm>();
+
+    test_invalid_root(comm);
+    test_null_root_recv_buffer(comm);
+    test_inplace(comm);
+    test_bitwise_ops_on_float(comm);
+  }
+};
+
 class ConfigWithExceptions {
  public:
   static constexpr std::string_view LIBRARY_NAME = "test_cpu_communicator_exceptions";
@@ -546,6 +698,7 @@ class ConfigWithExceptions {
     CPUAlltoallExceptionTester::register_variants(library);
     CPUAllgatherExceptionTester::register_variants(library);
     LocalNetworkAllreduceExceptionTester::register_variants(library);
+    CPURootedCollectiveExceptionTester::register_variants(library);
   }
 };
 
@@ -691,4 +844,31 @@ TEST_F(CPUCommunicatorExceptions, LocalNetworkAllreduceExceptionHandling)
   runtime->issue_execution_fence(/* block */ true);
 }
 
+TEST_F(CPUCommunicatorExceptions, RootedCollectiveExceptionHandling)
+{
+  constexpr std::int32_t ndim = 3;
+  const auto num_procs        = legate::get_machine().count(legate::mapping::TaskTarget::CPU);
+
+  if (num_procs <= 1) {
+    GTEST_SKIP() << num_procs;
+  }
+
+  auto runtime = legate::Runtime::get_runtime();
+  auto context = runtime->find_library(ConfigWithExceptions::LIBRARY_NAME);
+  auto store   = runtime->create_store(
+    legate::Shape{
+      legate::full<std::uint64_t>(ndim, SIZE)  // NOLINT(readability-suspicious-call-argument)
+    },
+    legate::int32());
+
+  auto task =
+    runtime->create_task(context, CPURootedCollectiveExceptionTester::TASK_CONFIG.task_id());
+  auto part = task.declare_partition();
+
+  task.add_output(store, part);
+  task.add_communicator("cpu");
+  runtime->submit(std::move(task));
+  runtime->issue_execution_fence(/* block */ true);
+}
+
 }  // namespace cpu_comm_exception
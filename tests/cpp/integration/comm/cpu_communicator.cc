@@ -362,6 +362,276 @@ class CPUCommunicatorAlltoallvTester : public legate::LegateTask<CPUCommunicator
   }
 };
 
+class CPUCommunicatorBroadcastTester : public legate::LegateTask<CPUCommunicatorBroadcastTester> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{4}};
+
+  static constexpr auto CPU_VARIANT_OPTIONS = legate::VariantOptions{}.with_concurrent(true);
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    ASSERT_TRUE((context.is_single_task() && context.communicators().empty()) ||
+                context.communicators().size() == 1);
+    if (context.is_single_task()) {
+      return;
+    }
+
+    auto comm            = context.communicator(0).get<legate::comm::coll::CollComm>();
+    const auto num_tasks = static_cast<std::int32_t>(context.get_launch_domain().get_volume());
+
+    constexpr std::size_t count  = 16;
+    constexpr std::int64_t value = 12345;
+
+    // Broadcast from the first and the last rank, so that non-zero roots are covered as well
+    for (auto root : {0, num_tasks - 1}) {
+      std::vector<std::int64_t> buffer(count, comm->global_rank == root ? value + root : 0);
+
+      collBroadcast(buffer.data(), count, legate::comm::coll::CollDataType::CollInt64, root, comm);
+      ASSERT_THAT(buffer, ::testing::Each(value + root));
+    }
+  }
+};
+
+class CPUCommunicatorGatherTester : public legate::LegateTask<CPUCommunicatorGatherTester> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{5}};
+
+  static constexpr auto CPU_VARIANT_OPTIONS = legate::VariantOptions{}.with_concurrent(true);
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    ASSERT_TRUE((context.is_single_task() && context.communicators().empty()) ||
+                context.communicators().size() == 1);
+    if (context.is_single_task()) {
+      return;
+    }
+
+    auto comm            = context.communicator(0).get<legate::comm::coll::CollComm>();
+    const auto num_tasks = static_cast<std::int32_t>(context.get_launch_domain().get_volume());
+    const auto my_rank   = comm->global_rank;
+
+    constexpr std::int32_t items_per_rank = 4;
+
+    for (auto root : {0, num_tasks - 1}) {
+      const std::vector<std::int32_t> send_buffer(items_per_rank, my_rank);
+      // Only the root needs a receive buffer
+      std::vector<std::int32_t> recv_buffer(my_rank == root ? num_tasks * items_per_rank : 0, -1);
+
+      collGather(send_buffer.data(),
+                 my_rank == root ? recv_buffer.data() : nullptr,
+                 items_per_rank,
+                 legate::comm::coll::CollDataType::CollInt,
+                 root,
+                 comm);
+      if (my_rank != root) {
+        continue;
+      }
+      for (std::int32_t sender = 0; sender < num_tasks; ++sender) {
+        for (std::int32_t i = 0; i < items_per_rank; ++i) {
+          ASSERT_EQ(recv_buffer[(sender * items_per_rank) + i], sender);
+        }
+      }
+    }
+  }
+};
+
+class CPUReduceTester : public legate::LegateTask<CPUReduceTester> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{6}};
+
+  static constexpr auto CPU_VARIANT_OPTIONS = legate::VariantOptions{}.with_concurrent(true);
+
+  static void test_sum(legate::comm::coll::CollComm comm, std::int32_t num_tasks, std::int32_t root)
+  {
+    constexpr std::size_t count = 5;
+    const std::vector<std::int64_t> send_buffer(count, comm->global_rank + 1);
+    std::vector<std::int64_t> recv_buffer(count, 0);
+
+    collReduce(send_buffer.data(),
+               recv_buffer.data(),
+               count,
+               legate::comm::coll::CollDataType::CollInt64,
+               legate::ReductionOpKind::ADD,
+               root,
+               comm);
+
+    if (comm->global_rank == root) {
+      // Expected sum: 1 + 2 + ... + num_tasks = num_tasks * (num_tasks + 1) / 2
+      const std::int64_t expected_sum =
+        (static_cast<std::int64_t>(num_tasks) * (num_tasks + 1)) / 2;
+
+      ASSERT_THAT(recv_buffer, ::testing::Each(expected_sum));
+    } else {
+      // Non-root receive buffers are left alone
+      ASSERT_THAT(recv_buffer, ::testing::Each(0));
+    }
+  }
+
+  static void test_max_with_same_buffer(legate::comm::coll::CollComm comm,
+                                        std::int32_t num_tasks,
+                                        std::int32_t root)
+  {
+    constexpr std::size_t count = 3;
+    std::vector<double> buffer(count, static_cast<double>(comm->global_rank));
+
+    collReduce(buffer.data(),
+               comm->global_rank == root ? buffer.data() : nullptr,
+               count,
+               legate::comm::coll::CollDataType::CollDouble,
+               legate::ReductionOpKind::MAX,
+               root,
+               comm);
+
+    if (comm->global_rank == root) {
+      for (auto v : buffer) {
+        ASSERT_DOUBLE_EQ(v, static_cast<double>(num_tasks - 1));
+      }
+    }
+  }
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    EXPECT_TRUE((context.is_single_task() && context.communicators().empty()) ||
+                context.communicators().size() == 1);
+    if (context.is_single_task()) {
+      return;
+    }
+
+    auto comm            = context.communicator(0).get<legate::comm::coll::CollComm>();
+    const auto num_tasks = static_cast<std::int32_t>(context.get_launch_domain().get_volume());
+
+    for (auto root : {0, num_tasks - 1}) {
+      test_sum(comm, num_tasks, root);
+      test_max_with_same_buffer(comm, num_tasks, root);
+    }
+  }
+};
+
+class CPUReduceScatterTester : public legate::LegateTask<CPUReduceScatterTester> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{7}};
+
+  static constexpr auto CPU_VARIANT_OPTIONS = legate::VariantOptions{}.with_concurrent(true);
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    ASSERT_TRUE((context.is_single_task() && context.communicators().empty()) ||
+                context.communicators().size() == 1);
+    if (context.is_single_task()) {
+      return;
+    }
+
+    auto comm            = context.communicator(0).get<legate::comm::coll::CollComm>();
+    const auto num_tasks = static_cast<std::int32_t>(context.get_launch_domain().get_volume());
+    const auto my_rank   = comm->global_rank;
+
+    constexpr std::int32_t recv_count = 6;
+
+    // Rank R contributes (R + 1) x i for element i, so element i of the result is
+    // i x num_tasks x (num_tasks + 1) / 2
+    std::vector<std::int64_t> send_buffer(static_cast<std::size_t>(num_tasks) * recv_count);
+    std::vector<std::int64_t> recv_buffer(recv_count, 0);
+
+    for (std::size_t i = 0; i < send_buffer.size(); ++i) {
+      send_buffer[i] = static_cast<std::int64_t>(i) * (my_rank + 1);
+    }
+
+    collReduceScatter(send_buffer.data(),
+                      recv_buffer.data(),
+                      recv_count,
+                      legate::comm::coll::CollDataType::CollInt64,
+                      legate::ReductionOpKind::ADD,
+                      comm);
+
+    const std::int64_t rank_sum = (static_cast<std::int64_t>(num_tasks) * (num_tasks + 1)) / 2;
+
+    for (std::int32_t i = 0; i < recv_count; ++i) {
+      ASSERT_EQ(recv_buffer[i], static_cast<std::int64_t>((my_rank * recv_count) + i) * rank_sum);
+    }
+  }
+};
+
+class CPUNonBlockingTester : public legate::LegateTask<CPUNonBlockingTester> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{8}};
+
+  static constexpr auto CPU_VARIANT_OPTIONS = legate::VariantOptions{}.with_concurrent(true);
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    ASSERT_TRUE((context.is_single_task() && context.communicators().empty()) ||
+                context.communicators().size() == 1);
+    if (context.is_single_task()) {
+      return;
+    }
+
+    auto comm            = context.communicator(0).get<legate::comm::coll::CollComm>();
+    const auto num_tasks = static_cast<std::int32_t>(context.get_launch_domain().get_volume());
+    const auto my_rank   = comm->global_rank;
+
+    constexpr std::int32_t items_per_rank = 4;
+    // Large enough for the all-reduce to be split into one slice per rank
+    constexpr std::int32_t reduce_count = 64 * 1024;
+
+    const std::vector<std::int32_t> gather_send(items_per_rank, my_rank);
+    std::vector<std::int32_t> gather_recv(static_cast<std::size_t>(num_tasks) * items_per_rank, -1);
+    const std::vector<std::int64_t> alltoall_send(gather_recv.size(), my_rank);
+    std::vector<std::int64_t> alltoall_recv(gather_recv.size(), -1);
+    const std::vector<double> reduce_send(reduce_count, 1.0);
+    std::vector<double> reduce_recv(reduce_count, 0.0);
+    std::vector<std::int64_t> reduce_inplace(items_per_rank, my_rank + 1);
+
+    // All the collectives are in flight at the same time, and are completed in a different order
+    // than they were started in
+    auto gather   = legate::comm::coll::collIallgather(gather_send.data(),
+                                                       gather_recv.data(),
+                                                       items_per_rank,
+                                                       legate::comm::coll::CollDataType::CollInt,
+                                                       comm);
+    auto alltoall = legate::comm::coll::collIalltoall(alltoall_send.data(),
+                                                      alltoall_recv.data(),
+                                                      items_per_rank,
+                                                      legate::comm::coll::CollDataType::CollInt64,
+                                                      comm);
+    auto reduce   = legate::comm::coll::collIallreduce(reduce_send.data(),
+                                                       reduce_recv.data(),
+                                                       reduce_count,
+                                                       legate::comm::coll::CollDataType::CollDouble,
+                                                       legate::ReductionOpKind::ADD,
+                                                       comm);
+    auto inplace  = legate::comm::coll::collIallreduce(reduce_inplace.data(),
+                                                       reduce_inplace.data(),
+                                                       items_per_rank,
+                                                       legate::comm::coll::CollDataType::CollInt64,
+                                                       legate::ReductionOpKind::ADD,
+                                                       comm);
+
+    while (!reduce.test()) {
+      // Testing the other requests makes progress on them as well
+      static_cast<void>(gather.test());
+    }
+    inplace.wait();
+    alltoall.wait();
+    gather.wait();
+    ASSERT_TRUE(gather.test());
+
+    for (std::int32_t sender = 0; sender < num_tasks; ++sender) {
+      for (std::int32_t i = 0; i < items_per_rank; ++i) {
+        ASSERT_EQ(gather_recv[(sender * items_per_rank) + i], sender);
+        ASSERT_EQ(alltoall_recv[(sender * items_per_rank) + i], sender);
+      }
+    }
+    ASSERT_THAT(reduce_recv, ::testing::Each(static_cast<double>(num_tasks)));
+    ASSERT_THAT(reduce_inplace,
+                ::testing::Each((static_cast<std::int64_t>(num_tasks) * (num_tasks + 1)) / 2));
+  }
+};
+
 class Config {
  public:
   static constexpr std::string_view LIBRARY_NAME = "test_cpu_communicator";
@@ -372,6 +642,11 @@ class Config {
     CPUCommunicatorAllGatherTester::register_variants(library);
     CPUCommunicatorAlltoallTester::register_variants(library);
     CPUCommunicatorAlltoallvTester::register_variants(library);
+    CPUCommunicatorBroadcastTester::register_variants(library);
+    CPUCommunicatorGatherTester::register_variants(library);
+    CPUReduceTester::register_variants(library);
+    CPUReduceScatterTester::register_variants(library);
+    CPUNonBlockingTester::register_variants(library);
   }
 };
 
@@ -499,6 +774,76 @@ TEST_P(CPUCommunicatorParameterized, AllreduceManualTask)
   test_cpu_communicator_manual(ndim, CPUAllreduceTester::TASK_CONFIG.task_id());
 }
 
+TEST_P(CPUCommunicatorParameterized, BroadcastAutoTask)
+{
+  const auto ndim = GetParam();
+
+  test_cpu_communicator_auto(ndim, CPUCommunicatorBroadcastTester::TASK_CONFIG.task_id());
+}
+
+TEST_P(CPUCommunicatorParameterized, BroadcastManualTask)
+{
+  const auto ndim = GetParam();
+
+  test_cpu_communicator_manual(ndim, CPUCommunicatorBroadcastTester::TASK_CONFIG.task_id());
+}
+
+TEST_P(CPUCommunicatorParameterized, GatherAutoTask)
+{
+  const auto ndim = GetParam();
+
+  test_cpu_communicator_auto(ndim, CPUCommunicatorGatherTester::TASK_CONFIG.task_id());
+}
+
+TEST_P(CPUCommunicatorParameterized, GatherManualTask)
+{
+  const auto ndim = GetParam();
+
+  test_cpu_communicator_manual(ndim, CPUCommunicatorGatherTester::TASK_CONFIG.task_id());
+}
+
+TEST_P(CPUCommunicatorParameterized, ReduceAutoTask)
+{
+  const auto ndim = GetParam();
+
+  test_cpu_communicator_auto(ndim, CPUReduceTester::TASK_CONFIG.task_id());
+}
+
+TEST_P(CPUCommunicatorParameterized, ReduceManualTask)
+{
+  const auto ndim = GetParam();
+
+  test_cpu_communicator_manual(ndim, CPUReduceTester::TASK_CONFIG.task_id());
+}
+
+TEST_P(CPUCommunicatorParameterized, ReduceScatterAutoTask)
+{
+  const auto ndim = GetParam();
+
+  test_cpu_communicator_auto(ndim, CPUReduceScatterTester::TASK_CONFIG.task_id());
+}
+
+TEST_P(CPUCommunicatorParameterized, ReduceScatterManualTask)
+{
+  const auto ndim = GetParam();
+
+  test_cpu_communicator_manual(ndim, CPUReduceScatterTester::TASK_CONFIG.task_id());
+}
+
+TEST_P(CPUCommunicatorParameterized, NonBlockingAutoTask)
+{
+  const auto ndim = GetParam();
+
+  test_cpu_communicator_auto(ndim, CPUNonBlockingTester::TASK_CONFIG.task_id());
+}
+
+TEST_P(CPUCommunicatorParameterized, NonBlockingManualTask)
+{
+  const auto ndim = GetParam();
+
+  test_cpu_communicator_manual(ndim, CPUNonBlockingTester::TASK_CONFIG.task_id());
+}
+
 INSTANTIATE_TEST_SUITE_P(CPUCommunicatorTests, CPUCommunicatorParameterized, testing::Values(1, 3));
 
 }  // namespace cpu_communicator
@@ -0,0 +1,202 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate.h>
+
+#include <legate/runtime/detail/runtime.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <utilities/utilities.h>
+
+namespace dead_operations_test {
+
+namespace {
+
+constexpr std::uint64_t EXT = 42;
+// Large enough to hold all operations of a test, including the discards of the temporary stores
+constexpr std::uint32_t WINDOW_SIZE = 32;
+
+std::atomic<std::uint32_t> num_runs{};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+// Computes output = input + scalar, and counts how many times it ran
+class AddTask : public legate::LegateTask<AddTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{0}};
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    auto input       = context.input(0).data();
+    auto output      = context.output(0).data();
+    const auto value = context.scalar(0).value<std::int64_t>();
+    const auto shape = output.shape<1>();
+
+    num_runs.fetch_add(1, std::memory_order_relaxed);
+    if (shape.empty()) {
+      return;
+    }
+
+    auto in_acc  = input.read_accessor<std::int64_t, 1>(shape);
+    auto out_acc = output.write_accessor<std::int64_t, 1>(shape);
+
+    for (auto idx = shape.lo[0]; idx <= shape.hi[0]; ++idx) {
+      out_acc[idx] = in_acc[idx] + value;
+    }
+  }
+};
+
+// Binds its unbound output to empty data, and counts how many times it ran
+class BindEmptyTask : public legate::LegateTask<BindEmptyTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{1}};
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    num_runs.fetch_add(1, std::memory_order_relaxed);
+    context.output(0).data().bind_empty_data();
+  }
+};
+
+class Config {
+ public:
+  static constexpr std::string_view LIBRARY_NAME = "test_dead_operations";
+
+  static void registration_callback(legate::Library library)
+  {
+    AddTask::register_variants(library);
+    BindEmptyTask::register_variants(library);
+  }
+};
+
+class DeadOperations : public RegisterOnceFixture<Config> {
+ protected:
+  void SetUp() override
+  {
+    RegisterOnceFixture<Config>::SetUp();
+
+    auto& runtime = legate::detail::Runtime::get_runtime();
+
+    // Launch the operations of the previous tests before resetting the counter
+    runtime.flush_scheduling_window();
+    legate::Runtime::get_runtime()->issue_execution_fence(/*block=*/true);
+    num_runs.store(0);
+    old_window_size_ = runtime.scope().exchange_scheduling_window_size(WINDOW_SIZE);
+  }
+
+  void TearDown() override
+  {
+    static_cast<void>(
+      legate::detail::Runtime::get_runtime().scope().exchange_scheduling_window_size(
+        old_window_size_));
+    RegisterOnceFixture<Config>::TearDown();
+  }
+
+ private:
+  std::uint32_t old_window_size_{};
+};
+
+void add(const legate::LogicalStore& input,
+         const legate::LogicalStore& output,
+         std::int64_t value,
+         bool has_side_effect = false)
+{
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = runtime->find_library(Config::LIBRARY_NAME);
+  auto task    = runtime->create_task(library, AddTask::TASK_CONFIG.task_id());
+  auto in_var  = task.add_input(input);
+  auto out_var = task.add_output(output);
+
+  task.add_constraint(legate::align(in_var, out_var));
+  task.add_scalar_arg(legate::Scalar{value});
+  task.set_side_effect(has_side_effect);
+  runtime->submit(std::move(task));
+}
+
+[[nodiscard]] legate::LogicalStore create_store(std::int64_t value)
+{
+  auto runtime = legate::Runtime::get_runtime();
+  auto store   = runtime->create_store(legate::Shape{EXT}, legate::int64());
+
+  runtime->issue_fill(store, legate::Scalar{value});
+  return store;
+}
+
+void check_store(const legate::LogicalStore& store, std::int64_t expected)
+{
+  auto p_store = store.get_physical_store();
+  auto acc     = p_store.read_accessor<std::int64_t, 1>();
+  auto shape   = p_store.shape<1>();
+
+  for (auto idx = shape.lo[0]; idx <= shape.hi[0]; ++idx) {
+    ASSERT_EQ(acc[idx], expected);
+  }
+}
+
+}  // namespace
+
+TEST_F(DeadOperations, Chain)
+{
+  {
+    auto first  = create_store(1);
+    auto second = create_store(2);
+
+    // Both stores are destroyed before they are read, so none of the tasks needs to run
+    add(first, second, 3);
+    add(second, first, 4);
+  }
+  legate::Runtime::get_runtime()->issue_execution_fence(/*block=*/true);
+  ASSERT_EQ(num_runs.load(), 0);
+}
+
+TEST_F(DeadOperations, SideEffect)
+{
+  {
+    auto first  = create_store(1);
+    auto second = create_store(2);
+
+    add(first, second, 3, /*has_side_effect=*/true);
+  }
+  legate::Runtime::get_runtime()->issue_execution_fence(/*block=*/true);
+  ASSERT_GT(num_runs.load(), 0);
+}
+
+TEST_F(DeadOperations, Read)
+{
+  auto result = create_store(0);
+
+  {
+    auto temp = create_store(1);
+
+    // The temporary store is read before it is destroyed, so all writes to it must happen
+    add(temp, temp, 2);
+    add(temp, result, 3);
+  }
+  check_store(result, 6);
+}
+
+TEST_F(DeadOperations, UnboundOutput)
+{
+  auto runtime = legate::Runtime::get_runtime();
+
+  {
+    auto unbound = runtime->create_store(legate::int64());
+    auto task    = runtime->create_task(runtime->find_library(Config::LIBRARY_NAME),
+                                     BindEmptyTask::TASK_CONFIG.task_id());
+
+    // The unbound store has no region field until the task runs, so the task must be kept even
+    // though the store is discarded right after
+    static_cast<void>(task.add_output(unbound));
+    runtime->submit(std::move(task));
+  }
+  runtime->issue_execution_fence(/*block=*/true);
+  ASSERT_GT(num_runs.load(), 0);
+}
+
+}  // namespace dead_operations_test
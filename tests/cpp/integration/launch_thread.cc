@@ -0,0 +1,203 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate.h>
+
+#include <legate/runtime/detail/runtime.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utilities/utilities.h>
+#include <utility>
+#include <vector>
+
+namespace launch_thread_test {
+
+namespace {
+
+constexpr std::uint64_t EXT            = 100;
+constexpr std::uint32_t WINDOW_SIZE    = 4;
+constexpr std::uint32_t NUM_ITERATIONS = 10;
+
+class IncrementTask : public legate::LegateTask<IncrementTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{0}};
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    auto output = context.output(0).data();
+    auto shape  = output.shape<1>();
+
+    if (shape.empty()) {
+      return;
+    }
+
+    auto acc = output.read_write_accessor<std::int64_t, 1>(shape);
+
+    for (auto idx = shape.lo[0]; idx <= shape.hi[0]; ++idx) {
+      acc[idx] += 1;
+    }
+  }
+};
+
+class Config {
+ public:
+  static constexpr std::string_view LIBRARY_NAME = "test_launch_thread";
+
+  static void registration_callback(legate::Library library)
+  {
+    IncrementTask::register_variants(library);
+  }
+};
+
+class LaunchThread : public RegisterOnceFixture<Config> {
+ protected:
+  void SetUp() override
+  {
+    RegisterOnceFixture<Config>::SetUp();
+
+    auto& runtime = legate::detail::Runtime::get_runtime();
+
+    old_window_size_ = runtime.scope().exchange_scheduling_window_size(WINDOW_SIZE);
+    was_active_      = runtime.launch_thread().active();
+    if (!was_active_) {
+      runtime.flush_scheduling_window();
+      runtime.launch_thread().start(runtime.get_legion_runtime(), runtime.get_legion_context());
+    }
+  }
+
+  void TearDown() override
+  {
+    auto& runtime = legate::detail::Runtime::get_runtime();
+
+    runtime.flush_scheduling_window();
+    if (!was_active_) {
+      runtime.launch_thread().stop();
+    }
+    static_cast<void>(runtime.scope().exchange_scheduling_window_size(old_window_size_));
+    RegisterOnceFixture<Config>::TearDown();
+  }
+
+ private:
+  std::uint32_t old_window_size_{};
+  bool was_active_{};
+};
+
+void increment(const legate::LogicalStore& store)
+{
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = runtime->find_library(Config::LIBRARY_NAME);
+  auto task    = runtime->create_task(library, IncrementTask::TASK_CONFIG.task_id());
+
+  task.add_input(store);
+  task.add_output(store);
+  runtime->submit(std::move(task));
+}
+
+[[nodiscard]] legate::LogicalStore create_store()
+{
+  auto runtime = legate::Runtime::get_runtime();
+  auto store   = runtime->create_store(legate::Shape{EXT}, legate::int64());
+
+  runtime->issue_fill(store, legate::Scalar{std::int64_t{0}});
+  return store;
+}
+
+void check_store(const legate::LogicalStore& store, std::int64_t expected)
+{
+  auto p_store = store.get_physical_store();
+  auto acc     = p_store.read_accessor<std::int64_t, 1>();
+  auto shape   = p_store.shape<1>();
+
+  for (auto idx = shape.lo[0]; idx <= shape.hi[0]; ++idx) {
+    ASSERT_EQ(acc[idx], expected);
+  }
+}
+
+}  // namespace
+
+TEST_F(LaunchThread, Loop)
+{
+  auto store = create_store();
+
+  // Fills the scheduling window several times over, so that most tasks are handed over to the
+  // launch thread
+  for (std::uint32_t i = 0; i < NUM_ITERATIONS; ++i) {
+    increment(store);
+  }
+  // Mapping the store must wait for all the tasks to be launched
+  check_store(store, NUM_ITERATIONS);
+}
+
+TEST_F(LaunchThread, TemporaryStores)
+{
+  auto store = create_store();
+
+  // The temporaries are released while the tasks using them are being launched
+  for (std::uint32_t i = 0; i < NUM_ITERATIONS; ++i) {
+    auto temp = create_store();
+
+    increment(temp);
+    increment(store);
+  }
+  legate::Runtime::get_runtime()->issue_execution_fence(/*block=*/true);
+  check_store(store, NUM_ITERATIONS);
+}
+
+TEST_F(LaunchThread, InterleavedStoreLifetimes)
+{
+  constexpr std::size_t MAX_LIVE = 3;
+  // Cached once, so that none of the calls below enter the runtime through get_runtime()
+  auto* const runtime = legate::Runtime::get_runtime();
+  const auto library  = runtime->find_library(Config::LIBRARY_NAME);
+  auto store          = runtime->create_store(legate::Shape{EXT}, legate::int64());
+  std::vector<std::pair<legate::LogicalStore, std::int64_t>> live;
+
+  runtime->issue_fill(store, legate::Scalar{std::int64_t{0}});
+  for (std::uint32_t i = 0; i < 4 * NUM_ITERATIONS; ++i) {
+    auto temp = runtime->create_store(legate::Shape{EXT}, legate::int64());
+    auto copy = runtime->create_store(legate::Shape{EXT}, legate::int64());
+    auto task = runtime->create_task(library, IncrementTask::TASK_CONFIG.task_id());
+
+    // Fills and copies don't go through the task submission path
+    runtime->issue_fill(temp, legate::Scalar{std::int64_t{i}});
+    runtime->issue_copy(copy, temp);
+    task.add_input(store);
+    task.add_output(store);
+    runtime->submit(std::move(task));
+    // Destroys stores while the windows using them may be being launched. The temporary store
+    // goes away at the end of the iteration.
+    if (live.size() == MAX_LIVE) {
+      live.erase(live.begin());
+    }
+    live.emplace_back(std::move(copy), i);
+  }
+  check_store(store, 4 * NUM_ITERATIONS);
+  for (auto&& [temp, value] : live) {
+    check_store(temp, value);
+  }
+}
+
+TEST_F(LaunchThread, Stop)
+{
+  auto& runtime        = legate::detail::Runtime::get_runtime();
+  auto&& launch_thread = runtime.launch_thread();
+  auto store           = create_store();
+
+  for (std::uint32_t i = 0; i < NUM_ITERATIONS; ++i) {
+    increment(store);
+  }
+  // Stopping the launch thread launches the windows handed over to it
+  launch_thread.stop();
+  ASSERT_FALSE(launch_thread.active());
+  check_store(store, NUM_ITERATIONS);
+  launch_thread.start(runtime.get_legion_runtime(), runtime.get_legion_context());
+}
+
+}  // namespace launch_thread_test
@@ -0,0 +1,200 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate.h>
+
+#include <legate/data/detail/logical_store.h>
+#include <legate/operation/detail/operation_signature.h>
+#include <legate/partitioning/detail/partition/tiling.h>
+#include <legate/partitioning/detail/strategy_cache.h>
+#include <legate/runtime/detail/runtime.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <utilities/utilities.h>
+
+namespace strategy_cache_test {
+
+namespace {
+
+constexpr std::uint64_t EXT            = 20;
+constexpr std::uint32_t NUM_ITERATIONS = 8;
+
+// Adds one to every element of the store, and checks that the store is broadcast along the first
+// dimension if the scalar argument says so
+class IncrementTask : public legate::LegateTask<IncrementTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{0}};
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    auto output          = context.output(0).data();
+    const auto broadcast = context.scalar(0).value<bool>();
+    const auto shape     = output.shape<2>();
+
+    if (broadcast) {
+      EXPECT_EQ(shape.lo[0], 0);
+      EXPECT_EQ(shape.hi[0], static_cast<legate::coord_t>(EXT) - 1);
+    }
+    if (shape.empty()) {
+      return;
+    }
+
+    auto acc = output.read_write_accessor<std::int64_t, 2>(shape);
+
+    for (legate::PointInRectIterator<2> it{shape}; it.valid(); ++it) {
+      acc[*it] += 1;
+    }
+  }
+};
+
+class Config {
+ public:
+  static constexpr std::string_view LIBRARY_NAME = "test_strategy_cache";
+
+  static void registration_callback(legate::Library library)
+  {
+    IncrementTask::register_variants(library);
+  }
+};
+
+class StrategyCache : public RegisterOnceFixture<Config> {
+ protected:
+  [[nodiscard]] static legate::detail::StrategyCache& cache()
+  {
+    return legate::detail::Runtime::get_runtime().strategy_cache();
+  }
+};
+
+void increment(const legate::LogicalStore& store, bool broadcast)
+{
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = runtime->find_library(Config::LIBRARY_NAME);
+  auto task    = runtime->create_task(library, IncrementTask::TASK_CONFIG.task_id());
+  auto in_var  = task.add_input(store);
+  auto out_var = task.add_output(store);
+
+  task.add_constraint(legate::align(in_var, out_var));
+  if (broadcast) {
+    task.add_constraint(legate::broadcast(out_var, {0}));
+  }
+  task.add_scalar_arg(legate::Scalar{broadcast});
+  runtime->submit(std::move(task));
+}
+
+[[nodiscard]] legate::LogicalStore create_store()
+{
+  auto runtime = legate::Runtime::get_runtime();
+  auto store   = runtime->create_store(legate::Shape{EXT, EXT}, legate::int64());
+
+  runtime->issue_fill(store, legate::Scalar{std::int64_t{0}});
+  return store;
+}
+
+[[nodiscard]] legate::detail::OperationSignature make_signature(std::uint64_t value)
+{
+  legate::detail::OperationSignature result{};
+
+  result.append(value);
+  return result;
+}
+
+void check_store(const legate::LogicalStore& store, std::int64_t expected)
+{
+  auto p_store = store.get_physical_store();
+  auto acc     = p_store.read_accessor<std::int64_t, 2>();
+  auto shape   = p_store.shape<2>();
+
+  for (legate::PointInRectIterator<2> it{shape}; it.valid(); ++it) {
+    ASSERT_EQ(acc[*it], expected);
+  }
+}
+
+}  // namespace
+
+TEST_F(StrategyCache, Loop)
+{
+  auto store      = create_store();
+  const auto hits = cache().num_hits();
+
+  for (std::uint32_t i = 0; i < NUM_ITERATIONS; ++i) {
+    increment(store, /*broadcast=*/false);
+  }
+  legate::Runtime::get_runtime()->issue_execution_fence(/*block=*/true);
+
+  ASSERT_GT(cache().num_hits(), hits);
+  check_store(store, NUM_ITERATIONS);
+}
+
+TEST_F(StrategyCache, Constraints)
+{
+  auto store = create_store();
+
+  // The tasks differ only by their constraints, so they must not share strategies
+  for (std::uint32_t i = 0; i < NUM_ITERATIONS; ++i) {
+    increment(store, /*broadcast=*/false);
+    increment(store, /*broadcast=*/true);
+  }
+  check_store(store, 2 * NUM_ITERATIONS);
+}
+
+TEST_F(StrategyCache, KeyPartitionEpoch)
+{
+  auto store     = create_store();
+  auto&& impl    = store.impl();
+  auto&& runtime = legate::detail::Runtime::get_runtime();
+
+  const auto tiling = [] {
+    return legate::detail::create_tiling(
+      legate::detail::SmallVector<std::uint64_t, LEGATE_MAX_DIM>{EXT / 2, EXT},
+      legate::detail::SmallVector<std::uint64_t, LEGATE_MAX_DIM>{2, 1});
+  };
+
+  runtime.flush_scheduling_window();
+
+  const auto initial = impl->key_partition_epochs();
+
+  impl->set_key_partition(runtime.get_machine(), legate::ParallelPolicy{}, tiling());
+
+  const auto tiled = impl->key_partition_epochs();
+
+  ASSERT_NE(tiled, initial);
+
+  // Setting an equivalent key partition keeps the strategies cached for the old one valid
+  impl->set_key_partition(runtime.get_machine(), legate::ParallelPolicy{}, tiling());
+  ASSERT_EQ(impl->key_partition_epochs(), tiled);
+
+  impl->reset_key_partition();
+  ASSERT_NE(impl->key_partition_epochs(), tiled);
+}
+
+TEST_F(StrategyCache, LeastRecentlyUsedEviction)
+{
+  constexpr auto MAX_NUM_ENTRIES = legate::detail::StrategyCache::MAX_NUM_ENTRIES;
+  legate::detail::StrategyCache local_cache{};
+
+  for (std::uint64_t i = 0; i < MAX_NUM_ENTRIES; ++i) {
+    local_cache.insert(make_signature(i), legate::detail::Strategy{nullptr});
+  }
+  ASSERT_EQ(local_cache.num_entries(), MAX_NUM_ENTRIES);
+  ASSERT_EQ(local_cache.num_evictions(), 0);
+
+  // Using the oldest entry makes the second oldest one the least recently used
+  ASSERT_TRUE(local_cache.find(nullptr, make_signature(0)).has_value());
+  local_cache.insert(make_signature(MAX_NUM_ENTRIES), legate::detail::Strategy{nullptr});
+
+  ASSERT_EQ(local_cache.num_entries(), MAX_NUM_ENTRIES);
+  ASSERT_EQ(local_cache.num_evictions(), 1);
+  ASSERT_TRUE(local_cache.find(nullptr, make_signature(0)).has_value());
+  ASSERT_FALSE(local_cache.find(nullptr, make_signature(1)).has_value());
+  ASSERT_TRUE(local_cache.find(nullptr, make_signature(MAX_NUM_ENTRIES)).has_value());
+  ASSERT_EQ(local_cache.num_hits(), 3);
+  ASSERT_EQ(local_cache.num_misses(), 1);
+}
+
+}  // namespace strategy_cache_test
@@ -0,0 +1,232 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate.h>
+
+#include <legate/runtime/detail/runtime.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <utilities/utilities.h>
+
+namespace task_fusion_test {
+
+namespace {
+
+constexpr std::uint64_t EXT = 42;
+// Large enough to hold all tasks of a test, so they all get a chance to be fused
+constexpr std::uint32_t WINDOW_SIZE = 16;
+
+template <std::int32_t DIM>
+void add_scalar(legate::TaskContext context)
+{
+  auto input       = context.input(0).data();
+  auto output      = context.output(0).data();
+  const auto value = context.scalar(0).value<std::int64_t>();
+  const auto shape = output.shape<DIM>();
+
+  if (shape.empty()) {
+    return;
+  }
+
+  auto in_acc  = input.read_accessor<std::int64_t, DIM>(shape);
+  auto out_acc = output.write_accessor<std::int64_t, DIM>(shape);
+
+  for (legate::PointInRectIterator<DIM> it{shape}; it.valid(); ++it) {
+    out_acc[*it] = in_acc[*it] + value;
+  }
+}
+
+// Computes output = input + scalar
+class FusableAddTask : public legate::LegateTask<FusableAddTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{0}};
+  static constexpr auto CPU_VARIANT_OPTIONS = legate::VariantOptions{}.with_fusable(true);
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    const auto dim = context.output(0).dim();
+
+    if (dim == 1) {
+      add_scalar<1>(context);
+    } else {
+      add_scalar<2>(context);
+    }
+  }
+};
+
+// Same as FusableAddTask, but doesn't opt in to fusion
+class AddTask : public legate::LegateTask<AddTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{1}};
+
+  static void cpu_variant(legate::TaskContext context) { add_scalar<1>(context); }
+};
+
+class Config {
+ public:
+  static constexpr std::string_view LIBRARY_NAME = "test_task_fusion";
+
+  static void registration_callback(legate::Library library)
+  {
+    FusableAddTask::register_variants(library);
+    AddTask::register_variants(library);
+  }
+};
+
+class TaskFusion : public RegisterOnceFixture<Config> {
+ protected:
+  void SetUp() override
+  {
+    RegisterOnceFixture<Config>::SetUp();
+    old_window_size_ =
+      legate::detail::Runtime::get_runtime().scope().exchange_scheduling_window_size(WINDOW_SIZE);
+  }
+
+  void TearDown() override
+  {
+    static_cast<void>(
+      legate::detail::Runtime::get_runtime().scope().exchange_scheduling_window_size(
+        old_window_size_));
+    RegisterOnceFixture<Config>::TearDown();
+  }
+
+ private:
+  std::uint32_t old_window_size_{};
+};
+
+void add(legate::LocalTaskID task_id,
+         const legate::LogicalStore& input,
+         const legate::LogicalStore& output,
+         std::int64_t value)
+{
+  auto runtime = legate::Runtime::get_runtime();
+  auto library = runtime->find_library(Config::LIBRARY_NAME);
+  auto task    = runtime->create_task(library, task_id);
+  auto in_var  = task.add_input(input);
+  auto out_var = task.add_output(output);
+
+  task.add_constraint(legate::align(in_var, out_var));
+  task.add_scalar_arg(legate::Scalar{value});
+  runtime->submit(std::move(task));
+}
+
+template <std::int32_t DIM>
+void check_store(const legate::LogicalStore& store, std::int64_t expected)
+{
+  auto p_store = store.get_physical_store();
+  auto acc     = p_store.read_accessor<std::int64_t, DIM>();
+  auto shape   = p_store.shape<DIM>();
+
+  for (legate::PointInRectIterator<DIM> it{shape}; it.valid(); ++it) {
+    ASSERT_EQ(acc[*it], expected);
+  }
+}
+
+}  // namespace
+
+TEST_F(TaskFusion, Chain)
+{
+  auto runtime  = legate::Runtime::get_runtime();
+  auto input    = runtime->create_store(legate::Shape{EXT}, legate::int64());
+  auto first    = runtime->create_store(legate::Shape{EXT}, legate::int64());
+  auto second   = runtime->create_store(legate::Shape{EXT}, legate::int64());
+  auto third    = runtime->create_store(legate::Shape{EXT}, legate::int64());
+  const auto id = FusableAddTask::TASK_CONFIG.task_id();
+
+  runtime->issue_fill(input, legate::Scalar{std::int64_t{1}});
+  add(id, input, first, 1);
+  add(id, first, second, 2);
+  add(id, second, third, 3);
+  runtime->issue_execution_fence(true);
+
+  check_store<1>(first, 2);
+  check_store<1>(second, 4);
+  check_store<1>(third, 7);
+}
+
+TEST_F(TaskFusion, InPlace)
+{
+  auto runtime  = legate::Runtime::get_runtime();
+  auto store    = runtime->create_store(legate::Shape{EXT}, legate::int64());
+  const auto id = FusableAddTask::TASK_CONFIG.task_id();
+
+  runtime->issue_fill(store, legate::Scalar{std::int64_t{0}});
+  for (std::int64_t i = 1; i <= 4; ++i) {
+    add(id, store, store, i);
+  }
+  runtime->issue_execution_fence(true);
+
+  check_store<1>(store, 10);
+}
+
+TEST_F(TaskFusion, MixedWithNonFusable)
+{
+  auto runtime  = legate::Runtime::get_runtime();
+  auto input    = runtime->create_store(legate::Shape{EXT}, legate::int64());
+  auto first    = runtime->create_store(legate::Shape{EXT}, legate::int64());
+  auto second   = runtime->create_store(legate::Shape{EXT}, legate::int64());
+  auto third    = runtime->create_store(legate::Shape{EXT}, legate::int64());
+  const auto id = FusableAddTask::TASK_CONFIG.task_id();
+
+  runtime->issue_fill(input, legate::Scalar{std::int64_t{1}});
+  add(id, input, first, 1);
+  add(AddTask::TASK_CONFIG.task_id(), first, second, 2);
+  add(id, second, third, 3);
+  runtime->issue_execution_fence(true);
+
+  check_store<1>(third, 7);
+}
+
+TEST_F(TaskFusion, DifferentShapes)
+{
+  auto runtime  = legate::Runtime::get_runtime();
+  auto input    = runtime->create_store(legate::Shape{EXT}, legate::int64());
+  auto first    = runtime->create_store(legate::Shape{EXT}, legate::int64());
+  auto other    = runtime->create_store(legate::Shape{EXT * 2}, legate::int64());
+  auto other2   = runtime->create_store(legate::Shape{EXT * 2}, legate::int64());
+  const auto id = FusableAddTask::TASK_CONFIG.task_id();
+
+  runtime->issue_fill(input, legate::Scalar{std::int64_t{1}});
+  runtime->issue_fill(other, legate::Scalar{std::int64_t{2}});
+  add(id, input, first, 1);
+  add(id, other, other2, 2);
+  runtime->issue_execution_fence(true);
+
+  check_store<1>(first, 2);
+  check_store<1>(other2, 4);
+}
+
+TEST_F(TaskFusion, TransposedView)
+{
+  // Reading a transposed view of a store written by the previous task crosses leaf tasks, so the
+  // two tasks must not be fused
+  auto runtime   = legate::Runtime::get_runtime();
+  auto input     = runtime->create_store(legate::Shape{EXT, EXT}, legate::int64());
+  auto first     = runtime->create_store(legate::Shape{EXT, EXT}, legate::int64());
+  auto second    = runtime->create_store(legate::Shape{EXT, EXT}, legate::int64());
+  auto input_row = input.slice(0, legate::Slice{0, 1});
+  const auto id  = FusableAddTask::TASK_CONFIG.task_id();
+
+  runtime->issue_fill(input, legate::Scalar{std::int64_t{0}});
+  runtime->issue_fill(input_row, legate::Scalar{std::int64_t{1}});
+  add(id, input, first, 1);
+  add(id, first.transpose({1, 0}), second, 1);
+  runtime->issue_execution_fence(true);
+
+  auto p_store = second.get_physical_store();
+  auto acc     = p_store.read_accessor<std::int64_t, 2>();
+  auto shape   = p_store.shape<2>();
+
+  for (legate::PointInRectIterator<2> it{shape}; it.valid(); ++it) {
+    ASSERT_EQ(acc[*it], (*it)[1] == 0 ? 3 : 2);
+  }
+}
+
+}  // namespace task_fusion_test
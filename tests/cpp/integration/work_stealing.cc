@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <utilities/utilities.h>
+
+namespace work_stealing_test {
+
+namespace {
+
+constexpr std::uint64_t TASKS_PER_PROC = 4;
+constexpr std::uint64_t TILE_SIZE      = 8;
+constexpr std::uint32_t OD_FACTOR      = 4;
+constexpr auto SLOW_TASK_DURATION      = std::chrono::milliseconds{50};
+
+// Fills its chunk of the output with its task index. The first point task takes much longer than
+// the others, so the processor it lands on falls behind the rest.
+void fill_with_task_index(legate::TaskContext context)
+{
+  auto output      = context.output(0);
+  const auto shape = output.shape<1>();
+  const auto index = context.get_task_index()[0];
+
+  if (index == 0) {
+    std::this_thread::sleep_for(SLOW_TASK_DURATION);
+  }
+  if (shape.empty()) {
+    return;
+  }
+
+  auto acc = output.write_accessor<std::int64_t, 1>(shape);
+
+  for (legate::PointInRectIterator<1> it{shape}; it.valid(); ++it) {
+    acc[*it] = index;
+  }
+}
+
+class StealableTask : public legate::LegateTask<StealableTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{0}};
+  static constexpr auto CPU_VARIANT_OPTIONS = legate::VariantOptions{}.with_stealable(true);
+
+  static void cpu_variant(legate::TaskContext context) { fill_with_task_index(context); }
+};
+
+class RegularTask : public legate::LegateTask<RegularTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{1}};
+
+  static void cpu_variant(legate::TaskContext context) { fill_with_task_index(context); }
+};
+
+class Config {
+ public:
+  static constexpr std::string_view LIBRARY_NAME = "test_work_stealing";
+
+  static void registration_callback(legate::Library library)
+  {
+    StealableTask::register_variants(library);
+    RegularTask::register_variants(library);
+  }
+};
+
+class WorkStealing : public RegisterOnceFixture<Config> {};
+
+[[nodiscard]] std::uint64_t num_tasks()
+{
+  return TASKS_PER_PROC *
+         legate::Runtime::get_runtime()->get_machine().count(legate::mapping::TaskTarget::CPU);
+}
+
+legate::LogicalStore launch(legate::LocalTaskID task_id)
+{
+  auto runtime      = legate::Runtime::get_runtime();
+  auto library      = runtime->find_library(Config::LIBRARY_NAME);
+  const auto ntasks = num_tasks();
+  auto store        = runtime->create_store(legate::Shape{ntasks * TILE_SIZE}, legate::int64());
+
+  auto task = runtime->create_task(library, task_id, legate::tuple<std::uint64_t>{ntasks});
+
+  task.add_output(store.partition_by_tiling({TILE_SIZE}));
+  runtime->submit(std::move(task));
+  return store;
+}
+
+void validate_store(const legate::LogicalStore& store)
+{
+  auto p_store = store.get_physical_store();
+  auto acc     = p_store.read_accessor<std::int64_t, 1>();
+  auto shape   = p_store.shape<1>();
+
+  for (legate::PointInRectIterator<1> it{shape}; it.valid(); ++it) {
+    EXPECT_EQ(acc[*it], (*it)[0] / static_cast<std::int64_t>(TILE_SIZE));
+  }
+}
+
+}  // namespace
+
+TEST_F(WorkStealing, StealableVariant)
+{
+  validate_store(launch(StealableTask::TASK_CONFIG.task_id()));
+}
+
+TEST_F(WorkStealing, ScopePolicy)
+{
+  const auto scope = legate::Scope{}.with_parallel_policy(
+    legate::ParallelPolicy{}.with_overdecompose_factor(OD_FACTOR).with_work_stealing(true));
+
+  validate_store(launch(RegularTask::TASK_CONFIG.task_id()));
+}
+
+TEST_F(WorkStealing, NotStealable)
+{
+  // Must keep working exactly as before when nobody opts in
+  validate_store(launch(RegularTask::TASK_CONFIG.task_id()));
+}
+
+}  // namespace work_stealing_test
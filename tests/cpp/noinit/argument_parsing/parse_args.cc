@@ -151,6 +151,11 @@ TEST_F(ParseArgsUnit, NoArgs)
               ArgumentMatches(std::string{LEGATE_SHARED_LIBRARY_PREFIX
                                           "cuda" LEGATE_SHARED_LIBRARY_SUFFIX ".1"}));
   ASSERT_THAT(parsed.experimental_copy_path, ArgumentMatches(::testing::IsFalse()));
+  ASSERT_THAT(parsed.mapper_profiling, ArgumentMatches(::testing::IsFalse()));
+  ASSERT_THAT(parsed.auto_trace, ArgumentMatches(::testing::IsFalse()));
+  ASSERT_THAT(parsed.launch_thread, ArgumentMatches(::testing::IsFalse()));
+  ASSERT_THAT(parsed.adaptive_window, ArgumentMatches(::testing::IsFalse()));
+  ASSERT_THAT(parsed.streaming_read_ahead, ScaledArgumentMatches(0));
 }
 
 TEST_F(ParseArgsUnitNoEnv, NoArgs)
@@ -219,6 +224,11 @@ TEST_F(ParseArgsUnitNoEnv, NoArgs)
   ASSERT_THAT(parsed.freeze_on_error, ArgumentMatches(::testing::IsFalse()));
   ASSERT_THAT(parsed.cuda_driver_path, ArgumentMatches(std::string{"libdummy_cuda_driver.so"}));
   ASSERT_THAT(parsed.experimental_copy_path, ArgumentMatches(::testing::IsFalse()));
+  ASSERT_THAT(parsed.mapper_profiling, ArgumentMatches(::testing::IsFalse()));
+  ASSERT_THAT(parsed.auto_trace, ArgumentMatches(::testing::IsFalse()));
+  ASSERT_THAT(parsed.launch_thread, ArgumentMatches(::testing::IsFalse()));
+  ASSERT_THAT(parsed.adaptive_window, ArgumentMatches(::testing::IsFalse()));
+  ASSERT_THAT(parsed.streaming_read_ahead, ScaledArgumentMatches(0));
 
 #undef TEMP_ENV_VAR
 }
@@ -582,6 +592,15 @@ TEST_F(ParseArgsUnit, Regmem)
   ASSERT_THAT(parsed.regmem, ScaledArgumentMatches(MAGIC));
 }
 
+TEST_F(ParseArgsUnit, StreamingReadAhead)
+{
+  constexpr auto MAGIC = 256;
+  const auto parsed =
+    legate::detail::parse_args({"dummy", "--streaming-read-ahead", std::to_string(MAGIC)});
+
+  ASSERT_THAT(parsed.streaming_read_ahead, ScaledArgumentMatches(MAGIC));
+}
+
 TEST_P(BoolArgs, Profile)
 {
   const auto [arg_value, expected] = GetParam();
@@ -684,6 +703,41 @@ TEST_P(BoolArgs, ExperimentalCopyPath)
   ASSERT_THAT(parsed.experimental_copy_path, ArgumentMatches(expected));
 }
 
+TEST_P(BoolArgs, MapperProfiling)
+{
+  const auto [arg_value, expected] = GetParam();
+  const auto parsed =
+    legate::detail::parse_args({"dummy", "--mapper-profiling", std::string{arg_value}});
+
+  ASSERT_THAT(parsed.mapper_profiling, ArgumentMatches(expected));
+}
+
+TEST_P(BoolArgs, AutoTrace)
+{
+  const auto [arg_value, expected] = GetParam();
+  const auto parsed = legate::detail::parse_args({"dummy", "--auto-trace", std::string{arg_value}});
+
+  ASSERT_THAT(parsed.auto_trace, ArgumentMatches(expected));
+}
+
+TEST_P(BoolArgs, LaunchThread)
+{
+  const auto [arg_value, expected] = GetParam();
+  const auto parsed =
+    legate::detail::parse_args({"dummy", "--launch-thread", std::string{arg_value}});
+
+  ASSERT_THAT(parsed.launch_thread, ArgumentMatches(expected));
+}
+
+TEST_P(BoolArgs, AdaptiveWindow)
+{
+  const auto [arg_value, expected] = GetParam();
+  const auto parsed =
+    legate::detail::parse_args({"dummy", "--adaptive-window", std::string{arg_value}});
+
+  ASSERT_THAT(parsed.adaptive_window, ArgumentMatches(expected));
+}
+
 TEST_F(ParseArgsUnit, Deduplication)
 {
   const auto orig = std::vector<std::string>{"dummy",
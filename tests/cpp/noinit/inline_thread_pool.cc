@@ -0,0 +1,182 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/task/detail/inline_thread_pool.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utilities/utilities.h>
+#include <vector>
+
+namespace inline_thread_pool_test {
+
+namespace {
+
+using legate::detail::InlineThreadPool;
+
+/**
+ * @brief Records the thread each job of a batch ran on.
+ */
+class JobRecorder {
+ public:
+  explicit JobRecorder(std::size_t num_jobs) : threads_(num_jobs) {}
+
+  void record(std::size_t job)
+  {
+    const std::lock_guard lock{mutex_};
+
+    threads_[job] = std::this_thread::get_id();
+    order_.push_back(job);
+  }
+
+  [[nodiscard]] const std::vector<std::thread::id>& threads() const { return threads_; }
+  [[nodiscard]] const std::vector<std::size_t>& order() const { return order_; }
+
+ private:
+  std::mutex mutex_{};
+  std::vector<std::thread::id> threads_{};
+  std::vector<std::size_t> order_{};
+};
+
+}  // namespace
+
+using InlineThreadPoolUnit = DefaultFixture;
+
+TEST_F(InlineThreadPoolUnit, RunsEveryJob)
+{
+  constexpr std::size_t NUM_JOBS = 64;
+  auto recorder                  = JobRecorder{NUM_JOBS};
+
+  InlineThreadPool::get().run(NUM_JOBS, /* num_threads */ 4, [&](std::size_t i) {
+    recorder.record(i);
+  });
+  ASSERT_EQ(recorder.order().size(), NUM_JOBS);
+  for (auto&& thread : recorder.threads()) {
+    ASSERT_NE(thread, std::thread::id{});
+  }
+}
+
+TEST_F(InlineThreadPoolUnit, HelperThreadException)
+{
+  constexpr std::size_t NUM_JOBS = 2;
+  const auto caller              = std::this_thread::get_id();
+  std::mutex mutex{};
+  std::condition_variable cv{};
+  std::size_t num_started = 0;
+
+  // Each job waits for the other one to start, so the two jobs run on different threads, and
+  // exactly one of them runs on a helper thread of the pool
+  const auto job = [&](std::size_t) {
+    {
+      std::unique_lock lock{mutex};
+
+      ++num_started;
+      cv.notify_all();
+      cv.wait(lock, [&] { return num_started == NUM_JOBS; });
+    }
+    if (std::this_thread::get_id() != caller) {
+      throw std::runtime_error{"exception from a helper thread"};
+    }
+  };
+
+  ASSERT_THAT([&] { InlineThreadPool::get().run(NUM_JOBS, /* num_threads */ NUM_JOBS, job); },
+              ::testing::ThrowsMessage<std::runtime_error>(
+                ::testing::StrEq("exception from a helper thread")));
+
+  // The pool is still usable after a batch that threw
+  auto recorder = JobRecorder{NUM_JOBS};
+
+  ASSERT_NO_THROW(InlineThreadPool::get().run(
+    NUM_JOBS, /* num_threads */ NUM_JOBS, [&](std::size_t i) { recorder.record(i); }));
+  ASSERT_EQ(recorder.order().size(), NUM_JOBS);
+}
+
+TEST_F(InlineThreadPoolUnit, LowestJobException)
+{
+  constexpr std::size_t NUM_JOBS = 32;
+  auto recorder                  = JobRecorder{NUM_JOBS};
+
+  // Whichever thread runs them, the exception of the job with the lowest index is rethrown, and
+  // the jobs that don't throw still run
+  ASSERT_THAT(
+    [&] {
+      InlineThreadPool::get().run(NUM_JOBS, /* num_threads */ 4, [&](std::size_t i) {
+        recorder.record(i);
+        if (i % 2 == 1) {
+          throw std::runtime_error{std::to_string(i)};
+        }
+      });
+    },
+    ::testing::ThrowsMessage<std::runtime_error>(::testing::StrEq("1")));
+  ASSERT_EQ(recorder.order().size(), NUM_JOBS);
+}
+
+TEST_F(InlineThreadPoolUnit, SerialFallbackSingleThread)
+{
+  constexpr std::size_t NUM_JOBS = 8;
+  const auto caller              = std::this_thread::get_id();
+  auto recorder                  = JobRecorder{NUM_JOBS};
+
+  InlineThreadPool::get().run(NUM_JOBS, /* num_threads */ 1, [&](std::size_t i) {
+    recorder.record(i);
+  });
+  ASSERT_THAT(recorder.order(), ::testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7));
+  ASSERT_THAT(recorder.threads(), ::testing::Each(caller));
+}
+
+TEST_F(InlineThreadPoolUnit, SerialFallbackWhenBusy)
+{
+  constexpr std::size_t NUM_JOBS       = 2;
+  constexpr std::size_t NUM_INNER_JOBS = 4;
+  auto outer                           = JobRecorder{NUM_JOBS};
+  // The recorders can't be moved, so they are kept in a deque
+  auto inner = std::deque<JobRecorder>{};
+
+  for (std::size_t i = 0; i < NUM_JOBS; ++i) {
+    inner.emplace_back(NUM_INNER_JOBS);
+  }
+  // A batch submitted by a job of a running batch can't use the pool, so it runs on the thread
+  // of that job alone, in order
+  InlineThreadPool::get().run(NUM_JOBS, /* num_threads */ NUM_JOBS, [&](std::size_t i) {
+    outer.record(i);
+    InlineThreadPool::get().run(
+      NUM_INNER_JOBS, /* num_threads */ NUM_INNER_JOBS, [&](std::size_t j) { inner[i].record(j); });
+  });
+  for (std::size_t i = 0; i < NUM_JOBS; ++i) {
+    ASSERT_THAT(inner[i].order(), ::testing::ElementsAre(0, 1, 2, 3));
+    ASSERT_THAT(inner[i].threads(), ::testing::Each(outer.threads()[i]));
+  }
+}
+
+TEST_F(InlineThreadPoolUnit, SerialFallbackException)
+{
+  constexpr std::size_t NUM_JOBS = 4;
+  auto recorder                  = JobRecorder{NUM_JOBS};
+
+  // As on the pool, a job that throws doesn't stop the others, and the first exception is
+  // rethrown
+  ASSERT_THAT(
+    [&] {
+      InlineThreadPool::get().run(NUM_JOBS, /* num_threads */ 1, [&](std::size_t i) {
+        recorder.record(i);
+        if (i >= 1) {
+          throw std::runtime_error{std::to_string(i)};
+        }
+      });
+    },
+    ::testing::ThrowsMessage<std::runtime_error>(::testing::StrEq("1")));
+  ASSERT_THAT(recorder.order(), ::testing::ElementsAre(0, 1, 2, 3));
+}
+
+}  // namespace inline_thread_pool_test
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/operation/detail/operation_signature.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string_view>
+#include <utilities/utilities.h>
+#include <vector>
+
+namespace operation_signature_test {
+
+namespace {
+
+using OperationSignatureUnit = DefaultFixture;
+using legate::detail::OperationSignature;
+
+enum class Kind : std::uint8_t { FOO, BAR };
+
+[[nodiscard]] OperationSignature make_signature(Kind kind,
+                                                std::string_view transform,
+                                                const std::vector<std::uint64_t>& extents)
+{
+  OperationSignature result{};
+
+  result.append(kind);
+  result.append(transform);
+  result.append_all(extents);
+  return result;
+}
+
+}  // namespace
+
+TEST_F(OperationSignatureUnit, Equal)
+{
+  const auto lhs = make_signature(Kind::FOO, "promote", {1, 2});
+  const auto rhs = make_signature(Kind::FOO, "promote", {1, 2});
+
+  ASSERT_EQ(lhs, rhs);
+  ASSERT_EQ(lhs.hash(), rhs.hash());
+}
+
+TEST_F(OperationSignatureUnit, DifferentValues)
+{
+  const auto signature = make_signature(Kind::FOO, "promote", {1, 2});
+
+  ASSERT_NE(signature, make_signature(Kind::BAR, "promote", {1, 2}));
+  ASSERT_NE(signature, make_signature(Kind::FOO, "project", {1, 2}));
+  ASSERT_NE(signature, make_signature(Kind::FOO, "promote", {1, 3}));
+}
+
+TEST_F(OperationSignatureUnit, ValueBoundaries)
+{
+  // The same bytes split differently between strings or ranges make different signatures
+  OperationSignature lhs{};
+  OperationSignature rhs{};
+
+  lhs.append(std::string_view{"ab"});
+  lhs.append(std::string_view{"c"});
+  rhs.append(std::string_view{"a"});
+  rhs.append(std::string_view{"bc"});
+  ASSERT_NE(lhs, rhs);
+
+  OperationSignature lhs_range{};
+  OperationSignature rhs_range{};
+
+  lhs_range.append_all(std::vector<std::uint64_t>{1, 2});
+  lhs_range.append_all(std::vector<std::uint64_t>{3});
+  rhs_range.append_all(std::vector<std::uint64_t>{1});
+  rhs_range.append_all(std::vector<std::uint64_t>{2, 3});
+  ASSERT_NE(lhs_range, rhs_range);
+}
+
+TEST_F(OperationSignatureUnit, Empty)
+{
+  ASSERT_EQ(OperationSignature{}, OperationSignature{});
+  ASSERT_NE(OperationSignature{}, make_signature(Kind::FOO, "", {}));
+}
+
+}  // namespace operation_signature_test
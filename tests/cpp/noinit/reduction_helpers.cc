@@ -0,0 +1,224 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/comm/coll_comm.h>
+#include <legate/comm/detail/reduction_helpers.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utilities/utilities.h>
+#include <vector>
+
+namespace reduction_helpers_test {
+
+namespace {
+
+using legate::comm::coll::CollDataType;
+using legate::detail::comm::coll::apply_reduction;
+
+template <typename T>
+[[nodiscard]] constexpr CollDataType coll_type_of()
+{
+  if constexpr (std::is_same_v<T, std::int8_t>) {
+    return CollDataType::CollInt8;
+  } else if constexpr (std::is_same_v<T, char>) {
+    return CollDataType::CollChar;
+  } else if constexpr (std::is_same_v<T, std::uint8_t>) {
+    return CollDataType::CollUint8;
+  } else if constexpr (std::is_same_v<T, int>) {
+    return CollDataType::CollInt;
+  } else if constexpr (std::is_same_v<T, std::uint32_t>) {
+    return CollDataType::CollUint32;
+  } else if constexpr (std::is_same_v<T, std::int64_t>) {
+    return CollDataType::CollInt64;
+  } else if constexpr (std::is_same_v<T, std::uint64_t>) {
+    return CollDataType::CollUint64;
+  } else if constexpr (std::is_same_v<T, float>) {
+    return CollDataType::CollFloat;
+  } else {
+    static_assert(std::is_same_v<T, double>);
+    return CollDataType::CollDouble;
+  }
+}
+
+template <typename T>
+[[nodiscard]] T reference(T a, T b, legate::ReductionOpKind op)
+{
+  switch (op) {
+    case legate::ReductionOpKind::ADD: return static_cast<T>(a + b);
+    case legate::ReductionOpKind::MUL: return static_cast<T>(a * b);
+    case legate::ReductionOpKind::MAX: return std::max(a, b);
+    case legate::ReductionOpKind::MIN: return std::min(a, b);
+    case legate::ReductionOpKind::AND: [[fallthrough]];
+    case legate::ReductionOpKind::OR: [[fallthrough]];
+    case legate::ReductionOpKind::XOR: {
+      if constexpr (std::is_integral_v<T>) {
+        if (op == legate::ReductionOpKind::AND) {
+          return static_cast<T>(a & b);
+        }
+        if (op == legate::ReductionOpKind::OR) {
+          return static_cast<T>(a | b);
+        }
+        return static_cast<T>(a ^ b);
+      }
+      break;
+    }
+  }
+  return T{};
+}
+
+// Small enough values that neither ADD nor MUL overflow any of the types
+template <typename T>
+[[nodiscard]] std::vector<T> make_values(std::size_t count, std::size_t seed)
+{
+  std::vector<T> values(count);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    values[i] = static_cast<T>(((i * 7) + (seed * 13)) % 11);
+  }
+  return values;
+}
+
+}  // namespace
+
+template <typename T>
+class ReductionHelpersUnit : public DefaultFixture {};
+
+using ReductionTypes = ::testing::Types<std::int8_t,
+                                        char,
+                                        std::uint8_t,
+                                        int,
+                                        std::uint32_t,
+                                        std::int64_t,
+                                        std::uint64_t,
+                                        float,
+                                        double>;
+
+TYPED_TEST_SUITE(ReductionHelpersUnit, ReductionTypes, );
+
+TYPED_TEST(ReductionHelpersUnit, MatchesScalarReference)
+{
+  using T = TypeParam;
+
+  std::vector<legate::ReductionOpKind> ops = {legate::ReductionOpKind::ADD,
+                                              legate::ReductionOpKind::MUL,
+                                              legate::ReductionOpKind::MAX,
+                                              legate::ReductionOpKind::MIN};
+
+  if constexpr (std::is_integral_v<T>) {
+    ops.insert(
+      ops.end(),
+      {legate::ReductionOpKind::AND, legate::ReductionOpKind::OR, legate::ReductionOpKind::XOR});
+  }
+
+  // Counts that are not multiples of any vector width exercise the remainder loops
+  for (auto&& op : ops) {
+    for (auto&& count : {0, 1, 3, 17, 64, 1023, 4099}) {
+      const auto n       = static_cast<std::size_t>(count);
+      auto dst       = make_values<T>(n, 1);
+      const auto src = make_values<T>(n, 2);
+      std::vector<T> expected(n);
+
+      std::transform(dst.begin(), dst.end(), src.begin(), expected.begin(), [&](T a, T b) {
+        return reference(a, b, op);
+      });
+      apply_reduction(dst.data(), src.data(), n, coll_type_of<T>(), op);
+      ASSERT_EQ(dst, expected) << "op " << static_cast<int>(op) << ", count " << count;
+    }
+  }
+}
+
+TYPED_TEST(ReductionHelpersUnit, BitwiseOnFloatingPoint)
+{
+  using T = TypeParam;
+
+  if constexpr (std::is_integral_v<T>) {
+    GTEST_SKIP() << "Bitwise reductions are supported for integral types";
+  } else {
+    std::vector<T> dst(5, T{1});
+    const std::vector<T> src(5, T{1});
+
+    ASSERT_THAT(
+      [&] {
+        apply_reduction(
+          dst.data(), src.data(), dst.size(), coll_type_of<T>(), legate::ReductionOpKind::XOR);
+      },
+      ::testing::ThrowsMessage<std::invalid_argument>(
+        ::testing::HasSubstr("Reduction does not support non-integral types with XOR")));
+  }
+}
+
+TYPED_TEST(ReductionHelpersUnit, InPlace)
+{
+  using T = TypeParam;
+
+  // In-place collectives pass the same buffer as both source and destination
+  constexpr std::size_t COUNT = 1023;
+  auto values                 = make_values<T>(COUNT, 1);
+  std::vector<T> expected(COUNT);
+
+  std::transform(values.begin(), values.end(), expected.begin(), [](T a) {
+    return reference(a, a, legate::ReductionOpKind::ADD);
+  });
+  apply_reduction(
+    values.data(), values.data(), COUNT, coll_type_of<T>(), legate::ReductionOpKind::ADD);
+  ASSERT_EQ(values, expected);
+}
+
+TYPED_TEST(ReductionHelpersUnit, OverlappingBuffers)
+{
+  using T = TypeParam;
+
+  // The source starts half way into the destination, so its upper half is read after the lower
+  // half of the destination has been updated
+  constexpr std::size_t COUNT = 1024;
+  auto values                 = make_values<T>(COUNT + (COUNT / 2), 1);
+  auto expected               = values;
+
+  for (std::size_t i = 0; i < COUNT; ++i) {
+    expected[i + (COUNT / 2)] =
+      reference(expected[i + (COUNT / 2)], expected[i], legate::ReductionOpKind::MAX);
+  }
+  apply_reduction(values.data() + (COUNT / 2),
+                  values.data(),
+                  COUNT,
+                  coll_type_of<T>(),
+                  legate::ReductionOpKind::MAX);
+  ASSERT_EQ(values, expected);
+}
+
+using ReductionHelpersExtremesUnit = DefaultFixture;
+
+TEST_F(ReductionHelpersExtremesUnit, MaxMin)
+{
+  // Extremes must survive the vectorized compare-and-select
+  std::vector<double> dst = {std::numeric_limits<double>::lowest(),
+                             std::numeric_limits<double>::max(),
+                             -0.5,
+                             0.5};
+  const std::vector<double> src = {0.0, 0.0, 0.0, 0.0};
+  auto dst_min                  = dst;
+
+  apply_reduction(
+    dst.data(), src.data(), dst.size(), CollDataType::CollDouble, legate::ReductionOpKind::MAX);
+  ASSERT_THAT(dst, ::testing::ElementsAre(0.0, std::numeric_limits<double>::max(), 0.0, 0.5));
+  apply_reduction(dst_min.data(),
+                  src.data(),
+                  dst_min.size(),
+                  CollDataType::CollDouble,
+                  legate::ReductionOpKind::MIN);
+  ASSERT_THAT(dst_min,
+              ::testing::ElementsAre(std::numeric_limits<double>::lowest(), 0.0, -0.5, 0.0));
+}
+
+}  // namespace reduction_helpers_test
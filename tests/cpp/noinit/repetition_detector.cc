@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/runtime/detail/auto_trace.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <optional>
+#include <utilities/utilities.h>
+#include <vector>
+
+namespace repetition_detector_test {
+
+namespace {
+
+using RepetitionDetectorUnit = DefaultFixture;
+using legate::detail::RepetitionDetector;
+
+// Records the signatures in order, and returns the last sequence the detector reported
+[[nodiscard]] std::optional<std::vector<std::size_t>> record_all(
+  RepetitionDetector* detector, const std::vector<std::size_t>& signatures)
+{
+  std::optional<std::vector<std::size_t>> result{};
+
+  for (auto&& signature : signatures) {
+    if (auto sequence = detector->record(signature); sequence.has_value()) {
+      result = std::move(sequence);
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST_F(RepetitionDetectorUnit, NoRepetition)
+{
+  RepetitionDetector detector;
+
+  ASSERT_FALSE(record_all(&detector, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}).has_value());
+}
+
+TEST_F(RepetitionDetectorUnit, Loop)
+{
+  RepetitionDetector detector;
+
+  // The first occurrence alone isn't a repetition
+  ASSERT_FALSE(record_all(&detector, {100, 1, 2, 3, 4, 5}).has_value());
+  ASSERT_THAT(record_all(&detector, {1, 2, 3, 4, 5}),
+              ::testing::Optional(::testing::ElementsAre(1, 2, 3, 4, 5)));
+}
+
+TEST_F(RepetitionDetectorUnit, ShortLoop)
+{
+  RepetitionDetector detector;
+
+  // Bodies shorter than the minimum length are reported as several iterations
+  ASSERT_THAT(record_all(&detector, {1, 2, 1, 2, 1, 2, 1, 2}),
+              ::testing::Optional(::testing::ElementsAre(1, 2, 1, 2)));
+}
+
+TEST_F(RepetitionDetectorUnit, ForgetsAfterReport)
+{
+  RepetitionDetector detector;
+
+  ASSERT_TRUE(record_all(&detector, {1, 2, 3, 4, 1, 2, 3, 4}).has_value());
+  // The history was cleared, so one more iteration isn't enough for another report
+  ASSERT_FALSE(record_all(&detector, {1, 2, 3, 4}).has_value());
+}
+
+TEST_F(RepetitionDetectorUnit, Reset)
+{
+  RepetitionDetector detector;
+
+  ASSERT_FALSE(record_all(&detector, {1, 2, 3, 4}).has_value());
+  detector.reset();
+  ASSERT_FALSE(record_all(&detector, {1, 2, 3, 4}).has_value());
+  ASSERT_TRUE(record_all(&detector, {1, 2, 3, 4}).has_value());
+}
+
+TEST_F(RepetitionDetectorUnit, TooLong)
+{
+  RepetitionDetector detector;
+  std::vector<std::size_t> body{};
+
+  for (std::size_t i = 0; i <= RepetitionDetector::MAX_LENGTH; ++i) {
+    body.push_back(i);
+  }
+  ASSERT_FALSE(record_all(&detector, body).has_value());
+  ASSERT_FALSE(record_all(&detector, body).has_value());
+}
+
+}  // namespace repetition_detector_test
@@ -0,0 +1,126 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/runtime/detail/scheduling_window.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <utilities/utilities.h>
+
+namespace scheduling_window_monitor_test {
+
+namespace {
+
+using SchedulingWindowMonitorUnit = DefaultFixture;
+using legate::detail::SchedulingWindowMonitor;
+using FlushCause = SchedulingWindowMonitor::FlushCause;
+
+constexpr std::uint32_t WINDOW_SIZE = 4;
+
+[[nodiscard]] SchedulingWindowMonitor make_adaptive_monitor()
+{
+  SchedulingWindowMonitor monitor;
+
+  monitor.set_adaptive(true);
+  return monitor;
+}
+
+}  // namespace
+
+TEST_F(SchedulingWindowMonitorUnit, Statistics)
+{
+  SchedulingWindowMonitor monitor;
+
+  monitor.record_window_opened();
+  ASSERT_FALSE(monitor.record_flush(FlushCause::WINDOW_FULL, WINDOW_SIZE, WINDOW_SIZE));
+  monitor.record_window_opened();
+  ASSERT_FALSE(monitor.record_flush(FlushCause::NEEDS_FLUSH, 2, WINDOW_SIZE));
+  monitor.record_window_opened();
+  ASSERT_FALSE(monitor.record_flush(FlushCause::EXPLICIT, 1, WINDOW_SIZE));
+  // Flushes of empty windows aren't counted
+  ASSERT_FALSE(monitor.record_flush(FlushCause::EXPLICIT, 0, WINDOW_SIZE));
+
+  const auto stats = monitor.statistics(WINDOW_SIZE);
+
+  ASSERT_EQ(stats.window_size, WINDOW_SIZE);
+  ASSERT_EQ(stats.num_full_flushes, 1);
+  ASSERT_EQ(stats.num_forced_flushes, 1);
+  ASSERT_EQ(stats.num_explicit_flushes, 1);
+  ASSERT_EQ(stats.num_flushed_operations, WINDOW_SIZE + 3);
+  ASSERT_EQ(stats.max_occupancy, WINDOW_SIZE);
+  ASSERT_EQ(stats.num_resizes, 0);
+}
+
+TEST_F(SchedulingWindowMonitorUnit, NotAdaptive)
+{
+  SchedulingWindowMonitor monitor;
+
+  monitor.record_launch(1, std::chrono::seconds{1});
+  monitor.record_window_opened();
+  ASSERT_FALSE(monitor.record_flush(FlushCause::WINDOW_FULL, WINDOW_SIZE, WINDOW_SIZE));
+}
+
+TEST_F(SchedulingWindowMonitorUnit, NoLaunchTime)
+{
+  auto monitor = make_adaptive_monitor();
+
+  // Nothing is known about the launch time yet
+  monitor.record_window_opened();
+  ASSERT_FALSE(monitor.record_flush(FlushCause::WINDOW_FULL, WINDOW_SIZE, WINDOW_SIZE));
+}
+
+TEST_F(SchedulingWindowMonitorUnit, Grow)
+{
+  auto monitor = make_adaptive_monitor();
+
+  // The window fills up much faster than its operations can be launched
+  monitor.record_launch(1, std::chrono::seconds{1});
+  monitor.record_window_opened();
+  ASSERT_THAT(monitor.record_flush(FlushCause::WINDOW_FULL, WINDOW_SIZE, WINDOW_SIZE),
+              ::testing::Optional(2 * WINDOW_SIZE));
+  ASSERT_EQ(monitor.statistics(2 * WINDOW_SIZE).num_resizes, 1);
+
+  // Never beyond the maximum
+  monitor.record_window_opened();
+  ASSERT_FALSE(monitor.record_flush(FlushCause::WINDOW_FULL,
+                                    SchedulingWindowMonitor::MAX_WINDOW_SIZE,
+                                    SchedulingWindowMonitor::MAX_WINDOW_SIZE));
+}
+
+TEST_F(SchedulingWindowMonitorUnit, ForcedFlushDoesNotGrow)
+{
+  auto monitor = make_adaptive_monitor();
+
+  monitor.record_launch(1, std::chrono::seconds{1});
+  monitor.record_window_opened();
+  ASSERT_FALSE(monitor.record_flush(FlushCause::NEEDS_FLUSH, 1, WINDOW_SIZE));
+  monitor.record_window_opened();
+  ASSERT_FALSE(monitor.record_flush(FlushCause::EXPLICIT, 1, WINDOW_SIZE));
+}
+
+TEST_F(SchedulingWindowMonitorUnit, Shrink)
+{
+  auto monitor = make_adaptive_monitor();
+
+  // The operations wait in the window for much longer than it takes to launch them
+  monitor.record_launch(1, std::chrono::nanoseconds{1});
+  monitor.record_window_opened();
+  std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  ASSERT_THAT(monitor.record_flush(FlushCause::EXPLICIT, 1, WINDOW_SIZE),
+              ::testing::Optional(WINDOW_SIZE / 2));
+
+  // Never below the minimum
+  monitor.record_window_opened();
+  std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  ASSERT_FALSE(monitor.record_flush(FlushCause::WINDOW_FULL,
+                                    1,
+                                    SchedulingWindowMonitor::MIN_WINDOW_SIZE));
+}
+
+}  // namespace scheduling_window_monitor_test
@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/mapping/detail/task_statistics.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utilities/utilities.h>
+
+namespace task_statistics_test {
+
+namespace {
+
+using TaskStatisticsUnit = DefaultFixture;
+using legate::mapping::detail::TaskStatisticsTable;
+
+constexpr auto TASK_ID = legate::GlobalTaskID{12};
+constexpr auto VARIANT = legate::VariantCode::CPU;
+
+}  // namespace
+
+TEST_F(TaskStatisticsUnit, Empty)
+{
+  const TaskStatisticsTable table;
+
+  ASSERT_FALSE(table.find(TASK_ID, VARIANT, legate::Processor::NO_PROC).has_value());
+}
+
+TEST_F(TaskStatisticsUnit, FootprintOnly)
+{
+  TaskStatisticsTable table;
+
+  table.record_footprint(TASK_ID, VARIANT, legate::Processor::NO_PROC, 100);
+  // Mapped but never run, so there is no execution time to report yet
+  ASSERT_FALSE(table.find(TASK_ID, VARIANT, legate::Processor::NO_PROC).has_value());
+}
+
+TEST_F(TaskStatisticsUnit, Record)
+{
+  TaskStatisticsTable table;
+  const auto proc = legate::Processor::NO_PROC;
+
+  table.record_footprint(TASK_ID, VARIANT, proc, 100);
+  table.record_footprint(TASK_ID, VARIANT, proc, 300);
+  table.record_execution(TASK_ID, VARIANT, proc, std::chrono::nanoseconds{1000});
+
+  auto stats = table.find(TASK_ID, VARIANT, proc);
+
+  ASSERT_TRUE(stats.has_value());
+  ASSERT_EQ(stats->num_executions, std::uint64_t{1});
+  ASSERT_EQ(stats->execution_time, std::chrono::nanoseconds{1000});
+  ASSERT_EQ(stats->instance_footprint, std::size_t{200});
+
+  // The moving average moves a quarter of the way towards the new sample
+  table.record_execution(TASK_ID, VARIANT, proc, std::chrono::nanoseconds{2000});
+  stats = table.find(TASK_ID, VARIANT, proc);
+  ASSERT_TRUE(stats.has_value());
+  ASSERT_EQ(stats->num_executions, std::uint64_t{2});
+  ASSERT_EQ(stats->execution_time, std::chrono::nanoseconds{1250});
+
+  // Other variants are tracked separately
+  ASSERT_FALSE(table.find(TASK_ID, legate::VariantCode::GPU, proc).has_value());
+  ASSERT_FALSE(table.find(legate::GlobalTaskID{13}, VARIANT, proc).has_value());
+}
+
+}  // namespace task_statistics_test
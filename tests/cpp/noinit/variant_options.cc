@@ -34,6 +34,9 @@ TEST_F(VariantOptions, Options)
                          .with_elide_device_ctx_sync(true)
                          .with_has_side_effect(true)
                          .with_may_throw_exception(true)
+                         .with_stealable(true)
+                         .with_fusable(true)
+                         .with_read_ahead(true)
                          .with_communicators({"my_comm", "my_other_comm"});
 
   ASSERT_EQ(options.concurrent, true);
@@ -41,6 +44,9 @@ TEST_F(VariantOptions, Options)
   ASSERT_EQ(options.elide_device_ctx_sync, true);
   ASSERT_EQ(options.has_side_effect, true);
   ASSERT_EQ(options.may_throw_exception, true);
+  ASSERT_EQ(options.stealable, true);
+  ASSERT_EQ(options.fusable, true);
+  ASSERT_EQ(options.read_ahead, true);
   ASSERT_THAT(
     options.communicators,
     ::testing::Optional(::testing::ElementsAreArray(
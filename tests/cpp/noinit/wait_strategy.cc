@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/comm/detail/wait_strategy.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utilities/utilities.h>
+#include <vector>
+
+namespace wait_strategy_test {
+
+namespace {
+
+using legate::detail::comm::coll::ThreadBarrier;
+using legate::detail::comm::coll::WaitEvent;
+using legate::detail::comm::coll::WaitStrategy;
+
+class WaitStrategyUnit : public DefaultFixture,
+                         public ::testing::WithParamInterface<WaitStrategy> {};
+
+}  // namespace
+
+INSTANTIATE_TEST_SUITE_P(,
+                         WaitStrategyUnit,
+                         ::testing::Values(WaitStrategy::SPIN,
+                                           WaitStrategy::YIELD,
+                                           WaitStrategy::BLOCK));
+
+TEST_P(WaitStrategyUnit, WaitUntilNotified)
+{
+  WaitEvent event;
+  std::atomic<bool> flag{};
+  std::thread waiter{[&] { event.wait_until([&] { return flag.load(); }, GetParam()); }};
+
+  // Give the waiter a chance to go to sleep, so that only the notification can wake it up
+  std::this_thread::sleep_for(std::chrono::milliseconds{50});
+  flag = true;
+  event.notify_all();
+  waiter.join();
+  ASSERT_TRUE(flag.load());
+}
+
+TEST_P(WaitStrategyUnit, BarrierSeparatesPhases)
+{
+  constexpr std::int32_t NUM_THREADS = 6;
+  constexpr int NUM_PHASES           = 50;
+  WaitEvent event;
+  ThreadBarrier barrier;
+  std::vector<std::atomic<int>> phases(NUM_THREADS);
+  std::atomic<int> num_errors{};
+  std::vector<std::thread> threads;
+
+  barrier.init(NUM_THREADS);
+  threads.reserve(NUM_THREADS);
+  for (std::int32_t i = 0; i < NUM_THREADS; ++i) {
+    threads.emplace_back([&, i] {
+      for (int phase = 1; phase <= NUM_PHASES; ++phase) {
+        phases[static_cast<std::size_t>(i)] = phase;
+        barrier.arrive_and_wait(event, GetParam());
+        // Nobody may have moved on to the next phase before everybody has read this one
+        for (auto&& other : phases) {
+          if (other != phase) {
+            ++num_errors;
+          }
+        }
+        barrier.arrive_and_wait(event, GetParam());
+      }
+    });
+  }
+  for (auto&& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(num_errors.load(), 0);
+}
+
+}  // namespace wait_strategy_test
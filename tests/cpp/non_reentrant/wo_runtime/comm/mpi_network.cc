@@ -0,0 +1,562 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/comm/detail/mpi_network.h>
+
+#include <legate/comm/coll_comm.h>
+#include <legate/comm/detail/coll_request.h>
+#include <legate/comm/detail/mpi_interface.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <integration/comm/common_comm.h>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utilities/utilities.h>
+#include <vector>
+
+namespace mpi_network_test {
+
+namespace {
+
+using legate::comm::coll::CollComm;
+using legate::comm::coll::CollDataType;
+using legate::detail::comm::coll::CollRequest;
+using legate::detail::comm::coll::MPINetwork;
+using legate::detail::comm::mpi::detail::MPIInterface;
+
+// Small enough that an all-to-all among more than two processes takes several windows
+constexpr std::int32_t MAX_IN_FLIGHT = 1;
+
+[[nodiscard]] int mpi_rank()
+{
+  int rank = 0;
+
+  EXPECT_EQ(MPIInterface::mpi_comm_rank(MPIInterface::MPI_COMM_WORLD(), &rank),
+            MPIInterface::MPI_SUCCESS());
+  return rank;
+}
+
+[[nodiscard]] int mpi_size()
+{
+  int size = 0;
+
+  EXPECT_EQ(MPIInterface::mpi_comm_size(MPIInterface::MPI_COMM_WORLD(), &size),
+            MPIInterface::MPI_SUCCESS());
+  return size;
+}
+
+/**
+ * @brief The mapping table of a communicator in which process `p` holds
+ * `ranks_per_process(p)` consecutive ranks.
+ */
+template <typename F>
+[[nodiscard]] std::vector<int> make_mapping_table(F&& ranks_per_process)
+{
+  std::vector<int> mapping_table{};
+
+  for (int process = 0; process < mpi_size(); ++process) {
+    mapping_table.insert(mapping_table.end(), ranks_per_process(process), process);
+  }
+  return mapping_table;
+}
+
+/**
+ * @brief The number of ranks of process `process` in the uneven layouts: three in the first
+ * process, and then alternately one and two, so that some processes have no other rank to share
+ * memory with.
+ */
+[[nodiscard]] int uneven_ranks_per_process(int process)
+{
+  if (process == 0) {
+    return 3;
+  }
+  return process % 2 == 1 ? 1 : 2;
+}
+
+/**
+ * @brief The mapping table of a communicator in which process `p` holds
+ * `ranks_per_process(p)` ranks, dealt out to the processes in turn, so that the ranks of a
+ * process are not consecutive.
+ */
+template <typename F>
+[[nodiscard]] std::vector<int> make_interleaved_mapping_table(F&& ranks_per_process)
+{
+  std::vector<int> remaining{};
+  std::vector<int> mapping_table{};
+
+  for (int process = 0; process < mpi_size(); ++process) {
+    remaining.push_back(ranks_per_process(process));
+  }
+  while (std::any_of(remaining.begin(), remaining.end(), [](int n) { return n > 0; })) {
+    for (std::size_t process = 0; process < remaining.size(); ++process) {
+      if (remaining[process] > 0) {
+        --remaining[process];
+        mapping_table.push_back(static_cast<int>(process));
+      }
+    }
+  }
+  return mapping_table;
+}
+
+/**
+ * @brief Run `body` on every rank of a communicator that lives in this process, each on a
+ * thread of its own, as the tasks of a collective launch would.
+ */
+template <typename F>
+void run_ranks(MPINetwork& network, const std::vector<int>& mapping_table, F&& body)
+{
+  const auto unique_id = network.init_comm();
+  const auto size      = static_cast<int>(mapping_table.size());
+  const auto process   = mpi_rank();
+  std::vector<std::thread> threads{};
+
+  for (int rank = 0; rank < size; ++rank) {
+    if (mapping_table[static_cast<std::size_t>(rank)] != process) {
+      continue;
+    }
+    threads.emplace_back([&, rank] {
+      legate::comm::coll::Coll_Comm comm{};
+
+      network.comm_create(&comm, size, rank, unique_id, mapping_table.data());
+      body(static_cast<CollComm>(&comm));
+      network.comm_destroy(&comm);
+    });
+  }
+  for (auto&& thread : threads) {
+    thread.join();
+  }
+}
+
+void wait_by_testing(CollRequest* request)
+{
+  while (!request->test()) {
+    std::this_thread::yield();
+  }
+  // Completion is sticky
+  ASSERT_TRUE(request->test());
+}
+
+// The value rank `src` sends to rank `dst` at index `idx` of the segment destined to it
+[[nodiscard]] std::int64_t value_of(int src, int dst, int idx)
+{
+  constexpr std::int64_t SCALE = 1000;
+
+  return (((static_cast<std::int64_t>(src) * SCALE) + dst) * SCALE) + idx;
+}
+
+// Small values, so that products over all ranks stay exact in floating point
+template <typename T>
+[[nodiscard]] T contribution_of(int rank, int idx)
+{
+  return static_cast<T>(1 + ((rank + idx) % 3));
+}
+
+template <typename T>
+[[nodiscard]] T reduce_reference(T lhs, T rhs, legate::ReductionOpKind op)
+{
+  switch (op) {
+    case legate::ReductionOpKind::ADD: return static_cast<T>(lhs + rhs);
+    case legate::ReductionOpKind::MUL: return static_cast<T>(lhs * rhs);
+    case legate::ReductionOpKind::MAX: return std::max(lhs, rhs);
+    case legate::ReductionOpKind::MIN: return std::min(lhs, rhs);
+    case legate::ReductionOpKind::OR: [[fallthrough]];
+    case legate::ReductionOpKind::AND: [[fallthrough]];
+    case legate::ReductionOpKind::XOR: {
+      if constexpr (std::is_integral_v<T>) {
+        switch (op) {
+          case legate::ReductionOpKind::OR: return static_cast<T>(lhs | rhs);
+          case legate::ReductionOpKind::AND: return static_cast<T>(lhs & rhs);
+          case legate::ReductionOpKind::XOR: return static_cast<T>(lhs ^ rhs);
+          case legate::ReductionOpKind::ADD: [[fallthrough]];
+          case legate::ReductionOpKind::MUL: [[fallthrough]];
+          case legate::ReductionOpKind::MAX: [[fallthrough]];
+          case legate::ReductionOpKind::MIN: break;
+        }
+      }
+      break;
+    }
+  }
+  ADD_FAILURE() << "Unexpected reduction op " << static_cast<int>(op);
+  return lhs;
+}
+
+class MPINetworkTest : public ::testing::Test {
+ public:
+  static void SetUpTestSuite()
+  {
+    // A network finalizes MPI if it initialized it, after which MPI cannot be initialized again,
+    // so the networks are shared by all tests. The first one created must be destroyed last.
+    network_      = std::make_unique<MPINetwork>(MAX_IN_FLIGHT);
+    flat_network_ = std::make_unique<MPINetwork>(MPINetwork::DEFAULT_ALL_TO_ALL_MAX_IN_FLIGHT,
+                                                 /* hierarchical_collectives */ false);
+  }
+
+  static void TearDownTestSuite()
+  {
+    flat_network_.reset();
+    network_.reset();
+  }
+
+ protected:
+  /**
+   * @return The network under test, with hierarchical collectives.
+   */
+  [[nodiscard]] static MPINetwork& network() { return *network_; }
+
+  /**
+   * @return A network running all collectives through the root, to compare against.
+   */
+  [[nodiscard]] static MPINetwork& flat_network() { return *flat_network_; }
+
+  /**
+   * @brief All-gather with both networks on the given layout, and check that they agree with
+   * each other and with the expected result.
+   */
+  template <typename T>
+  static void check_all_gather(const std::vector<int>& mapping_table, int count);
+
+  /**
+   * @brief All-reduce with both networks on the given layout, and check that they agree with
+   * each other and with the expected result.
+   */
+  template <typename T>
+  static void check_all_reduce(const std::vector<int>& mapping_table,
+                               int count,
+                               legate::ReductionOpKind op,
+                               bool in_place);
+
+  /**
+   * @brief Check all reduction ops applicable to `T`, in and out of place.
+   */
+  template <typename T>
+  static void check_all_reduce_ops(const std::vector<int>& mapping_table, int count);
+
+ private:
+  static inline std::unique_ptr<MPINetwork> network_{};
+  static inline std::unique_ptr<MPINetwork> flat_network_{};
+};
+
+template <typename T>
+/*static*/ void MPINetworkTest::check_all_gather(const std::vector<int>& mapping_table, int count)
+{
+  const auto size = static_cast<int>(mapping_table.size());
+  // The result of each rank living in this process, indexed by global rank
+  std::vector<std::vector<T>> hierarchical(static_cast<std::size_t>(size));
+  std::vector<std::vector<T>> flat(static_cast<std::size_t>(size));
+  const auto gather_with = [&](MPINetwork& net, std::vector<std::vector<T>>* results) {
+    run_ranks(net, mapping_table, [&](CollComm comm) {
+      const auto self = comm->global_rank;
+      std::vector<T> send{};
+      auto& recv = (*results)[static_cast<std::size_t>(self)];
+
+      for (int i = 0; i < count; ++i) {
+        send.push_back(contribution_of<T>(self, i));
+      }
+      recv.resize(static_cast<std::size_t>(size * count));
+      net.all_gather(
+        send.data(), recv.data(), count, common_comm::TypeToCollDataType<T>::VALUE, comm);
+    });
+  };
+
+  gather_with(network(), &hierarchical);
+  gather_with(flat_network(), &flat);
+  for (int rank = 0; rank < size; ++rank) {
+    if (mapping_table[static_cast<std::size_t>(rank)] != mpi_rank()) {
+      continue;
+    }
+
+    const auto& result = hierarchical[static_cast<std::size_t>(rank)];
+
+    ASSERT_EQ(result, flat[static_cast<std::size_t>(rank)]) << "rank " << rank;
+    for (int src = 0; src < size; ++src) {
+      for (int i = 0; i < count; ++i) {
+        ASSERT_EQ(result[static_cast<std::size_t>((src * count) + i)], contribution_of<T>(src, i))
+          << "rank " << rank << ", block " << src << ", element " << i;
+      }
+    }
+  }
+}
+
+template <typename T>
+/*static*/ void MPINetworkTest::check_all_reduce(const std::vector<int>& mapping_table,
+                                                 int count,
+                                                 legate::ReductionOpKind op,
+                                                 bool in_place)
+{
+  const auto size = static_cast<int>(mapping_table.size());
+  std::vector<std::vector<T>> hierarchical(static_cast<std::size_t>(size));
+  std::vector<std::vector<T>> flat(static_cast<std::size_t>(size));
+  const auto reduce_with = [&](MPINetwork& net, std::vector<std::vector<T>>* results) {
+    run_ranks(net, mapping_table, [&](CollComm comm) {
+      const auto self = comm->global_rank;
+      std::vector<T> send{};
+      auto& recv = (*results)[static_cast<std::size_t>(self)];
+
+      for (int i = 0; i < count; ++i) {
+        send.push_back(contribution_of<T>(self, i));
+      }
+      if (in_place) {
+        recv = send;
+      } else {
+        recv.resize(static_cast<std::size_t>(count));
+      }
+      net.all_reduce(in_place ? recv.data() : send.data(),
+                     recv.data(),
+                     count,
+                     common_comm::TypeToCollDataType<T>::VALUE,
+                     op,
+                     comm);
+    });
+  };
+
+  reduce_with(network(), &hierarchical);
+  reduce_with(flat_network(), &flat);
+
+  std::vector<T> expected{};
+
+  for (int i = 0; i < count; ++i) {
+    auto value = contribution_of<T>(0, i);
+
+    for (int rank = 1; rank < size; ++rank) {
+      value = reduce_reference(value, contribution_of<T>(rank, i), op);
+    }
+    expected.push_back(value);
+  }
+  for (int rank = 0; rank < size; ++rank) {
+    if (mapping_table[static_cast<std::size_t>(rank)] != mpi_rank()) {
+      continue;
+    }
+    ASSERT_EQ(hierarchical[static_cast<std::size_t>(rank)], flat[static_cast<std::size_t>(rank)])
+      << "rank " << rank << ", op " << static_cast<int>(op) << ", in place " << in_place;
+    ASSERT_EQ(hierarchical[static_cast<std::size_t>(rank)], expected)
+      << "rank " << rank << ", op " << static_cast<int>(op) << ", in place " << in_place;
+  }
+}
+
+template <typename T>
+/*static*/ void MPINetworkTest::check_all_reduce_ops(const std::vector<int>& mapping_table,
+                                                     int count)
+{
+  std::vector<legate::ReductionOpKind> ops = {legate::ReductionOpKind::ADD,
+                                              legate::ReductionOpKind::MUL,
+                                              legate::ReductionOpKind::MAX,
+                                              legate::ReductionOpKind::MIN};
+
+  if constexpr (std::is_integral_v<T>) {
+    ops.insert(ops.end(),
+               {legate::ReductionOpKind::OR,
+                legate::ReductionOpKind::AND,
+                legate::ReductionOpKind::XOR});
+  }
+  for (auto&& op : ops) {
+    for (auto in_place : {false, true}) {
+      check_all_reduce<T>(mapping_table, count, op, in_place);
+    }
+  }
+}
+
+}  // namespace
+
+TEST_F(MPINetworkTest, IsendIrecv)
+{
+  constexpr int COUNT = 16;
+  const auto self     = mpi_rank();
+  const auto peer     = (self + 1) % mpi_size();
+  const auto from     = (self + mpi_size() - 1) % mpi_size();
+  std::vector<std::int64_t> send(COUNT), recv(COUNT);
+  std::vector<MPIInterface::MPI_Request> requests(2);
+
+  for (int i = 0; i < COUNT; ++i) {
+    send[static_cast<std::size_t>(i)] = value_of(self, peer, i);
+  }
+
+  // Poll with testall
+  ASSERT_EQ(MPIInterface::mpi_irecv(recv.data(),
+                                    COUNT,
+                                    MPIInterface::MPI_INT64_T(),
+                                    from,
+                                    /* tag */ 0,
+                                    MPIInterface::MPI_COMM_WORLD(),
+                                    &requests[0]),
+            MPIInterface::MPI_SUCCESS());
+  ASSERT_EQ(MPIInterface::mpi_isend(send.data(),
+                                    COUNT,
+                                    MPIInterface::MPI_INT64_T(),
+                                    peer,
+                                    /* tag */ 0,
+                                    MPIInterface::MPI_COMM_WORLD(),
+                                    &requests[1]),
+            MPIInterface::MPI_SUCCESS());
+  for (int flag = 0; !flag;) {
+    ASSERT_EQ(MPIInterface::mpi_testall(static_cast<int>(requests.size()), requests.data(), &flag),
+              MPIInterface::MPI_SUCCESS());
+  }
+  for (int i = 0; i < COUNT; ++i) {
+    ASSERT_EQ(recv[static_cast<std::size_t>(i)], value_of(from, self, i));
+  }
+
+  // Block with waitall
+  recv.assign(COUNT, 0);
+  ASSERT_EQ(MPIInterface::mpi_irecv(recv.data(),
+                                    COUNT,
+                                    MPIInterface::MPI_INT64_T(),
+                                    from,
+                                    /* tag */ 1,
+                                    MPIInterface::MPI_COMM_WORLD(),
+                                    &requests[0]),
+            MPIInterface::MPI_SUCCESS());
+  ASSERT_EQ(MPIInterface::mpi_isend(send.data(),
+                                    COUNT,
+                                    MPIInterface::MPI_INT64_T(),
+                                    peer,
+                                    /* tag */ 1,
+                                    MPIInterface::MPI_COMM_WORLD(),
+                                    &requests[1]),
+            MPIInterface::MPI_SUCCESS());
+  ASSERT_EQ(MPIInterface::mpi_waitall(static_cast<int>(requests.size()), requests.data()),
+            MPIInterface::MPI_SUCCESS());
+  for (int i = 0; i < COUNT; ++i) {
+    ASSERT_EQ(recv[static_cast<std::size_t>(i)], value_of(from, self, i));
+  }
+}
+
+TEST_F(MPINetworkTest, AllToAll)
+{
+  constexpr int COUNT       = 3;
+  const auto mapping_table  = make_mapping_table([](int) { return 2; });
+  const auto size           = static_cast<int>(mapping_table.size());
+  const auto segment_offset = [](int rank, int idx) {
+    return static_cast<std::size_t>((rank * COUNT) + idx);
+  };
+
+  run_ranks(network(), mapping_table, [&](CollComm comm) {
+    const auto self = comm->global_rank;
+    std::vector<std::int64_t> send(static_cast<std::size_t>(size * COUNT));
+    std::vector<std::int64_t> recv(send.size());
+
+    for (int dst = 0; dst < size; ++dst) {
+      for (int i = 0; i < COUNT; ++i) {
+        send[segment_offset(dst, i)] = value_of(self, dst, i);
+      }
+    }
+    network().all_to_all(send.data(), recv.data(), COUNT, CollDataType::CollInt64, comm);
+    for (int src = 0; src < size; ++src) {
+      for (int i = 0; i < COUNT; ++i) {
+        EXPECT_EQ(recv[segment_offset(src, i)], value_of(src, self, i));
+      }
+    }
+  });
+}
+
+TEST_F(MPINetworkTest, IAllToAllV)
+{
+  const auto mapping_table = make_mapping_table([](int) { return 2; });
+  const auto size          = static_cast<int>(mapping_table.size());
+
+  run_ranks(network(), mapping_table, [&](CollComm comm) {
+    const auto self = comm->global_rank;
+    // Rank `src` sends `src + dst + 1` elements to rank `dst`, so the segments differ in size
+    const auto count_of = [](int src, int dst) { return src + dst + 1; };
+    std::vector<int> sendcounts, sdispls, recvcounts, rdispls;
+    std::vector<std::int64_t> send, recv;
+
+    for (int peer = 0; peer < size; ++peer) {
+      sdispls.push_back(static_cast<int>(send.size()));
+      sendcounts.push_back(count_of(self, peer));
+      for (int i = 0; i < sendcounts.back(); ++i) {
+        send.push_back(value_of(self, peer, i));
+      }
+      rdispls.push_back(static_cast<int>(recv.size()));
+      recvcounts.push_back(count_of(peer, self));
+      recv.resize(recv.size() + static_cast<std::size_t>(recvcounts.back()));
+    }
+
+    auto request = network().iall_to_all_v(send.data(),
+                                           sendcounts.data(),
+                                           sdispls.data(),
+                                           recv.data(),
+                                           recvcounts.data(),
+                                           rdispls.data(),
+                                           CollDataType::CollInt64,
+                                           comm);
+
+    wait_by_testing(request.get());
+    for (int src = 0; src < size; ++src) {
+      for (int i = 0; i < count_of(src, self); ++i) {
+        EXPECT_EQ(recv[static_cast<std::size_t>(rdispls[static_cast<std::size_t>(src)] + i)],
+                  value_of(src, self, i));
+      }
+    }
+  });
+}
+
+TEST_F(MPINetworkTest, IAllReduce)
+{
+  constexpr int COUNT      = 7;
+  const auto mapping_table = make_mapping_table([](int) { return 2; });
+  const auto size          = static_cast<std::int64_t>(mapping_table.size());
+
+  run_ranks(network(), mapping_table, [&](CollComm comm) {
+    std::vector<std::int64_t> send(COUNT), recv(COUNT);
+
+    for (int i = 0; i < COUNT; ++i) {
+      send[static_cast<std::size_t>(i)] = (comm->global_rank * COUNT) + i;
+    }
+
+    auto request = network().iall_reduce(send.data(),
+                                         recv.data(),
+                                         COUNT,
+                                         CollDataType::CollInt64,
+                                         legate::ReductionOpKind::ADD,
+                                         comm);
+
+    request->wait();
+    for (int i = 0; i < COUNT; ++i) {
+      // The sum over all ranks r of r * COUNT + i
+      EXPECT_EQ(recv[static_cast<std::size_t>(i)],
+                ((size * (size - 1) / 2) * COUNT) + (size * i));
+    }
+  });
+}
+
+TEST_F(MPINetworkTest, HierarchicalAllGather)
+{
+  const auto contiguous  = make_mapping_table(uneven_ranks_per_process);
+  const auto interleaved = make_interleaved_mapping_table(uneven_ranks_per_process);
+
+  for (auto&& mapping_table : {contiguous, interleaved}) {
+    for (auto count : {1, 13}) {
+      check_all_gather<std::int8_t>(mapping_table, count);
+      check_all_gather<std::uint32_t>(mapping_table, count);
+      check_all_gather<std::int64_t>(mapping_table, count);
+      check_all_gather<double>(mapping_table, count);
+    }
+  }
+}
+
+TEST_F(MPINetworkTest, HierarchicalAllReduce)
+{
+  const auto contiguous  = make_mapping_table(uneven_ranks_per_process);
+  const auto interleaved = make_interleaved_mapping_table(uneven_ranks_per_process);
+
+  for (auto&& mapping_table : {contiguous, interleaved}) {
+    // Fewer elements than ranks leaves some ranks without a slice to reduce
+    for (auto count : {2, 13}) {
+      check_all_reduce_ops<std::int8_t>(mapping_table, count);
+      check_all_reduce_ops<int>(mapping_table, count);
+      check_all_reduce_ops<std::uint64_t>(mapping_table, count);
+      check_all_reduce_ops<float>(mapping_table, count);
+      check_all_reduce_ops<double>(mapping_table, count);
+    }
+  }
+}
+
+}  // namespace mpi_network_test
@@ -0,0 +1,302 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <utilities/env.h>
+#include <utilities/utilities.h>
+#include <utility>
+#include <vector>
+
+namespace test_inline_launch_index_launch {
+
+namespace {
+
+constexpr std::uint64_t TILE_SIZE  = 4;
+constexpr std::uint64_t NUM_TILES  = 8;
+constexpr std::int64_t FILL_VALUE  = 10;
+constexpr std::int64_t NO_VALUE    = -1;
+constexpr std::uint64_t STORE_SIZE = TILE_SIZE * NUM_TILES;
+
+// Computes output = input + the index of the point, and checks that each point gets its own tile
+// of the output, in the coordinates of the whole store
+class AddIndexTask : public legate::LegateTask<AddIndexTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{0}};
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    auto input        = context.input(0).data();
+    auto output       = context.output(0).data();
+    const auto index  = context.get_task_index()[0];
+    const auto shape  = output.shape<1>();
+    const auto in_acc = input.read_accessor<std::int64_t, 1>();
+    auto out_acc      = output.write_accessor<std::int64_t, 1>();
+
+    ASSERT_FALSE(context.is_single_task());
+    ASSERT_EQ(context.get_launch_domain().get_volume(), NUM_TILES);
+    ASSERT_EQ(shape.lo[0], index * static_cast<std::int64_t>(TILE_SIZE));
+    ASSERT_EQ(shape.volume(), TILE_SIZE);
+    for (auto idx = shape.lo[0]; idx <= shape.hi[0]; ++idx) {
+      out_acc[idx] = in_acc[idx] + index;
+    }
+  }
+};
+
+// Writes the index of the point to its tile of the output, and raises an exception on the odd
+// points
+class ThrowTask : public legate::LegateTask<ThrowTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{1}};
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    auto output      = context.output(0).data();
+    const auto index = context.get_task_index()[0];
+    const auto shape = output.shape<1>();
+    auto acc         = output.write_accessor<std::int64_t, 1>();
+
+    for (auto idx = shape.lo[0]; idx <= shape.hi[0]; ++idx) {
+      acc[idx] = index;
+    }
+    if (index % 2 == 1) {
+      throw legate::TaskException{static_cast<std::int32_t>(index), "exception from a point"};
+    }
+  }
+};
+
+// Records the thread each point runs on, in the order the points run
+class RecordThreadTask : public legate::LegateTask<RecordThreadTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{2}};
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    const std::lock_guard lock{mutex};
+
+    points.emplace_back(context.get_task_index()[0], std::this_thread::get_id());
+  }
+
+  static inline std::mutex mutex{};
+  static inline std::vector<std::pair<std::int64_t, std::thread::id>> points{};
+};
+
+class Config {
+ public:
+  static constexpr std::string_view LIBRARY_NAME = "test_inline_launch_index_launch";
+
+  static void registration_callback(legate::Library library)
+  {
+    AddIndexTask::register_variants(library);
+    ThrowTask::register_variants(library);
+    RecordThreadTask::register_variants(library);
+  }
+};
+
+class InlineIndexLaunch : public RegisterOnceFixture<Config> {
+ protected:
+  void SetUp() override
+  {
+    ASSERT_NO_THROW(legate::start());
+    RegisterOnceFixture::SetUp();
+  }
+
+  void TearDown() override
+  {
+    RegisterOnceFixture::TearDown();
+    ASSERT_EQ(legate::finish(), 0);
+  }
+
+ private:
+  legate::test::Environment::TemporaryEnvVar legate_config_{"LEGATE_CONFIG",
+                                                            /*value=*/"--inline-task-launch ",
+                                                            /* overwrite */ true};
+};
+
+[[nodiscard]] legate::LogicalStore make_store(std::int64_t value)
+{
+  auto* const runtime = legate::Runtime::get_runtime();
+  auto ret            = runtime->create_store(legate::Shape{STORE_SIZE}, legate::int64());
+
+  runtime->issue_fill(ret, legate::Scalar{value});
+  return ret;
+}
+
+[[nodiscard]] legate::Scope cpu_scope()
+{
+  return legate::Scope{
+    legate::Runtime::get_runtime()->get_machine().only(legate::mapping::TaskTarget::CPU)};
+}
+
+[[nodiscard]] legate::ManualTask create_task(legate::LocalTaskID task_id)
+{
+  auto* const runtime = legate::Runtime::get_runtime();
+  const auto lib      = runtime->find_library(Config::LIBRARY_NAME);
+
+  return runtime->create_task(lib, task_id, {NUM_TILES});
+}
+
+void launch(const legate::LogicalStore& input, const legate::LogicalStorePartition& output)
+{
+  auto task = create_task(AddIndexTask::TASK_CONFIG.task_id());
+
+  task.add_input(input);
+  task.add_output(output);
+  legate::Runtime::get_runtime()->submit(std::move(task));
+}
+
+// Submits the task, and launches it right away rather than when the scheduling window fills up
+void submit_and_flush(legate::ManualTask task)
+{
+  auto* const runtime = legate::Runtime::get_runtime();
+
+  runtime->submit(std::move(task));
+  runtime->issue_execution_fence(/* block */ true);
+}
+
+void check_store(const legate::LogicalStore& store)
+{
+  const auto p_store = store.get_physical_store();
+  const auto acc     = p_store.read_accessor<std::int64_t, 1>();
+
+  for (std::uint64_t idx = 0; idx < STORE_SIZE; ++idx) {
+    ASSERT_EQ(acc[idx], FILL_VALUE + static_cast<std::int64_t>(idx / TILE_SIZE));
+  }
+}
+
+}  // namespace
+
+TEST_F(InlineIndexLaunch, Tiled)
+{
+  const auto _      = cpu_scope();
+  const auto input  = make_store(FILL_VALUE);
+  const auto output = make_store(NO_VALUE);
+
+  launch(input, output.partition_by_tiling({TILE_SIZE}));
+  check_store(output);
+}
+
+TEST_F(InlineIndexLaunch, Sliced)
+{
+  auto* const runtime = legate::Runtime::get_runtime();
+  const auto _        = cpu_scope();
+  const auto input    = make_store(FILL_VALUE);
+  const auto parent   =
+    runtime->create_store(legate::Shape{STORE_SIZE + TILE_SIZE}, legate::int64());
+  // The tiles of the slice are in the coordinates of the slice, not in those of its parent
+  const auto output = parent.slice(0, legate::Slice{static_cast<std::int64_t>(TILE_SIZE)});
+
+  runtime->issue_fill(output, legate::Scalar{NO_VALUE});
+  launch(input, output.partition_by_tiling({TILE_SIZE}));
+  check_store(output);
+}
+
+TEST_F(InlineIndexLaunch, ExceptionFromPoints)
+{
+  const auto _      = cpu_scope();
+  const auto output = make_store(NO_VALUE);
+  auto task         = create_task(ThrowTask::TASK_CONFIG.task_id());
+
+  // The points write disjoint tiles, so they run concurrently, and the odd points raise their
+  // exceptions on whichever thread of the pool runs them. The exception of the first point that
+  // raised one is reported.
+  task.throws_exception(true);
+  task.add_output(output.partition_by_tiling({TILE_SIZE}));
+  try {
+    legate::Runtime::get_runtime()->submit(std::move(task));
+    FAIL();
+  } catch (const legate::TaskException& exn) {
+    ASSERT_EQ(exn.index(), 1);
+  }
+
+  // The points that raised no exception, and those that did, all ran to completion
+  const auto p_output = output.get_physical_store();
+  const auto acc      = p_output.read_accessor<std::int64_t, 1>();
+
+  for (std::uint64_t idx = 0; idx < STORE_SIZE; ++idx) {
+    ASSERT_EQ(acc[idx], static_cast<std::int64_t>(idx / TILE_SIZE));
+  }
+}
+
+TEST_F(InlineIndexLaunch, SerialFallback)
+{
+  const auto _      = cpu_scope();
+  const auto output = make_store(NO_VALUE);
+  auto task         = create_task(RecordThreadTask::TASK_CONFIG.task_id());
+
+  // Every point writes the whole output, so the points can't run concurrently, and run one after
+  // the other on the thread launching the task instead
+  task.add_output(output);
+  RecordThreadTask::points.clear();
+  submit_and_flush(std::move(task));
+
+  ASSERT_EQ(RecordThreadTask::points.size(), NUM_TILES);
+  for (std::uint64_t idx = 0; idx < NUM_TILES; ++idx) {
+    ASSERT_EQ(RecordThreadTask::points[idx].first, static_cast<std::int64_t>(idx));
+    ASSERT_EQ(RecordThreadTask::points[idx].second, RecordThreadTask::points.front().second);
+  }
+}
+
+TEST_F(InlineIndexLaunch, RejectProjection)
+{
+  const auto _     = cpu_scope();
+  const auto input = make_store(FILL_VALUE);
+  auto task        = create_task(AddIndexTask::TASK_CONFIG.task_id());
+
+  ASSERT_THAT(
+    [&] {
+      task.add_input(input.partition_by_tiling({TILE_SIZE}),
+                     legate::SymbolicPoint{legate::dimension(0)});
+    },
+    ::testing::ThrowsMessage<std::invalid_argument>(
+      ::testing::HasSubstr("Projections are not supported by index launches executed inline")));
+}
+
+TEST_F(InlineIndexLaunch, RejectConcurrent)
+{
+  const auto _      = cpu_scope();
+  const auto input  = make_store(FILL_VALUE);
+  const auto output = make_store(NO_VALUE);
+  auto task         = create_task(AddIndexTask::TASK_CONFIG.task_id());
+
+  // The points of a concurrent launch would have to run at the same time, which inline execution
+  // can't guarantee
+  task.add_input(input);
+  task.add_output(output.partition_by_tiling({TILE_SIZE}));
+  task.set_concurrent(true);
+  ASSERT_THAT([&] { submit_and_flush(std::move(task)); },
+              ::testing::ThrowsMessage<std::invalid_argument>(::testing::HasSubstr(
+                "Concurrent tasks and tasks with communicators are not supported")));
+}
+
+TEST_F(InlineIndexLaunch, RejectFutureBackedStore)
+{
+  auto* const runtime = legate::Runtime::get_runtime();
+  const auto _        = cpu_scope();
+  const auto input    = make_store(FILL_VALUE);
+  const auto output =
+    runtime->create_store(legate::Shape{1}, legate::int64(), /* optimize_scalar */ true);
+  auto task = create_task(AddIndexTask::TASK_CONFIG.task_id());
+
+  task.add_input(input);
+  task.add_output(output);
+  ASSERT_THAT([&] { submit_and_flush(std::move(task)); },
+              ::testing::ThrowsMessage<std::invalid_argument>(::testing::HasSubstr(
+                "Stores backed by futures are not supported by index launches executed inline")));
+}
+
+}  // namespace test_inline_launch_index_launch
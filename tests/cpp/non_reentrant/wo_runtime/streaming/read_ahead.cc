@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate.h>
+
+#include <legate/experimental/io/kvikio/interface.h>
+#include <legate/mapping/detail/base_mapper.h>
+#include <legate/runtime/detail/runtime.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <utilities/env.h>
+#include <utilities/utilities.h>
+#include <vector>
+
+namespace test_streaming_read_ahead {
+
+namespace {
+
+constexpr std::size_t NUM_ELEMS         = 1 << 15;
+constexpr std::uint32_t OVERDECOMPOSE   = 4;
+constexpr std::uint64_t BUDGET_MIB      = 1;
+constexpr std::uint64_t BUDGET_BYTES    = BUDGET_MIB << 20;
+constexpr std::string_view LIBRARY_NAME = "test_streaming_read_ahead";
+
+class AddTask : public legate::LegateTask<AddTask> {
+ public:
+  static inline const auto TASK_CONFIG =  // NOLINT(cert-err58-cpp)
+    legate::TaskConfig{legate::LocalTaskID{0}}.with_signature(
+      legate::TaskSignature{}.inputs(2).outputs(1));
+
+  static void cpu_variant(legate::TaskContext context)
+  {
+    const auto lhs     = context.input(0).data();
+    const auto rhs     = context.input(1).data();
+    const auto out     = context.output(0).data();
+    const auto shape   = out.shape<1>();
+    const auto lhs_acc = lhs.read_accessor<std::int64_t, 1>();
+    const auto rhs_acc = rhs.read_accessor<std::int64_t, 1>();
+    const auto out_acc = out.write_accessor<std::int64_t, 1>();
+
+    for (legate::PointInRectIterator<1> it{shape}; it.valid(); ++it) {
+      out_acc[*it] = lhs_acc[*it] + rhs_acc[*it];
+    }
+  }
+};
+
+class Result {
+ public:
+  std::vector<std::int64_t> values{};
+  legate::mapping::detail::BaseMapper::ReadAheadStatistics statistics{};
+};
+
+class StreamingReadAhead : public DefaultFixture {
+ protected:
+  void SetUp() override
+  {
+    DefaultFixture::SetUp();
+    // Unique file names, so the tests can run concurrently
+    const auto prefix = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+
+    lhs_path_ = std::filesystem::temp_directory_path() / (std::string{prefix} + "_lhs.bin");
+    rhs_path_ = std::filesystem::temp_directory_path() / (std::string{prefix} + "_rhs.bin");
+    write_file_(lhs_path_, 0);
+    write_file_(rhs_path_, 1'000'000);
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove(lhs_path_);
+    std::filesystem::remove(rhs_path_);
+    DefaultFixture::TearDown();
+  }
+
+  /**
+   * @brief Read both files and add them in a streaming scope, on a runtime started with the
+   * given read-ahead budget.
+   */
+  [[nodiscard]] Result run(std::uint64_t budget_mib) const
+  {
+    const auto config = "--streaming-read-ahead " + std::to_string(budget_mib);
+    const legate::test::Environment::TemporaryEnvVar legate_config{
+      "LEGATE_CONFIG", config.c_str(), /* overwrite */ true};
+
+    legate::start();
+
+    auto* const runtime = legate::Runtime::get_runtime();
+    const auto library  = runtime->create_library(LIBRARY_NAME);
+
+    AddTask::register_variants(library);
+
+    auto out = runtime->create_store(legate::Shape{NUM_ELEMS}, legate::int64());
+
+    {
+      const auto _ = legate::Scope{legate::ParallelPolicy{}
+                                     .with_streaming(legate::StreamingMode::RELAXED)
+                                     .with_overdecompose_factor(OVERDECOMPOSE)};
+
+      const auto lhs = legate::experimental::io::kvikio::from_file(lhs_path_, legate::int64());
+      const auto rhs = legate::experimental::io::kvikio::from_file(rhs_path_, legate::int64());
+      auto task      = runtime->create_task(library, AddTask::TASK_CONFIG.task_id());
+
+      task.add_input(lhs);
+      task.add_input(rhs);
+      task.add_output(out);
+      task.add_constraint(legate::align(task.input(0), task.output(0)));
+      task.add_constraint(legate::align(task.input(1), task.output(0)));
+      runtime->submit(std::move(task));
+    }
+
+    Result result{};
+
+    {
+      const auto p_out = out.get_physical_store();
+      const auto acc   = p_out.read_accessor<std::int64_t, 1>();
+
+      result.values.reserve(NUM_ELEMS);
+      for (std::size_t idx = 0; idx < NUM_ELEMS; ++idx) {
+        result.values.push_back(acc[static_cast<legate::coord_t>(idx)]);
+      }
+    }
+    runtime->issue_execution_fence(/* block */ true);
+    result.statistics =
+      legate::detail::Runtime::get_runtime().base_mapper().read_ahead_statistics();
+    EXPECT_EQ(legate::finish(), 0);
+    return result;
+  }
+
+ private:
+  static void write_file_(const std::filesystem::path& path, std::int64_t offset)
+  {
+    std::vector<std::int64_t> data(NUM_ELEMS);
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+
+    std::iota(data.begin(), data.end(), offset);
+    file.write(reinterpret_cast<const char*>(data.data()),
+               static_cast<std::streamsize>(data.size() * sizeof(std::int64_t)));
+    ASSERT_TRUE(file.good());
+  }
+
+  std::filesystem::path lhs_path_{};
+  std::filesystem::path rhs_path_{};
+};
+
+}  // namespace
+
+TEST_F(StreamingReadAhead, MatchesWithoutReadAhead)
+{
+  const auto expected = run(/* budget_mib */ 0);
+
+  // Nothing may be read ahead without a budget
+  ASSERT_EQ(expected.statistics.num_tasks, 0);
+  ASSERT_EQ(expected.statistics.max_bytes, 0);
+  ASSERT_EQ(expected.values.size(), NUM_ELEMS);
+  for (std::size_t idx = 0; idx < NUM_ELEMS; ++idx) {
+    ASSERT_EQ(expected.values[idx], static_cast<std::int64_t>((2 * idx) + 1'000'000));
+  }
+
+  const auto actual = run(BUDGET_MIB);
+
+  // Whether any read is mapped ahead depends on when the tasks become ready, but the reads
+  // mapped ahead must never exceed the budget of their processor
+  ASSERT_LE(actual.statistics.max_bytes, BUDGET_BYTES);
+  ASSERT_EQ(actual.values, expected.values);
+}
+
+}  // namespace test_streaming_read_ahead
@@ -0,0 +1,210 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate.h>
+
+#include <legate/io/hdf5/detail/handle_cache.h>
+#include <legate/io/hdf5/detail/hdf5_wrapper.h>
+
+#include <H5Dpublic.h>
+#include <H5Fpublic.h>
+#include <H5Spublic.h>
+#include <H5Tpublic.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace test_io_hdf5_handle_cache {
+
+namespace {
+
+using legate::io::hdf5::detail::wrapper::HDF5File;
+using legate::io::hdf5::detail::wrapper::HDF5HandleCache;
+
+constexpr auto DATASET = "/data";
+
+void create_file(const std::filesystem::path& file_path, hsize_t size = 8)
+{
+  const auto dims = std::array<hsize_t, 1>{size};
+  const auto file = H5Fcreate(file_path.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+
+  ASSERT_GE(file, 0);
+
+  const auto space = H5Screate_simple(dims.size(), dims.data(), nullptr);
+
+  ASSERT_GE(space, 0);
+
+  const auto dset =
+    H5Dcreate(file, DATASET, H5T_IEEE_F32LE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+  ASSERT_GE(dset, 0);
+  ASSERT_GE(H5Sclose(space), 0);
+  ASSERT_GE(H5Dclose(dset), 0);
+  ASSERT_GE(H5Fclose(file), 0);
+}
+
+/**
+ * @brief Look a dataset up, with the identity the file has now, as a read task would.
+ */
+[[nodiscard]] legate::io::hdf5::detail::wrapper::HDF5DataSet data_set(
+  HDF5HandleCache& cache, const std::filesystem::path& file_path, const char* dataset_name)
+{
+  const auto identity = HDF5HandleCache::identify(file_path.native());
+
+  return cache.data_set(file_path.native(), dataset_name, /* gds_on */ false, identity);
+}
+
+class IOHDF5HandleCacheUnit : public ::testing::Test {
+ protected:
+  void SetUp() override
+  {
+    Test::SetUp();
+    ASSERT_NO_THROW(std::filesystem::create_directories(base_path));
+    HDF5HandleCache::get().clear();
+  }
+
+  void TearDown() override
+  {
+    HDF5HandleCache::get().clear();
+    Test::TearDown();
+    ASSERT_NO_THROW(static_cast<void>(std::filesystem::remove_all(base_path)));
+  }
+
+  // NOLINTNEXTLINE(cert-err58-cpp, bugprone-throwing-static-initialization)
+  static inline auto base_path = std::filesystem::temp_directory_path() / "legate_handle_cache";
+};
+
+}  // namespace
+
+TEST_F(IOHDF5HandleCacheUnit, Reuse)
+{
+  const auto file_path = base_path / "reuse.h5";
+
+  create_file(file_path);
+
+  auto cache         = HDF5HandleCache{};
+  const auto first   = data_set(cache, file_path, DATASET);
+  // A different spelling of the same path
+  const auto aliased = (base_path / "." / "reuse.h5").native();
+  const auto second  = data_set(cache, aliased, DATASET);
+
+  ASSERT_EQ(first.hid(), second.hid());
+  ASSERT_EQ(cache.size(), 1);
+}
+
+TEST_F(IOHDF5HandleCacheUnit, Evict)
+{
+  const auto path_a = base_path / "a.h5";
+  const auto path_b = base_path / "b.h5";
+
+  create_file(path_a);
+  create_file(path_b);
+
+  auto cache    = HDF5HandleCache{/* capacity */ 1};
+  const auto a1 = data_set(cache, path_a, DATASET);
+  const auto b  = data_set(cache, path_b, DATASET);
+
+  ASSERT_EQ(cache.size(), 1);
+
+  // The handle of the evicted file is still usable, but is no longer handed out
+  const auto a2 = data_set(cache, path_a, DATASET);
+
+  ASSERT_EQ(a1.data_space().extents(), a2.data_space().extents());
+  ASSERT_NE(a1.hid(), a2.hid());
+  ASSERT_EQ(cache.size(), 1);
+}
+
+TEST_F(IOHDF5HandleCacheUnit, Invalidate)
+{
+  const auto file_path = base_path / "invalidate.h5";
+
+  create_file(file_path);
+
+  auto cache = HDF5HandleCache{};
+
+  static_cast<void>(data_set(cache, file_path, DATASET));
+  ASSERT_EQ(cache.size(), 1);
+  cache.invalidate((base_path / "other.h5").native());
+  ASSERT_EQ(cache.size(), 1);
+  cache.invalidate(file_path.native());
+  ASSERT_EQ(cache.size(), 0);
+}
+
+TEST_F(IOHDF5HandleCacheUnit, Replaced)
+{
+  const auto file_path = base_path / "replaced.h5";
+  const auto tmp_path  = base_path / "replaced.h5.tmp";
+
+  create_file(file_path);
+
+  auto cache        = HDF5HandleCache{};
+  const auto before = data_set(cache, file_path, DATASET);
+
+  // Replace the file behind the back of the cache, as another process would
+  create_file(tmp_path, /* size */ 16);
+  std::filesystem::rename(tmp_path, file_path);
+
+  const auto after = data_set(cache, file_path, DATASET);
+
+  ASSERT_NE(before.hid(), after.hid());
+  ASSERT_EQ(before.data_space().extents().front(), hsize_t{8});
+  ASSERT_EQ(after.data_space().extents().front(), hsize_t{16});
+  ASSERT_EQ(cache.size(), 1);
+}
+
+TEST_F(IOHDF5HandleCacheUnit, Removed)
+{
+  const auto file_path = base_path / "removed.h5";
+
+  create_file(file_path);
+
+  auto cache = HDF5HandleCache{};
+
+  static_cast<void>(data_set(cache, file_path, DATASET));
+  ASSERT_TRUE(std::filesystem::remove(file_path));
+  // The read of a file that no longer exists fails at launch, before the cached handle is used
+  ASSERT_THROW(static_cast<void>(HDF5HandleCache::identify(file_path.native())),
+               std::system_error);
+}
+
+TEST_F(IOHDF5HandleCacheUnit, Overwrite)
+{
+  const auto file_path  = base_path / "overwrite.h5";
+  const auto other_path = base_path / "other.h5";
+  auto&& cache          = HDF5HandleCache::get();
+
+  create_file(file_path);
+  create_file(other_path);
+  static_cast<void>(data_set(cache, file_path, DATASET));
+  static_cast<void>(data_set(cache, other_path, DATASET));
+  ASSERT_EQ(cache.size(), 2);
+
+  // HDF5 refuses to truncate a file that is still open, so this only succeeds if the file was
+  // dropped from the cache. Other files may hold it open as the source of a virtual dataset,
+  // so they are dropped as well.
+  ASSERT_NO_THROW(static_cast<void>(HDF5File{file_path.native(), HDF5File::OpenMode::OVERWRITE}));
+  ASSERT_EQ(cache.size(), 0);
+}
+
+TEST_F(IOHDF5HandleCacheUnit, MissingDataSet)
+{
+  const auto file_path = base_path / "missing.h5";
+
+  create_file(file_path);
+
+  auto cache = HDF5HandleCache{};
+
+  ASSERT_THROW(static_cast<void>(data_set(cache, file_path, "/missing")), std::runtime_error);
+  // Nothing is cached unless the dataset could be opened
+  ASSERT_EQ(cache.size(), 0);
+}
+
+}  // namespace test_io_hdf5_handle_cache
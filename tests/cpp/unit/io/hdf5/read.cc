@@ -25,12 +25,18 @@
 #include <string>
 #include <string_view>
 #include <utilities/utilities.h>
+#include <utility>
 #include <vector>
 
 namespace test_io_hdf5_read {
 
 namespace {
 
+/**
+ * @brief The filters applied to the chunks of a dataset.
+ */
+enum class Filters : std::uint8_t { NONE, DEFLATE, SHUFFLE_DEFLATE };
+
 /**
  * @brief Helper function to create HDF5 file with sequential float data
  *
@@ -39,12 +45,14 @@ namespace {
  * @param dims The dimensions of the dataset.
  * @param chunk_dims Optional chunk dimensions. If provided, creates a chunked dataset;
  *                   otherwise creates a contiguous dataset.
+ * @param filters The filters applied to the chunks, only for chunked datasets.
  */
 template <std::size_t NDIM>
 void create_hdf5_file_with_sequential_data(const std::filesystem::path& file_path,
                                            const std::string& dataset_name,
                                            const std::array<hsize_t, NDIM>& dims,
-                                           const std::array<hsize_t, NDIM>* chunk_dims = nullptr)
+                                           const std::array<hsize_t, NDIM>* chunk_dims = nullptr,
+                                           Filters filters = Filters::NONE)
 {
   const auto file = H5Fcreate(file_path.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
 
@@ -62,6 +70,14 @@ void create_hdf5_file_with_sequential_data(const std::filesystem::path& file_pat
 
     ASSERT_GE(dcpl, 0);
     ASSERT_GE(H5Pset_chunk(dcpl, NDIM, chunk_dims->data()), 0);
+
+    constexpr auto DEFLATE_LEVEL = 6;
+
+    switch (filters) {
+      case Filters::NONE: break;
+      case Filters::SHUFFLE_DEFLATE: ASSERT_GE(H5Pset_shuffle(dcpl), 0); [[fallthrough]];
+      case Filters::DEFLATE: ASSERT_GE(H5Pset_deflate(dcpl, DEFLATE_LEVEL), 0); break;
+    }
   }
 
   const auto dset =
@@ -578,6 +594,35 @@ void submit_verify_3d_task(const legate::LogicalStore& read_store, std::uint32_t
   runtime->submit(std::move(verify_task));
 }
 
+/**
+ * @brief Check that a store holds the given hyperslab of a 2D dataset created by
+ * `create_hdf5_file_with_sequential_data()`.
+ */
+void check_hyperslab_2d(const legate::LogicalStore& store,
+                        const legate::io::hdf5::Hyperslab& selection,
+                        std::uint64_t y)
+{
+  const auto& start  = selection.start();
+  const auto& count  = selection.count();
+  const auto& stride = selection.stride();
+
+  ASSERT_EQ(store.shape(), (legate::Shape{count}));
+
+  const auto p_store = store.get_physical_store();
+  const auto acc     = p_store.read_accessor<float, 2>();
+
+  for (std::uint64_t i = 0; i < count[0]; ++i) {
+    for (std::uint64_t j = 0; j < count[1]; ++j) {
+      const auto row = start[0] + (i * stride[0]);
+      const auto col = start[1] + (j * stride[1]);
+      const auto idx = legate::Point<2>{static_cast<legate::coord_t>(i),
+                                        static_cast<legate::coord_t>(j)};
+
+      ASSERT_EQ(acc[idx], static_cast<float>((row * y) + col));
+    }
+  }
+}
+
 }  // namespace
 
 TEST_F(IOHDF5ReadUnit, Binary)
@@ -936,4 +981,175 @@ TEST_F(IOHDF5ReadUnit, NullDataspace)
   ASSERT_EQ(read_store.type(), legate::float32());
 }
 
+TEST_F(IOHDF5ReadUnit, ChunkedPartiallyWritten)
+{
+  constexpr auto SIZE       = 100;
+  constexpr auto CHUNK_SIZE = 10;
+  constexpr auto FILL_VALUE = -1.0F;
+  constexpr auto DATASET    = "/partial";
+  const auto file_path      = base_path / "partial.h5";
+
+  {
+    // Only the chunks of the first half of the dataset are written, the others are read as the
+    // fill value
+    constexpr auto dims       = std::array<hsize_t, 1>{SIZE};
+    constexpr auto chunk_dims = std::array<hsize_t, 1>{CHUNK_SIZE};
+    constexpr auto start      = std::array<hsize_t, 1>{0};
+    constexpr auto count      = std::array<hsize_t, 1>{SIZE / 2};
+
+    const auto file = H5Fcreate(file_path.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+
+    ASSERT_GE(file, 0);
+
+    const auto space = H5Screate_simple(dims.size(), dims.data(), nullptr);
+    const auto dcpl  = H5Pcreate(H5P_DATASET_CREATE);
+
+    ASSERT_GE(space, 0);
+    ASSERT_GE(dcpl, 0);
+    ASSERT_GE(H5Pset_chunk(dcpl, chunk_dims.size(), chunk_dims.data()), 0);
+    ASSERT_GE(H5Pset_fill_value(dcpl, H5T_NATIVE_FLOAT, &FILL_VALUE), 0);
+
+    const auto dset =
+      H5Dcreate(file, DATASET, H5T_IEEE_F32LE, space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+
+    ASSERT_GE(dset, 0);
+
+    auto data            = std::vector<float>(SIZE / 2);
+    const auto mem_space = H5Screate_simple(count.size(), count.data(), nullptr);
+
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      data[i] = static_cast<float>(i);
+    }
+    ASSERT_GE(mem_space, 0);
+    ASSERT_GE(
+      H5Sselect_hyperslab(space, H5S_SELECT_SET, start.data(), nullptr, count.data(), nullptr),
+      0);
+    ASSERT_GE(H5Dwrite(dset, H5T_NATIVE_FLOAT, mem_space, space, H5P_DEFAULT, data.data()), 0);
+    ASSERT_GE(H5Sclose(mem_space), 0);
+    ASSERT_GE(H5Sclose(space), 0);
+    ASSERT_GE(H5Pclose(dcpl), 0);
+    ASSERT_GE(H5Dclose(dset), 0);
+    ASSERT_GE(H5Fclose(file), 0);
+  }
+
+  const auto read_store = legate::io::hdf5::from_file(file_path, DATASET);
+  const auto p_store    = read_store.get_physical_store();
+  const auto acc        = p_store.read_accessor<float, 1>();
+
+  for (std::int64_t i = 0; i < SIZE; ++i) {
+    ASSERT_EQ(acc[i], i < SIZE / 2 ? static_cast<float>(i) : FILL_VALUE);
+  }
+}
+
+TEST_F(IOHDF5ReadUnit, Hyperslab)
+{
+  constexpr auto X       = 100;
+  constexpr auto Y       = 50;
+  constexpr auto DATASET = "/hyperslab";
+  const auto file_path   = base_path / "hyperslab.h5";
+  constexpr auto dims    = std::array<hsize_t, 2>{X, Y};
+
+  create_hdf5_file_with_sequential_data(file_path, DATASET, dims);
+
+  const auto selection  = legate::io::hdf5::Hyperslab{{10, 5}, {80, 40}};
+  const auto read_store = legate::io::hdf5::from_file(file_path, DATASET, selection);
+
+  ASSERT_EQ(read_store.type(), legate::float32());
+  check_hyperslab_2d(read_store, selection, Y);
+}
+
+TEST_F(IOHDF5ReadUnit, HyperslabStrided)
+{
+  constexpr auto X       = 100;
+  constexpr auto Y       = 50;
+  constexpr auto DATASET = "/hyperslab";
+  const auto file_path   = base_path / "hyperslab.h5";
+  constexpr auto dims    = std::array<hsize_t, 2>{X, Y};
+
+  create_hdf5_file_with_sequential_data(file_path, DATASET, dims);
+
+  // The last selected element of each dimension is the last element of the dataset
+  const auto selection  = legate::io::hdf5::Hyperslab{{1, 0}, {33, 8}, {3, 7}};
+  const auto read_store = legate::io::hdf5::from_file(file_path, DATASET, selection);
+
+  check_hyperslab_2d(read_store, selection, Y);
+}
+
+TEST_F(IOHDF5ReadUnit, HyperslabChunked)
+{
+  constexpr auto X          = 100;
+  constexpr auto Y          = 50;
+  constexpr auto DATASET    = "/hyperslab";
+  const auto file_path      = base_path / "hyperslab.h5";
+  constexpr auto dims       = std::array<hsize_t, 2>{X, Y};
+  constexpr auto chunk_dims = std::array<hsize_t, 2>{10, 25};
+
+  create_hdf5_file_with_sequential_data(file_path, DATASET, dims, &chunk_dims);
+
+  for (auto&& selection : {legate::io::hdf5::Hyperslab{{5, 3}, {90, 40}},
+                           legate::io::hdf5::Hyperslab{{2, 1}, {49, 12}, {2, 4}}}) {
+    const auto read_store = legate::io::hdf5::from_file(file_path, DATASET, selection);
+
+    check_hyperslab_2d(read_store, selection, Y);
+  }
+}
+
+TEST_F(IOHDF5ReadUnit, ChunkedDeflate)
+{
+  constexpr auto X          = 100;
+  constexpr auto Y          = 50;
+  constexpr auto DATASET    = "/deflate";
+  constexpr auto dims       = std::array<hsize_t, 2>{X, Y};
+  // Not a divisor of the extents, so that the edge chunks are partial
+  constexpr auto chunk_dims = std::array<hsize_t, 2>{30, 20};
+
+  // The chunks are decompressed with zlib instead of through HDF5
+  for (auto&& [filters, file_name] : {std::pair{Filters::DEFLATE, "deflate.h5"},
+                                      std::pair{Filters::SHUFFLE_DEFLATE, "shuffle_deflate.h5"}}) {
+    const auto file_path = base_path / file_name;
+
+    create_hdf5_file_with_sequential_data(file_path, DATASET, dims, &chunk_dims, filters);
+
+    const auto read_store = legate::io::hdf5::from_file(file_path, DATASET);
+
+    ASSERT_EQ(read_store.shape(), (legate::Shape{X, Y}));
+    ASSERT_EQ(read_store.type(), legate::float32());
+    submit_verify_2d_task(read_store, Y);
+
+    const auto selection = legate::io::hdf5::Hyperslab{{2, 1}, {49, 12}, {2, 4}};
+
+    check_hyperslab_2d(legate::io::hdf5::from_file(file_path, DATASET, selection), selection, Y);
+  }
+}
+
+TEST_F(IOHDF5ReadUnit, InvalidHyperslab)
+{
+  constexpr auto DATASET = "/hyperslab";
+  const auto file_path   = base_path / "hyperslab.h5";
+  constexpr auto dims    = std::array<hsize_t, 2>{10, 10};
+
+  create_hdf5_file_with_sequential_data(file_path, DATASET, dims);
+
+  // Mismatched sizes and zero strides are rejected on construction
+  ASSERT_THROW(static_cast<void>(legate::io::hdf5::Hyperslab({0, 0}, {1})),
+               std::invalid_argument);
+  ASSERT_THROW(static_cast<void>(legate::io::hdf5::Hyperslab({0, 0}, {1, 1}, {1})),
+               std::invalid_argument);
+  ASSERT_THROW(static_cast<void>(legate::io::hdf5::Hyperslab({0, 0}, {1, 1}, {1, 0})),
+               std::invalid_argument);
+
+  // Wrong number of dimensions
+  ASSERT_THROW(static_cast<void>(legate::io::hdf5::from_file(
+                 file_path, DATASET, legate::io::hdf5::Hyperslab{{0}, {1}})),
+               std::invalid_argument);
+  // Start out of bounds
+  ASSERT_THROW(static_cast<void>(legate::io::hdf5::from_file(
+                 file_path, DATASET, legate::io::hdf5::Hyperslab{{10, 0}, {1, 1}})),
+               std::invalid_argument);
+  // Last selected element out of bounds
+  ASSERT_THROW(static_cast<void>(legate::io::hdf5::from_file(
+                 file_path, DATASET, legate::io::hdf5::Hyperslab{{1, 0}, {6, 1}, {2, 1}})),
+               std::invalid_argument);
+}
+
 }  // namespace test_io_hdf5_read
@@ -12,11 +12,15 @@
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
+#include <H5Dpublic.h>
+#include <H5Fpublic.h>
+#include <H5Ppublic.h>
 #include <H5public.h>
 
 #include <gtest/gtest.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <limits>
@@ -24,6 +28,7 @@
 #include <string>
 #include <string_view>
 #include <utilities/utilities.h>
+#include <vector>
 
 namespace test_io_hdf5_write {
 
@@ -388,4 +393,142 @@ TEST_F(IOHDF5WriteUnit, IgnoresStaleSubFiles)
   }
 }
 
+TEST_F(IOHDF5WriteUnit, OverwriteAfterRead)
+{
+  auto* const runtime = legate::Runtime::get_runtime();
+  const auto lib      = runtime->find_library(Config::LIBRARY_NAME);
+  const auto shape    = legate::Shape{5, 5};
+  const auto store    = runtime->create_store(shape, legate::int32());
+
+  {
+    auto task = runtime->create_task(lib, IotaTask::TASK_CONFIG.task_id());
+
+    task.add_scalar_arg(legate::Scalar{shape.extents() - 1});
+    task.add_output(store);
+    runtime->submit(std::move(task));
+  }
+
+  const auto h5_file = base_path / "overwrite_after_read.h5";
+
+  legate::io::hdf5::to_file(store, h5_file, "first");
+  runtime->issue_execution_fence(/* block */ true);
+
+  // No fence between the read and the overwrite: the read tasks only run once the overwrite is
+  // launched, so they cache the file after to_file() invalidated it at launch. The overwrite
+  // also truncates the source files of the virtual dataset they read.
+  const auto first = legate::io::hdf5::from_file(h5_file, "first");
+
+  legate::io::hdf5::to_file(first, h5_file, "second");
+  // Only so that the file is on disk when from_file() inspects it at launch
+  runtime->issue_execution_fence(/* block */ true);
+
+  // The dataset only exists in the new file, so this fails if a stale handle is handed out
+  const auto second = legate::io::hdf5::from_file(h5_file, "second");
+
+  ASSERT_EQ(second.shape(), store.shape());
+
+  {
+    auto task = runtime->create_task(lib, CheckerTask::TASK_CONFIG.task_id());
+
+    task.add_input(store);
+    task.add_input(second);
+    runtime->submit(std::move(task));
+  }
+}
+
+TEST_F(IOHDF5WriteUnit, Compressed)
+{
+  auto* const runtime = legate::Runtime::get_runtime();
+  const auto lib      = runtime->find_library(Config::LIBRARY_NAME);
+  const auto shape    = legate::Shape{10, 10, 10};
+  const auto store    = runtime->create_store(shape, legate::int64());
+
+  {
+    auto task = runtime->create_task(lib, IotaTask::TASK_CONFIG.task_id());
+
+    task.add_scalar_arg(legate::Scalar{shape.extents() - 1});
+    task.add_output(store);
+    runtime->submit(std::move(task));
+  }
+
+  const auto h5_file     = base_path / "compressed.h5";
+  constexpr auto dataset = "my_dataset";
+  const auto options     = legate::io::hdf5::WriteOptions{}
+                         .with_chunk_shape({2, 3, 4})
+                         .with_compression(legate::io::hdf5::Compression::DEFLATE)
+                         .with_shuffle(true);
+
+  legate::io::hdf5::to_file(store, h5_file, dataset, options);
+  runtime->issue_execution_fence(/* block */ true);
+
+  // Every tile must have been written as a chunked dataset with the shuffle and deflate filters
+  auto vds_dir = h5_file;
+
+  vds_dir.replace_filename(h5_file.stem().native() + "_legate_vds");
+  for (auto&& entry : std::filesystem::directory_iterator{vds_dir}) {
+    if (entry.path().extension() != ".h5") {
+      continue;
+    }
+
+    const auto file = H5Fopen(entry.path().c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+
+    ASSERT_GE(file, 0);
+
+    const auto dset = H5Dopen2(file, dataset, H5P_DEFAULT);
+
+    ASSERT_GE(dset, 0);
+
+    const auto dcpl = H5Dget_create_plist(dset);
+
+    ASSERT_GE(dcpl, 0);
+    ASSERT_EQ(H5Pget_layout(dcpl), H5D_CHUNKED);
+    ASSERT_EQ(H5Pget_nfilters(dcpl), 2);
+    ASSERT_GE(H5Pclose(dcpl), 0);
+    ASSERT_GE(H5Dclose(dset), 0);
+    ASSERT_GE(H5Fclose(file), 0);
+  }
+
+  const auto store_copy = legate::io::hdf5::from_file(h5_file, dataset);
+
+  ASSERT_EQ(store_copy.shape(), store.shape());
+  ASSERT_EQ(store_copy.type(), store.type());
+
+  {
+    auto task = runtime->create_task(lib, CheckerTask::TASK_CONFIG.task_id());
+
+    task.add_input(store);
+    task.add_input(store_copy);
+    runtime->submit(std::move(task));
+  }
+}
+
+TEST_F(IOHDF5WriteUnit, InvalidWriteOptions)
+{
+  auto* const runtime = legate::Runtime::get_runtime();
+  const auto store    = runtime->create_store(legate::Shape{4, 4}, legate::int32());
+  const auto h5_file  = base_path / "invalid.h5";
+
+  runtime->issue_fill(store, legate::Scalar{std::int32_t{0}});
+
+  const auto write = [&](const legate::io::hdf5::WriteOptions& options) {
+    legate::io::hdf5::to_file(store, h5_file, "my_dataset", options);
+  };
+
+  // Wrong number of dimensions
+  ASSERT_THROW(write(legate::io::hdf5::WriteOptions{}.with_chunk_shape({2})),
+               std::invalid_argument);
+  // Empty chunks
+  ASSERT_THROW(write(legate::io::hdf5::WriteOptions{}.with_chunk_shape({2, 0})),
+               std::invalid_argument);
+  // Chunks of 4 GiB or more
+  ASSERT_THROW(write(legate::io::hdf5::WriteOptions{}.with_chunk_shape({1 << 16, 1 << 14})),
+               std::invalid_argument);
+  ASSERT_THROW(write(legate::io::hdf5::WriteOptions{}
+                       .with_compression(legate::io::hdf5::Compression::DEFLATE)
+                       .with_compression_level(10)),
+               std::invalid_argument);
+  ASSERT_THROW(write(legate::io::hdf5::WriteOptions{}.with_compression_level(1)),
+               std::invalid_argument);
+}
+
 }  // namespace test_io_hdf5_write
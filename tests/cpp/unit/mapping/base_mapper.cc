@@ -155,6 +155,15 @@ TEST_F(BaseMapperTest, ProcessorAccessorsMatchLocalMachine)
   ASSERT_EQ(mapper.total_nodes(), local_machine.total_nodes);
 }
 
+TEST_F(BaseMapperTest, NoTaskStatisticsWithoutProfiling)
+{
+  const legate::mapping::detail::BaseMapper mapper;
+
+  ASSERT_FALSE(
+    mapper.task_statistics(legate::GlobalTaskID{0}, legate::VariantCode::CPU, mapper.cpus().front())
+      .has_value());
+}
+
 TEST_F(BaseMapperTest, MappableShardingIdAccessor)
 {
   legate::detail::BufferBuilder buffer;
@@ -163,6 +172,7 @@ TEST_F(BaseMapperTest, MappableShardingIdAccessor)
   constexpr std::uint32_t expected_key_projection_id = 0;
   constexpr std::uint32_t expected_sharding_id       = 123;
   constexpr std::int32_t priority                    = 7;
+  constexpr bool stealable                           = false;
 
   // Keep this prefix in sync with Mappable::Mappable(private_tag, MapperDataDeserializer).
   buffer.pack(streaming_generation);
@@ -170,6 +180,7 @@ TEST_F(BaseMapperTest, MappableShardingIdAccessor)
   buffer.pack(expected_key_projection_id);
   buffer.pack(expected_sharding_id);
   buffer.pack(priority);
+  buffer.pack(stealable);
 
   const auto legion_buffer = buffer.to_legion_buffer();
   TestMappable legion_mappable;
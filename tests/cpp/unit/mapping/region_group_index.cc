@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/mapping/detail/region_group_index.h>
+
+#include <legate/mapping/detail/instance_manager.h>
+
+#include <legate.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <utilities/utilities.h>
+#include <vector>
+
+namespace region_group_index_unit {
+
+namespace {
+
+using RegionGroupIndexTest = DefaultFixture;
+using RegionGroup          = legate::mapping::detail::RegionGroup;
+using RegionGroupIndex     = legate::mapping::detail::RegionGroupIndex;
+
+[[nodiscard]] RegionGroup make_group(const legate::Rect<2>& bbox)
+{
+  return RegionGroup{{}, legate::Domain{bbox}};
+}
+
+[[nodiscard]] std::vector<RegionGroup*> find_overlapping(const RegionGroupIndex& index,
+                                                         const legate::Rect<2>& bbox)
+{
+  std::vector<RegionGroup*> result{};
+
+  index.find_overlapping(legate::Domain{bbox}, &result);
+  return result;
+}
+
+}  // namespace
+
+TEST_F(RegionGroupIndexTest, Empty)
+{
+  const RegionGroupIndex index{};
+
+  ASSERT_TRUE(index.empty());
+  ASSERT_EQ(index.size(), 0);
+  ASSERT_THAT(find_overlapping(index, {{0, 0}, {10, 10}}), ::testing::IsEmpty());
+}
+
+TEST_F(RegionGroupIndexTest, FindOverlapping)
+{
+  auto left   = make_group({{0, 0}, {9, 9}});
+  auto right  = make_group({{10, 0}, {19, 9}});
+  auto top    = make_group({{0, 10}, {19, 19}});
+  auto middle = make_group({{5, 5}, {14, 14}});
+  RegionGroupIndex index{};
+
+  for (auto* group : {&left, &right, &top, &middle}) {
+    index.insert(group);
+  }
+  ASSERT_EQ(index.size(), 4);
+
+  ASSERT_THAT(find_overlapping(index, {{0, 0}, {4, 4}}), ::testing::ElementsAre(&left));
+  ASSERT_THAT(find_overlapping(index, {{9, 0}, {10, 0}}),
+              ::testing::UnorderedElementsAre(&left, &right));
+  // Overlaps everything along the first dimension, but only the top group along the second
+  ASSERT_THAT(find_overlapping(index, {{0, 15}, {19, 19}}), ::testing::ElementsAre(&top));
+  ASSERT_THAT(find_overlapping(index, {{12, 12}, {12, 12}}),
+              ::testing::UnorderedElementsAre(&top, &middle));
+  ASSERT_THAT(find_overlapping(index, {{20, 0}, {30, 30}}), ::testing::IsEmpty());
+}
+
+TEST_F(RegionGroupIndexTest, Refcounting)
+{
+  auto group = make_group({{0, 0}, {9, 9}});
+  RegionGroupIndex index{};
+
+  // Once for the instance and once for a pending instance creation
+  index.insert(&group);
+  index.insert(&group);
+  ASSERT_EQ(index.size(), 1);
+  ASSERT_THAT(find_overlapping(index, {{0, 0}, {9, 9}}), ::testing::ElementsAre(&group));
+
+  index.erase(&group);
+  ASSERT_THAT(find_overlapping(index, {{0, 0}, {9, 9}}), ::testing::ElementsAre(&group));
+
+  index.erase(&group);
+  ASSERT_TRUE(index.empty());
+  ASSERT_THAT(find_overlapping(index, {{0, 0}, {9, 9}}), ::testing::IsEmpty());
+}
+
+TEST_F(RegionGroupIndexTest, EmptyBoundingBox)
+{
+  auto group = make_group({{1, 1}, {0, 0}});
+  RegionGroupIndex index{};
+
+  index.insert(&group);
+  ASSERT_EQ(index.size(), 1);
+  ASSERT_THAT(find_overlapping(index, {{0, 0}, {9, 9}}), ::testing::IsEmpty());
+  index.erase(&group);
+  ASSERT_TRUE(index.empty());
+}
+
+TEST_F(RegionGroupIndexTest, ManyGroups)
+{
+  constexpr legate::coord_t NUM_TILES = 64;
+  constexpr legate::coord_t TILE_SIZE = 10;
+  std::vector<RegionGroup> groups{};
+
+  groups.reserve(NUM_TILES);
+  for (legate::coord_t i = 0; i < NUM_TILES; ++i) {
+    groups.emplace_back(make_group({{i * TILE_SIZE, 0}, {((i + 1) * TILE_SIZE) - 1, 0}}));
+  }
+
+  RegionGroupIndex index{};
+
+  for (auto&& group : groups) {
+    index.insert(&group);
+  }
+  // Remove every other tile
+  for (std::size_t i = 0; i < groups.size(); i += 2) {
+    index.erase(&groups[i]);
+  }
+  ASSERT_EQ(index.size(), static_cast<std::size_t>(NUM_TILES / 2));
+
+  for (std::size_t i = 0; i < groups.size(); ++i) {
+    const auto& bbox = groups[i].bounding_box;
+    const auto found = find_overlapping(index, bbox.bounds<2, legate::coord_t>());
+
+    if (i % 2 == 0) {
+      ASSERT_THAT(found, ::testing::IsEmpty());
+    } else {
+      ASSERT_THAT(found, ::testing::ElementsAre(&groups[i]));
+    }
+  }
+}
+
+}  // namespace region_group_index_unit
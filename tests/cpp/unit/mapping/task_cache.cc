@@ -0,0 +1,270 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights
+ * reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <legate/mapping/detail/task_cache.h>
+
+#include <legate.h>
+
+#include <legate/mapping/detail/machine.h>
+#include <legate/mapping/detail/operation.h>
+#include <legate/utilities/detail/buffer_builder.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utilities/mock_mapper.h>
+#include <utilities/utilities.h>
+#include <vector>
+
+namespace task_cache_unit {
+
+namespace {
+
+using legate::test::MockMapperRuntime;
+
+class TestTask final : public Legion::Task {
+ public:
+  TestTask(Legion::UniqueID unique_id,
+           const Legion::UntypedBuffer& task_args,
+           const Legion::UntypedBuffer& mapper_args)
+    : unique_id_{unique_id}
+  {
+    args             = task_args.get_ptr();
+    arglen           = task_args.get_size();
+    mapper_data      = mapper_args.get_ptr();
+    mapper_data_size = mapper_args.get_size();
+    index_point      = legate::DomainPoint{legate::Point<1>{0}};
+  }
+
+  [[nodiscard]] Legion::UniqueID get_unique_id() const override { return unique_id_; }
+
+  [[nodiscard]] std::uint64_t get_context_index() const override
+  {
+    ADD_FAILURE() << "TestTask::get_context_index() should not be called";
+    return 0;
+  }
+
+  [[nodiscard]] int get_depth() const override
+  {
+    ADD_FAILURE() << "TestTask::get_depth() should not be called";
+    return 0;
+  }
+
+  [[nodiscard]] bool has_parent_task() const override
+  {
+    ADD_FAILURE() << "TestTask::has_parent_task() should not be called";
+    return false;
+  }
+
+  [[nodiscard]] const Legion::Task* get_parent_task() const override
+  {
+    ADD_FAILURE() << "TestTask::get_parent_task() should not be called";
+    return nullptr;
+  }
+
+  [[nodiscard]] const std::string_view& get_provenance_string(bool) const override
+  {
+    ADD_FAILURE() << "TestTask::get_provenance_string() should not be called";
+    static constexpr std::string_view provenance{};
+    return provenance;
+  }
+
+  [[nodiscard]] const char* get_task_name() const override
+  {
+    ADD_FAILURE() << "TestTask::get_task_name() should not be called";
+    return "";
+  }
+
+  [[nodiscard]] Legion::Domain get_slice_domain() const override
+  {
+    ADD_FAILURE() << "TestTask::get_slice_domain() should not be called";
+    return {};
+  }
+
+  [[nodiscard]] Legion::ShardID get_shard_id() const override
+  {
+    ADD_FAILURE() << "TestTask::get_shard_id() should not be called";
+    return 0;
+  }
+
+  [[nodiscard]] std::size_t get_total_shards() const override
+  {
+    ADD_FAILURE() << "TestTask::get_total_shards() should not be called";
+    return 0;
+  }
+
+  [[nodiscard]] Legion::DomainPoint get_shard_point() const override
+  {
+    ADD_FAILURE() << "TestTask::get_shard_point() should not be called";
+    return {};
+  }
+
+  [[nodiscard]] Legion::Domain get_shard_domain() const override
+  {
+    ADD_FAILURE() << "TestTask::get_shard_domain() should not be called";
+    return {};
+  }
+
+ private:
+  Legion::UniqueID unique_id_{};
+};
+
+class TaskCacheTest : public DefaultFixture {
+ protected:
+  void SetUp() override
+  {
+    DefaultFixture::SetUp();
+
+    // Keep these in sync with Mappable::Mappable(private_tag, MapperDataDeserializer) and
+    // Task::Task(const Legion::Task&, Legion::Mapping::MapperRuntime&,
+    // Legion::Mapping::MapperContext).
+    const std::optional<legate::detail::StreamingGeneration> streaming_generation{};
+    const legate::mapping::detail::Machine machine{};
+    constexpr std::uint32_t key_projection_id = 0;
+    constexpr std::uint32_t sharding_id       = 0;
+    constexpr std::int32_t priority           = 0;
+    constexpr bool stealable                  = false;
+
+    mapper_args_.pack(streaming_generation);
+    machine.pack(mapper_args_);
+    mapper_args_.pack(key_projection_id);
+    mapper_args_.pack(sharding_id);
+    mapper_args_.pack(priority);
+    mapper_args_.pack(stealable);
+
+    constexpr std::uint32_t num_stores  = 0;
+    constexpr std::uint32_t num_scalars = 0;
+    constexpr std::size_t future_size   = 0;
+    constexpr bool can_raise_exception  = false;
+
+    // The mapper view only keeps the library and task info pointers, so they can be null here
+    task_args_.pack(static_cast<legate::detail::Library*>(nullptr));
+    task_args_.pack(static_cast<legate::detail::TaskInfo*>(nullptr));
+    task_args_.pack(num_stores);   // inputs
+    task_args_.pack(num_stores);   // outputs
+    task_args_.pack(num_stores);   // reductions
+    task_args_.pack(num_scalars);  // scalars
+    task_args_.pack(future_size);
+    task_args_.pack(can_raise_exception);
+  }
+
+  [[nodiscard]] TestTask make_task(Legion::UniqueID unique_id) const
+  {
+    return TestTask{unique_id, task_args_.to_legion_buffer(), mapper_args_.to_legion_buffer()};
+  }
+
+  MockMapperRuntime runtime_{};
+  Legion::Mapping::MapperContext context_{};
+
+ private:
+  legate::detail::BufferBuilder task_args_{};
+  legate::detail::BufferBuilder mapper_args_{};
+};
+
+}  // namespace
+
+TEST_F(TaskCacheTest, FindOrCreateThenTake)
+{
+  legate::mapping::detail::TaskCache cache;
+  const auto task = make_task(1);
+
+  const auto created = cache.find_or_create(task, runtime_, context_);
+
+  ASSERT_EQ(cache.size(), 1);
+  ASSERT_EQ(&created->legion_task(), &task);
+
+  const auto found = cache.find_or_create(task, runtime_, context_);
+
+  ASSERT_EQ(found, created);
+  ASSERT_EQ(cache.size(), 1);
+
+  const auto taken = cache.take(task, runtime_, context_);
+
+  ASSERT_EQ(taken, created);
+}
+
+TEST_F(TaskCacheTest, TakeRemovesEntry)
+{
+  legate::mapping::detail::TaskCache cache;
+  const auto task = make_task(1);
+
+  const auto created = cache.find_or_create(task, runtime_, context_);
+
+  ASSERT_EQ(cache.size(), 1);
+
+  const auto taken = cache.take(task, runtime_, context_);
+
+  ASSERT_EQ(taken, created);
+  ASSERT_EQ(cache.size(), 0);
+
+  // Taking it again decodes a fresh view instead of handing out the one already taken
+  const auto retaken = cache.take(task, runtime_, context_);
+
+  ASSERT_NE(retaken, created);
+  ASSERT_EQ(&retaken->legion_task(), &task);
+  ASSERT_EQ(cache.size(), 0);
+}
+
+TEST_F(TaskCacheTest, TakeUncached)
+{
+  legate::mapping::detail::TaskCache cache;
+  const auto task = make_task(1);
+
+  const auto taken = cache.take(task, runtime_, context_);
+
+  ASSERT_EQ(&taken->legion_task(), &task);
+  ASSERT_EQ(cache.size(), 0);
+}
+
+TEST_F(TaskCacheTest, SameKeyDifferentTask)
+{
+  legate::mapping::detail::TaskCache cache;
+  const auto task       = make_task(1);
+  const auto other_task = make_task(1);
+
+  const auto created = cache.find_or_create(task, runtime_, context_);
+  const auto other   = cache.find_or_create(other_task, runtime_, context_);
+
+  ASSERT_NE(other, created);
+  ASSERT_EQ(&other->legion_task(), &other_task);
+  ASSERT_EQ(cache.size(), 1);
+
+  // The entry now belongs to the other task, so taking the first one must decode it again
+  const auto taken = cache.take(task, runtime_, context_);
+
+  ASSERT_NE(taken, created);
+  ASSERT_NE(taken, other);
+  ASSERT_EQ(&taken->legion_task(), &task);
+  ASSERT_EQ(cache.size(), 0);
+}
+
+TEST_F(TaskCacheTest, ClearedAtMaxSize)
+{
+  constexpr auto MAX_SIZE = legate::mapping::detail::TaskCache::MAX_SIZE;
+  legate::mapping::detail::TaskCache cache;
+  std::vector<TestTask> tasks;
+
+  tasks.reserve(MAX_SIZE + 1);
+  for (std::size_t idx = 0; idx < MAX_SIZE + 1; ++idx) {
+    tasks.emplace_back(make_task(static_cast<Legion::UniqueID>(idx)));
+  }
+  for (std::size_t idx = 0; idx < MAX_SIZE; ++idx) {
+    static_cast<void>(cache.find_or_create(tasks[idx], runtime_, context_));
+  }
+
+  ASSERT_EQ(cache.size(), MAX_SIZE);
+
+  const auto last = cache.find_or_create(tasks.back(), runtime_, context_);
+
+  ASSERT_EQ(cache.size(), 1);
+  ASSERT_EQ(cache.take(tasks.back(), runtime_, context_), last);
+  ASSERT_EQ(cache.size(), 0);
+}
+
+}  // namespace task_cache_unit
@@ -32,6 +32,7 @@ TEST_F(ParallelPolicyTest, DefaultConstruct)
 
   ASSERT_EQ(pp.streaming_mode(), legate::StreamingMode::OFF);
   ASSERT_EQ(pp.overdecompose_factor(), 1);
+  ASSERT_FALSE(pp.work_stealing());
 
   const auto& cfg = legate::detail::Runtime::get_runtime().config();
 
@@ -46,6 +47,7 @@ TEST_F(ParallelPolicyTest, DefaultGlobalScope)
 
   ASSERT_EQ(pp.streaming_mode(), legate::StreamingMode::OFF);
   ASSERT_EQ(pp.overdecompose_factor(), 1);
+  ASSERT_FALSE(pp.work_stealing());
 
   const auto& cfg = legate::detail::Runtime::get_runtime().config();
 
@@ -109,4 +111,13 @@ TEST_F(ParallelPolicyTest, ODfactor)
   ASSERT_EQ(pp.overdecompose_factor(), OD_FACTOR);
 }
 
+TEST_F(ParallelPolicyTest, WorkStealing)
+{
+  auto pp = legate::ParallelPolicy{}.with_work_stealing(true);
+
+  ASSERT_TRUE(pp.work_stealing());
+  ASSERT_NE(pp, legate::ParallelPolicy{});
+  ASSERT_EQ(pp.with_work_stealing(false), legate::ParallelPolicy{});
+}
+
 }  // namespace parallel_policy_test
@@ -45,4 +45,25 @@ TEST_F(Runtime, IndexSpaceTooManyDims)
       data.size()))));
 }
 
+TEST_F(Runtime, FindLibraryByTaskID)
+{
+  constexpr std::int64_t NUM_TASKS = 10;
+  auto runtime                     = legate::Runtime::get_runtime();
+  auto&& runtime_impl              = legate::detail::Runtime::get_runtime();
+  const auto library               = runtime->find_or_create_library(
+    "test_runtime_find_library", legate::ResourceConfig{NUM_TASKS});
+  const auto find = [&](legate::GlobalTaskID task_id) {
+    const auto found = runtime_impl.find_library(task_id);
+
+    return found.has_value() ? &found->get() : nullptr;
+  };
+
+  ASSERT_EQ(find(library.get_task_id(legate::LocalTaskID{0})), library.impl());
+  ASSERT_EQ(find(library.get_task_id(legate::LocalTaskID{NUM_TASKS - 1})), library.impl());
+
+  const auto& core = runtime_impl.core_library();
+
+  ASSERT_EQ(find(core.get_task_id(legate::LocalTaskID{0})), &core);
+}
+
 }  // namespace test_runtime
@@ -56,6 +56,7 @@ class ScalarUnitTestDeserializer
   ScalarUnitTestDeserializer(const void* args, std::size_t arglen);
 
   using BaseDeserializer::unpack_impl;
+  using BaseDeserializer::unpack_type_;
 };
 
 ScalarUnitTestDeserializer::ScalarUnitTestDeserializer(const void* args, std::size_t arglen)
@@ -177,6 +178,56 @@ TEST_F(PackScalarUnit, PackCopiedScalar)
   check_pack(scalar2);
 }
 
+TEST_F(PackScalarUnit, PackInternedStructScalar)
+{
+  const PaddingStructData struct_data = {BOOL_VALUE, INT32_VALUE, UINT64_VALUE};
+  const legate::Scalar scalar{
+    struct_data,
+    legate::struct_type(/* align */ true, legate::bool_(), legate::int32(), legate::uint64())};
+  legate::detail::BufferBuilder buf;
+
+  // The second copy of the type description is skipped once the first one has been unpacked
+  scalar.impl()->pack(buf);
+  scalar.impl()->pack(buf);
+
+  auto legion_buffer = buf.to_legion_buffer();
+  ScalarUnitTestDeserializer deserializer{legion_buffer.get_ptr(), legion_buffer.get_size()};
+  auto first  = deserializer.unpack_scalar();
+  auto second = deserializer.unpack_scalar();
+
+  ASSERT_EQ(first->type(), second->type());
+  ASSERT_EQ(*static_cast<const PaddingStructData*>(second->data()), struct_data);
+}
+
+TEST_F(PackScalarUnit, UnpackSameUidDifferentType)
+{
+  // Type UIDs are only unique within one process, so another process may send a different type
+  // under a UID already interned here
+  constexpr std::uint32_t UID = 0xFFFFFF00;
+  legate::detail::BufferBuilder buf;
+  const auto pack_fixed_array = [&](std::uint32_t num_elements, legate::Type::Code elem_code) {
+    buf.pack<std::int32_t>(static_cast<std::int32_t>(legate::Type::Code::FIXED_ARRAY));
+    buf.pack<std::uint32_t>(UID);
+    buf.pack<std::uint32_t>(num_elements);
+    buf.pack<std::int32_t>(static_cast<std::int32_t>(elem_code));
+  };
+
+  pack_fixed_array(2, legate::Type::Code::INT32);
+  pack_fixed_array(4, legate::Type::Code::INT64);
+  pack_fixed_array(2, legate::Type::Code::INT32);
+
+  auto legion_buffer = buf.to_legion_buffer();
+  ScalarUnitTestDeserializer deserializer{legion_buffer.get_ptr(), legion_buffer.get_size()};
+  auto first  = deserializer.unpack_type_();
+  auto second = deserializer.unpack_type_();
+  auto third  = deserializer.unpack_type_();
+
+  ASSERT_EQ(first->size(), 2 * sizeof(std::int32_t));
+  ASSERT_EQ(second->size(), 4 * sizeof(std::int64_t));
+  ASSERT_NE(first, second);
+  ASSERT_EQ(first, third);
+}
+
 TEST_P(ScalarDimTest, PackPointScalar)
 {
   const auto DIM = GetParam();
@@ -7,11 +7,15 @@
 #include <legate/data/detail/transform/transform_stack.h>
 
 #include <legate/data/detail/transform/promote.h>
+#include <legate/data/detail/transform/shift.h>
+#include <legate/operation/detail/operation_signature.h>
 #include <legate/utilities/internal_shared_ptr.h>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <memory>
 #include <utilities/utilities.h>
 
 namespace transform_stack_test {
@@ -22,8 +26,37 @@ using TransformStackUnit = DefaultFixture;
 
 using TransformStackUnitDeathTest = TransformStackUnit;
 
+[[nodiscard]] legate::detail::OperationSignature signature_of(
+  const legate::detail::TransformStack& transform)
+{
+  legate::detail::OperationSignature result{};
+
+  transform.add_to_signature(result);
+  return result;
+}
+
 }  // namespace
 
+TEST_F(TransformStackUnit, Signature)
+{
+  const auto identity = legate::make_internal_shared<legate::detail::TransformStack>();
+  const auto promote  = [&](std::int32_t extra_dim) {
+    return legate::detail::TransformStack{std::make_unique<legate::detail::Promote>(extra_dim, 3),
+                                          identity};
+  };
+  const auto shift = [&](std::int32_t dim) {
+    return legate::detail::TransformStack{std::make_unique<legate::detail::Shift>(dim, 3),
+                                          identity};
+  };
+
+  ASSERT_EQ(signature_of(*identity), signature_of(legate::detail::TransformStack{}));
+  ASSERT_EQ(signature_of(promote(1)), signature_of(promote(1)));
+  ASSERT_NE(signature_of(promote(1)), signature_of(promote(0)));
+  // Transforms of different kinds with the same parameters have different signatures
+  ASSERT_NE(signature_of(promote(1)), signature_of(shift(1)));
+  ASSERT_NE(signature_of(promote(1)), signature_of(*identity));
+}
+
 TEST_F(TransformStackUnit, ConvertColor)
 {
   auto transform = legate::make_internal_shared<legate::detail::TransformStack>();